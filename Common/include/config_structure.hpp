@@ -38,6 +38,7 @@
 #include <assert.h>
 
 #include "./option_structure.hpp"
+#include "./profiling_structure.hpp"
 
 using namespace std;
 
@@ -85,6 +86,9 @@ private:
 	Sens_Remove_Sharp,			/*!< \brief Flag for removing or not the sharp edges from the sensitivity computation. */
 	Hold_GridFixed,	/*!< \brief Flag hold fixed some part of the mesh during the deformation. */
 	Axisymmetric, /*!< \brief Flag for axisymmetric calculations */
+	Edge_Batch, /*!< \brief Compute the edges in batches with the batched numerical methods. */
+	Edge_Batch_Check, /*!< \brief Compare the batched residuals with the edge by edge ones. */
+	Single_Precision_Gradient, /*!< \brief Store the gradients and limiters of the primitive variables in single precision. */
 	Show_Adj_Sens, /*!< \brief Flag for outputting sensitivities on exit */
   ionization;  /*!< \brief Flag for determining if free electron gas is in the mixture */
 	bool Visualize_Partition;	/*!< \brief Flag to visualize each partition in the DDM. */
@@ -258,6 +262,8 @@ private:
 	double **ParamDV;				/*!< \brief Parameters of the design variable. */
   string *FFDTag;				/*!< \brief Parameters of the design variable. */
 	unsigned short GeometryMode;			/*!< \brief Gemoetry mode (analysis or gradient computation). */
+  bool GeoJacobian_Analytic;      /*!< \brief Analytic surface Jacobian of the FFD control point and Hicks-Henne design variables. */
+  unsigned short GeoJacobian_FileFormat;     /*!< \brief Format of the geometric Jacobian file. */
 	unsigned short MGCycle;			/*!< \brief Kind of multigrid cycle. */
 	unsigned short FinestMesh;		/*!< \brief Finest mesh for the full multigrid approach. */
 	unsigned short nMG_PreSmooth,                 /*!< \brief Number of MG pre-smooth parameters found in config file. */
@@ -274,6 +280,7 @@ private:
 	*Kind_GridMovement,    /*!< \brief Kind of the unsteady mesh movement. */
 	Kind_Gradient_Method,		/*!< \brief Numerical method for computation of spatial gradients. */
 	Kind_Reconst_Gradient_Method,		/*!< \brief Numerical method for computation of spatial gradients. */
+	Kind_Edge_Loop,		/*!< \brief Separate or fused edge loops for the upwind and viscous residuals. */
 	Kind_Linear_Solver,		/*!< \brief Numerical solver for the implicit scheme. */
 	Kind_Linear_Solver_Prec,		/*!< \brief Preconditioner of the linear solver. */
 	Kind_AdjTurb_Linear_Solver,		/*!< \brief Numerical solver for the turbulent adjoint implicit scheme. */
@@ -351,6 +358,9 @@ private:
 	unsigned long Linear_Solver_Iter;		/*!< \brief Max iterations of the linear solver for the implicit formulation. */
 	unsigned long Linear_Solver_Restart_Frequency;   /*!< \brief Restart frequency of the linear solver for the implicit formulation. */
 	double Linear_Solver_Relax;		/*!< \brief Relaxation coefficient of the linear solver. */
+  bool Newton_Krylov;   /*!< \brief Jacobian-free Newton-Krylov steps for the flow equations. */
+  double Newton_Krylov_Eps;   /*!< \brief Relative finite difference step of the Jacobian-free product. */
+  bool CFL_SER;   /*!< \brief Switched evolution relaxation of the CFL number. */
 	double AdjTurb_Linear_Error;		/*!< \brief Min error of the turbulent adjoint linear solver for the implicit formulation. */
   double EntropyFix_Coeff;              /*!< \brief Entropy fix coefficient. */
 	unsigned short AdjTurb_Linear_Iter;		/*!< \brief Min error of the turbulent adjoint linear solver for the implicit formulation. */
@@ -384,6 +394,11 @@ private:
   unsigned short Deform_Stiffness_Type; /*!< \brief Type of element stiffness imposed for FEA mesh deformation. */
   bool Deform_Output;  /*!< \brief Print the residuals during mesh deformation to the console. */
   double Deform_Tol_Factor; /*!< Factor to multiply smallest volume for deform tolerance (0.001 default) */
+  bool Deform_WarmStart;  /*!< \brief Start the deformation linear solver from the previous displacement field. */
+  unsigned short Deform_Method; /*!< \brief Volume deformation method (FEA or RBF). */
+  double Deform_RBF_Radius,     /*!< \brief Support radius of the RBF deformation. */
+  Deform_RBF_Tolerance;         /*!< \brief Relative interpolation error of the RBF control points selection. */
+  unsigned long Deform_RBF_MaxPoints; /*!< \brief Maximum number of control points of the RBF deformation. */
   double Deform_ElasticityMod, Deform_PoissonRatio; /*!< young's modulus and poisson ratio for volume deformation stiffness model */
   bool Visualize_Deformation;	/*!< \brief Flag to visualize the deformation in MDC. */
 	double Mach;		/*!< \brief Mach number. */
@@ -458,6 +473,7 @@ private:
   *RefOriginMoment_Y,      /*!< \brief Y Origin for moment computation. */
   *RefOriginMoment_Z,      /*!< \brief Z Origin for moment computation. */
   *CFLRamp,      /*!< \brief Information about the CFL ramp. */
+  *CFL_SER_Param,      /*!< \brief Growth factor and limits of the switched evolution relaxation. */
   *CFL,
 	DomainVolume;		/*!< \brief Volume of the computational grid. */
   unsigned short nRefOriginMoment_X,    /*!< \brief Number of X-coordinate moment computation origins. */
@@ -588,6 +604,10 @@ private:
   double ***Omega00,        /*!< \brief Collision integrals (Omega(0,0)) */
   ***Omega11;                  /*!< \brief Collision integrals (Omega(1,1)) */
   bool CuthillMckee_Ordering; /*!< \brief Cuthill–McKee ordering algorithm. */
+  bool Geometry_Cache; /*!< \brief Read/write the preprocessed geometry from/to a binary cache. */
+  string Geometry_Cache_FileName; /*!< \brief Geometry cache file. */
+  bool Profiling; /*!< \brief Time the phases of the solver. */
+  string Profiling_FileName; /*!< \brief Profiling summary file. */
 	bool Mesh_Output; /*!< \brief Flag to specify whether a new mesh should be written in the converted units. */
 	double ElasticyMod,			/*!< \brief Young's modulus of elasticity. */
 	PoissonRatio,						/*!< \brief Poisson's ratio. */
@@ -1871,6 +1891,18 @@ public:
 	 */
 	unsigned short GetGeometryMode(void);
 
+	/*!
+	 * \brief Get whether the surface Jacobian of the FFD control point and Hicks-Henne design variables is computed analytically.
+	 * \return <code>TRUE</code> if the Jacobian is computed from the Bernstein basis and the bump functions; otherwise <code>FALSE</code>.
+	 */
+	bool GetGeoJacobian_Analytic(void);
+
+	/*!
+	 * \brief Get the format of the geometric Jacobian file written by the gradient projection.
+	 * \return Format of the geometric Jacobian file.
+	 */
+	unsigned short GetGeoJacobian_FileFormat(void);
+
 	/*!
 	 * \brief Get the Courant Friedrich Levi number for each grid.
 	 * \param[in] val_mesh - Index of the mesh were the CFL is applied.
@@ -1885,6 +1917,19 @@ public:
 	 */
 	void SetCFL(unsigned short val_mesh, double val_cfl);
 
+  /*!
+	 * \brief Get if the CFL number is adapted with the residual history (switched evolution relaxation).
+	 * \return <code>TRUE</code> if the CFL number is adapted; otherwise <code>FALSE</code>.
+	 */
+	bool GetCFL_SER(void);
+
+  /*!
+	 * \brief Get the parameters of the switched evolution relaxation of the CFL number.
+	 * \param[in] val_index - 0: max growth factor per iteration, 1: min CFL, 2: max CFL.
+	 * \return Value of the parameter.
+	 */
+	double GetCFL_SER_Param(unsigned short val_index);
+
 	/*!
 	 * \brief Get the Courant Friedrich Levi number for each grid, for each species
 	 * \param[in] val_mesh - Index of the mesh were the CFL is applied.
@@ -2503,6 +2548,31 @@ public:
 	 */
 	unsigned short GetKind_Gradient_Method(void);
 	unsigned short GetKind_Reconst_Gradient_Method(void);
+
+	/*!
+	 * \brief Get the kind of edge loop for the upwind convective and viscous residuals.
+	 * \return Separate loops, or a fused loop (see ENUM_EDGE_LOOP).
+	 */
+	unsigned short GetKind_Edge_Loop(void);
+
+	/*!
+	 * \brief Get if the edges are computed in batches of EDGE_BATCH_SIZE by the numerical methods with a batched kernel.
+	 * \return <code>TRUE</code> if the edges are computed in batches; otherwise <code>FALSE</code>.
+	 */
+	bool GetEdge_Batch(void);
+
+	/*!
+	 * \brief Get if the residuals of the batched kernels are compared with the edge by edge numerical methods (debug mode).
+	 * \return <code>TRUE</code> if the residuals are compared; otherwise <code>FALSE</code>.
+	 */
+	bool GetEdge_Batch_Check(void);
+
+	/*!
+	 * \brief Get if the gradients and limiters of the primitive variables are stored in single precision.
+	 * \return <code>TRUE</code> if they are stored in single precision; otherwise <code>FALSE</code>.
+	 */
+	bool GetSingle_Precision_Gradient(void);
+
 	/*!
 	 * \brief Get the kind of solver for the implicit solver.
 	 * \return Numerical solver for implicit formulation (solving the linear system).
@@ -2545,6 +2615,18 @@ public:
 	 */
 	double GetLinear_Solver_Relax(void);
 
+  /*!
+	 * \brief Get if the flow equations are solved with Jacobian-free Newton-Krylov steps.
+	 * \return <code>TRUE</code> if Newton-Krylov steps are used; otherwise <code>FALSE</code>.
+	 */
+	bool GetNewton_Krylov(void);
+
+  /*!
+	 * \brief Get the relative finite difference step of the Jacobian-free matrix-vector product.
+	 * \return Relative finite difference step.
+	 */
+	double GetNewton_Krylov_Eps(void);
+
 	/*!
 	 * \brief Get the kind of solver for the implicit solver.
 	 * \return Numerical solver for implicit formulation (solving the linear system).
@@ -2611,6 +2693,12 @@ public:
 	 */
 	double GetDeform_Tol_Factor(void);
 
+  /*!
+	 * \brief Get information about the initial guess of the grid deformation linear solver.
+	 * \return <code>TRUE</code> means that the previous displacement field is used as initial guess.
+	 */
+	bool GetDeform_WarmStart(void);
+
   /*!
    * \brief Get Young's modulus for deformation (constant stiffness deformation)
    */
@@ -2627,6 +2715,30 @@ public:
 	 * \return type of stiffness to impose for FEA mesh deformation.
 	 */
 	unsigned short GetDeform_Stiffness_Type(void);
+  
+  /*!
+	 * \brief Get the volume deformation method.
+	 * \return Volume deformation method (FEA or RBF).
+	 */
+	unsigned short GetDeform_Method(void);
+  
+  /*!
+	 * \brief Get the support radius of the RBF deformation.
+	 * \return Support radius (0.0 means computed from the size of the moving surfaces).
+	 */
+	double GetDeform_RBF_Radius(void);
+  
+  /*!
+	 * \brief Get the interpolation error of the RBF control points selection.
+	 * \return Interpolation error, relative to the maximum displacement.
+	 */
+	double GetDeform_RBF_Tolerance(void);
+  
+  /*!
+	 * \brief Get the maximum number of control points of the RBF deformation.
+	 * \return Maximum number of control points.
+	 */
+	unsigned long GetDeform_RBF_MaxPoints(void);
 
 	/*!
 	 * \brief Creates a teot file to visualize the deformation made by the MDC software.
@@ -2640,6 +2752,12 @@ public:
 	 */
 	unsigned short GetKind_SU2(void);
 
+	/*!
+	 * \brief Set the kind of SU2 software component.
+	 * \param[in] val_kind_su2 - Kind of the SU2 software component.
+	 */
+	void SetKind_SU2(unsigned short val_kind_su2);
+
 	/*!
 	 * \brief Get the kind of the turbulence model.
 	 * \return Kind of the turbulence model.
@@ -2795,6 +2913,13 @@ public:
 	 */
 	unsigned short GetKind_TimeIntScheme_Flow(void);
 
+  /*!
+	 * \brief Set the kind of integration scheme (explicit or implicit)
+	 *        for the flow equations.
+	 * \param[in] val_kind_timeintscheme - Kind of integration scheme for the flow equations.
+	 */
+	void SetKind_TimeIntScheme_Flow(unsigned short val_kind_timeintscheme);
+
   /*!
 	 * \brief Get the kind of integration scheme (explicit or implicit)
 	 *        for the flow equations.
@@ -3851,6 +3976,13 @@ public:
 	 */
 	double GetDV_Value(unsigned short val_dv);
 
+	/*!
+	 * \brief Set the value of the design variable step, we use this value in design problems.
+	 * \param[in] val_dv - Number of the design variable that we want to set.
+	 * \param[in] val_value - Design variable step.
+	 */
+	void SetDV_Value(unsigned short val_dv, double val_value);
+
 	/*!
 	 * \brief Get information about the grid movement.
 	 * \return <code>TRUE</code> if there is a grid movement; otherwise <code>FALSE</code>.
@@ -4395,6 +4527,30 @@ public:
 	 */
 	bool GetCuthillMckee_Ordering(void);
 
+  /*!
+	 * \brief Get information about the geometry preprocessing cache.
+	 * \return <code>TRUE</code> if the preprocessed geometry is read from/written to a cache; otherwise <code>FALSE</code>.
+	 */
+	bool GetGeometry_Cache(void);
+
+  /*!
+	 * \brief Get the name of the geometry preprocessing cache.
+	 * \return Name of the cache file (without the zone and rank suffixes).
+	 */
+	string GetGeometry_Cache_FileName(void);
+
+	/*!
+	 * \brief Get if the phases of the solver are timed (wall-clock profiling).
+	 * \return <code>TRUE</code> if the profiling is active; otherwise <code>FALSE</code>.
+	 */
+	bool GetProfiling(void);
+
+	/*!
+	 * \brief Get the name of the profiling summary file (JSON).
+	 * \return Name of the profiling summary file.
+	 */
+	string GetProfiling_FileName(void);
+
 	/*!
 	 * \brief Get information about whether a converted mesh should be written.
 	 * \return <code>TRUE</code> if the converted mesh should be written; otherwise <code>FALSE</code>.
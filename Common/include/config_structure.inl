@@ -32,6 +32,8 @@ inline unsigned short CConfig::GetiZone(void) { return iZone; }
 
 inline unsigned short CConfig::GetKind_SU2(void) { return Kind_SU2; }
 
+inline void CConfig::SetKind_SU2(unsigned short val_kind_su2) { Kind_SU2 = val_kind_su2; }
+
 inline bool CConfig::GetAdjoint(void) { return Adjoint; }
 
 inline bool CConfig::GetViscous(void) { return Viscous; }
@@ -353,10 +355,18 @@ inline unsigned short CConfig::GetMGCycle(void) { return MGCycle; }
 
 inline unsigned short CConfig::GetGeometryMode(void) { return GeometryMode; }
 
+inline bool CConfig::GetGeoJacobian_Analytic(void) { return GeoJacobian_Analytic; }
+
+inline unsigned short CConfig::GetGeoJacobian_FileFormat(void) { return GeoJacobian_FileFormat; }
+
 inline double CConfig::GetCFL(unsigned short val_mesh) {	return CFL[val_mesh]; }
 
 inline void CConfig::SetCFL(unsigned short val_mesh, double val_cfl) { CFL[val_mesh] = val_cfl; }
 
+inline bool CConfig::GetCFL_SER(void) { return CFL_SER; }
+
+inline double CConfig::GetCFL_SER_Param(unsigned short val_index) { return CFL_SER_Param[val_index]; }
+
 inline double CConfig::GetUnst_CFL(void) {	return Unst_CFL; }
 
 inline double CConfig::GetParamDV(unsigned short val_dv, unsigned short val_param) {	return ParamDV[val_dv][val_param]; }
@@ -552,6 +562,14 @@ inline unsigned short CConfig::GetKind_Gradient_Method(void) { return Kind_Gradi
 
 inline unsigned short CConfig::GetKind_Reconst_Gradient_Method(void) { return Kind_Reconst_Gradient_Method; }
 
+inline unsigned short CConfig::GetKind_Edge_Loop(void) { return Kind_Edge_Loop; }
+
+inline bool CConfig::GetEdge_Batch(void) { return Edge_Batch; }
+
+inline bool CConfig::GetEdge_Batch_Check(void) { return Edge_Batch_Check; }
+
+inline bool CConfig::GetSingle_Precision_Gradient(void) { return Single_Precision_Gradient; }
+
 inline unsigned short CConfig::GetKind_Linear_Solver(void) { return Kind_Linear_Solver; }
 
 inline unsigned short CConfig::GetKind_Linear_Solver_Prec(void) { return Kind_Linear_Solver_Prec; }
@@ -566,6 +584,10 @@ inline unsigned long CConfig::GetLinear_Solver_Restart_Frequency(void) { return
 
 inline double CConfig::GetLinear_Solver_Relax(void) { return Linear_Solver_Relax; }
 
+inline bool CConfig::GetNewton_Krylov(void) { return Newton_Krylov; }
+
+inline double CConfig::GetNewton_Krylov_Eps(void) { return Newton_Krylov_Eps; }
+
 inline unsigned short CConfig::GetKind_AdjTurb_Linear_Solver(void) { return Kind_AdjTurb_Linear_Solver; }
 
 inline unsigned short CConfig::GetKind_AdjTurb_Linear_Prec(void) { return Kind_AdjTurb_Linear_Prec; }
@@ -588,12 +610,22 @@ inline bool CConfig::GetDeform_Output(void) { return Deform_Output; }
 
 inline double CConfig::GetDeform_Tol_Factor(void) { return Deform_Tol_Factor; }
 
+inline bool CConfig::GetDeform_WarmStart(void) { return Deform_WarmStart; }
+
 inline double CConfig::GetDeform_ElasticityMod(void) { return Deform_ElasticityMod; }
 
 inline double CConfig::GetDeform_PoissonRatio(void) { return Deform_PoissonRatio; }
 
 inline unsigned short CConfig::GetDeform_Stiffness_Type(void) { return Deform_Stiffness_Type; }
 
+inline unsigned short CConfig::GetDeform_Method(void) { return Deform_Method; }
+
+inline double CConfig::GetDeform_RBF_Radius(void) { return Deform_RBF_Radius; }
+
+inline double CConfig::GetDeform_RBF_Tolerance(void) { return Deform_RBF_Tolerance; }
+
+inline unsigned long CConfig::GetDeform_RBF_MaxPoints(void) { return Deform_RBF_MaxPoints; }
+
 inline bool CConfig::GetVisualize_Deformation(void) { return Visualize_Deformation; }
 
 inline unsigned short CConfig::GetKind_Adaptation(void) { return Kind_Adaptation; }
@@ -624,6 +656,8 @@ inline unsigned short CConfig::GetSpatialOrder_AdjTNE2(void) { return SpatialOrd
 
 inline unsigned short CConfig::GetKind_TimeIntScheme_Flow(void) { return Kind_TimeIntScheme_Flow; }
 
+inline void CConfig::SetKind_TimeIntScheme_Flow(unsigned short val_kind_timeintscheme) { Kind_TimeIntScheme_Flow = val_kind_timeintscheme; }
+
 inline unsigned short CConfig::GetKind_TimeIntScheme_TNE2(void) { return Kind_TimeIntScheme_TNE2; }
 
 inline unsigned short CConfig::GetKind_TimeIntScheme_Wave(void) { return Kind_TimeIntScheme_Wave; }
@@ -944,6 +978,8 @@ inline bool CConfig::GetEngine_Intake(void) { return Engine_Intake; }
 
 inline double CConfig::GetDV_Value(unsigned short val_dv) { return DV_Value[val_dv]; }
 
+inline void CConfig::SetDV_Value(unsigned short val_dv, double val_value) { DV_Value[val_dv] = val_value; }
+
 inline double CConfig::GetOrderMagResidual(void) { return OrderMagResidual; }
 
 inline double CConfig::GetMinLogResidual(void) { return MinLogResidual; }
@@ -1004,6 +1040,14 @@ inline bool CConfig::GetCGNS_To_SU2(void) {return CGNS_To_SU2; }
 
 inline bool CConfig::GetCuthillMckee_Ordering(void) { return CuthillMckee_Ordering; }
 
+inline bool CConfig::GetGeometry_Cache(void) { return Geometry_Cache; }
+
+inline string CConfig::GetGeometry_Cache_FileName(void) { return Geometry_Cache_FileName; }
+
+inline bool CConfig::GetProfiling(void) { return Profiling; }
+
+inline string CConfig::GetProfiling_FileName(void) { return Profiling_FileName; }
+
 inline bool CConfig::GetMesh_Output(void) { return Mesh_Output; }
 
 inline unsigned short CConfig::GetnPeriodicIndex(void) { return nPeriodic_Index; }
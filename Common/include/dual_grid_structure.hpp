@@ -335,6 +335,13 @@ public:
 	 * \param[in] val_point - Point to be added.		 
 	 */
 	void SetPoint(unsigned long val_point);
+
+	/*!
+	 * \brief Set all the points that compose the control volume at once (the list must not have repeated points).
+	 * \param[in] val_point - Pointer to the first point of the list.
+	 * \param[in] val_nPoint - Number of points in the list.
+	 */
+	void SetPoint(unsigned long *val_point, unsigned short val_nPoint);
 	
 	/*! 
 	 * \brief Set the edges that compose the control volume.
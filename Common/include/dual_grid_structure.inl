@@ -24,12 +24,18 @@
 
 inline void CPoint::SetElem(unsigned long val_elem) { Elem.push_back(val_elem); nElem = Elem.size(); }
 
-inline void CPoint::ResetBoundary(void) { if (vertex != NULL) delete [] vertex; Boundary = false; }
+inline void CPoint::ResetBoundary(void) { if (vertex != NULL) delete [] vertex; vertex = NULL; Boundary = false; }
 
 inline void CPoint::ResetElem(void) { Elem.clear(); nElem = 0; }
 
 inline void CPoint::ResetPoint(void) { Point.clear(); Edge.clear(); nPoint = 0; }
 
+inline void CPoint::SetPoint(unsigned long *val_point, unsigned short val_nPoint) {
+  Point.assign(val_point, val_point+val_nPoint);
+  Edge.assign(val_nPoint, -1);
+  nPoint = val_nPoint;
+}
+
 inline double CPoint::GetCoord(unsigned short val_dim) { return coord[val_dim]; }
 
 inline double *CPoint::GetCoord(void) { return coord; }
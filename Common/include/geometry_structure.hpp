@@ -47,6 +47,48 @@
 
 using namespace std;
 
+/*! 
+ * \class CAirfoilSlicing
+ * \brief Surface segments cut by a set of parallel section planes, and the order of the cut points 
+ *        in each airfoil, used to update the sections of a deformed surface without slicing it again.
+ * \version 3.2.3 "eagle"
+ */
+class CAirfoilSlicing {
+public:
+  unsigned short nSection;          /*!< \brief Number of section planes. */
+  double Normal[3];                 /*!< \brief Common normal of the section planes. */
+  double *Offset;                   /*!< \brief Position of each plane along the normal. */
+  vector<unsigned long> *Segment;   /*!< \brief Pairs of points of the (local) segments cut by each plane. */
+  vector<unsigned long> *Order;     /*!< \brief Gathered cut point of each ordered airfoil point (master node). */
+  
+  /*!
+	 * \brief Constructor of the class.
+	 * \param[in] val_nSection - Number of section planes.
+	 * \param[in] Plane_P0 - Point of each plane.
+	 * \param[in] Plane_Normal - Normal of each plane.
+	 */
+  CAirfoilSlicing(unsigned short val_nSection, double **Plane_P0, double **Plane_Normal);
+  
+  /*!
+	 * \brief Destructor of the class.
+	 */
+  ~CAirfoilSlicing(void);
+  
+  /*!
+	 * \brief Check if the slicing was built for this set of planes.
+	 * \param[in] val_nSection - Number of section planes.
+	 * \param[in] Plane_P0 - Point of each plane.
+	 * \param[in] Plane_Normal - Normal of each plane.
+	 * \return <code>TRUE</code> if the planes are the same; otherwise <code>FALSE</code>.
+	 */
+  bool Match(unsigned short val_nSection, double **Plane_P0, double **Plane_Normal);
+  
+  /*!
+	 * \brief Remove the stored segments and orderings.
+	 */
+  void Reset(void);
+};
+
 /*! 
  * \class CGeometry
  * \brief Parent class for defining the geometry of the problem (complete geometry, 
@@ -90,6 +132,14 @@ protected:
 	nMarker;				/*!< \brief Number of different markers of the mesh. */
 	bool FinestMGLevel; /*!< \brief Indicates whether the geometry class contains the finest (original) multigrid mesh. */
   unsigned long Max_GlobalPoint;  /*!< \brief Greater global point in the domain local structure. */
+  vector<unsigned long> Edge_Map_Ptr,  /*!< \brief Position of the first neighbor of each point in the CSR edge map. */
+  Edge_Map_Point;  /*!< \brief Neighbors of each point, sorted, in the CSR edge map. */
+  vector<long> Edge_Map_Edge;  /*!< \brief Edge between each point and each of its neighbors in the CSR edge map. */
+  vector<unsigned long> Linelet_Ptr,  /*!< \brief Position of the first point of each linelet (CSR). */
+  Linelet_Point;  /*!< \brief Points of the linelets, starting from the wall. */
+  unsigned long Linelet_MeanPoints;  /*!< \brief Average number of points in each linelet (all the domains). */
+  vector<unsigned long> File_to_Local_Point,  /*!< \brief Local index of each point of the grid file (empty if the points were not renumbered). */
+  Local_to_File_Point;  /*!< \brief Index in the grid file of each local point (empty if the points were not renumbered). */
 
 public:
 	unsigned long *nElem_Bound;			/*!< \brief Number of elements of the boundary. */
@@ -120,6 +170,7 @@ public:
 	vector<vector<unsigned long> > Plane_points; /*!< \brief Vector containing points appearing on a single plane */
 
 	vector<double> XCoordList;	/*!< \brief Vector containing points appearing on a single plane */
+  vector<CAirfoilSlicing*> AirfoilSlicing;   /*!< \brief Stored slicings of the surface (batched airfoil sections). */
 	CPrimalGrid*** newBound;            /*!< \brief Boundary vector for new periodic elements (primal grid information). */
 	unsigned long *nNewElem_Bound;			/*!< \brief Number of new periodic elements of the boundary. */
 
@@ -203,6 +254,59 @@ public:
 	 * \return Index of the edge.
 	 */
 	bool CheckEdge(unsigned long first_point, unsigned long second_point);
+
+	/*!
+	 * \brief Build the CSR edge map (sorted neighbors and edge index of each point) used by FindEdge
+   *        and CheckEdge, from the points and edges stored in the nodes.
+	 */
+	void SetEdge_Map(void);
+
+	/*!
+	 * \brief Build the linelets (lines of strongly coupled points that start at the walls) of the grid,
+	 *        only the first time it is called.
+	 * \param[in] config - Definition of the particular problem.
+	 */
+	void SetLinelets(CConfig *config);
+
+	/*!
+	 * \brief Get the number of linelets of the grid.
+	 * \return Number of linelets.
+	 */
+	unsigned long GetnLinelet(void);
+
+	/*!
+	 * \brief Get the position of the first point of a linelet in the list of linelet points.
+	 * \param[in] val_linelet - Linelet (nLinelet gives the end of the list).
+	 * \return Position of the first point.
+	 */
+	unsigned long GetLinelet_Ptr(unsigned long val_linelet);
+
+	/*!
+	 * \brief Get a point of the list of linelet points.
+	 * \param[in] val_index - Position in the list.
+	 * \return Index of the point.
+	 */
+	unsigned long GetLinelet_Point(unsigned long val_index);
+
+	/*!
+	 * \brief Get the average number of points in each linelet.
+	 * \return Average number of points (all the domains).
+	 */
+	unsigned long GetLinelet_MeanPoints(void);
+
+	/*!
+	 * \brief Get the local index of a point of the grid file (they differ after a renumbering).
+	 * \param[in] val_ipoint - Index of the point in the grid file.
+	 * \return Local index of the point.
+	 */
+	unsigned long GetFile_to_Local_Point(unsigned long val_ipoint);
+
+	/*!
+	 * \brief Get the index in the grid file of a local point (they differ after a renumbering).
+	 * \param[in] val_ipoint - Local index of the point.
+	 * \return Index of the point in the grid file.
+	 */
+	unsigned long GetLocal_to_File_Point(unsigned long val_ipoint);
     
 	/*! 
 	 * \brief Get the distance between a plane (defined by three point) and a point.
@@ -468,6 +572,13 @@ public:
 	 */	
 	virtual void SetCoord(CGeometry *geometry);
 
+	/*!
+	 * \brief A virtual member.
+	 * \param[in] cache_file - Binary cache file.
+	 * \param[in] fine_grid - Geometrical definition of the problem.
+	 */
+	virtual void WriteCache_Agglomeration(ofstream &cache_file, CGeometry *fine_grid);
+
 	/*! 
 	 * \brief A virtual member.
 	 * \param[in] val_nSmooth - Number of smoothing iterations.
@@ -571,6 +682,13 @@ public:
 	 */
 	virtual void SetRestricted_GridVelocity(CGeometry *fine_mesh, CConfig *config);
 
+  /*!
+	 * \brief Rotate the normals of the edges and boundary vertices after a rigid rotation of the grid.
+   *        The control volumes of a rigid motion do not change and are not recomputed.
+	 * \param[in] rotMatrix - Rotation matrix of the rigid motion.
+	 */
+  void SetRotation_Normal(double rotMatrix[3][3]);
+
 	/*!
 	 * \brief Find and store all vertices on a sharp corner in the geometry.
 	 * \param[in] config - Definition of the particular problem.
@@ -587,6 +705,47 @@ public:
                                       vector<double> &Zcoord_Airfoil, vector<double> &Variable_Airfoil,
                                       bool original_surface, CConfig *config);
   
+  /*!
+	 * \brief Compute all the airfoil sections of a set of parallel planes in a single pass over the 
+	 *        surface (the segments are binned by their position along the normal) and a single gather to 
+	 *        the master node. The slicing of the original surface is stored, and the sections of a deformed 
+	 *        surface are updated by intersecting the same (displaced) segments, with the same ordering.
+	 * \param[in] nSection - Number of section planes.
+	 * \param[in] Plane_P0 - Point of each plane.
+	 * \param[in] Plane_Normal - Normal of each plane (non parallel planes are sliced one by one).
+	 * \param[in] MinXCoord - Minimum x coordinate of the points of the segments.
+	 * \param[in] MaxXCoord - Maximum x coordinate of the points of the segments.
+	 * \param[in] FlowVariable - Variable to be interpolated at the sections (or NULL).
+	 * \param[out] Xcoord_Airfoil - x coordinates of each section.
+	 * \param[out] Ycoord_Airfoil - y coordinates of each section.
+	 * \param[out] Zcoord_Airfoil - z coordinates of each section.
+	 * \param[out] Variable_Airfoil - Interpolated variable of each section.
+	 * \param[in] original_surface - Slice the original surface, or the surface displaced by the vertex VarCoord.
+	 * \param[in] config - Definition of the particular problem.
+	 */
+	void ComputeAirfoil_Sections(unsigned short nSection, double **Plane_P0, double **Plane_Normal,
+                               double MinXCoord, double MaxXCoord, double *FlowVariable,
+                               vector<double> *Xcoord_Airfoil, vector<double> *Ycoord_Airfoil,
+                               vector<double> *Zcoord_Airfoil, vector<double> *Variable_Airfoil,
+                               bool original_surface, CConfig *config);
+  
+  /*!
+	 * \brief Remove the duplicated cut points of a section and order them as an airfoil, starting 
+	 *        from the trailing edge (the input vectors are emptied).
+	 * \param[in] Xcoord - x coordinates of the cut points.
+	 * \param[in] Ycoord - y coordinates of the cut points.
+	 * \param[in] Zcoord - z coordinates of the cut points.
+	 * \param[in] Variable - Interpolated variable at the cut points.
+	 * \param[out] Xcoord_Airfoil - x coordinates of the airfoil.
+	 * \param[out] Ycoord_Airfoil - y coordinates of the airfoil.
+	 * \param[out] Zcoord_Airfoil - z coordinates of the airfoil.
+	 * \param[out] Variable_Airfoil - Interpolated variable of the airfoil.
+	 * \param[out] Order - Index of the cut point of each airfoil point.
+	 */
+  void SortAirfoil_Section(vector<double> &Xcoord, vector<double> &Ycoord, vector<double> &Zcoord, vector<double> &Variable,
+                           vector<double> &Xcoord_Airfoil, vector<double> &Ycoord_Airfoil, vector<double> &Zcoord_Airfoil,
+                           vector<double> &Variable_Airfoil, vector<unsigned long> &Order);
+  
   /*!
 	 * \brief A virtual member.
 	 * \param[in] config - Definition of the particular problem.
@@ -813,6 +972,48 @@ public:
   unsigned short ComputeSegmentPlane_Intersection(double *Segment_P0, double *Segment_P1, double Variable_P0, double Variable_P1,
                                                   double *Plane_P0, double *Plane_Normal, double *Intersection, double &Variable_Interp);
 
+  /*!
+	 * \brief Compute a hash (64-bit FNV-1a) of the primal grid of this rank and of the options that
+   *        define the preprocessing, used to validate the geometry cache.
+	 * \param[in] config - Definition of the particular problem.
+	 * \returns Hash of the grid.
+	 */
+  unsigned long GetGeometry_Hash(CConfig *config);
+
+  /*!
+	 * \brief Write the header of the geometry cache.
+	 * \param[in] cache_file - Binary cache file.
+	 * \param[in] config - Definition of the particular problem.
+	 * \param[in] val_hash - Hash of the grid.
+	 * \param[in] val_nMGLevels - Number of coarse levels stored in the cache.
+	 */
+  void WriteCache_Header(ofstream &cache_file, CConfig *config, unsigned long val_hash, unsigned short val_nMGLevels);
+
+  /*!
+	 * \brief Read and validate the header of the geometry cache.
+	 * \param[in] cache_file - Binary cache file.
+	 * \param[in] config - Definition of the particular problem.
+	 * \param[in] val_hash - Hash of the current grid.
+	 * \param[out] val_nMGLevels - Number of coarse levels stored in the cache.
+	 * \returns <code>TRUE</code> if the cache belongs to the current grid and version; otherwise <code>FALSE</code>.
+	 */
+  bool ReadCache_Header(ifstream &cache_file, CConfig *config, unsigned long val_hash, unsigned short &val_nMGLevels);
+
+  /*!
+	 * \brief Write the edges, the control volumes and the boundary normals of this level to the geometry cache.
+	 * \param[in] cache_file - Binary cache file.
+	 */
+  void WriteCache_DualGrid(ofstream &cache_file);
+
+  /*!
+	 * \brief Read the edges, the control volumes and the boundary normals of this level from the geometry cache,
+   *        replacing SetEdges, SetControlVolume, SetBoundControlVolume and FindNormal_Neighbor. The point
+   *        connectivity and the vertices must be already set.
+	 * \param[in] cache_file - Binary cache file.
+	 * \returns <code>TRUE</code> if the data is consistent with the grid; otherwise <code>FALSE</code> (nothing is modified).
+	 */
+  bool ReadCache_DualGrid(ifstream &cache_file);
+
 };
 
 /*!
@@ -1305,6 +1506,16 @@ public:
 	 */	
 	CMultiGridGeometry(CGeometry ***geometry, CConfig **config_container, unsigned short iMesh, unsigned short iZone);
 
+	/*!
+	 * \brief Constructor of the class, the agglomeration is read from the geometry cache.
+	 * \param[in] geometry - Geometrical definition of the problem.
+	 * \param[in] config - Definition of the particular problem.
+	 * \param[in] iMesh - Level of the multigrid.
+	 * \param[in] iZone - Current zone in the mesh.
+	 * \param[in] cache_file - Binary cache file.
+	 */
+	CMultiGridGeometry(CGeometry ***geometry, CConfig **config_container, unsigned short iMesh, unsigned short iZone, ifstream &cache_file);
+
 	/*! 
 	 * \brief Destructor of the class.
 	 */
@@ -1320,6 +1531,21 @@ public:
 	 */	
 	bool SetBoundAgglomeration(unsigned long CVPoint, short marker_seed, CGeometry *fine_grid, CConfig *config);
 
+	/*!
+	 * \brief Set the CFL of the level and check the agglomeration rate (the level is discarded if it is too low).
+	 * \param[in] fine_grid - Geometrical definition of the problem.
+	 * \param[in] config - Definition of the particular problem.
+	 * \param[in] iMesh - Level of the multigrid.
+	 */
+	void SetAgglomeration_Rate(CGeometry *fine_grid, CConfig *config, unsigned short iMesh);
+
+	/*!
+	 * \brief Write the agglomeration of this level to the geometry cache.
+	 * \param[in] cache_file - Binary cache file.
+	 * \param[in] fine_grid - Geometrical definition of the problem.
+	 */
+	void WriteCache_Agglomeration(ofstream &cache_file, CGeometry *fine_grid);
+
 	/*! 
 	 * \brief Determine if a can be agglomerated using geometrical criteria.
 	 * \param[in] iPoint - Seed point.
@@ -1608,12 +1834,35 @@ public:
  * \author F. Palacios.
  * \version 3.2.3 "eagle"
  * \date Aug 12, 2012
+ *
+ * The control volumes of each priority are stored in a doubly linked list (in order of
+ * insertion), so that a control volume is removed or moved to a different priority in
+ * constant time, and the next seed is the first control volume of the highest priority.
  */
 class CMultiGridQueue {
-	vector<vector<unsigned long> > QueueCV; /*!< \brief Queue structure to choose the next control volume in the agglomeration process. */
+	vector<long> Head_QueueCV; /*!< \brief First control volume of the list of each priority (-1 if empty). */
+	vector<long> Tail_QueueCV; /*!< \brief Last control volume of the list of each priority (-1 if empty). */
+	long *Next_QueueCV;	/*!< \brief Next control volume in the list of the same priority (-1 at the end). */
+	long *Prev_QueueCV;	/*!< \brief Previous control volume in the list of the same priority (-1 at the beginning). */
 	short *Priority;	/*!< \brief The priority is based on the number of pre-agglomerated neighbors. */
 	bool *RightCV;	/*!< \brief In the lowest priority there are some CV that can not be agglomerated, this is the way to identify them */  
 	unsigned long nPoint; /*!< \brief Total number of points. */  
+	unsigned long nQueueCV; /*!< \brief Number of control volumes in the queue. */
+	unsigned long nRightCV_Zero; /*!< \brief Number of control volumes of the lowest priority that can be agglomerated. */
+	short MaxPriority; /*!< \brief Highest priority with control volumes in the queue (0 if the queue is empty). */
+
+	/*! 
+	 * \brief Append a CV at the end of the list of a priority.
+	 * \param[in] val_point - Index of the control volume.
+	 * \param[in] val_priority - Priority of the control volume.
+	 */
+	void LinkCV(unsigned long val_point, short val_priority);
+
+	/*! 
+	 * \brief Take a CV out of the list of its priority (the order of the others is kept).
+	 * \param[in] val_point - Index of the control volume.
+	 */
+	void UnlinkCV(unsigned long val_point);
 
 public:
 
@@ -96,6 +96,8 @@ inline void CGeometry::SetCoord_Smoothing (unsigned short val_nSmooth, double va
 
 inline void CGeometry::SetCoord(CGeometry *geometry) { }
 
+inline void CGeometry::WriteCache_Agglomeration(ofstream &cache_file, CGeometry *fine_grid) { }
+
 inline void CGeometry::SetPoint_Connectivity(CGeometry *fine_grid) { }
 
 inline void CGeometry::SetElement_Connectivity(void) { }
@@ -104,6 +106,18 @@ inline unsigned long CGeometry::GetnPoint(void) { return nPoint; }
 
 inline unsigned long CGeometry::GetnPointDomain(void) { return nPointDomain; }
 
+inline unsigned long CGeometry::GetnLinelet(void) { return (Linelet_Ptr.empty() ? 0 : Linelet_Ptr.size()-1); }
+
+inline unsigned long CGeometry::GetLinelet_Ptr(unsigned long val_linelet) { return Linelet_Ptr[val_linelet]; }
+
+inline unsigned long CGeometry::GetLinelet_Point(unsigned long val_index) { return Linelet_Point[val_index]; }
+
+inline unsigned long CGeometry::GetLinelet_MeanPoints(void) { return Linelet_MeanPoints; }
+
+inline unsigned long CGeometry::GetFile_to_Local_Point(unsigned long val_ipoint) { return (File_to_Local_Point.empty() ? val_ipoint : File_to_Local_Point[val_ipoint]); }
+
+inline unsigned long CGeometry::GetLocal_to_File_Point(unsigned long val_ipoint) { return (Local_to_File_Point.empty() ? val_ipoint : Local_to_File_Point[val_ipoint]); }
+
 inline unsigned long CGeometry::GetnElem(void) { return nElem; }
 
 inline unsigned short CGeometry::GetnDim(void) { return nDim; }
@@ -60,7 +60,7 @@ public:
 	/*! 
 	 * \brief Destructor of the class. 
 	 */
-	~CGridMovement(void);
+	virtual ~CGridMovement(void);
   
   
   /*!
@@ -111,6 +111,8 @@ public:
 	unsigned long nSurfacePoint;				/*!< \brief Number of surfaces in the FFD FFDBox. */
 	vector<string> ParentFFDBox;					/*!< \brief Vector with all the parent FFD FFDBox. */
 	vector<string> ChildFFDBox;					/*!< \brief Vector with all the child FFD FFDBox. */
+	vector<double> SurfaceBasis;				/*!< \brief Cached 1D Bernstein basis (u, v and w) of every surface point. */
+	vector<double> BasisScratch;				/*!< \brief Work array for the Bernstein basis of a single point. */
 	
 public:
 	
@@ -448,6 +450,64 @@ public:
 	 */		
 	double *EvalCartesianCoord(double *ParamCoord);
 	
+	/*! 
+	 * \brief Tensor-product evaluation of the Bezier parameterization, X = Sum_ijk P_ijk Bu_i Bv_j Bw_k, 
+	 *        from the 1D Bernstein basis of each parametric direction.
+	 * \param[in] val_ubasis - Bernstein basis B_i^l(u), i = 0..l.
+	 * \param[in] val_vbasis - Bernstein basis B_j^m(v), j = 0..m.
+	 * \param[in] val_wbasis - Bernstein basis B_k^n(w), k = 0..n.
+	 * \return Pointer to the cartesian coordinates of a point.
+	 */		
+	double *EvalCartesianCoord(double *val_ubasis, double *val_vbasis, double *val_wbasis);
+	
+	/*! 
+	 * \brief Evaluate the cartesian coordinates of a surface point of the box using its cached Bernstein 
+	 *        basis (the parametric coordinates do not change during the deformation).
+	 * \param[in] val_iSurfacePoints - Index of the surface point.
+	 * \return Pointer to the cartesian coordinates of a point.
+	 */		
+	double *EvalSurfaceCartesianCoord(unsigned long val_iSurfacePoints);
+	
+	/*! 
+	 * \brief Get the cached Bernstein basis of a surface point, stored as the l+1 values in u, 
+	 *        followed by the m+1 values in v and the n+1 values in w.
+	 * \param[in] val_iSurfacePoints - Index of the surface point.
+	 * \return Pointer to the basis of the surface point.
+	 */		
+	double *GetSurfaceBasis(unsigned long val_iSurfacePoints);
+	
+	/*! 
+	 * \brief Compute (or recompute) the cached Bernstein basis of all the surface points.
+	 */		
+	void SetSurfaceBasis(void);
+	
+	/*! 
+	 * \brief Evaluate the Bezier parameterization and its first and second parametric derivatives.
+	 * \param[in] uvw - Parametric coordinates of the point.
+	 * \param[out] val_X - Cartesian coordinates X(u,v,w).
+	 * \param[out] val_dX - First derivatives, val_dX[iDim][jDim] = dX_iDim/du_jDim.
+	 * \param[out] val_d2X - Second derivatives, val_d2X[iDim][jDim][kDim] = d2X_iDim/du_jDim du_kDim.
+	 */		
+	void EvalCartesianDerivatives(double *uvw, double *val_X, double val_dX[3][3], double val_d2X[3][3][3]);
+	
+	/*! 
+	 * \brief Compute all the Bernstein polynomials B_i^n(t), i = 0..n, with the triangular recurrence 
+	 *        B_i^n = (1-t) B_i^(n-1) + t B_(i-1)^(n-1) (no binomial coefficients nor pow calls).
+	 * \param[in] val_n - Degree of the Bernstein polynomials.
+	 * \param[in] val_t - Value of the parameter where the polynomials are evaluated.
+	 * \param[out] val_basis - Values of the n+1 polynomials.
+	 */		
+	void GetBernsteinBasis(short val_n, double val_t, double *val_basis);
+	
+	/*! 
+	 * \brief Compute the "order" derivative of all the Bernstein polynomials B_i^n(t), i = 0..n.
+	 * \param[in] val_n - Degree of the Bernstein polynomials.
+	 * \param[in] val_t - Value of the parameter where the polynomials are evaluated.
+	 * \param[in] val_order - Order of the derivative.
+	 * \param[out] val_basis - Values of the n+1 derivatives.
+	 */		
+	void GetBernsteinBasisDerivative(short val_n, double val_t, short val_order, double *val_basis);
+	
 	/*! 
 	 * \brief Set the Bernstein polynomial, defined as B_i^n(t) = Binomial(n,i)*t^i*(1-t)^(n-i).
 	 * \param[in] val_n - Degree of the Bernstein polynomial.
@@ -695,6 +755,25 @@ protected:
   CSysMatrix StiffMatrix; /*!< \brief Matrix to store the point-to-point stiffness. */
   CSysVector LinSysSol;
   CSysVector LinSysRes;
+  
+  bool StiffMatrix_Built;                      /*!< \brief The matrix structure, element maps and linear solver are allocated. */
+  double **StiffMatrix_Elem;                   /*!< \brief Element stiffness matrix (largest element). */
+  double **StiffMatrix_Node;                   /*!< \brief Point-to-point block of the element stiffness matrix. */
+  unsigned long *Elem_Block_Ptr;               /*!< \brief First entry of each element in Elem_Block. */
+  unsigned long *Elem_Block;                   /*!< \brief Position in the sparse matrix of the (iNode, jNode) blocks of each element. */
+  CMatrixVectorProduct *StiffMatrix_MatVec;    /*!< \brief Matrix vector product of the stiffness matrix. */
+  CPreconditioner *StiffMatrix_Precond;        /*!< \brief Preconditioner of the stiffness matrix. */
+  CSysSolve *StiffMatrix_Solver;               /*!< \brief Krylov linear solver of the deformation. */
+  
+  double RBF_Radius;                           /*!< \brief Support radius of the RBF kernel. */
+  vector<double> RBF_Coord;                    /*!< \brief Coordinates of the RBF control points. */
+  vector<double> RBF_Coeff;                    /*!< \brief Interpolation coefficients of the RBF control points (nDim per point). */
+  double RBF_Bin_Min[3], RBF_Bin_Size[3];      /*!< \brief Origin and size of the bins of the RBF control points. */
+  long RBF_nBin[3];                            /*!< \brief Number of bins in each direction. */
+  vector<unsigned long> RBF_Bin_Ptr,           /*!< \brief First control point of each bin. */
+  RBF_Bin_Point;                               /*!< \brief Control points sorted by bin. */
+  
+  double Rigid_RotMatrix[3][3];                /*!< \brief Rotation of the rigid motion since the last update of the multigrid levels. */
 
 public:
 
@@ -729,6 +808,21 @@ public:
 	 */
 	void UpdateMultiGrid(CGeometry **geometry, CConfig *config);
   
+  /*!
+	 * \brief Update the coarse multigrid levels after a rigid grid motion: the normals are rotated,
+   *        the control volumes are not recomputed.
+	 * \param[in] geometry - Geometrical definition of the problem.
+	 * \param[in] config - Definition of the particular problem.
+	 */
+	void UpdateRigidMultiGrid(CGeometry **geometry, CConfig *config);
+  
+  /*!
+	 * \brief Update the dual grid of the fine mesh after a rigid rotation of the nodes.
+	 * \param[in] geometry - Geometrical definition of the problem.
+	 * \param[in] rotMatrix - Rotation matrix of the rigid motion.
+	 */
+	void UpdateRigidDualGrid(CGeometry *geometry, double rotMatrix[3][3]);
+  
   /*!
 	 * \brief Compute the stiffness matrix for grid deformation using spring analogy.
 	 * \param[in] geometry - Geometrical definition of the problem.
@@ -736,6 +830,14 @@ public:
 	 */
 	double SetFEAMethodContributions_Elem(CGeometry *geometry, CConfig *config);
   
+  /*!
+	 * \brief Build (only once) the sparse structure of the stiffness matrix, the position of the blocks of
+	 *        each element in the matrix, the element work arrays, and the linear solver structures.
+	 * \param[in] geometry - Geometrical definition of the problem.
+	 * \param[in] config - Definition of the particular problem.
+	 */
+	void SetStiffMatrix_Structure(CGeometry *geometry, CConfig *config);
+  
   /*!
 	 * \brief Build the stiffness matrix for a 3-D hexahedron element. The result will be placed in StiffMatrix_Elem.
 	 * \param[in] geometry - Geometrical definition of the problem.
@@ -852,12 +954,10 @@ public:
 	 * \brief Add the stiffness matrix for a 2-D triangular element to the global stiffness matrix for the entire mesh (node-based).
 	 * \param[in] geometry - Geometrical definition of the problem.
    * \param[in] StiffMatrix_Elem - Element stiffness matrix to be filled.
-	 * \param[in] val_Point_0 - Index value for Node 0 of the current tetrahedron.
-   * \param[in] val_Point_1 - Index value for Node 1 of the current tetrahedron.
-   * \param[in] val_Point_2 - Index value for Node 2 of the current tetrahedron.
-   * \param[in] val_Point_3 - Index value for Node 3 of the current tetrahedron.
+	 * \param[in] iElem - Index of the element (position of its blocks in the matrix).
+   * \param[in] nNodes - Number of nodes of the element.
 	 */
-  void AddFEA_StiffMatrix(CGeometry *geometry, double **StiffMatrix_Elem, unsigned long PointCorners[8], unsigned short nNodes);
+  void AddFEA_StiffMatrix(CGeometry *geometry, double **StiffMatrix_Elem, unsigned long iElem, unsigned short nNodes);
   
   /*!
 	 * \brief Check for negative volumes (all elements) after performing grid deformation.
@@ -930,6 +1030,36 @@ public:
 	 */
 	void SetVolume_Deformation(CGeometry *geometry, CConfig *config, bool UpdateGeo);
   
+  /*!
+	 * \brief Grid deformation by radial basis function interpolation of the boundary displacements. The
+	 *        control points are selected greedily among the boundary points (until the interpolation error
+	 *        of the remaining ones is below the tolerance), and the compactly supported interpolant is
+	 *        evaluated at the volume points using bins of the control points.
+	 * \param[in] geometry - Geometrical definition of the problem.
+	 * \param[in] config - Definition of the particular problem.
+	 * \param[in] UpdateGeo - Update geometry.
+	 */
+	void SetRBF_Deformation(CGeometry *geometry, CConfig *config, bool UpdateGeo);
+  
+  /*!
+	 * \brief Sort the RBF control points in bins (of size larger than the support radius).
+	 */
+	void SetRBF_Bins(void);
+  
+  /*!
+	 * \brief Evaluate the RBF interpolation of the displacements.
+	 * \param[in] Coord - Coordinates of the point.
+	 * \param[out] Disp - Interpolated displacement.
+	 */
+	void GetRBF_Displacement(double *Coord, double *Disp);
+  
+  /*!
+	 * \brief Compactly supported RBF kernel (Wendland C2).
+	 * \param[in] Dist - Distance between the points.
+	 * \return Value of the kernel.
+	 */
+	double GetRBF_Kernel(double Dist);
+  
   /*!
 	 * \brief Compute the determinant of a 3 by 3 matrix.
 	 * \param[in] val_matrix 3 by 3 matrix.
@@ -973,6 +1103,28 @@ public:
 	 */
 	void SetHicksHenne(CGeometry *boundary, CConfig *config, unsigned short iDV, bool ResetDef);
   
+	/*! 
+	 * \brief Angle of attack of the airfoil (DV markers) that is undone before the Hicks-Henne bumps are applied.
+	 * \param[in] boundary - Geometry of the boundary.
+	 * \param[in] config - Definition of the particular problem.
+	 * \return Angle (degrees) of the chord from the leading to the trailing edge.
+	 */
+	double GetAirfoil_AoA(CGeometry *boundary, CConfig *config);
+  
+	/*! 
+	 * \brief Analytic derivative of the displacement of a surface vertex with respect to a Hicks-Henne
+	 *        design variable. The bump is linear in the DV value, so dX/dDV is the bump of unit amplitude.
+	 * \param[in] config - Definition of the particular problem.
+	 * \param[in] iDV - Index of the design variable.
+	 * \param[in] val_AoA - Angle of attack of the airfoil (see GetAirfoil_AoA).
+	 * \param[in] val_Coord - Coordinates of the vertex.
+	 * \param[in] val_Normal - Normal of the vertex (it selects the upper or lower surface).
+	 * \param[out] val_dX - Derivative of the cartesian coordinates of the vertex.
+	 * \return <code>TRUE</code> if the design variable moves the vertex; otherwise <code>FALSE</code>.
+	 */
+	bool GetHicksHenneDerivative(CConfig *config, unsigned short iDV, double val_AoA,
+	                             double *val_Coord, double *val_Normal, double *val_dX);
+  
   /*!
 	 * \brief Set a spherical design problem.
 	 * \param[in] boundary - Geometry of the boundary.
@@ -1207,6 +1359,19 @@ public:
 	 * \param[in] ResetDef - Reset the deformation before starting a new one.
 	 */		
 	void SetFFDCPChange(CGeometry *geometry, CConfig *config, CFreeFormDefBox *FFDBox, unsigned short iDV, bool ResetDef);
+  
+	/*! 
+	 * \brief Analytic derivative of the displacement of a surface point of the box with respect to a 
+	 *        control point design variable (FFD_CONTROL_POINT or FFD_CONTROL_POINT_2D). The deformation 
+	 *        is linear in the control point movement, so dX/dDV = movement * B_i(u) B_j(v) B_k(w).
+	 * \param[in] config - Definition of the particular problem.
+	 * \param[in] FFDBox - Free form box of the surface point.
+	 * \param[in] iDV - Index of the design variable.
+	 * \param[in] iSurfacePoints - Index of the surface point inside the box.
+	 * \param[out] val_dX - Derivative of the cartesian coordinates of the point.
+	 * \return <code>TRUE</code> if the design variable moves a control point of this box; otherwise <code>FALSE</code>.
+	 */		
+	bool GetFFDCPDerivative(CConfig *config, CFreeFormDefBox *FFDBox, unsigned short iDV, unsigned long iSurfacePoints, double *val_dX);
 	
   /*!
 	 * \brief Set a camber deformation of the Free From box using the control point position.
@@ -24,6 +24,12 @@
 
 inline void CGridMovement::SetSurface_Deformation(CGeometry *geometry, CConfig *config)  { }
 
+inline double CVolumetricMovement::GetRBF_Kernel(double Dist) {
+  double Ratio = Dist/RBF_Radius;
+  if (Ratio >= 1.0) return 0.0;
+  return pow(1.0-Ratio, 4)*(4.0*Ratio+1.0);
+}
+
 inline unsigned short CSurfaceMovement::GetnLevel(void) { return nLevel; }
 
 inline unsigned short CSurfaceMovement::GetnFFDBox(void) { return nFFDBox; }
@@ -48,11 +54,11 @@ inline void CFreeFormDefBox::Set_CartesianCoord(double *val_coord, unsigned long
 																																																			CartesianCoord[1][val_iSurfacePoints] = val_coord[1]; 
 																																																			CartesianCoord[2][val_iSurfacePoints] = val_coord[2]; }		
 
-inline void CFreeFormDefBox::Set_ParametricCoord(double *val_coord) { ParametricCoord[0].push_back(val_coord[0]);
+inline void CFreeFormDefBox::Set_ParametricCoord(double *val_coord) { SurfaceBasis.clear(); ParametricCoord[0].push_back(val_coord[0]);
 																																		 ParametricCoord[1].push_back(val_coord[1]); 
 																																		 ParametricCoord[2].push_back(val_coord[2]); }
 																																		 
-inline void CFreeFormDefBox::Set_ParametricCoord(double *val_coord, unsigned long val_iSurfacePoints) { ParametricCoord[0][val_iSurfacePoints] = val_coord[0];
+inline void CFreeFormDefBox::Set_ParametricCoord(double *val_coord, unsigned long val_iSurfacePoints) { SurfaceBasis.clear(); ParametricCoord[0][val_iSurfacePoints] = val_coord[0];
 																																																			 ParametricCoord[1][val_iSurfacePoints] = val_coord[1]; 
 																																																			 ParametricCoord[2][val_iSurfacePoints] = val_coord[2]; }
 
@@ -108,11 +114,11 @@ inline unsigned short CFreeFormDefBox::GetmOrder(void) { return mOrder; }
 
 inline unsigned short CFreeFormDefBox::GetnOrder(void) { return nOrder; }
 
-inline void CFreeFormDefBox::SetlOrder(unsigned short val_lOrder) { lOrder = val_lOrder; lDegree = lOrder-1; }
+inline void CFreeFormDefBox::SetlOrder(unsigned short val_lOrder) { lOrder = val_lOrder; lDegree = lOrder-1; SurfaceBasis.clear(); }
 
-inline void CFreeFormDefBox::SetmOrder(unsigned short val_mOrder) { mOrder = val_mOrder; mDegree = mOrder-1; }
+inline void CFreeFormDefBox::SetmOrder(unsigned short val_mOrder) { mOrder = val_mOrder; mDegree = mOrder-1; SurfaceBasis.clear(); }
 
-inline void CFreeFormDefBox::SetnOrder(unsigned short val_nOrder) { nOrder = val_nOrder; nDegree = nOrder-1;}
+inline void CFreeFormDefBox::SetnOrder(unsigned short val_nOrder) { nOrder = val_nOrder; nDegree = nOrder-1; SurfaceBasis.clear(); }
 
 inline void  CFreeFormDefBox::SetCoordCornerPoints(double *val_coord, unsigned short val_icornerpoints) {
 	for (unsigned short iDim = 0; iDim < nDim; iDim++) 
@@ -170,10 +170,12 @@ public:
    * \param[in] tol - tolerance with which to solve the system
    * \param[in] m - maximum size of the search subspace
    * \param[in] monitoring - turn on priting residuals from solver to screen.
+   * \param[in] rhs_norm - measure the convergence relative to the norm of b instead of the
+   *            initial residual (the tolerance does not depend on the initial guess).
    */
   unsigned long FGMRES_LinSolver(const CSysVector & b, CSysVector & x, CMatrixVectorProduct & mat_vec,
                       CPreconditioner & precond, double tol,
-                      unsigned long m, bool monitoring);
+                      unsigned long m, bool monitoring, bool rhs_norm = false);
 	
 	/*!
    * \brief Biconjugate Gradient Stabilized Method (BCGSTAB)
@@ -201,6 +203,18 @@ public:
    */
   unsigned long Solve(CSysMatrix & Jacobian, CSysVector & LinSysRes, CSysVector & LinSysSol, CGeometry *geometry, CConfig *config);
   
+  /*!
+   * \brief Solve a linear system with a Krylov method and a given matrix-vector product (e.g. Jacobian-free).
+   * \param[in] Jacobian - matrix used to build the preconditioner.
+   * \param[in] mat_vec - object that defines matrix-vector product.
+   * \param[in] LinSysRes - the right hand size vector.
+   * \param[in,out] LinSysSol - on entry the intial guess, on exit the solution.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \return Number of iterations of the linear solver.
+   */
+  unsigned long Solve(CSysMatrix & Jacobian, CMatrixVectorProduct & mat_vec, CSysVector & LinSysRes, CSysVector & LinSysSol, CGeometry *geometry, CConfig *config);
+  
 };
 
 #include "linear_solvers_structure.inl"
@@ -63,12 +63,13 @@ private:
   double *sum_vector;         /*!< \brief Auxilar array to store intermediate results. */
 	double *invM;              /*!< \brief Inverse of (Jacobi) preconditioner. */
 	bool *LineletBool;                          /*!< \brief Identify if a point belong to a linelet. */
-	vector<unsigned long> *LineletPoint;        /*!< \brief Linelet structure. */
 	unsigned long nLinelet;                     /*!< \brief Number of Linelets in the system. */
-  double **UBlock, **invUBlock, **LBlock,
-  **yVector, **zVector, **rVector, *LFBlock,
-  *LyVector, *FzVector, *AuxVector;           /*!< \brief Arrays of the Linelet preconditioner methodology. */
-  unsigned long max_nElem;
+  vector<unsigned long> Linelet_Ptr,          /*!< \brief Position of the first point of each linelet (CSR). */
+  Linelet_Point,                              /*!< \brief Points of the linelets, starting from the wall. */
+  Linelet_Block;                              /*!< \brief Index of the diagonal, lower and upper blocks of each linelet point. */
+  double *Linelet_invU,                       /*!< \brief Inverse of the pivot block of each linelet point (block Thomas factorization). */
+  *Linelet_L;                                 /*!< \brief Lower factor of each linelet point (block Thomas factorization). */
+  vector<unsigned long> Edge_Block;           /*!< \brief Index of the ii, ij, ji and jj blocks of each edge (batched edge loops). */
   
 public:
   
@@ -110,6 +111,24 @@ public:
 	 */
 	void SetValZero(void);
   
+	/*!
+	 * \brief Get the number of entries of the sparse matrix (<i>nnz</i> blocks of <i>nVar</i> x <i>nEqn</i>).
+	 * \return Number of entries.
+	 */
+	unsigned long GetnVal(void);
+  
+	/*!
+	 * \brief Copy all the entries of the sparse matrix.
+	 * \param[out] val_matrix - Entries of the matrix (see GetnVal), in the order of the sparse structure.
+	 */
+	void GetVal(double *val_matrix);
+  
+	/*!
+	 * \brief Set all the entries of the sparse matrix (same sparse structure).
+	 * \param[in] val_matrix - Entries of the matrix (see GetnVal), in the order of the sparse structure.
+	 */
+	void SetVal(double *val_matrix);
+  
   /*!
 	 * \brief Copies the block (i,j) of the matrix-by-blocks structure in the internal variable *block.
 	 * \param[in] block_i - Indexes of the block in the matrix-by-blocks structure.
@@ -148,6 +167,34 @@ public:
 	 */
 	void AddBlock(unsigned long block_i, unsigned long block_j, double **val_block);
   
+  /*!
+	 * \brief Position of the block (i,j) in the sparse matrix structure (nnz if it is not stored).
+	 */
+	unsigned long GetBlock_Index(unsigned long block_i, unsigned long block_j);
+  
+	/*!
+	 * \brief Adds the specified block to the sparse matrix, using its position (see GetBlock_Index).
+	 */
+	void AddBlock_Index(unsigned long block_index, double **val_block);
+  
+	/*!
+	 * \brief Store the position of the ii, ij, ji and jj blocks of each edge (see AddBlocks_Batch).
+	 * \param[in] geometry - Geometrical definition of the problem.
+	 */
+	void SetEdge_Block(CGeometry *geometry);
+  
+	/*!
+	 * \brief Adds the blocks of a batch of edges, using the positions stored by SetEdge_Block:
+	 *        A(i,i) += sign*Block_i, A(i,j) += sign*Block_j, A(j,i) -= sign*Block_i and A(j,j) -= sign*Block_j.
+	 * \param[in] val_edge - Edges of the batch.
+	 * \param[in] val_nLane - Number of edges in the batch.
+	 * \param[in] val_block_i - Blocks of the first point of the edges ([iVar*nEqn+jVar][lane]).
+	 * \param[in] val_block_j - Blocks of the second point of the edges ([iVar*nEqn+jVar][lane]).
+	 * \param[in] val_sign - 1.0, or -1.0 to subtract the blocks of the first point.
+	 */
+	void AddBlocks_Batch(unsigned long *val_edge, unsigned short val_nLane, double (*val_block_i)[EDGE_BATCH_SIZE],
+                       double (*val_block_j)[EDGE_BATCH_SIZE], double val_sign);
+  
 	/*!
 	 * \brief Subtracts the specified block to the sparse matrix.
 	 * \param[in] block_i - Indexes of the block in the matrix-by-blocks structure.
@@ -357,6 +404,11 @@ public:
 	 * \param[in] config - Definition of the particular problem.
 	 */
 	unsigned short BuildLineletPreconditioner(CGeometry *geometry, CConfig *config);
+  
+	/*!
+	 * \brief Block Thomas factorization of the linelets, once for each update of the matrix.
+	 */
+	void BuildLineletFactorization(void);
 	
 	/*!
 	 * \brief Multiply CSysVector by the preconditioner
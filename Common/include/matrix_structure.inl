@@ -27,6 +27,18 @@ inline void CSysMatrix::SetValZero(void) {
 		matrix[index] = 0.0;
 }
 
+inline unsigned long CSysMatrix::GetnVal(void) { return nnz*nVar*nEqn; }
+
+inline void CSysMatrix::GetVal(double *val_matrix) {
+	for (unsigned long index = 0; index < nnz*nVar*nEqn; index++)
+		val_matrix[index] = matrix[index];
+}
+
+inline void CSysMatrix::SetVal(double *val_matrix) {
+	for (unsigned long index = 0; index < nnz*nVar*nEqn; index++)
+		matrix[index] = val_matrix[index];
+}
+
 inline CSysMatrixVectorProduct::CSysMatrixVectorProduct(CSysMatrix & matrix_ref, CGeometry *geometry_ref, CConfig *config_ref) {
   sparse_matrix = &matrix_ref;
   geometry = geometry_ref;
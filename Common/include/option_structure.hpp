@@ -109,6 +109,15 @@ const unsigned int MAX_NUMBER_FFD = 10;	/*!< \brief Maximum number of FFDBoxes f
 const unsigned int MAX_SOLS = 6;		/*!< \brief Maximum number of solutions at the same time (dimension of solution container array). */
 const unsigned int MAX_TERMS = 6;		/*!< \brief Maximum number of terms in the numerical equations (dimension of solver container array). */
 const unsigned int MAX_ZONES = 3; /*!< \brief Maximum number of zones. */
+const unsigned int GEOMETRY_CACHE_VERSION = 1; /*!< \brief Version of the binary geometry cache. */
+const unsigned int ML_BATCH_SIZE = 128; /*!< \brief Number of points evaluated together by the machine learning turbulence model. */
+const unsigned int MAX_ML_INPUTS = 8; /*!< \brief Maximum number of inputs of the machine learning turbulence model. */
+const unsigned int MAX_ML_OUTPUTS = 4; /*!< \brief Maximum number of outputs of the machine learning turbulence model. */
+const unsigned int MAX_PROFILE_PHASES = 12; /*!< \brief Number of phases timed by the profiler. */
+const unsigned int MAX_PRIMVAR_GRAD = 10; /*!< \brief Maximum number of primitive variables with gradient (load buffers of the single precision gradients). */
+const unsigned int MAX_DERIVED_FIELDS = 4; /*!< \brief Number of derived fields with tracked validity in a solver. */
+const unsigned int EDGE_BATCH_SIZE = 8; /*!< \brief Number of edges computed together by the batched numerical methods. */
+const unsigned int INTERFACE_NDONOR = 3; /*!< \brief Number of donor vertices interpolated at each target vertex of a coupling interface. */
 const unsigned int NO_RK_ITER = 0;		/*!< \brief No Runge-Kutta iteration. */
 const unsigned int MESH_0 = 0;			/*!< \brief Definition of the finest grid level. */
 const unsigned int MESH_1 = 1;			/*!< \brief Definition of the finest grid level. */
@@ -125,6 +134,7 @@ const double MAGNETIC_CONSTANT = 1.25663706E-6;  /*!< \brief magnetic permeabili
 const double STANDART_GRAVITY = 9.80665;        /*!< \brief Acceleration due to gravity at surface of earth. */
 const double EPS = 1.0E-16;			/*!< \brief Error scale. */
 const double TURB_EPS = 1.0E-16;		/*!< \brief Turbulent Error scale. */
+const double EDGE_BATCH_CHECK_TOL = 1.0E-10; /*!< \brief Relative tolerance of the comparison of the batched and edge by edge residuals (EDGE_BATCH_CHECK). */
 const double ONE2 = 0.5;			/*!< \brief One divided by two. */
 const double TWO3 = 2.0 / 3.0;			/*!< \brief Two divided by three. */
 const double FOUR3 = 4.0 / 3.0;			/*!< \brief Four divided by three. */
@@ -622,6 +632,19 @@ static const map<string, ENUM_RECONST_GRADIENT> Reconst_Gradient_Map = CCreateMa
 ("WLS", WLS)
 ("SDWLS_QR", SDWLS_QR)
 ("SDWLS_DIRECT", SDWLS_DIRECT);
+
+/*!
+ * \brief types of edge loops for the upwind convective and viscous residuals
+ */
+enum ENUM_EDGE_LOOP {
+  SEPARATE_EDGE_LOOPS = 0,	/*!< \brief One loop over the edges for each term. */
+  FUSED_EDGE_LOOP = 1,	/*!< \brief A single loop, the viscous contribution is added right after the convective one. */
+  FUSED_EDGE_LOOP_REFERENCE = 2	/*!< \brief A single loop, the viscous contributions are added after all the convective ones (same results as separate loops). */
+};
+static const map<string, ENUM_EDGE_LOOP> Edge_Loop_Map = CCreateMap<string, ENUM_EDGE_LOOP>
+("SEPARATE", SEPARATE_EDGE_LOOPS)
+("FUSED", FUSED_EDGE_LOOP)
+("FUSED_REFERENCE", FUSED_EDGE_LOOP_REFERENCE);
 /*!
  * \brief types of action to take on a geometry structure
  */
@@ -641,6 +664,19 @@ static const map<string, GEOMETRY_MODE> GeometryMode_Map = CCreateMap<string, GE
 ("FUNCTION", FUNCTION)
 ("GRADIENT", GRADIENT);
 
+/*!
+ * \brief types of file for the geometric Jacobian of the gradient projection
+ */
+enum ENUM_GEO_JACOBIAN {
+  GEO_JACOBIAN_NONE = 0,     /*!<  \brief Do not write the geometric Jacobian. */
+  GEO_JACOBIAN_CSV = 1,      /*!<  \brief Dense CSV file (serial computations only). */
+  GEO_JACOBIAN_BINARY = 2    /*!<  \brief Sparse binary file (one file per domain). */
+};
+static const map<string, ENUM_GEO_JACOBIAN> GeoJacobian_Map = CCreateMap<string, ENUM_GEO_JACOBIAN>
+("NONE", GEO_JACOBIAN_NONE)
+("CSV", GEO_JACOBIAN_CSV)
+("BINARY", GEO_JACOBIAN_BINARY);
+
 /*!
  * \brief types of boundary conditions
  */
@@ -1063,6 +1099,34 @@ static const map<string, ENUM_LINEAR_SOLVER_PREC> Linear_Solver_Prec_Map = CCrea
 ("LINELET", LINELET)
 ("ILU0", ILU);
 
+/*!
+ * \brief phases of the solver timed by the wall-clock profiler
+ */
+enum ENUM_PROFILE_PHASE {
+  PROFILE_SETUP = 0,             /*!< \brief Geometry, solver and numerics preprocessing of the driver. */
+  PROFILE_ITERATION = 1,         /*!< \brief Complete iteration of the solver. */
+  PROFILE_PREPROCESSING = 2,     /*!< \brief Preprocessing of the solvers at each iteration. */
+  PROFILE_CONV_RESIDUAL = 3,     /*!< \brief Convective residual. */
+  PROFILE_VISC_RESIDUAL = 4,     /*!< \brief Viscous residual. */
+  PROFILE_SOURCE_RESIDUAL = 5,   /*!< \brief Source term residual. */
+  PROFILE_BOUND_RESIDUAL = 6,    /*!< \brief Boundary conditions and dual time residual. */
+  PROFILE_GRADIENT = 7,          /*!< \brief Gradients and limiters. */
+  PROFILE_LINEAR_SOLVER = 8,     /*!< \brief Linear solver. */
+  PROFILE_MPI_HALO = 9,          /*!< \brief Halo communication. */
+  PROFILE_MPI_REDUCE = 10,       /*!< \brief Global reductions. */
+  PROFILE_OUTPUT = 11            /*!< \brief Output files and convergence history. */
+};
+
+/*!
+ * \brief fields derived from the solution whose validity is tracked by the solvers
+ */
+enum ENUM_DERIVED_FIELD {
+  DERIVED_PRIMITIVE = 0,         /*!< \brief Primitive variables (depend on the solution and the grid). */
+  DERIVED_PRIM_GRADIENT = 1,     /*!< \brief Gradient of the primitive variables (depends on the primitive variables). */
+  DERIVED_PRIM_LIMITER = 2,      /*!< \brief Limiter of the primitive variables (depends on the gradient). */
+  DERIVED_VORTICITY = 3          /*!< \brief Vorticity and rate of strain magnitude (depend on the gradient). */
+};
+
 /*!
  * \brief types of analytic definitions for various geometries
  */
@@ -1124,6 +1188,17 @@ static const map<string, ENUM_CONVERGE_CRIT> Converge_Crit_Map = CCreateMap<stri
 ("CAUCHY", CAUCHY)
 ("RESIDUAL", RESIDUAL);
 
+/*!
+ * \brief types of volume mesh deformation methods
+ */
+enum ENUM_DEFORM_METHOD {
+  FEA_DEFORMATION = 0,    /*!< \brief Linear elasticity equations solved with the finite element method. */
+  RBF_DEFORMATION = 1     /*!< \brief Radial basis function interpolation of the boundary displacements. */
+};
+static const map<string, ENUM_DEFORM_METHOD> Deform_Method_Map = CCreateMap<string, ENUM_DEFORM_METHOD>
+("FEA", FEA_DEFORMATION)
+("RBF", RBF_DEFORMATION);
+
 /*!
  * \brief types of element stiffnesses imposed for FEA mesh deformation
  */
@@ -1464,11 +1539,11 @@ public:
         string str;
         str.append(this->name);
         str.append(": invalid option value ");
-        str.append(option_value[0]);
+        str.append(option_value[i]);
         return str;
       }
       // If it is there, set the option value
-      enums[i] = this->m[option_value[0]];
+      enums[i] = this->m[option_value[i]];
     }
     this->field = enums;
     return "";
@@ -1489,10 +1564,13 @@ class COptionDoubleArray : public COptionBase{
 public:
   COptionDoubleArray(string option_field_name, const int list_size, double * & option_field, double * default_value) : field(option_field), size(list_size){
     this->name = option_field_name;
-    this->default_value = default_value;
+    // The default is usually a local array of the caller, keep a copy of it
+    this->default_value = new double[this->size];
+    for(int i  = 0; i < this->size; i++)
+      this->default_value[i] = default_value[i];
   }
 
-  ~COptionDoubleArray(){};
+  ~COptionDoubleArray(){ delete [] this->default_value; };
   string SetValue(vector<string> option_value){
     // Check that the size is correct
     if (option_value.size() != this->size){
@@ -1524,7 +1602,11 @@ public:
   }
 
   void SetDefault(){
-    this->field = this->default_value;
+    // The field is owned (and deleted) by the config, give it its own copy
+    double * vals = new double[this->size];
+    for(int i  = 0; i < this->size; i++)
+      vals[i] = this->default_value[i];
+    this->field = vals;
   }
 };
 
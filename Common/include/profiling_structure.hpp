@@ -0,0 +1,129 @@
+/*!
+ * \file profiling_structure.hpp
+ * \brief Headers of the wall-clock profiler of the solver phases.
+ *        The subroutines and functions are in the <i>profiling_structure.cpp</i> file.
+ * \author Aerospace Design Laboratory (Stanford University) <http://su2.stanford.edu>.
+ * \version 3.2.3 "eagle"
+ *
+ * SU2, Copyright (C) 2012-2014 Aerospace Design Laboratory (ADL).
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#ifdef HAVE_MPI
+  #include "mpi.h"
+#else
+  #include <sys/time.h>
+#endif
+#include <cmath>
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+#include <string>
+
+#include "./option_structure.hpp"
+
+using namespace std;
+
+/*!
+ * \class CProfiler
+ * \brief Wall-clock timers of the phases of the solver (see ENUM_PROFILE_PHASE).
+ * \author Aerospace Design Laboratory (Stanford University).
+ * \version 3.2.3 "eagle"
+ *
+ * The time of a phase is inclusive: nested phases (e.g. the halo communication
+ * inside the gradient computation) are also counted in the enclosing phase.
+ * Nested timers of the same phase are only counted once.
+ */
+class CProfiler {
+
+private:
+
+  static bool Active;                               /*!< \brief Profiling is active. */
+  static unsigned short Depth[MAX_PROFILE_PHASES];  /*!< \brief Nesting level of the timers of each phase. */
+  static double Start_Time[MAX_PROFILE_PHASES];     /*!< \brief Start of the outermost timer of each phase. */
+  static double Total_Time[MAX_PROFILE_PHASES];     /*!< \brief Accumulated wall-clock time of each phase. */
+  static unsigned long nCalls[MAX_PROFILE_PHASES];  /*!< \brief Number of times each phase has been timed. */
+
+public:
+
+  /*!
+   * \brief Activate or deactivate the profiler.
+   * \param[in] val_active - <code>TRUE</code> to time the phases of the solver.
+   */
+  static void SetActive(bool val_active);
+
+  /*!
+   * \brief Get if the profiler is active.
+   * \return <code>TRUE</code> if the phases of the solver are timed.
+   */
+  static bool GetActive(void);
+
+  /*!
+   * \brief Get the wall-clock time.
+   * \return Wall-clock time in seconds.
+   */
+  static double GetTime(void);
+
+  /*!
+   * \brief Start the timer of a phase.
+   * \param[in] val_phase - Phase of the solver.
+   */
+  static void Start(unsigned short val_phase);
+
+  /*!
+   * \brief Stop the timer of a phase.
+   * \param[in] val_phase - Phase of the solver.
+   */
+  static void Stop(unsigned short val_phase);
+
+  /*!
+   * \brief Reduce the timers over all the ranks (min, max, mean and load imbalance),
+   *        print them, and write the summary in JSON format (master node).
+   * \param[in] val_filename - Name of the JSON file.
+   */
+  static void WriteReport(string val_filename);
+
+};
+
+/*!
+ * \class CProfilerTimer
+ * \brief Scoped timer, the phase is timed from the construction to the destruction of the object.
+ * \author Aerospace Design Laboratory (Stanford University).
+ * \version 3.2.3 "eagle"
+ */
+class CProfilerTimer {
+
+private:
+
+  unsigned short Phase;  /*!< \brief Phase of the solver. */
+
+public:
+
+  /*!
+   * \brief Constructor of the class, starts the timer.
+   * \param[in] val_phase - Phase of the solver.
+   */
+  CProfilerTimer(unsigned short val_phase);
+
+  /*!
+   * \brief Destructor of the class, stops the timer.
+   */
+  ~CProfilerTimer(void);
+
+};
+
+#include "profiling_structure.inl"
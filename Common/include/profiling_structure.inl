@@ -0,0 +1,56 @@
+/*!
+ * \file profiling_structure.inl
+ * \brief In-Line subroutines of the <i>profiling_structure.hpp</i> file.
+ * \author Aerospace Design Laboratory (Stanford University) <http://su2.stanford.edu>.
+ * \version 3.2.3 "eagle"
+ *
+ * SU2, Copyright (C) 2012-2014 Aerospace Design Laboratory (ADL).
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+inline void CProfiler::SetActive(bool val_active) { Active = val_active; }
+
+inline bool CProfiler::GetActive(void) { return Active; }
+
+inline double CProfiler::GetTime(void) {
+#ifdef HAVE_MPI
+  return MPI_Wtime();
+#else
+  timeval Time;
+  gettimeofday(&Time, NULL);
+  return double(Time.tv_sec) + 1E-6*double(Time.tv_usec);
+#endif
+}
+
+inline void CProfiler::Start(unsigned short val_phase) {
+  if (!Active) return;
+  if (Depth[val_phase] == 0) Start_Time[val_phase] = GetTime();
+  Depth[val_phase]++;
+}
+
+inline void CProfiler::Stop(unsigned short val_phase) {
+  if ((!Active) || (Depth[val_phase] == 0)) return;
+  Depth[val_phase]--;
+  if (Depth[val_phase] == 0) {
+    Total_Time[val_phase] += GetTime() - Start_Time[val_phase];
+    nCalls[val_phase]++;
+  }
+}
+
+inline CProfilerTimer::CProfilerTimer(unsigned short val_phase) { Phase = val_phase; CProfiler::Start(Phase); }
+
+inline CProfilerTimer::~CProfilerTimer(void) { CProfiler::Stop(Phase); }
@@ -35,6 +35,8 @@
 #include <string>
 #include <cstdlib>
 
+#include "./profiling_structure.hpp"
+
 using namespace std;
 
 const double eps = numeric_limits<double>::epsilon(); /*!< \brief machine epsilon */
@@ -92,6 +92,13 @@ void CConfig::SetPointersNull(void){
   Marker_FlowLoad=NULL;       Marker_Neumann=NULL;          Marker_Neumann_Elec=NULL;
   Marker_All_TagBound=NULL;        Marker_CfgFile_TagBound=NULL;       Marker_All_KindBC=NULL;
   Marker_CfgFile_KindBC=NULL;    Marker_All_SendRecv=NULL; Marker_All_PerBound=NULL; 
+  Marker_CfgFile_Monitoring=NULL;  Marker_All_Monitoring=NULL;        Marker_CfgFile_Designing=NULL;
+  Marker_All_Designing=NULL;       Marker_CfgFile_Plotting=NULL;      Marker_All_Plotting=NULL;
+  Marker_CfgFile_GeoEval=NULL;     Marker_All_GeoEval=NULL;           Marker_CfgFile_DV=NULL;
+  Marker_All_DV=NULL;              Marker_CfgFile_Moving=NULL;        Marker_All_Moving=NULL;
+  Marker_CfgFile_Out_1D=NULL;      Marker_All_Out_1D=NULL;            Marker_CfgFile_PerBound=NULL;
+  Marker_Monitoring=NULL;     Marker_Designing=NULL;        Marker_GeoEval=NULL;
+  Marker_Plotting=NULL;       Marker_DV=NULL;               Marker_Moving=NULL;
 
   /*--- Boundary Condition settings ---*/
 
@@ -104,6 +111,7 @@ void CConfig::SetPointersNull(void){
   FlowLoad_Value=NULL;        Periodic_RotCenter=NULL;      Periodic_RotAngles=NULL;
   Periodic_Translation=NULL;  Periodic_Center=NULL;         Periodic_Rotation=NULL;
   Periodic_Translate=NULL;    Wall_Catalycity=NULL;
+  Heat_FluxCatalytic=NULL;    Heat_FluxNonCatalytic=NULL;
 
   /*--- Miscellaneous/unsorted ---*/
 
@@ -112,11 +120,16 @@ void CConfig::SetPointersNull(void){
   Velocity_FreeStream=NULL;
   RefOriginMoment=NULL;     RefOriginMoment_X=NULL;  RefOriginMoment_Y=NULL;
   RefOriginMoment_Z=NULL;   CFLRamp=NULL;            CFL=NULL;
+  CFL_SER_Param=NULL;
   PlaneTag=NULL;
   Kappa_Flow=NULL;    Kappa_AdjFlow=NULL;  Kappa_TNE2=NULL;
   Kappa_AdjTNE2=NULL;  Kappa_LinFlow=NULL;
   Section_Location=NULL;
   U_FreeStreamND=NULL;
+  RK_Alpha_Step=NULL;     MG_PreSmooth=NULL;     MG_PostSmooth=NULL;
+  MG_CorrecSmooth=NULL;   EA_IntLimit=NULL;      Hold_GridFixed_Coord=NULL;
+  Subsonic_Nacelle_Box=NULL;
+  Design_Variable=NULL;   DV_Value=NULL;         ParamDV=NULL;
 
   /*--- Moving mesh pointers ---*/
 
@@ -454,6 +467,11 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
   default_vec_3d[0] = 1.0; default_vec_3d[1] = 100.0; default_vec_3d[2] = 1.0;
   /* DESCRIPTION: CFL ramp (factor, number of iterations, CFL limit) */
   addDoubleArrayOption("CFL_RAMP", 3, CFLRamp, default_vec_3d);
+  /* DESCRIPTION: Adapt the CFL number with the residual history (switched evolution relaxation) */
+  addBoolOption("CFL_SER", CFL_SER, false);
+  default_vec_3d[0] = 1.5; default_vec_3d[1] = 1.0; default_vec_3d[2] = 1000.0;
+  /* DESCRIPTION: Switched evolution relaxation (max growth factor per iteration, CFL min, CFL max) */
+  addDoubleArrayOption("CFL_SER_PARAM", 3, CFL_SER_Param, default_vec_3d);
   /* DESCRIPTION: Reduction factor of the CFL coefficient in the adjoint problem */
   addDoubleOption("CFL_REDUCTION_ADJFLOW", CFLRedCoeff_AdjFlow, 0.8);
   /* DESCRIPTION: Reduction factor of the CFL coefficient in the level set problem */
@@ -519,6 +537,10 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
   addUnsignedLongOption("LINEAR_SOLVER_RESTART_FREQUENCY", Linear_Solver_Restart_Frequency, 10);
   /* DESCRIPTION: Relaxation of the linear solver for the implicit formulation */
   addDoubleOption("LINEAR_SOLVER_RELAX", Linear_Solver_Relax, 1.0);
+  /* DESCRIPTION: Jacobian-free Newton-Krylov steps for the flow equations on the finest grid */
+  addBoolOption("NEWTON_KRYLOV", Newton_Krylov, false);
+  /* DESCRIPTION: Relative step of the finite differences of the Jacobian-free matrix-vector product */
+  addDoubleOption("NEWTON_KRYLOV_EPS", Newton_Krylov_Eps, 1E-7);
   /* DESCRIPTION: Roe-Turkel preconditioning for low Mach number flows */
   addBoolOption("ROE_TURKEL_PREC", Low_Mach_Precon, false);
   /* DESCRIPTION: Time Step for dual time stepping simulations (s) */
@@ -591,6 +613,14 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
   addEnumOption("NUM_METHOD_GRAD", Kind_Gradient_Method, Gradient_Map, WEIGHTED_LEAST_SQUARES);
     /* DESCRIPTION: Numerical method for reconstruction spatial gradients */
   addEnumOption("RECONST_METHOD_GRAD", Kind_Reconst_Gradient_Method, Reconst_Gradient_Map, NO_SDWLS);
+  /* DESCRIPTION: Separate or fused edge loops for the upwind convective and viscous residuals */
+  addEnumOption("EDGE_LOOP", Kind_Edge_Loop, Edge_Loop_Map, SEPARATE_EDGE_LOOPS);
+  /* DESCRIPTION: Compute the edges in batches (Roe, JST and corrected average of gradients) */
+  addBoolOption("EDGE_BATCH", Edge_Batch, false);
+  /* DESCRIPTION: Compare the batched residuals with the edge by edge methods (debug) */
+  addBoolOption("EDGE_BATCH_CHECK", Edge_Batch_Check, false);
+  /* DESCRIPTION: Store the gradients and limiters of the primitive variables in single precision */
+  addBoolOption("SINGLE_PRECISION_GRADIENT", Single_Precision_Gradient, false);
     /* DESCRIPTION: Coefficient for the limiter */
   addDoubleOption("LIMITER_COEFF", LimiterCoeff, 0.5);
   /* DESCRIPTION: Freeze the value of the limiter after a number of iterations */
@@ -685,6 +715,10 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
   addBoolOption("GEO_PLOT_SECTIONS", Plot_Section_Forces, false);
   /* DESCRIPTION: Mode of the GDC code (analysis, or gradient) */
   addEnumOption("GEO_MODE", GeometryMode, GeometryMode_Map, FUNCTION);
+  /* DESCRIPTION: Analytic surface Jacobian of the FFD control point and Hicks-Henne design variables in the gradient projection */
+  addBoolOption("GEO_JACOBIAN_ANALYTIC", GeoJacobian_Analytic, false);
+  /* DESCRIPTION: Format of the geometric Jacobian file written by the gradient projection (NONE, CSV, BINARY) */
+  addEnumOption("GEO_JACOBIAN_FORMAT", GeoJacobian_FileFormat, GeoJacobian_Map, GEO_JACOBIAN_CSV);
 
   /* DESCRIPTION: Drag weight in sonic boom Objective Function (from 0.0 to 1.0) */
   addDoubleOption("DRAG_IN_SONICBOOM", WeightCd, 0.0);
@@ -719,10 +753,18 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
   addDoubleOption("MESH_SCALE_CHANGE", Mesh_Scale_Change, 1.0);
   /* DESCRIPTION: Write a new mesh converted to meters */
   addBoolOption("MESH_OUTPUT", Mesh_Output, false);
-  /* DESCRIPTION: Cuthill–McKee ordering algorithm */
-  addBoolOption("CUTHILL_MCKEE_ORDERING", CuthillMckee_Ordering, false);
+  /* DESCRIPTION: Reverse Cuthill–McKee renumbering of the points of each domain (halo points are kept at the end) */
+  addBoolOption("CUTHILL_MCKEE_ORDERING", CuthillMckee_Ordering, true);
   /* DESCRIPTION: Mesh output file */
   addStringOption("MESH_OUT_FILENAME", Mesh_Out_FileName, string("mesh_out.su2"));
+  /* DESCRIPTION: Read/write the preprocessed geometry (edges, dual grid, multigrid levels) from/to a binary cache */
+  addBoolOption("GEOMETRY_CACHE", Geometry_Cache, false);
+  /* DESCRIPTION: Geometry cache file (a zone and a rank suffix are added when needed) */
+  addStringOption("GEOMETRY_CACHE_FILENAME", Geometry_Cache_FileName, string("geometry_cache.dat"));
+  /* DESCRIPTION: Time the phases of the solver (wall-clock) and write a summary at exit */
+  addBoolOption("PROFILING", Profiling, false);
+  /* DESCRIPTION: Profiling summary file (JSON) */
+  addStringOption("PROFILING_FILENAME", Profiling_FileName, string("profiling.json"));
 
   /* DESCRIPTION: Output file convergence history (w/o extension) */
   addStringOption("CONV_FILENAME", Conv_FileName, string("history"));
@@ -990,6 +1032,16 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
   addUnsignedLongOption("DEFORM_LINEAR_ITER", GridDef_Linear_Iter, 500);
   /* DESCRIPTION: Factor to multiply smallest volume for deform tolerance (0.001 default) */
   addDoubleOption("DEFORM_TOL_FACTOR", Deform_Tol_Factor, 0.001);
+  /* DESCRIPTION: Start the deformation linear solver from the previous displacement field (NO, YES) */
+  addBoolOption("DEFORM_WARM_START", Deform_WarmStart, true);
+  /* DESCRIPTION: Volume deformation method (FEA, RBF) */
+  addEnumOption("DEFORM_METHOD", Deform_Method, Deform_Method_Map, FEA_DEFORMATION);
+  /* DESCRIPTION: Support radius of the RBF deformation (0.0 computes it from the moving surfaces and the max. displacement) */
+  addDoubleOption("DEFORM_RBF_RADIUS", Deform_RBF_Radius, 0.0);
+  /* DESCRIPTION: Interpolation error of the RBF control points selection, relative to the maximum displacement */
+  addDoubleOption("DEFORM_RBF_TOLERANCE", Deform_RBF_Tolerance, 1E-3);
+  /* DESCRIPTION: Maximum number of control points of the RBF deformation */
+  addUnsignedLongOption("DEFORM_RBF_MAX_POINTS", Deform_RBF_MaxPoints, 1000);
   /* DESCRIPTION: Type of element stiffness imposed for FEA mesh deformation (INVERSE_VOLUME, WALL_DISTANCE, CONSTANT_STIFFNESS) */
   addEnumOption("DEFORM_STIFFNESS_TYPE", Deform_Stiffness_Type, Deform_Stiffness_Map, INVERSE_VOLUME);
   /* DESCRIPTION: Poisson's ratio for constant stiffness FEA method of grid deformation*/
@@ -1056,7 +1108,7 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
   /* DESCRIPTION: what kind of input/output feature map is there */
   addStringOption("ML_TURB_MODEL_FEATURESET", ML_Turb_Model_FeatureSet, string("none"));
 
-  /* DESCRIPTION: Extra values for ML Turb model */
+  /* DESCRIPTION: Extra values for ML Turb model (BlOnly, FlatplateBlOnlyCutoff, FastTanh) */
   addStringListOption("ML_TURB_MODEL_EXTRA",nML_Turb_Model_Extra, ML_Turb_Model_Extra);
 
   /*--- options related to the FFD problem ---*/
@@ -1098,12 +1150,18 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
   /* DESCRIPTION: Finite different step for gradient estimation */
   addPythonOption("FIN_DIFF_STEP");
 
+  /* DESCRIPTION: Number of groups of ranks that evaluate the finite difference steps concurrently */
+  addPythonOption("FINDIFF_GROUPS");
+
   /* DESCRIPTION: Verbosity of the python scripts to Stdout */
   addPythonOption("CONSOLE");
 
   /* DESCRIPTION: Flag specifying if the mesh was decomposed */
   addPythonOption("DECOMPOSED");
 
+  /* DESCRIPTION: Run SU2_CFD and SU2_DEF in resident drivers of libSU2_CFD.so (YES, NO) */
+  addPythonOption("LIBRARY");
+
   /* END_CONFIG_OPTIONS */
 
 }
@@ -2673,6 +2731,21 @@ void CConfig::SetPostprocessing(unsigned short val_software, unsigned short val_
 
   }
 
+  /*--- The Newton-Krylov steps need the implicit flow solver with a Krylov linear
+   solver, and a residual that only depends on the solution ---*/
+  
+  if (Newton_Krylov) {
+    if ((Kind_TimeIntScheme_Flow != EULER_IMPLICIT) ||
+        ((Kind_Linear_Solver != FGMRES) && (Kind_Linear_Solver != RFGMRES) && (Kind_Linear_Solver != BCGSTAB))) {
+      cout << "NEWTON_KRYLOV requires TIME_DISCRE_FLOW= EULER_IMPLICIT and LINEAR_SOLVER= FGMRES, RFGMRES or BCGSTAB." << endl;
+      exit(EXIT_FAILURE);
+    }
+    if (Fixed_CL_Mode || Low_Mach_Precon) {
+      cout << "NEWTON_KRYLOV is not compatible with FIXED_CL_MODE or ROE_TURKEL_PREC." << endl;
+      exit(EXIT_FAILURE);
+    }
+  }
+
   /*--- Check for 2nd order w/ limiting for JST and correct ---*/
   
   if ((Kind_ConvNumScheme_Flow == SPACE_CENTERED) && (Kind_Centered_Flow == JST) && (SpatialOrder_Flow == SECOND_ORDER_LIMITER))
@@ -3768,6 +3841,8 @@ void CConfig::SetOutput(unsigned short val_software, unsigned short val_izone) {
               cout << "Relaxation coefficient: "<< Linear_Solver_Relax <<"."<<endl;
               break;
           }
+          if (Newton_Krylov)
+            cout << "Jacobian-free Newton-Krylov steps on the finest grid, finite difference step: "<< Newton_Krylov_Eps <<"."<<endl;
           break;
       }
     }
@@ -3856,7 +3931,8 @@ void CConfig::SetOutput(unsigned short val_software, unsigned short val_izone) {
 
     if ((Kind_Solver != LINEAR_ELASTICITY) && (Kind_Solver != HEAT_EQUATION) && (Kind_Solver != WAVE_EQUATION)) {
 
-      if (CFLRamp[0] == 1.0) cout << "No CFL ramp." << endl;
+      if (CFL_SER) cout << "Switched evolution relaxation of the CFL. Max growth factor: "<< CFL_SER_Param[0] <<", between "<< CFL_SER_Param[1] <<" and "<< CFL_SER_Param[2] <<"." << endl;
+      else if (CFLRamp[0] == 1.0) cout << "No CFL ramp." << endl;
       else cout << "CFL ramp definition. factor: "<< CFLRamp[0] <<", every "<< int(CFLRamp[1]) <<" iterations, with a limit of "<< CFLRamp[2] <<"." << endl;
 
       if (nMultiLevel !=0) {
@@ -4686,9 +4762,11 @@ bool CConfig::GetPython_Option(string & option_name) {
   if (option_name == "OPT_CONSTRAINT") isPython_Option = true;
   if (option_name == "GRADIENTS") isPython_Option = true;
   if (option_name == "FIN_DIFF_STEP") isPython_Option = true;
+  if (option_name == "FINDIFF_GROUPS") isPython_Option = true;
   if (option_name == "ADAPT_CYCLES") isPython_Option = true;
   if (option_name == "CONSOLE") isPython_Option = true;
   if (option_name == "DECOMPOSED") isPython_Option = true;
+  if (option_name == "LIBRARY") isPython_Option = true;
 
   return isPython_Option;
 }
@@ -4955,6 +5033,7 @@ CConfig::~CConfig(void)
   if (Kappa_LinFlow!=NULL  )    delete[] Kappa_LinFlow;
   if (PlaneTag!=NULL)    delete[] PlaneTag;
   if (CFLRamp!=NULL)    delete[] CFLRamp;
+  if (CFL_SER_Param!=NULL)    delete[] CFL_SER_Param;
   if (CFL!=NULL)    delete[] CFL;
   /*String markers*/
   if (Marker_Euler!=NULL )              delete[] Marker_Euler;
@@ -5054,6 +5133,13 @@ void CConfig::SetFileNameDomain(unsigned short val_domain) {
     old_name = old_name.substr(0, lastindex);
     Mesh_FileName = old_name + buffer;
 
+    /*--- Geometry cache ---*/
+    sprintf (buffer, "_%d.dat", int(val_domain));
+    old_name = Geometry_Cache_FileName;
+    lastindex = old_name.find_last_of(".");
+    old_name = old_name.substr(0, lastindex);
+    Geometry_Cache_FileName = old_name + buffer;
+
   }
 #endif
 }
@@ -5175,7 +5261,7 @@ void CConfig::UpdateCFL(unsigned long val_iter) {
   if (Adjoint) coeff = CFLRedCoeff_AdjFlow;
   else coeff = 1.0;
 
-  if ((CFLRamp[0] != 1.0) && (val_iter % int(CFLRamp[1]) == 0 ) && (val_iter != 0) && (CFL[0] < CFLRamp[2]*coeff)) {
+  if ((!CFL_SER) && (CFLRamp[0] != 1.0) && (val_iter % int(CFLRamp[1]) == 0 ) && (val_iter != 0) && (CFL[0] < CFLRamp[2]*coeff)) {
 
     for (iCFL = 0; iCFL <= nMultiLevel; iCFL++)
         CFL[iCFL] *= CFLRamp[0];
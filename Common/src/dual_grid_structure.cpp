@@ -265,11 +265,6 @@ CPoint::CPoint(double val_coord_0, double val_coord_1, double val_coord_2, unsig
 
 CPoint::~CPoint() {
   
-	Elem.~vector();
-	Point.~vector();
-	Edge.~vector();
-  Children_CV.~vector();
-
 	if (Volume != NULL) delete[] Volume;
 	if (vertex != NULL) delete[] vertex;
 	if (coord != NULL) delete[] coord;
@@ -22,6 +22,61 @@
 
 #include "../include/geometry_structure.hpp"
 
+CAirfoilSlicing::CAirfoilSlicing(unsigned short val_nSection, double **Plane_P0, double **Plane_Normal) {
+  
+  unsigned short iSection, iDim;
+  
+  nSection = val_nSection;
+  
+  for (iDim = 0; iDim < 3; iDim++)
+    Normal[iDim] = Plane_Normal[0][iDim];
+  
+  Offset = new double [nSection];
+  for (iSection = 0; iSection < nSection; iSection++)
+    Offset[iSection] = Normal[0]*Plane_P0[iSection][0] + Normal[1]*Plane_P0[iSection][1] + Normal[2]*Plane_P0[iSection][2];
+  
+  Segment = new vector<unsigned long> [nSection];
+  Order = new vector<unsigned long> [nSection];
+  
+}
+
+CAirfoilSlicing::~CAirfoilSlicing(void) {
+  
+  delete [] Offset;
+  delete [] Segment;
+  delete [] Order;
+  
+}
+
+bool CAirfoilSlicing::Match(unsigned short val_nSection, double **Plane_P0, double **Plane_Normal) {
+  
+  unsigned short iSection, iDim;
+  double Value;
+  
+  if (val_nSection != nSection) return false;
+  
+  for (iSection = 0; iSection < nSection; iSection++) {
+    for (iDim = 0; iDim < 3; iDim++)
+      if (fabs(Plane_Normal[iSection][iDim] - Normal[iDim]) > EPS) return false;
+    Value = Normal[0]*Plane_P0[iSection][0] + Normal[1]*Plane_P0[iSection][1] + Normal[2]*Plane_P0[iSection][2];
+    if (fabs(Value - Offset[iSection]) > EPS) return false;
+  }
+  
+  return true;
+  
+}
+
+void CAirfoilSlicing::Reset(void) {
+  
+  unsigned short iSection;
+  
+  for (iSection = 0; iSection < nSection; iSection++) {
+    Segment[iSection].clear();
+    Order[iSection].clear();
+  }
+  
+}
+
 CGeometry::CGeometry(void) {
   
   nEdge = 0;
@@ -40,6 +95,7 @@ CGeometry::CGeometry(void) {
   newBound = NULL;
   nNewElem_Bound = NULL;
   Marker_All_SendRecv = NULL;
+  Linelet_MeanPoints = 0;
   
   //	PeriodicPoint[MAX_NUMBER_PERIODIC][2].clear();
   //	PeriodicElem[MAX_NUMBER_PERIODIC].clear();
@@ -56,7 +112,10 @@ CGeometry::CGeometry(void) {
 
 CGeometry::~CGeometry(void) {
   unsigned long iElem, iElem_Bound, iPoint, iFace, iVertex, iEdge;
-  unsigned short iMarker;
+  unsigned short iMarker, iSlicing;
+  
+  for (iSlicing = 0; iSlicing < AirfoilSlicing.size(); iSlicing++)
+    delete AirfoilSlicing[iSlicing];
   
   if (elem != NULL) {
     for (iElem = 0; iElem < nElem; iElem++)
@@ -155,6 +214,18 @@ double CGeometry::Point2Plane_Distance(double *Coord, double *iCoord, double *jC
 long CGeometry::FindEdge(unsigned long first_point, unsigned long second_point) {
   unsigned long iPoint = 0;
   unsigned short iNode;
+  
+  /*--- Binary search in the sorted neighbors of the CSR edge map ---*/
+  
+  if (Edge_Map_Ptr.size() == nPoint+1) {
+    vector<unsigned long>::iterator First = Edge_Map_Point.begin()+Edge_Map_Ptr[first_point];
+    vector<unsigned long>::iterator Last = Edge_Map_Point.begin()+Edge_Map_Ptr[first_point+1];
+    vector<unsigned long>::iterator it = lower_bound(First, Last, second_point);
+    if ((it != Last) && (*it == second_point)) return Edge_Map_Edge[it-Edge_Map_Point.begin()];
+  }
+  
+  /*--- Otherwise (the map is not built), search in the list of the point ---*/
+  
   for (iNode = 0; iNode < node[first_point]->GetnPoint(); iNode++) {
     iPoint = node[first_point]->GetPoint(iNode);
     if (iPoint == second_point) break;
@@ -172,6 +243,13 @@ long CGeometry::FindEdge(unsigned long first_point, unsigned long second_point)
 bool CGeometry::CheckEdge(unsigned long first_point, unsigned long second_point) {
   unsigned long iPoint = 0;
   unsigned short iNode;
+  
+  if (Edge_Map_Ptr.size() == nPoint+1) {
+    vector<unsigned long>::iterator First = Edge_Map_Point.begin()+Edge_Map_Ptr[first_point];
+    vector<unsigned long>::iterator Last = Edge_Map_Point.begin()+Edge_Map_Ptr[first_point+1];
+    if (binary_search(First, Last, second_point)) return true;
+  }
+  
   for (iNode = 0; iNode < node[first_point]->GetnPoint(); iNode++) {
     iPoint = node[first_point]->GetPoint(iNode);
     if (iPoint == second_point) break;
@@ -183,35 +261,209 @@ bool CGeometry::CheckEdge(unsigned long first_point, unsigned long second_point)
 }
 
 void CGeometry::SetEdges(void) {
-  unsigned long iPoint, jPoint;
+  unsigned long iPoint, jPoint, iNeighbor;
   long iEdge;
   unsigned short jNode, iNode;
-  long TestEdge = 0;
+  vector<pair<unsigned long, unsigned short> > Neighbor;
+  
+  /*--- Each edge is stored once, by its first (smallest) point ---*/
   
   nEdge = 0;
   for(iPoint = 0; iPoint < nPoint; iPoint++)
+    for(iNode = 0; iNode < node[iPoint]->GetnPoint(); iNode++)
+      if (node[iPoint]->GetPoint(iNode) > iPoint) nEdge++;
+  
+  edge = new CEdge*[nEdge];
+  
+  /*--- The edges are numbered by their first point and then by the second
+   one, so the edge loops sweep the points (and the Jacobian rows) in order ---*/
+  
+  iEdge = 0;
+  for(iPoint = 0; iPoint < nPoint; iPoint++) {
+    
+    Neighbor.clear();
     for(iNode = 0; iNode < node[iPoint]->GetnPoint(); iNode++) {
       jPoint = node[iPoint]->GetPoint(iNode);
+      if (jPoint > iPoint) Neighbor.push_back(make_pair(jPoint, iNode));
+    }
+    sort(Neighbor.begin(), Neighbor.end());
+    
+    for (iNeighbor = 0; iNeighbor < Neighbor.size(); iNeighbor++) {
+      jPoint = Neighbor[iNeighbor].first;
+      edge[iEdge] = new CEdge(iPoint, jPoint, nDim);
+      node[iPoint]->SetEdge(iEdge, Neighbor[iNeighbor].second);
       for(jNode = 0; jNode < node[jPoint]->GetnPoint(); jNode++)
         if (node[jPoint]->GetPoint(jNode) == iPoint) {
-          TestEdge = node[jPoint]->GetEdge(jNode);
+          node[jPoint]->SetEdge(iEdge, jNode);
           break;
         }
-      if (TestEdge == -1) {
-        node[iPoint]->SetEdge(nEdge, iNode);
-        node[jPoint]->SetEdge(nEdge, jNode);
-        nEdge++;
-      }
+      iEdge++;
     }
+    
+  }
   
-  edge = new CEdge*[nEdge];
+  /*--- CSR edge map for FindEdge ---*/
   
+  SetEdge_Map();
+  
+}
+
+void CGeometry::SetEdge_Map(void) {
+  unsigned long iPoint, iNeighbor, Index;
+  unsigned short iNode;
+  vector<pair<unsigned long, long> > Neighbor;
+  
+  /*--- Count the neighbors of each point ---*/
+  
+  Edge_Map_Ptr.assign(nPoint+1, 0);
   for(iPoint = 0; iPoint < nPoint; iPoint++)
-    for(iNode = 0; iNode < node[iPoint]->GetnPoint(); iNode++) {
-      jPoint = node[iPoint]->GetPoint(iNode);
-      iEdge = FindEdge(iPoint, jPoint);
-      if (iPoint < jPoint) edge[iEdge] = new CEdge(iPoint, jPoint, nDim);
+    Edge_Map_Ptr[iPoint+1] = Edge_Map_Ptr[iPoint] + node[iPoint]->GetnPoint();
+  
+  Edge_Map_Point.resize(Edge_Map_Ptr[nPoint]);
+  Edge_Map_Edge.resize(Edge_Map_Ptr[nPoint]);
+  
+  /*--- Store the neighbors sorted, with the edge that connects them ---*/
+  
+  for(iPoint = 0; iPoint < nPoint; iPoint++) {
+    Neighbor.clear();
+    for(iNode = 0; iNode < node[iPoint]->GetnPoint(); iNode++)
+      Neighbor.push_back(make_pair(node[iPoint]->GetPoint(iNode), node[iPoint]->GetEdge(iNode)));
+    sort(Neighbor.begin(), Neighbor.end());
+    for (iNeighbor = 0; iNeighbor < Neighbor.size(); iNeighbor++) {
+      Index = Edge_Map_Ptr[iPoint]+iNeighbor;
+      Edge_Map_Point[Index] = Neighbor[iNeighbor].first;
+      Edge_Map_Edge[Index] = Neighbor[iNeighbor].second;
+    }
+  }
+  
+}
+
+void CGeometry::SetLinelets(CConfig *config) {
+  unsigned long iPoint, jPoint, iVertex, iStart, next_Point, Local_nLinelet[2], Global_nLinelet[2];
+  unsigned short iMarker, iNode, iDim, counter;
+  double alpha = 0.9, max_weight, area, *normal;
+  vector<unsigned long> Start_Point;
+  vector<double> Weight;
+  
+  /*--- The linelets depend only on the grid, they are built once and
+   shared by all the matrices (solvers) of this grid ---*/
+  
+  if (!Linelet_Ptr.empty()) return;
+  
+  /*--- The linelets start at each vertex of the walls ---*/
+  
+  vector<bool> check_Point(nPoint, true);
+  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+    if ((config->GetMarker_All_KindBC(iMarker) == HEAT_FLUX              ) ||
+        (config->GetMarker_All_KindBC(iMarker) == HEAT_FLUX_CATALYTIC    ) ||
+        (config->GetMarker_All_KindBC(iMarker) == HEAT_FLUX_NONCATALYTIC ) ||
+        (config->GetMarker_All_KindBC(iMarker) == ISOTHERMAL             ) ||
+        (config->GetMarker_All_KindBC(iMarker) == ISOTHERMAL_CATALYTIC   ) ||
+        (config->GetMarker_All_KindBC(iMarker) == ISOTHERMAL_NONCATALYTIC) ||
+        (config->GetMarker_All_KindBC(iMarker) == EULER_WALL             ) ||
+        (config->GetMarker_All_KindBC(iMarker) == DISPLACEMENT_BOUNDARY)) {
+      for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++) {
+        iPoint = vertex[iMarker][iVertex]->GetNode();
+        Start_Point.push_back(iPoint);
+        check_Point[iPoint] = false;
+      }
+    }
+  }
+  
+  /*--- Grow each linelet with the neighbor of strongest coupling (area over volume),
+   while it is the only one within a factor alpha of the maximum (otherwise the
+   zone is isotropic). The weights of each point are computed once ---*/
+  
+  Linelet_Ptr.push_back(0);
+  for (iStart = 0; iStart < Start_Point.size(); iStart++) {
+    
+    iPoint = Start_Point[iStart];
+    Linelet_Point.push_back(iPoint);
+    
+    while (true) {
+      
+      Weight.assign(node[iPoint]->GetnPoint(), 0.0);
+      max_weight = 0.0;
+      for (iNode = 0; iNode < node[iPoint]->GetnPoint(); iNode++) {
+        jPoint = node[iPoint]->GetPoint(iNode);
+        if (check_Point[jPoint] && node[jPoint]->GetDomain()) {
+          normal = edge[node[iPoint]->GetEdge(iNode)]->GetNormal();
+          area = 0.0;
+          for (iDim = 0; iDim < nDim; iDim++) area += normal[iDim]*normal[iDim];
+          area = sqrt(area);
+          Weight[iNode] = 0.5*area*((1.0/node[iPoint]->GetVolume())+(1.0/node[jPoint]->GetVolume()));
+          max_weight = max(max_weight, Weight[iNode]);
+        }
+      }
+      
+      counter = 0; next_Point = iPoint;
+      for (iNode = 0; iNode < node[iPoint]->GetnPoint(); iNode++) {
+        if ((Weight[iNode] > 0.0) && (Weight[iNode]/max_weight > alpha)) {
+          next_Point = node[iPoint]->GetPoint(iNode);
+          counter++;
+        }
+      }
+      
+      if (counter != 1) break;
+      
+      Linelet_Point.push_back(next_Point);
+      check_Point[next_Point] = false;
+      iPoint = next_Point;
+      
+    }
+    
+    Linelet_Ptr.push_back(Linelet_Point.size());
+    
+  }
+  
+  /*--- Average number of points in each linelet (screen output) ---*/
+  
+  Local_nLinelet[0] = Linelet_Point.size();
+  Local_nLinelet[1] = Start_Point.size();
+  
+#ifndef HAVE_MPI
+  Global_nLinelet[0] = Local_nLinelet[0];
+  Global_nLinelet[1] = Local_nLinelet[1];
+#else
+  MPI_Allreduce(Local_nLinelet, Global_nLinelet, 2, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+#endif
+  
+  if (Global_nLinelet[1] != 0) Linelet_MeanPoints = Global_nLinelet[0]/Global_nLinelet[1];
+  else Linelet_MeanPoints = 0;
+  
+}
+
+void CGeometry::SetRotation_Normal(double rotMatrix[3][3]) {
+  unsigned long iEdge, iVertex;
+  unsigned short iMarker, iDim, jDim;
+  double Normal[3], rotNormal[3];
+  
+  /*--- Rotate the normals of the edges ---*/
+  
+  Normal[2] = 0.0;
+  for (iEdge = 0; iEdge < nEdge; iEdge++) {
+    edge[iEdge]->GetNormal(Normal);
+    for (iDim = 0; iDim < nDim; iDim++) {
+      rotNormal[iDim] = 0.0;
+      for (jDim = 0; jDim < 3; jDim++)
+        rotNormal[iDim] += rotMatrix[iDim][jDim]*Normal[jDim];
+    }
+    edge[iEdge]->SetNormal(rotNormal);
+  }
+  
+  /*--- Rotate the normals of the boundary vertices ---*/
+  
+  for (iMarker = 0; iMarker < nMarker; iMarker++)
+    for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++) {
+      vertex[iMarker][iVertex]->GetNormal(Normal);
+      for (iDim = 0; iDim < nDim; iDim++) {
+        rotNormal[iDim] = 0.0;
+        for (jDim = 0; jDim < 3; jDim++)
+          rotNormal[iDim] += rotMatrix[iDim][jDim]*Normal[jDim];
+      }
+      vertex[iMarker][iVertex]->SetNormal(rotNormal);
     }
+  
 }
 
 void CGeometry::SetFaces(void) {
@@ -399,13 +651,11 @@ void CGeometry::ComputeAirfoil_Section(double *Plane_P0, double *Plane_Normal, u
                                        bool original_surface, CConfig *config) {
   
   unsigned short iMarker, iNode, jNode, iDim, intersect;
-  long MinDist_Point, MinDistAngle_Point;
-  unsigned long iPoint, jPoint, iElem, Trailing_Point, Airfoil_Point, iVertex, jVertex;
-  double Segment_P0[3] = {0.0, 0.0, 0.0}, Segment_P1[3] = {0.0, 0.0, 0.0}, Variable_P0 = 0.0, Variable_P1 = 0.0, Intersection[3] = {0.0, 0.0, 0.0}, Trailing_Coord, MinDist_Value, MinDistAngle_Value, Dist_Value,
-  Airfoil_Tangent[3] = {0.0, 0.0, 0.0}, Segment[3] = {0.0, 0.0, 0.0}, Length, Angle_Value, MaxAngle = 30, *VarCoord = NULL, CosValue, Variable_Interp;
+  unsigned long iPoint, jPoint, iElem, iVertex;
+  double Segment_P0[3] = {0.0, 0.0, 0.0}, Segment_P1[3] = {0.0, 0.0, 0.0}, Variable_P0 = 0.0, Variable_P1 = 0.0, Intersection[3] = {0.0, 0.0, 0.0},
+  *VarCoord = NULL, Variable_Interp;
   vector<double> Xcoord, Ycoord, Zcoord, Variable;
-  vector<unsigned long> Duplicate;
-  vector<unsigned long>::iterator it;
+  vector<unsigned long> Order;
   int rank = MASTER_NODE;
   double **Coord_Variation = NULL;
   
@@ -572,126 +822,460 @@ void CGeometry::ComputeAirfoil_Section(double *Plane_P0, double *Plane_Normal, u
   
 #endif
   
-  if ((rank == MASTER_NODE) && (Xcoord.size() != 0)) {
+  if ((rank == MASTER_NODE) && (Xcoord.size() != 0))
+    SortAirfoil_Section(Xcoord, Ycoord, Zcoord, Variable, Xcoord_Airfoil, Ycoord_Airfoil,
+                        Zcoord_Airfoil, Variable_Airfoil, Order);
+  
+#ifdef HAVE_MPI
+  MPI_Barrier(MPI_COMM_WORLD);
+#endif
+  
+}
+
+void CGeometry::ComputeAirfoil_Sections(unsigned short nSection, double **Plane_P0, double **Plane_Normal,
+                                        double MinXCoord, double MaxXCoord, double *FlowVariable,
+                                        vector<double> *Xcoord_Airfoil, vector<double> *Ycoord_Airfoil,
+                                        vector<double> *Zcoord_Airfoil, vector<double> *Variable_Airfoil,
+                                        bool original_surface, CConfig *config) {
+  
+  unsigned short iMarker, iNode, jNode, iDim, iSection, intersect;
+  unsigned long iPoint, jPoint, iElem, iVertex, iSegment, iOrder;
+  double Segment_P0[3] = {0.0, 0.0, 0.0}, Segment_P1[3] = {0.0, 0.0, 0.0}, Variable_P0 = 0.0, Variable_P1 = 0.0, Intersection[3] = {0.0, 0.0, 0.0},
+  *VarCoord = NULL, Variable_Interp, Proj_P0, Proj_P1, Numerator, Denominator, Aux;
+  bool Parallel = true, Update = false, Sorted;
+  int rank = MASTER_NODE;
+  double **Coord_Variation = NULL;
+  CAirfoilSlicing *Slicing = NULL;
+  vector<unsigned long> Order;
+  vector<pair<double, unsigned short> > Plane_Offset;
+  vector<pair<double, unsigned short> >::iterator it;
+  
+#ifdef HAVE_MPI
+  unsigned long nLocalVertex, MaxLocalVertex, *Buffer_Send_nVertex, *Buffer_Receive_nVertex, nBuffer, iBuffer;
+  int nProcessor, iProcessor;
+  double *Buffer_Send_Coord, *Buffer_Receive_Coord = NULL;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+#endif
+  
+  /*--- Non parallel planes (or 2D) are sliced one by one ---*/
+  
+  for (iSection = 1; iSection < nSection; iSection++)
+    for (iDim = 0; iDim < 3; iDim++)
+      if (fabs(Plane_Normal[iSection][iDim] - Plane_Normal[0][iDim]) > EPS) Parallel = false;
+  
+  if ((nDim == 2) || (!Parallel) || (nSection == 0)) {
+    for (iSection = 0; iSection < nSection; iSection++)
+      ComputeAirfoil_Section(Plane_P0[iSection], Plane_Normal[iSection], iSection, MinXCoord, MaxXCoord, FlowVariable,
+                             Xcoord_Airfoil[iSection], Ycoord_Airfoil[iSection], Zcoord_Airfoil[iSection],
+                             Variable_Airfoil[iSection], original_surface, config);
+    return;
+  }
+  
+  vector<double> *Xcoord = new vector<double> [nSection];
+  vector<double> *Ycoord = new vector<double> [nSection];
+  vector<double> *Zcoord = new vector<double> [nSection];
+  vector<double> *Variable = new vector<double> [nSection];
+  
+  for (iSection = 0; iSection < nSection; iSection++) {
+    Xcoord_Airfoil[iSection].clear();
+    Ycoord_Airfoil[iSection].clear();
+    Zcoord_Airfoil[iSection].clear();
+    Variable_Airfoil[iSection].clear();
+  }
+  
+  /*--- Look for a stored slicing of this set of planes. The original surface is
+   always sliced (and stored), a deformed surface reuses the stored segments ---*/
+  
+  for (iSegment = 0; iSegment < AirfoilSlicing.size(); iSegment++)
+    if (AirfoilSlicing[iSegment]->Match(nSection, Plane_P0, Plane_Normal)) Slicing = AirfoilSlicing[iSegment];
+  
+  if (original_surface) {
+    if (Slicing == NULL) {
+      Slicing = new CAirfoilSlicing(nSection, Plane_P0, Plane_Normal);
+      AirfoilSlicing.push_back(Slicing);
+    }
+    else Slicing->Reset();
+  }
+  else Update = (Slicing != NULL);
+  
+  /*--- the grid variation is stored using a vertices information,
+   we should go from vertex to points ---*/
+  
+  if (original_surface == false) {
     
-    /*--- Create a list with the duplicated points ---*/
+    Coord_Variation = new double *[nPoint];
+    for (iPoint = 0; iPoint < nPoint; iPoint++) {
+      Coord_Variation[iPoint] = new double [nDim];
+      for (iDim = 0; iDim < nDim; iDim++)
+        Coord_Variation[iPoint][iDim] = 0.0;
+    }
     
-    for (iVertex = 0; iVertex < Xcoord.size()-1; iVertex++) {
-      for (jVertex = iVertex+1; jVertex < Xcoord.size(); jVertex++) {
-        Segment[0] = Xcoord[jVertex] - Xcoord[iVertex];
-        Segment[1] = Ycoord[jVertex] - Ycoord[iVertex];
-        Segment[2] = Zcoord[jVertex] - Zcoord[iVertex];
-        Dist_Value = sqrt(pow(Segment[0], 2.0) + pow(Segment[1], 2.0) + pow(Segment[2], 2.0));
-        if (Dist_Value < 1E-6) {
-          Duplicate.push_back (jVertex);
+    for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+      if (config->GetMarker_All_GeoEval(iMarker) == YES) {
+        for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++) {
+          VarCoord = vertex[iMarker][iVertex]->GetVarCoord();
+          iPoint = vertex[iMarker][iVertex]->GetNode();
+          for (iDim = 0; iDim < nDim; iDim++)
+            Coord_Variation[iPoint][iDim] = VarCoord[iDim];
         }
       }
     }
     
-    sort(Duplicate.begin(), Duplicate.end());
-    it = unique(Duplicate.begin(), Duplicate.end());
-    Duplicate.resize(it - Duplicate.begin());
+  }
+  
+  if (!Update) {
+    
+    /*--- Sorted position of the planes along the common normal ---*/
     
-    /*--- Remove duplicated points (starting from the back) ---*/
+    for (iSection = 0; iSection < nSection; iSection++)
+      Plane_Offset.push_back(make_pair(Plane_Normal[0][0]*Plane_P0[iSection][0] + Plane_Normal[0][1]*Plane_P0[iSection][1] +
+                                       Plane_Normal[0][2]*Plane_P0[iSection][2], iSection));
+    sort(Plane_Offset.begin(), Plane_Offset.end());
     
-    for (iVertex = Duplicate.size(); iVertex > 0; iVertex--) {
-      Xcoord.erase (Xcoord.begin() + Duplicate[iVertex-1]);
-      Ycoord.erase (Ycoord.begin() + Duplicate[iVertex-1]);
-      Zcoord.erase (Zcoord.begin() + Duplicate[iVertex-1]);
-      Variable.erase (Variable.begin() + Duplicate[iVertex-1]);
+    /*--- Single pass over the surface, each segment is only intersected
+     with the planes that lie between its end points ---*/
+    
+    for (iMarker = 0; iMarker < nMarker; iMarker++) {
+      if (config->GetMarker_All_GeoEval(iMarker) == YES) {
+        for (iElem = 0; iElem < nElem_Bound[iMarker]; iElem++) {
+          for(iNode = 0; iNode < bound[iMarker][iElem]->GetnNodes(); iNode++) {
+            iPoint = bound[iMarker][iElem]->GetNode(iNode);
+            for(jNode = 0; jNode < bound[iMarker][iElem]->GetnNodes(); jNode++) {
+              jPoint = bound[iMarker][iElem]->GetNode(jNode);
+              
+              if ((jPoint > iPoint) && ((node[iPoint]->GetCoord(0) > MinXCoord) && (node[iPoint]->GetCoord(0) < MaxXCoord))) {
+                
+                for (iDim = 0; iDim < nDim; iDim++) {
+                  if (original_surface == true) {
+                    Segment_P0[iDim] = node[iPoint]->GetCoord(iDim);
+                    Segment_P1[iDim] = node[jPoint]->GetCoord(iDim);
+                  }
+                  else {
+                    Segment_P0[iDim] = node[iPoint]->GetCoord(iDim) + Coord_Variation[iPoint][iDim];
+                    Segment_P1[iDim] = node[jPoint]->GetCoord(iDim) + Coord_Variation[jPoint][iDim];
+                  }
+                }
+                
+                if (FlowVariable != NULL) {
+                  Variable_P0 = FlowVariable[iPoint];
+                  Variable_P1 = FlowVariable[jPoint];
+                }
+                
+                Proj_P0 = Plane_Normal[0][0]*Segment_P0[0] + Plane_Normal[0][1]*Segment_P0[1] + Plane_Normal[0][2]*Segment_P0[2];
+                Proj_P1 = Plane_Normal[0][0]*Segment_P1[0] + Plane_Normal[0][1]*Segment_P1[1] + Plane_Normal[0][2]*Segment_P1[2];
+                
+                it = lower_bound(Plane_Offset.begin(), Plane_Offset.end(), make_pair(min(Proj_P0, Proj_P1), (unsigned short)0));
+                
+                for (; (it != Plane_Offset.end()) && (it->first <= max(Proj_P0, Proj_P1)); it++) {
+                  iSection = it->second;
+                  intersect = ComputeSegmentPlane_Intersection(Segment_P0, Segment_P1, Variable_P0, Variable_P1, Plane_P0[iSection],
+                                                               Plane_Normal[iSection], Intersection, Variable_Interp);
+                  if (intersect == 1) {
+                    Xcoord[iSection].push_back(Intersection[0]);
+                    Ycoord[iSection].push_back(Intersection[1]);
+                    Zcoord[iSection].push_back(Intersection[2]);
+                    Variable[iSection].push_back(Variable_Interp);
+                    if (Slicing != NULL) {
+                      Slicing->Segment[iSection].push_back(iPoint);
+                      Slicing->Segment[iSection].push_back(jPoint);
+                    }
+                  }
+                }
+                
+              }
+              
+            }
+          }
+        }
+      }
     }
     
-    if (Xcoord.size() != 1) {
-      
-      /*--- Find the trailing edge ---*/
-      
-      Trailing_Point = 0; Trailing_Coord = Xcoord[0];
-      for (iVertex = 1; iVertex < Xcoord.size(); iVertex++) {
-        if (Xcoord[iVertex] > Trailing_Coord) {
-          Trailing_Point = iVertex; Trailing_Coord = Xcoord[iVertex];
+  }
+  
+  else {
+    
+    /*--- Intersect the displaced segments of the stored slicing (same cut points,
+     and the same ordering of the airfoil as the original surface) ---*/
+    
+    for (iSection = 0; iSection < nSection; iSection++) {
+      for (iSegment = 0; iSegment < Slicing->Segment[iSection].size(); iSegment += 2) {
+        iPoint = Slicing->Segment[iSection][iSegment];
+        jPoint = Slicing->Segment[iSection][iSegment+1];
+        
+        for (iDim = 0; iDim < nDim; iDim++) {
+          Segment_P0[iDim] = node[iPoint]->GetCoord(iDim) + Coord_Variation[iPoint][iDim];
+          Segment_P1[iDim] = node[jPoint]->GetCoord(iDim) + Coord_Variation[jPoint][iDim];
+        }
+        
+        if (FlowVariable != NULL) {
+          Variable_P0 = FlowVariable[iPoint];
+          Variable_P1 = FlowVariable[jPoint];
+        }
+        
+        Numerator = 0.0; Denominator = 0.0;
+        for (iDim = 0; iDim < 3; iDim++) {
+          Numerator += Plane_Normal[iSection][iDim]*(Plane_P0[iSection][iDim] - Segment_P0[iDim]);
+          Denominator += Plane_Normal[iSection][iDim]*(Segment_P1[iDim] - Segment_P0[iDim]);
+        }
+        
+        if (fabs(Denominator) > 0.0) Aux = Numerator / Denominator;
+        else Aux = 0.5;
+        
+        Xcoord[iSection].push_back(Segment_P0[0] + Aux*(Segment_P1[0] - Segment_P0[0]));
+        Ycoord[iSection].push_back(Segment_P0[1] + Aux*(Segment_P1[1] - Segment_P0[1]));
+        Zcoord[iSection].push_back(Segment_P0[2] + Aux*(Segment_P1[2] - Segment_P0[2]));
+        Variable[iSection].push_back(Variable_P0 + Aux*(Variable_P1 - Variable_P0));
+      }
+    }
+    
+  }
+  
+  if (original_surface == false) {
+    
+    for (iPoint = 0; iPoint < nPoint; iPoint++)
+      delete [] Coord_Variation[iPoint];
+    delete [] Coord_Variation;
+    
+  }
+  
+#ifdef HAVE_MPI
+  
+  /*--- Copy the cut points of all the planes to the master node (single gather),
+   the points of each plane are kept in processor order ---*/
+  
+  MPI_Comm_size(MPI_COMM_WORLD, &nProcessor);
+  
+  Buffer_Send_nVertex = new unsigned long [nSection];
+  Buffer_Receive_nVertex = new unsigned long [nProcessor*nSection];
+  
+  nLocalVertex = 0;
+  for (iSection = 0; iSection < nSection; iSection++) {
+    Buffer_Send_nVertex[iSection] = Xcoord[iSection].size();
+    nLocalVertex += Xcoord[iSection].size();
+  }
+  
+  MPI_Allreduce(&nLocalVertex, &MaxLocalVertex, 1, MPI_UNSIGNED_LONG, MPI_MAX, MPI_COMM_WORLD);
+  MPI_Allgather(Buffer_Send_nVertex, nSection, MPI_UNSIGNED_LONG, Buffer_Receive_nVertex, nSection, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+  
+  nBuffer = MaxLocalVertex*4;
+  Buffer_Send_Coord = new double [nBuffer];
+  if (rank == MASTER_NODE) Buffer_Receive_Coord = new double [nProcessor*nBuffer];
+  
+  iBuffer = 0;
+  for (iSection = 0; iSection < nSection; iSection++) {
+    for (iVertex = 0; iVertex < Xcoord[iSection].size(); iVertex++) {
+      Buffer_Send_Coord[iBuffer + 0] = Xcoord[iSection][iVertex];
+      Buffer_Send_Coord[iBuffer + 1] = Ycoord[iSection][iVertex];
+      Buffer_Send_Coord[iBuffer + 2] = Zcoord[iSection][iVertex];
+      Buffer_Send_Coord[iBuffer + 3] = Variable[iSection][iVertex];
+      iBuffer += 4;
+    }
+    Xcoord[iSection].clear(); Ycoord[iSection].clear(); Zcoord[iSection].clear(); Variable[iSection].clear();
+  }
+  
+  MPI_Gather(Buffer_Send_Coord, nBuffer, MPI_DOUBLE, Buffer_Receive_Coord, nBuffer, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+  
+  if (rank == MASTER_NODE) {
+    for (iProcessor = 0; iProcessor < nProcessor; iProcessor++) {
+      iBuffer = iProcessor*nBuffer;
+      for (iSection = 0; iSection < nSection; iSection++) {
+        for (iVertex = 0; iVertex < Buffer_Receive_nVertex[iProcessor*nSection + iSection]; iVertex++) {
+          Xcoord[iSection].push_back(Buffer_Receive_Coord[iBuffer + 0]);
+          Ycoord[iSection].push_back(Buffer_Receive_Coord[iBuffer + 1]);
+          Zcoord[iSection].push_back(Buffer_Receive_Coord[iBuffer + 2]);
+          Variable[iSection].push_back(Buffer_Receive_Coord[iBuffer + 3]);
+          iBuffer += 4;
+        }
+      }
+    }
+    delete[] Buffer_Receive_Coord;
+  }
+  
+  delete[] Buffer_Send_Coord;
+  delete[] Buffer_Send_nVertex; delete[] Buffer_Receive_nVertex;
+  
+#endif
+  
+  /*--- Order the points of each airfoil (or reuse the stored ordering) ---*/
+  
+  if (rank == MASTER_NODE) {
+    for (iSection = 0; iSection < nSection; iSection++) {
+      
+      if (Xcoord[iSection].size() == 0) continue;
+      
+      Sorted = false;
+      if (Update && (Slicing->Order[iSection].size() != 0)) {
+        Sorted = true;
+        for (iOrder = 0; iOrder < Slicing->Order[iSection].size(); iOrder++)
+          if (Slicing->Order[iSection][iOrder] >= Xcoord[iSection].size()) Sorted = false;
+        if (Sorted) {
+          for (iOrder = 0; iOrder < Slicing->Order[iSection].size(); iOrder++) {
+            iVertex = Slicing->Order[iSection][iOrder];
+            Xcoord_Airfoil[iSection].push_back(Xcoord[iSection][iVertex]);
+            Ycoord_Airfoil[iSection].push_back(Ycoord[iSection][iVertex]);
+            Zcoord_Airfoil[iSection].push_back(Zcoord[iSection][iVertex]);
+            Variable_Airfoil[iSection].push_back(Variable[iSection][iVertex]);
+          }
         }
       }
       
-      /*--- Add the trailing edge to the list, and remove from the original list ---*/
-      Xcoord_Airfoil.push_back(Xcoord[Trailing_Point]); Ycoord_Airfoil.push_back(Ycoord[Trailing_Point]); Zcoord_Airfoil.push_back(Zcoord[Trailing_Point]); Variable_Airfoil.push_back(Variable[Trailing_Point]);
-      Xcoord.erase (Xcoord.begin() + Trailing_Point); Ycoord.erase (Ycoord.begin() + Trailing_Point); Zcoord.erase (Zcoord.begin() + Trailing_Point); Variable.erase (Variable.begin() + Trailing_Point);
+      if (!Sorted) {
+        if ((Slicing != NULL) && (!Update))
+          SortAirfoil_Section(Xcoord[iSection], Ycoord[iSection], Zcoord[iSection], Variable[iSection], Xcoord_Airfoil[iSection],
+                              Ycoord_Airfoil[iSection], Zcoord_Airfoil[iSection], Variable_Airfoil[iSection], Slicing->Order[iSection]);
+        else {
+          Order.clear();
+          SortAirfoil_Section(Xcoord[iSection], Ycoord[iSection], Zcoord[iSection], Variable[iSection], Xcoord_Airfoil[iSection],
+                              Ycoord_Airfoil[iSection], Zcoord_Airfoil[iSection], Variable_Airfoil[iSection], Order);
+        }
+      }
       
-      /*--- Find the next point using the right hand side rule ---*/
-      MinDist_Value = 1E6; MinDist_Point = 0;
-      for (iVertex = 0; iVertex < Xcoord.size(); iVertex++) {
-        Segment[0] = Xcoord[iVertex] - Xcoord_Airfoil[0];
-        Segment[1] = Ycoord[iVertex] - Ycoord_Airfoil[0];
-        Segment[2] = Zcoord[iVertex] - Zcoord_Airfoil[0];
-        Dist_Value = sqrt(pow(Segment[0], 2.0) + pow(Segment[1], 2.0) + pow(Segment[2], 2.0));
-        Segment[0] /= Dist_Value; Segment[1] /= Dist_Value; Segment[2] /= Dist_Value;
-        
-        if ((Dist_Value < MinDist_Value) && (Segment[2] > 0.0)) { MinDist_Point = iVertex; MinDist_Value = Dist_Value; }
+    }
+  }
+  
+  delete [] Xcoord; delete [] Ycoord; delete [] Zcoord; delete [] Variable;
+  
+#ifdef HAVE_MPI
+  MPI_Barrier(MPI_COMM_WORLD);
+#endif
+  
+}
+
+void CGeometry::SortAirfoil_Section(vector<double> &Xcoord, vector<double> &Ycoord, vector<double> &Zcoord, vector<double> &Variable,
+                                    vector<double> &Xcoord_Airfoil, vector<double> &Ycoord_Airfoil, vector<double> &Zcoord_Airfoil,
+                                    vector<double> &Variable_Airfoil, vector<unsigned long> &Order) {
+  
+  long MinDist_Point, MinDistAngle_Point;
+  unsigned long Trailing_Point, Airfoil_Point, iVertex, jVertex;
+  double Trailing_Coord, MinDist_Value, MinDistAngle_Value, Dist_Value, Airfoil_Tangent[3] = {0.0, 0.0, 0.0},
+  Segment[3] = {0.0, 0.0, 0.0}, Length, Angle_Value, MaxAngle = 30, CosValue;
+  vector<unsigned long> Duplicate, Index;
+  vector<unsigned long>::iterator it;
+  
+  Order.clear();
+  if (Xcoord.size() == 0) return;
+  
+  /*--- Index of each cut point, to keep track of the ordering ---*/
+  
+  for (iVertex = 0; iVertex < Xcoord.size(); iVertex++)
+    Index.push_back(iVertex);
+  
+  
+  /*--- Create a list with the duplicated points ---*/
+  
+  for (iVertex = 0; iVertex < Xcoord.size()-1; iVertex++) {
+    for (jVertex = iVertex+1; jVertex < Xcoord.size(); jVertex++) {
+      Segment[0] = Xcoord[jVertex] - Xcoord[iVertex];
+      Segment[1] = Ycoord[jVertex] - Ycoord[iVertex];
+      Segment[2] = Zcoord[jVertex] - Zcoord[iVertex];
+      Dist_Value = sqrt(pow(Segment[0], 2.0) + pow(Segment[1], 2.0) + pow(Segment[2], 2.0));
+      if (Dist_Value < 1E-6) {
+        Duplicate.push_back (jVertex);
+      }
+    }
+  }
+  
+  sort(Duplicate.begin(), Duplicate.end());
+  it = unique(Duplicate.begin(), Duplicate.end());
+  Duplicate.resize(it - Duplicate.begin());
+  
+  /*--- Remove duplicated points (starting from the back) ---*/
+  
+  for (iVertex = Duplicate.size(); iVertex > 0; iVertex--) {
+    Xcoord.erase (Xcoord.begin() + Duplicate[iVertex-1]);
+    Ycoord.erase (Ycoord.begin() + Duplicate[iVertex-1]);
+    Zcoord.erase (Zcoord.begin() + Duplicate[iVertex-1]);
+    Variable.erase (Variable.begin() + Duplicate[iVertex-1]);
+    Index.erase (Index.begin() + Duplicate[iVertex-1]);
+  }
+  
+  if (Xcoord.size() != 1) {
+    
+    /*--- Find the trailing edge ---*/
+    
+    Trailing_Point = 0; Trailing_Coord = Xcoord[0];
+    for (iVertex = 1; iVertex < Xcoord.size(); iVertex++) {
+      if (Xcoord[iVertex] > Trailing_Coord) {
+        Trailing_Point = iVertex; Trailing_Coord = Xcoord[iVertex];
       }
+    }
+    
+    /*--- Add the trailing edge to the list, and remove from the original list ---*/
+    Order.push_back(Index[Trailing_Point]); Index.erase (Index.begin() + Trailing_Point);
+    Xcoord_Airfoil.push_back(Xcoord[Trailing_Point]); Ycoord_Airfoil.push_back(Ycoord[Trailing_Point]); Zcoord_Airfoil.push_back(Zcoord[Trailing_Point]); Variable_Airfoil.push_back(Variable[Trailing_Point]);
+    Xcoord.erase (Xcoord.begin() + Trailing_Point); Ycoord.erase (Ycoord.begin() + Trailing_Point); Zcoord.erase (Zcoord.begin() + Trailing_Point); Variable.erase (Variable.begin() + Trailing_Point);
+    
+    /*--- Find the next point using the right hand side rule ---*/
+    MinDist_Value = 1E6; MinDist_Point = 0;
+    for (iVertex = 0; iVertex < Xcoord.size(); iVertex++) {
+      Segment[0] = Xcoord[iVertex] - Xcoord_Airfoil[0];
+      Segment[1] = Ycoord[iVertex] - Ycoord_Airfoil[0];
+      Segment[2] = Zcoord[iVertex] - Zcoord_Airfoil[0];
+      Dist_Value = sqrt(pow(Segment[0], 2.0) + pow(Segment[1], 2.0) + pow(Segment[2], 2.0));
+      Segment[0] /= Dist_Value; Segment[1] /= Dist_Value; Segment[2] /= Dist_Value;
+      
+      if ((Dist_Value < MinDist_Value) && (Segment[2] > 0.0)) { MinDist_Point = iVertex; MinDist_Value = Dist_Value; }
+    }
+    
+    Order.push_back(Index[MinDist_Point]); Index.erase (Index.begin() + MinDist_Point);
+    Xcoord_Airfoil.push_back(Xcoord[MinDist_Point]);  Ycoord_Airfoil.push_back(Ycoord[MinDist_Point]);  Zcoord_Airfoil.push_back(Zcoord[MinDist_Point]);  Variable_Airfoil.push_back(Variable[MinDist_Point]);
+    Xcoord.erase (Xcoord.begin() + MinDist_Point);    Ycoord.erase (Ycoord.begin() + MinDist_Point);    Zcoord.erase (Zcoord.begin() + MinDist_Point);    Variable.erase (Variable.begin() + MinDist_Point);
+    
+    /*--- Algorithm for the rest of the points ---*/
+    do {
       
-      Xcoord_Airfoil.push_back(Xcoord[MinDist_Point]);  Ycoord_Airfoil.push_back(Ycoord[MinDist_Point]);  Zcoord_Airfoil.push_back(Zcoord[MinDist_Point]);  Variable_Airfoil.push_back(Variable[MinDist_Point]);
-      Xcoord.erase (Xcoord.begin() + MinDist_Point);    Ycoord.erase (Ycoord.begin() + MinDist_Point);    Zcoord.erase (Zcoord.begin() + MinDist_Point);    Variable.erase (Variable.begin() + MinDist_Point);
+      /*--- Last added point in the list ---*/
+      Airfoil_Point = Xcoord_Airfoil.size() - 1;
       
-      /*--- Algorithm for the rest of the points ---*/
-      do {
+      /*--- Compute the slope of the curve ---*/
+      Airfoil_Tangent[0] = Xcoord_Airfoil[Airfoil_Point] - Xcoord_Airfoil[Airfoil_Point-1];
+      Airfoil_Tangent[1] = Ycoord_Airfoil[Airfoil_Point] - Ycoord_Airfoil[Airfoil_Point-1];
+      Airfoil_Tangent[2] = Zcoord_Airfoil[Airfoil_Point] - Zcoord_Airfoil[Airfoil_Point-1];
+      Length = sqrt(pow(Airfoil_Tangent[0], 2.0) + pow(Airfoil_Tangent[1], 2.0) + pow(Airfoil_Tangent[2], 2.0));
+      Airfoil_Tangent[0] /= Length; Airfoil_Tangent[1] /= Length; Airfoil_Tangent[2] /= Length;
+      
+      /*--- Find the closest point with the right slope ---*/
+      MinDist_Value = 1E6; MinDistAngle_Value = 180;
+      MinDist_Point = -1; MinDistAngle_Point = -1;
+      for (iVertex = 0; iVertex < Xcoord.size(); iVertex++) {
         
-        /*--- Last added point in the list ---*/
-        Airfoil_Point = Xcoord_Airfoil.size() - 1;
+        Segment[0] = Xcoord[iVertex] - Xcoord_Airfoil[Airfoil_Point];
+        Segment[1] = Ycoord[iVertex] - Ycoord_Airfoil[Airfoil_Point];
+        Segment[2] = Zcoord[iVertex] - Zcoord_Airfoil[Airfoil_Point];
         
-        /*--- Compute the slope of the curve ---*/
-        Airfoil_Tangent[0] = Xcoord_Airfoil[Airfoil_Point] - Xcoord_Airfoil[Airfoil_Point-1];
-        Airfoil_Tangent[1] = Ycoord_Airfoil[Airfoil_Point] - Ycoord_Airfoil[Airfoil_Point-1];
-        Airfoil_Tangent[2] = Zcoord_Airfoil[Airfoil_Point] - Zcoord_Airfoil[Airfoil_Point-1];
-        Length = sqrt(pow(Airfoil_Tangent[0], 2.0) + pow(Airfoil_Tangent[1], 2.0) + pow(Airfoil_Tangent[2], 2.0));
-        Airfoil_Tangent[0] /= Length; Airfoil_Tangent[1] /= Length; Airfoil_Tangent[2] /= Length;
+        /*--- Compute the distance to each point ---*/
+        Dist_Value = sqrt(pow(Segment[0], 2.0) + pow(Segment[1], 2.0) + pow(Segment[2], 2.0));
         
-        /*--- Find the closest point with the right slope ---*/
-        MinDist_Value = 1E6; MinDistAngle_Value = 180;
-        MinDist_Point = -1; MinDistAngle_Point = -1;
-        for (iVertex = 0; iVertex < Xcoord.size(); iVertex++) {
-          
-          Segment[0] = Xcoord[iVertex] - Xcoord_Airfoil[Airfoil_Point];
-          Segment[1] = Ycoord[iVertex] - Ycoord_Airfoil[Airfoil_Point];
-          Segment[2] = Zcoord[iVertex] - Zcoord_Airfoil[Airfoil_Point];
-          
-          /*--- Compute the distance to each point ---*/
-          Dist_Value = sqrt(pow(Segment[0], 2.0) + pow(Segment[1], 2.0) + pow(Segment[2], 2.0));
-          
-          /*--- Compute the angle of the point ---*/
-          Segment[0] /= Dist_Value; Segment[1] /= Dist_Value; Segment[2] /= Dist_Value;
-          
-          /*--- Clip the value of the cosine, this is important due to the round errors ---*/
-          CosValue = Airfoil_Tangent[0]*Segment[0] + Airfoil_Tangent[1]*Segment[1] + Airfoil_Tangent[2]*Segment[2];
-          if (CosValue >= 1.0) CosValue = 1.0;
-          if (CosValue <= -1.0) CosValue = -1.0;
-          
-          Angle_Value = acos(CosValue) * 180 / PI_NUMBER;
-          
-          if (Dist_Value < MinDist_Value) { MinDist_Point = iVertex; MinDist_Value = Dist_Value; }
-          if ((Dist_Value < MinDistAngle_Value) && (Angle_Value < MaxAngle)) {MinDistAngle_Point = iVertex; MinDistAngle_Value = Dist_Value;}
-          
-        }
+        /*--- Compute the angle of the point ---*/
+        Segment[0] /= Dist_Value; Segment[1] /= Dist_Value; Segment[2] /= Dist_Value;
         
-        if ( MinDistAngle_Point != -1) MinDist_Point = MinDistAngle_Point;
+        /*--- Clip the value of the cosine, this is important due to the round errors ---*/
+        CosValue = Airfoil_Tangent[0]*Segment[0] + Airfoil_Tangent[1]*Segment[1] + Airfoil_Tangent[2]*Segment[2];
+        if (CosValue >= 1.0) CosValue = 1.0;
+        if (CosValue <= -1.0) CosValue = -1.0;
         
-        /*--- Add and remove the min distance to the list ---*/
-        Xcoord_Airfoil.push_back(Xcoord[MinDist_Point]);  Ycoord_Airfoil.push_back(Ycoord[MinDist_Point]);  Zcoord_Airfoil.push_back(Zcoord[MinDist_Point]);    Variable_Airfoil.push_back(Variable[MinDist_Point]);
-        Xcoord.erase(Xcoord.begin() + MinDist_Point);     Ycoord.erase(Ycoord.begin() + MinDist_Point);     Zcoord.erase(Zcoord.begin() + MinDist_Point);       Variable.erase(Variable.begin() + MinDist_Point);
+        Angle_Value = acos(CosValue) * 180 / PI_NUMBER;
         
-      } while (Xcoord.size() != 0);
+        if (Dist_Value < MinDist_Value) { MinDist_Point = iVertex; MinDist_Value = Dist_Value; }
+        if ((Dist_Value < MinDistAngle_Value) && (Angle_Value < MaxAngle)) {MinDistAngle_Point = iVertex; MinDistAngle_Value = Dist_Value;}
+        
+      }
       
-      /*--- Clean the vector before using them again for storing the upper or the lower side ---*/
+      if ( MinDistAngle_Point != -1) MinDist_Point = MinDistAngle_Point;
       
-      Xcoord.clear(); Ycoord.clear(); Zcoord.clear(); Variable.clear();
+      /*--- Add and remove the min distance to the list ---*/
+      Order.push_back(Index[MinDist_Point]); Index.erase (Index.begin() + MinDist_Point);
+      Xcoord_Airfoil.push_back(Xcoord[MinDist_Point]);  Ycoord_Airfoil.push_back(Ycoord[MinDist_Point]);  Zcoord_Airfoil.push_back(Zcoord[MinDist_Point]);    Variable_Airfoil.push_back(Variable[MinDist_Point]);
+      Xcoord.erase(Xcoord.begin() + MinDist_Point);     Ycoord.erase(Ycoord.begin() + MinDist_Point);     Zcoord.erase(Zcoord.begin() + MinDist_Point);       Variable.erase(Variable.begin() + MinDist_Point);
       
-    }
+    } while (Xcoord.size() != 0);
     
+    /*--- Clean the vector before using them again for storing the upper or the lower side ---*/
     
-  }
-  
-#ifdef HAVE_MPI
-  MPI_Barrier(MPI_COMM_WORLD);
-#endif
-  
+    Xcoord.clear(); Ycoord.clear(); Zcoord.clear(); Variable.clear();
+    
+  }
+
 }
 
 void CGeometry::ComputeSurf_Curvature(CConfig *config) {
@@ -1088,7 +1672,259 @@ void CGeometry::ComputeSurf_Curvature(CConfig *config) {
   
 }
 
-CPhysicalGeometry::CPhysicalGeometry() : CGeometry() {}
+/*--- Add a block of bytes to a 64-bit FNV-1a hash ---*/
+
+static void AddHash_Bytes(unsigned long &Hash, const void *val_data, unsigned long val_size) {
+  const unsigned char *Data = static_cast<const unsigned char *>(val_data);
+  for (unsigned long iByte = 0; iByte < val_size; iByte++) {
+    Hash ^= (unsigned long)Data[iByte];
+    Hash *= 1099511628211UL;
+  }
+}
+
+unsigned long CGeometry::GetGeometry_Hash(CConfig *config) {
+  unsigned long iPoint, iElem, Data, Hash = 14695981039346656037UL;
+  unsigned short iMarker, iNode, nNode, Kind;
+  string Marker_Tag;
+  
+  /*--- Cache version and size of the primal grid ---*/
+  
+  Data = GEOMETRY_CACHE_VERSION; AddHash_Bytes(Hash, &Data, sizeof(unsigned long));
+  AddHash_Bytes(Hash, &nDim, sizeof(unsigned short));
+  AddHash_Bytes(Hash, &nPoint, sizeof(unsigned long));
+  AddHash_Bytes(Hash, &nPointDomain, sizeof(unsigned long));
+  AddHash_Bytes(Hash, &nElem, sizeof(unsigned long));
+  AddHash_Bytes(Hash, &nMarker, sizeof(unsigned short));
+  
+  /*--- Coordinates and global index of the points ---*/
+  
+  for (iPoint = 0; iPoint < nPoint; iPoint++) {
+    AddHash_Bytes(Hash, node[iPoint]->GetCoord(), nDim*sizeof(double));
+    Data = node[iPoint]->GetGlobalIndex(); AddHash_Bytes(Hash, &Data, sizeof(unsigned long));
+  }
+  
+  /*--- Interior elements (after the orientation checks) ---*/
+  
+  for (iElem = 0; iElem < nElem; iElem++) {
+    Kind = elem[iElem]->GetVTK_Type(); AddHash_Bytes(Hash, &Kind, sizeof(unsigned short));
+    nNode = elem[iElem]->GetnNodes();
+    for (iNode = 0; iNode < nNode; iNode++) {
+      Data = elem[iElem]->GetNode(iNode); AddHash_Bytes(Hash, &Data, sizeof(unsigned long));
+    }
+  }
+  
+  /*--- Markers, boundary conditions and boundary elements ---*/
+  
+  for (iMarker = 0; iMarker < nMarker; iMarker++) {
+    Marker_Tag = config->GetMarker_All_TagBound(iMarker);
+    AddHash_Bytes(Hash, Marker_Tag.c_str(), Marker_Tag.size());
+    Kind = config->GetMarker_All_KindBC(iMarker); AddHash_Bytes(Hash, &Kind, sizeof(unsigned short));
+    Data = config->GetMarker_All_SendRecv(iMarker); AddHash_Bytes(Hash, &Data, sizeof(unsigned long));
+    AddHash_Bytes(Hash, &nElem_Bound[iMarker], sizeof(unsigned long));
+    for (iElem = 0; iElem < nElem_Bound[iMarker]; iElem++) {
+      Kind = bound[iMarker][iElem]->GetRotation_Type(); AddHash_Bytes(Hash, &Kind, sizeof(unsigned short));
+      nNode = bound[iMarker][iElem]->GetnNodes();
+      for (iNode = 0; iNode < nNode; iNode++) {
+        Data = bound[iMarker][iElem]->GetNode(iNode); AddHash_Bytes(Hash, &Data, sizeof(unsigned long));
+      }
+    }
+  }
+  
+  /*--- Options that change the multigrid agglomeration ---*/
+  
+  Kind = config->GetMGLevels(); AddHash_Bytes(Hash, &Kind, sizeof(unsigned short));
+  
+  return Hash;
+  
+}
+
+void CGeometry::WriteCache_Header(ofstream &cache_file, CConfig *config, unsigned long val_hash, unsigned short val_nMGLevels) {
+  unsigned long Header[5];
+  double DomainVolume = config->GetDomainVolume();
+  
+  Header[0] = GEOMETRY_CACHE_VERSION;
+  Header[1] = sizeof(unsigned long);
+  Header[2] = sizeof(double);
+  Header[3] = val_hash;
+  Header[4] = val_nMGLevels;
+  
+  cache_file.write("SU2GEOM", 8);
+  cache_file.write((char *)Header, 5*sizeof(unsigned long));
+  cache_file.write((char *)&DomainVolume, sizeof(double));
+  
+}
+
+bool CGeometry::ReadCache_Header(ifstream &cache_file, CConfig *config, unsigned long val_hash, unsigned short &val_nMGLevels) {
+  char Magic[8];
+  unsigned long Header[5];
+  double DomainVolume;
+  
+  cache_file.read(Magic, 8);
+  if (!cache_file.good() || (strncmp(Magic, "SU2GEOM", 8) != 0)) return false;
+  
+  /*--- The version and the size of the types must match before trusting the hash ---*/
+  
+  cache_file.read((char *)Header, 2*sizeof(unsigned long));
+  if (!cache_file.good() || (Header[0] != GEOMETRY_CACHE_VERSION) || (Header[1] != sizeof(unsigned long))) return false;
+  cache_file.read((char *)&Header[2], 3*sizeof(unsigned long));
+  cache_file.read((char *)&DomainVolume, sizeof(double));
+  if (!cache_file.good() || (Header[2] != sizeof(double)) || (Header[3] != val_hash)) return false;
+  
+  val_nMGLevels = (unsigned short)Header[4];
+  config->SetDomainVolume(DomainVolume);
+  
+  return true;
+  
+}
+
+void CGeometry::WriteCache_DualGrid(ofstream &cache_file) {
+  unsigned long iPoint, iEdge, iVertex, Data[3];
+  unsigned short iMarker, iNeigh, nNeigh;
+  long Edge;
+  double Volume;
+  
+  /*--- Sizes of the level ---*/
+  
+  Data[0] = nPoint; Data[1] = nEdge; Data[2] = nMarker;
+  cache_file.write((char *)Data, 3*sizeof(unsigned long));
+  for (iMarker = 0; iMarker < nMarker; iMarker++)
+    cache_file.write((char *)&nVertex[iMarker], sizeof(unsigned long));
+  
+  /*--- Edges surrounding each point and control volumes ---*/
+  
+  for (iPoint = 0; iPoint < nPoint; iPoint++) {
+    nNeigh = node[iPoint]->GetnPoint();
+    cache_file.write((char *)&nNeigh, sizeof(unsigned short));
+    for (iNeigh = 0; iNeigh < nNeigh; iNeigh++) {
+      Edge = node[iPoint]->GetEdge(iNeigh);
+      cache_file.write((char *)&Edge, sizeof(long));
+    }
+    Volume = node[iPoint]->GetVolume();
+    cache_file.write((char *)&Volume, sizeof(double));
+  }
+  
+  /*--- Edges and dual faces ---*/
+  
+  for (iEdge = 0; iEdge < nEdge; iEdge++) {
+    Data[0] = edge[iEdge]->GetNode(0); Data[1] = edge[iEdge]->GetNode(1);
+    cache_file.write((char *)Data, 2*sizeof(unsigned long));
+    cache_file.write((char *)edge[iEdge]->GetNormal(), nDim*sizeof(double));
+  }
+  
+  /*--- Boundary normals and closest normal neighbors ---*/
+  
+  for (iMarker = 0; iMarker < nMarker; iMarker++)
+    for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++) {
+      Data[0] = vertex[iMarker][iVertex]->GetNode();
+      Data[1] = vertex[iMarker][iVertex]->GetNormal_Neighbor();
+      cache_file.write((char *)Data, 2*sizeof(unsigned long));
+      cache_file.write((char *)vertex[iMarker][iVertex]->GetNormal(), nDim*sizeof(double));
+    }
+  
+}
+
+bool CGeometry::ReadCache_DualGrid(ifstream &cache_file) {
+  unsigned long iPoint, iEdge, iVertex, Data[3], Cache_nEdge, iData;
+  unsigned short iMarker, iNeigh, nNeigh;
+  bool Consistent = true;
+  
+  /*--- Sizes of the level ---*/
+  
+  cache_file.read((char *)Data, 3*sizeof(unsigned long));
+  if (!cache_file.good() || (Data[0] != nPoint) || (Data[2] != nMarker)) return false;
+  Cache_nEdge = Data[1];
+  
+  vector<unsigned long> Cache_nVertex(nMarker);
+  for (iMarker = 0; iMarker < nMarker; iMarker++) {
+    cache_file.read((char *)&Cache_nVertex[iMarker], sizeof(unsigned long));
+    if (Cache_nVertex[iMarker] != nVertex[iMarker]) Consistent = false;
+  }
+  if (!cache_file.good() || !Consistent) return false;
+  
+  /*--- Read everything into buffers, the geometry is only modified once
+   the whole level has been checked against the current connectivity ---*/
+  
+  vector<long> Point_Edge;
+  vector<double> Point_Volume(nPoint);
+  for (iPoint = 0; iPoint < nPoint; iPoint++) {
+    cache_file.read((char *)&nNeigh, sizeof(unsigned short));
+    if (!cache_file.good() || (nNeigh != node[iPoint]->GetnPoint())) return false;
+    for (iNeigh = 0; iNeigh < nNeigh; iNeigh++) {
+      long Edge;
+      cache_file.read((char *)&Edge, sizeof(long));
+      if ((Edge < 0) || ((unsigned long)Edge >= Cache_nEdge)) Consistent = false;
+      Point_Edge.push_back(Edge);
+    }
+    cache_file.read((char *)&Point_Volume[iPoint], sizeof(double));
+  }
+  if (!cache_file.good() || !Consistent) return false;
+  
+  vector<unsigned long> Edge_Node(2*Cache_nEdge);
+  vector<double> Edge_Normal(nDim*Cache_nEdge);
+  for (iEdge = 0; iEdge < Cache_nEdge; iEdge++) {
+    cache_file.read((char *)&Edge_Node[2*iEdge], 2*sizeof(unsigned long));
+    cache_file.read((char *)&Edge_Normal[nDim*iEdge], nDim*sizeof(double));
+    if ((Edge_Node[2*iEdge] >= nPoint) || (Edge_Node[2*iEdge+1] >= nPoint)) Consistent = false;
+  }
+  if (!cache_file.good() || !Consistent) return false;
+  
+  unsigned long Total_nVertex = 0;
+  for (iMarker = 0; iMarker < nMarker; iMarker++) Total_nVertex += nVertex[iMarker];
+  vector<unsigned long> Vertex_Neighbor(Total_nVertex);
+  vector<double> Vertex_Normal(nDim*Total_nVertex);
+  iData = 0;
+  for (iMarker = 0; iMarker < nMarker; iMarker++)
+    for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++) {
+      cache_file.read((char *)Data, 2*sizeof(unsigned long));
+      cache_file.read((char *)&Vertex_Normal[nDim*iData], nDim*sizeof(double));
+      if (Data[0] != vertex[iMarker][iVertex]->GetNode()) Consistent = false;
+      Vertex_Neighbor[iData] = Data[1];
+      iData++;
+    }
+  if (!cache_file.good() || !Consistent) return false;
+  
+  /*--- Edge structure ---*/
+  
+  nEdge = Cache_nEdge;
+  edge = new CEdge*[nEdge];
+  for (iEdge = 0; iEdge < nEdge; iEdge++) {
+    edge[iEdge] = new CEdge(Edge_Node[2*iEdge], Edge_Node[2*iEdge+1], nDim);
+    edge[iEdge]->SetNormal(&Edge_Normal[nDim*iEdge]);
+  }
+  
+  /*--- Edges surrounding the points and control volumes ---*/
+  
+  iData = 0;
+  for (iPoint = 0; iPoint < nPoint; iPoint++) {
+    for (iNeigh = 0; iNeigh < node[iPoint]->GetnPoint(); iNeigh++)
+      node[iPoint]->SetEdge(Point_Edge[iData++], iNeigh);
+    node[iPoint]->SetVolume(Point_Volume[iPoint]);
+  }
+  
+  /*--- Boundary normals and closest normal neighbors ---*/
+  
+  iData = 0;
+  for (iMarker = 0; iMarker < nMarker; iMarker++)
+    for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++) {
+      vertex[iMarker][iVertex]->SetNormal(&Vertex_Normal[nDim*iData]);
+      vertex[iMarker][iVertex]->SetNormal_Neighbor(Vertex_Neighbor[iData]);
+      iData++;
+    }
+  
+  SetEdge_Map();
+  
+  return true;
+  
+}
+
+CPhysicalGeometry::CPhysicalGeometry() : CGeometry() {
+  
+  Global_to_Local_Point  = NULL;
+  Local_to_Global_Point  = NULL;
+  Global_to_Local_Marker = NULL;
+  Local_to_Global_Marker = NULL;
+  
+}
 
 CPhysicalGeometry::CPhysicalGeometry(CConfig *config, unsigned short val_iZone, unsigned short val_nZone) : CGeometry() {
   
@@ -1100,6 +1936,11 @@ CPhysicalGeometry::CPhysicalGeometry(CConfig *config, unsigned short val_iZone,
   int rank = MASTER_NODE;
   nZone = val_nZone;
   
+  Global_to_Local_Point  = NULL;
+  Local_to_Global_Point  = NULL;
+  Global_to_Local_Marker = NULL;
+  Local_to_Global_Marker = NULL;
+  
   string val_mesh_filename = config->GetMesh_FileName();
   unsigned short val_format = config->GetMesh_FileFormat();
   
@@ -1206,6 +2047,11 @@ CPhysicalGeometry::CPhysicalGeometry(CGeometry *geometry, CConfig *config) {
   int rank = MASTER_NODE;
   int size = SINGLE_NODE;
   
+  Global_to_Local_Point  = NULL;
+  Local_to_Global_Point  = NULL;
+  Global_to_Local_Marker = NULL;
+  Local_to_Global_Marker = NULL;
+  
 #ifdef HAVE_MPI
   
   /*--- MPI initialization ---*/
@@ -5634,8 +6480,9 @@ void CPhysicalGeometry::SetPositive_ZArea(CConfig *config) {
 
 void CPhysicalGeometry::SetPoint_Connectivity(void) {
   
-  unsigned short Node_Neighbor, iNode, iNeighbor;
-  unsigned long jElem, Point_Neighbor, iPoint, iElem;
+  unsigned short Node_Neighbor, iNode, iNeighbor, nNeighbor;
+  unsigned long iPoint, iElem;
+  vector<unsigned long> Point_Ptr, Point_Adj, Point_Fill;
   
   /*--- Loop over all the elements ---*/
   for(iElem = 0; iElem < nElem; iElem++)
@@ -5646,34 +6493,40 @@ void CPhysicalGeometry::SetPoint_Connectivity(void) {
       node[iPoint]->SetElem(iElem);
     }
 
-  /*--- Loop over all the points ---*/
+  /*--- Points surrounding points, stored as a CSR graph built with two
+   sweeps over the elements (count and fill). A neighbor shared by several
+   elements is repeated, the rows are sorted and compacted afterwards ---*/
+  
+  Point_Ptr.assign(nPoint+1, 0);
+  for(iElem = 0; iElem < nElem; iElem++)
+    for(iNode = 0; iNode < elem[iElem]->GetnNodes(); iNode++)
+      Point_Ptr[elem[iElem]->GetNode(iNode)+1] += elem[iElem]->GetnNeighbor_Nodes(iNode);
   
   for(iPoint = 0; iPoint < nPoint; iPoint++)
-    
-  /*--- Loop over all elements shared by the point ---*/
-    
-    for(iElem = 0; iElem < node[iPoint]->GetnElem(); iElem++) {
-      
-      jElem = node[iPoint]->GetElem(iElem);
-      
-      /*--- If we find the point iPoint in the surronding element ---*/
-      
-      for(iNode = 0; iNode < elem[jElem]->GetnNodes(); iNode++)
-        
-        if (elem[jElem]->GetNode(iNode) == iPoint)
-          
-        /*--- Localize the local index of the neighbor of iPoint in the element ---*/
-          
-          for(iNeighbor = 0; iNeighbor < elem[jElem]->GetnNeighbor_Nodes(iNode); iNeighbor++) {
-            Node_Neighbor = elem[jElem]->GetNeighbor_Nodes(iNode,iNeighbor);
-            Point_Neighbor = elem[jElem]->GetNode(Node_Neighbor);
-            
-            /*--- Store the point into the point ---*/
-            
-            node[iPoint]->SetPoint(Point_Neighbor);
-          }
+    Point_Ptr[iPoint+1] += Point_Ptr[iPoint];
+  
+  Point_Adj.resize(Point_Ptr[nPoint]);
+  Point_Fill.assign(Point_Ptr.begin(), Point_Ptr.end()-1);
+  
+  for(iElem = 0; iElem < nElem; iElem++)
+    for(iNode = 0; iNode < elem[iElem]->GetnNodes(); iNode++) {
+      iPoint = elem[iElem]->GetNode(iNode);
+      for(iNeighbor = 0; iNeighbor < elem[iElem]->GetnNeighbor_Nodes(iNode); iNeighbor++) {
+        Node_Neighbor = elem[iElem]->GetNeighbor_Nodes(iNode,iNeighbor);
+        Point_Adj[Point_Fill[iPoint]] = elem[iElem]->GetNode(Node_Neighbor);
+        Point_Fill[iPoint]++;
+      }
     }
   
+  /*--- Store the points into the point ---*/
+  
+  for(iPoint = 0; iPoint < nPoint; iPoint++) {
+    if (Point_Ptr[iPoint+1] == Point_Ptr[iPoint]) continue;
+    sort(Point_Adj.begin()+Point_Ptr[iPoint], Point_Adj.begin()+Point_Ptr[iPoint+1]);
+    nNeighbor = unique(Point_Adj.begin()+Point_Ptr[iPoint], Point_Adj.begin()+Point_Ptr[iPoint+1]) - (Point_Adj.begin()+Point_Ptr[iPoint]);
+    node[iPoint]->SetPoint(&Point_Adj[Point_Ptr[iPoint]], nNeighbor);
+  }
+  
   /*--- Set the number of neighbors variable, this is
    important for JST and multigrid in parallel ---*/
   
@@ -5683,7 +6536,7 @@ void CPhysicalGeometry::SetPoint_Connectivity(void) {
 }
 
 void CPhysicalGeometry::SetRCM_Ordering(CConfig *config) {
-  unsigned long iPoint, AdjPoint, AuxPoint, AddPoint, iElem;
+  unsigned long iPoint, AdjPoint, AuxPoint, AddPoint = 0, iElem, QueueHead = 0;
   vector<unsigned long> Queue, AuxQueue, Result;
   unsigned short Degree, MinDegree, iNode, jNode, iDim, iMarker;
   bool *inQueue;
@@ -5693,21 +6546,37 @@ void CPhysicalGeometry::SetRCM_Ordering(CConfig *config) {
   for(iPoint = 0; iPoint < nPoint; iPoint++)
     inQueue[iPoint] = false;
   
-  /*--- Select the node with the lowest degree in the grid. ---*/
+  Result.reserve(nPoint);
+  Queue.reserve(nPointDomain);
   
-  MinDegree = node[0]->GetnNeighbor(); AddPoint = 0;
-  for(iPoint = 1; iPoint < nPointDomain; iPoint++) {
-    Degree = node[iPoint]->GetnPoint();
-    if (Degree < MinDegree) { MinDegree = Degree; AddPoint = iPoint; }
-  }
-  
-  /*--- Add the node in the first free position. ---*/
-  
-  Result.push_back(AddPoint); inQueue[AddPoint] = true;
-  
-  /*--- Loop until reorganize all the nodes ---*/
+  /*--- Loop until reorganize all the nodes of the domain, the halo
+   points are kept at the end (in the same order) ---*/
   
-  do {
+  while (Result.size() < nPointDomain) {
+    
+    /*--- Select the node with the lowest degree in the grid (or in the
+     part of the grid that has not been reached yet). ---*/
+    
+    if (QueueHead == Queue.size()) {
+      MinDegree = 0; AddPoint = nPointDomain;
+      for(iPoint = 0; iPoint < nPointDomain; iPoint++) {
+        Degree = node[iPoint]->GetnPoint();
+        if ((!inQueue[iPoint]) && ((AddPoint == nPointDomain) || (Degree < MinDegree))) { MinDegree = Degree; AddPoint = iPoint; }
+      }
+      inQueue[AddPoint] = true;
+    }
+    
+    /*--- Otherwise, extract the first node from the queue (the queue is
+     only advanced, never shifted). ---*/
+    
+    else {
+      AddPoint = Queue[QueueHead];
+      QueueHead++;
+    }
+    
+    /*--- Add the node in the first free position. ---*/
+    
+    Result.push_back(AddPoint);
     
     /*--- Add to the queue all the nodes adjacent in the increasing
      order of their degree, checking if the element is already
@@ -5738,23 +6607,6 @@ void CPhysicalGeometry::SetRCM_Ordering(CConfig *config) {
       inQueue[AuxQueue[iNode]] = true;
     }
     
-    /*--- Extract the first node from the queue and add it in the first free
-     position. ---*/
-    
-    AddPoint = Queue[0];
-    Result.push_back(Queue[0]);
-    Queue.erase (Queue.begin(), Queue.begin()+1);
-    
-    /*--- Add to the queue all the nodes adjacent in the increasing
-     order of their degree, checking if the element is already
-     in the Queue. ---*/
-    
-  } while (Queue.size() != 0);
-  
-  /*--- Check that all the points have been added ---*/
-  
-  for(iPoint = 0; iPoint < nPointDomain; iPoint++) {
-    if (inQueue[iPoint] == false) Result.push_back(iPoint);
   }
   
   delete[] inQueue;
@@ -5813,6 +6665,17 @@ void CPhysicalGeometry::SetRCM_Ordering(CConfig *config) {
   for (iPoint = 0; iPoint < nPoint; iPoint++)
     InvResult[Result[iPoint]] = iPoint;
   
+  /*--- Keep the position of each point in the grid file, the mesh and FFD
+   files written after a deformation use the numbering of the file ---*/
+  
+  vector<unsigned long> Old_to_File(Local_to_File_Point);
+  Local_to_File_Point.resize(nPoint);
+  File_to_Local_Point.resize(nPoint);
+  for (iPoint = 0; iPoint < nPoint; iPoint++) {
+    Local_to_File_Point[iPoint] = (Old_to_File.empty() ? Result[iPoint] : Old_to_File[Result[iPoint]]);
+    File_to_Local_Point[Local_to_File_Point[iPoint]] = iPoint;
+  }
+  
   for(iElem = 0; iElem < nElem; iElem++) {
     for (iNode = 0; iNode < elem[iElem]->GetnNodes(); iNode++) {
       iPoint = elem[iElem]->GetNode(iNode);
@@ -7224,7 +8087,7 @@ void CPhysicalGeometry::SetMeshFile (CConfig *config, string val_mesh_out_filena
 
 void CPhysicalGeometry::SetMeshFile(CConfig *config, string val_mesh_out_filename, string val_mesh_in_filename) {
   
-  unsigned long iElem, iPoint, iElem_Bound, nElem_, nElem_Bound_, vnodes_edge[2], vnodes_triangle[3], vnodes_quad[4], vnodes_tetra[4], vnodes_hexa[8], vnodes_wedge[6], vnodes_pyramid[5], vnodes_vertex;
+  unsigned long iElem, iPoint, iPoint_File, iElem_Bound, nElem_, nElem_Bound_, vnodes_edge[2], vnodes_triangle[3], vnodes_quad[4], vnodes_tetra[4], vnodes_hexa[8], vnodes_wedge[6], vnodes_pyramid[5], vnodes_vertex;
   unsigned short iMarker, iDim, iChar, iPeriodic, nPeriodic = 0, VTK_Type, nDim_, nMarker_, transform;
   char *cstr;
   double *center, *angles, *transl;
@@ -7312,15 +8175,17 @@ void CPhysicalGeometry::SetMeshFile(CConfig *config, string val_mesh_out_filenam
         getline(input_file, text_line);
       }
       
-      /*--- Add the new coordinates ---*/
+      /*--- Add the new coordinates, in the order of the input file (the
+       elements and markers are copied from it) ---*/
       output_file << "NPOIN= " << nPoint << "\t" << nPointDomain << endl;
-      for (iPoint = 0; iPoint < nPoint; iPoint++) {
+      for (iPoint_File = 0; iPoint_File < nPoint; iPoint_File++) {
+        iPoint = GetFile_to_Local_Point(iPoint_File);
         for (iDim = 0; iDim < nDim; iDim++)
           output_file << scientific << node[iPoint]->GetCoord(iDim) << "\t";
 #ifndef HAVE_MPI
-        output_file << iPoint << endl;
+        output_file << iPoint_File << endl;
 #else
-        output_file << iPoint << "\t" << node[iPoint]->GetGlobalIndex() << endl;
+        output_file << iPoint_File << "\t" << node[iPoint]->GetGlobalIndex() << endl;
 #endif
       }
       
@@ -8949,18 +9814,15 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry ***geometry, CConfig **config_c
   
   /*--- Local variables ---*/
   
-  unsigned long iPoint, Index_CoarseCV, CVPoint, iElem, iVertex, jPoint, iteration, nVertexS, nVertexR, nBufferS_Vector, nBufferR_Vector, iParent, jVertex, *Buffer_Receive_Parent = NULL, *Buffer_Send_Parent = NULL, *Buffer_Receive_Children = NULL, *Buffer_Send_Children = NULL, *Parent_Remote = NULL, *Children_Remote = NULL, *Parent_Local = NULL, *Children_Local = NULL, Local_nPointCoarse, Local_nPointFine, Global_nPointCoarse, Global_nPointFine;;
+  unsigned long iPoint, Index_CoarseCV, CVPoint, iElem, iVertex, jPoint, iteration, nVertexS, nVertexR, nBufferS_Vector, nBufferR_Vector, iParent, jVertex, *Buffer_Receive_Parent = NULL, *Buffer_Send_Parent = NULL, *Buffer_Receive_Children = NULL, *Buffer_Send_Children = NULL, *Parent_Remote = NULL, *Children_Remote = NULL, *Parent_Local = NULL, *Children_Local = NULL;
   short marker_seed;
-  int send_to, receive_from, rank;
+  int send_to, receive_from;
   bool agglomerate_seed = true;
   unsigned short nChildren, iNode, counter, iMarker, jMarker, Marker_Boundary, priority, copy_marker[MAX_NUMBER_MARKER], MarkerS, MarkerR, *nChildren_MPI;
   vector<unsigned long> Suitable_Indirect_Neighbors, Aux_Parent;
   vector<unsigned long>::iterator it;
   
-#ifndef HAVE_MPI
-  rank = MASTER_NODE;
-#else
-  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+#ifdef HAVE_MPI
   MPI_Status status;
 #endif
   
@@ -9437,7 +10299,80 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry ***geometry, CConfig **config_c
   
   /*--- Console output with the summary of the agglomeration ---*/
   
+  SetAgglomeration_Rate(fine_grid, config, iMesh);
+  
+}
+
+CMultiGridGeometry::CMultiGridGeometry(CGeometry ***geometry, CConfig **config_container, unsigned short iMesh, unsigned short iZone, ifstream &cache_file) : CGeometry() {
+  
+  CGeometry *fine_grid = geometry[iZone][iMesh-1];
+  CConfig *config = config_container[iZone];
+  
+  unsigned long iPoint, iFinePoint, Data[3], *Children;
+  unsigned short iChildren, nChildren, Flags[3];
+  int rank = MASTER_NODE;
+  
+#ifdef HAVE_MPI
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+#endif
+  
+  FinestMGLevel = false;
+  nDim = fine_grid->GetnDim();
+  
+  /*--- Size of the coarse level (local points, points in the domain, fine points) ---*/
+  
+  cache_file.read((char *)Data, 3*sizeof(unsigned long));
+  if (!cache_file.good() || (Data[2] != fine_grid->GetnPoint())) {
+    cout << "The agglomeration of the MG level "<< iMesh << " in the geometry cache (rank "<< rank <<") does not match the grid." << endl;
+    cout << "Remove the cache file and run again." << endl;
+#ifndef HAVE_MPI
+    exit(EXIT_FAILURE);
+#else
+    MPI_Abort(MPI_COMM_WORLD,1);
+    MPI_Finalize();
+#endif
+  }
+  nPoint = Data[0];
+  nPointDomain = Data[1];
+  
+  /*--- Coarse control volumes and their children ---*/
+  
+  node = new CPoint*[nPoint];
+  Children = new unsigned long [fine_grid->GetnPoint()];
+  for (iPoint = 0; iPoint < nPoint; iPoint++) {
+    node[iPoint] = new CPoint(nDim, iPoint, config);
+    cache_file.read((char *)Flags, 3*sizeof(unsigned short));
+    nChildren = Flags[0];
+    cache_file.read((char *)Children, nChildren*sizeof(unsigned long));
+    for (iChildren = 0; iChildren < nChildren; iChildren++)
+      node[iPoint]->SetChildren_CV(iChildren, Children[iChildren]);
+    node[iPoint]->SetnChildren_CV(nChildren);
+    node[iPoint]->SetAgglomerate_Indirect(Flags[1] == 1);
+    node[iPoint]->SetDomain(Flags[2] == 1);
+  }
+  delete [] Children;
+  
+  /*--- Parent of the fine control volumes ---*/
+  
+  for (iFinePoint = 0; iFinePoint < fine_grid->GetnPoint(); iFinePoint++) {
+    cache_file.read((char *)Data, sizeof(unsigned long));
+    cache_file.read((char *)Flags, 2*sizeof(unsigned short));
+    if (Flags[0] == 1) fine_grid->node[iFinePoint]->SetParent_CV(Data[0]);
+    fine_grid->node[iFinePoint]->SetAgglomerate_Indirect(Flags[1] == 1);
+  }
+  
+  SetAgglomeration_Rate(fine_grid, config, iMesh);
+  
+}
+
+void CMultiGridGeometry::SetAgglomeration_Rate(CGeometry *fine_grid, CConfig *config, unsigned short iMesh) {
+  
+  unsigned long Local_nPointCoarse, Local_nPointFine, Global_nPointCoarse, Global_nPointFine;
+  int rank = MASTER_NODE;
   
+#ifdef HAVE_MPI
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+#endif
   
   Local_nPointCoarse = nPoint;
   Local_nPointFine = fine_grid->GetnPoint();
@@ -9471,6 +10406,41 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry ***geometry, CConfig **config_c
   
 }
 
+void CMultiGridGeometry::WriteCache_Agglomeration(ofstream &cache_file, CGeometry *fine_grid) {
+  
+  unsigned long iPoint, iFinePoint, Data[3];
+  unsigned short iChildren, Flags[3];
+  
+  /*--- Size of the coarse level (local points, points in the domain, fine points) ---*/
+  
+  Data[0] = nPoint; Data[1] = nPointDomain; Data[2] = fine_grid->GetnPoint();
+  cache_file.write((char *)Data, 3*sizeof(unsigned long));
+  
+  /*--- Coarse control volumes and their children ---*/
+  
+  for (iPoint = 0; iPoint < nPoint; iPoint++) {
+    Flags[0] = node[iPoint]->GetnChildren_CV();
+    Flags[1] = node[iPoint]->GetAgglomerate_Indirect();
+    Flags[2] = node[iPoint]->GetDomain();
+    cache_file.write((char *)Flags, 3*sizeof(unsigned short));
+    for (iChildren = 0; iChildren < Flags[0]; iChildren++) {
+      Data[0] = node[iPoint]->GetChildren_CV(iChildren);
+      cache_file.write((char *)Data, sizeof(unsigned long));
+    }
+  }
+  
+  /*--- Parent of the fine control volumes ---*/
+  
+  for (iFinePoint = 0; iFinePoint < fine_grid->GetnPoint(); iFinePoint++) {
+    Data[0] = fine_grid->node[iFinePoint]->GetParent_CV();
+    Flags[0] = fine_grid->node[iFinePoint]->GetAgglomerate();
+    Flags[1] = fine_grid->node[iFinePoint]->GetAgglomerate_Indirect();
+    cache_file.write((char *)Data, sizeof(unsigned long));
+    cache_file.write((char *)Flags, 2*sizeof(unsigned short));
+  }
+  
+}
+
 
 CMultiGridGeometry::~CMultiGridGeometry(void) {
   
@@ -11485,12 +12455,9 @@ double CBoundaryGeometry::Compute_Volume(CConfig *config, bool original_surface)
   
   /*--- Create the section slices through the geometry ---*/
   
-  for (iPlane = 0; iPlane < nPlane; iPlane++) {
-    ComputeAirfoil_Section(Plane_P0[iPlane], Plane_Normal[iPlane], iPlane,
-                           MinXCoord, MaxXCoord, NULL, Xcoord_Airfoil[iPlane],
-                           Ycoord_Airfoil[iPlane], Zcoord_Airfoil[iPlane],
-                           Variable_Airfoil[iPlane], original_surface, config);
-  }
+  ComputeAirfoil_Sections(nPlane, Plane_P0, Plane_Normal, MinXCoord, MaxXCoord, NULL,
+                          Xcoord_Airfoil, Ycoord_Airfoil, Zcoord_Airfoil,
+                          Variable_Airfoil, original_surface, config);
   
   /*--- Compute the area at each section ---*/
   
@@ -12252,14 +13219,17 @@ CMultiGridQueue::CMultiGridQueue(unsigned long val_npoint) {
   nPoint = val_npoint;
   Priority = new short[nPoint];
   RightCV = new bool[nPoint];
+  Next_QueueCV = new long[nPoint];
+  Prev_QueueCV = new long[nPoint];
   
-  QueueCV.resize(1);
+  Head_QueueCV.resize(1, -1);
+  Tail_QueueCV.resize(1, -1);
+  nQueueCV = 0; nRightCV_Zero = 0; MaxPriority = 0;
   
   /*--- Queue initialization with all the points in the finer grid ---*/
   for (iPoint = 0; iPoint < nPoint; iPoint ++) {
-    QueueCV[0].push_back(iPoint);
-    Priority[iPoint] = 0;
     RightCV[iPoint] = true;
+    LinkCV(iPoint, 0);
   }
   
 }
@@ -12268,41 +13238,77 @@ CMultiGridQueue::~CMultiGridQueue(void) {
   
   delete[] Priority;
   delete[] RightCV;
+  delete[] Next_QueueCV;
+  delete[] Prev_QueueCV;
   
 }
 
-void CMultiGridQueue::AddCV(unsigned long val_new_point, unsigned short val_number_neighbors) {
+void CMultiGridQueue::LinkCV(unsigned long val_point, short val_priority) {
+  
+  /*--- Resize the list ---*/
+  if (val_priority >= short(Head_QueueCV.size())) {
+    Head_QueueCV.resize(val_priority+1, -1);
+    Tail_QueueCV.resize(val_priority+1, -1);
+  }
+  
+  /*--- Append the control volume at the end of the list ---*/
+  Next_QueueCV[val_point] = -1;
+  Prev_QueueCV[val_point] = Tail_QueueCV[val_priority];
+  if (Tail_QueueCV[val_priority] != -1) Next_QueueCV[Tail_QueueCV[val_priority]] = val_point;
+  else Head_QueueCV[val_priority] = val_point;
+  Tail_QueueCV[val_priority] = val_point;
+  
+  Priority[val_point] = val_priority;
+  if (val_priority > MaxPriority) MaxPriority = val_priority;
+  if ((val_priority == 0) && RightCV[val_point]) nRightCV_Zero++;
+  nQueueCV++;
+  
+}
+
+void CMultiGridQueue::UnlinkCV(unsigned long val_point) {
+  
+  short val_priority = Priority[val_point];
+  
+  /*--- Connect the previous and the next control volumes ---*/
+  if (Prev_QueueCV[val_point] != -1) Next_QueueCV[Prev_QueueCV[val_point]] = Next_QueueCV[val_point];
+  else Head_QueueCV[val_priority] = Next_QueueCV[val_point];
+  if (Next_QueueCV[val_point] != -1) Prev_QueueCV[Next_QueueCV[val_point]] = Prev_QueueCV[val_point];
+  else Tail_QueueCV[val_priority] = Prev_QueueCV[val_point];
   
-  unsigned short Max_Neighbors = QueueCV.size()-1;
+  Priority[val_point] = -1;
+  if ((val_priority == 0) && RightCV[val_point]) nRightCV_Zero--;
+  nQueueCV--;
+  
+  /*--- The highest priority is the last one with control volumes, at least
+   we need one element in the queue ---*/
+  while ((MaxPriority > 0) && (Head_QueueCV[MaxPriority] == -1)) MaxPriority--;
+  
+}
+
+void CMultiGridQueue::AddCV(unsigned long val_new_point, unsigned short val_number_neighbors) {
   
   /*--- Basic check ---*/
-  if (val_new_point > nPoint) {
+  if (val_new_point >= nPoint) {
     cout << "The index of the CV is greater than the size of the priority list." << endl;
     exit(EXIT_FAILURE);
   }
   
-  /*--- Resize the list ---*/
-  if (val_number_neighbors > Max_Neighbors)
-    QueueCV.resize(val_number_neighbors+1);
-  
   /*--- Find the point in the queue ---*/
   bool InQueue = false;
   if (Priority[val_new_point] == val_number_neighbors) InQueue = true;
   
   if (!InQueue) {
-    /*--- Add the control volume, and update the priority list ---*/
-    QueueCV[val_number_neighbors].push_back(val_new_point);
-    Priority[val_new_point] = val_number_neighbors;
+    /*--- Add the control volume (taking it out of a different list), and update the priority list ---*/
+    if (Priority[val_new_point] != -1) UnlinkCV(val_new_point);
+    LinkCV(val_new_point, val_number_neighbors);
   }
   
 }
 
 void CMultiGridQueue::RemoveCV(unsigned long val_remove_point) {
-  unsigned short iPoint;
-  bool check;
   
   /*--- Basic check ---*/
-  if (val_remove_point > nPoint) {
+  if (val_remove_point >= nPoint) {
     cout << "The index of the CV is greater than the size of the priority list." << endl;
     exit(EXIT_FAILURE);
   }
@@ -12314,42 +13320,24 @@ void CMultiGridQueue::RemoveCV(unsigned long val_remove_point) {
     exit(EXIT_FAILURE);
   }
   
-  /*--- Find the point in the queue ---*/
-  vector<unsigned long>::iterator ItQueue = find(QueueCV[Number_Neighbors].begin(),
-                                                 QueueCV[Number_Neighbors].end(),
-                                                 val_remove_point);
-  if( ItQueue != QueueCV[Number_Neighbors].end() ) QueueCV[Number_Neighbors].erase(ItQueue);
-  
-  Priority[val_remove_point] = -1;
-  
-  /*--- Check that the size of the queue is the right one ---*/
-  unsigned short Size_QueueCV = 0;
-  check = false;
-  for (iPoint = 0; iPoint < QueueCV.size(); iPoint ++)
-    if (QueueCV[iPoint].size() != 0) { Size_QueueCV = iPoint; check = true;}
-  
-  /*--- Resize the queue, if check = false, the queue is empty, at least
-   we need one element in the queue ---*/
-  if (check) QueueCV.resize(Size_QueueCV+1);
-  else QueueCV.resize(1);
+  /*--- Remove the point from its list ---*/
+  UnlinkCV(val_remove_point);
   
 }
 
 void CMultiGridQueue::MoveCV(unsigned long val_move_point, short val_number_neighbors) {
-  unsigned short Priority;
+  
+  /*--- Remove the control volume ---*/
+  RemoveCV(val_move_point);
   
   if (val_number_neighbors < 0) {
     val_number_neighbors = 0;
     RightCV[val_move_point] = false;
   }
   else {
-    Priority = val_number_neighbors;
     RightCV[val_move_point] = true;
   }
   
-  /*--- Remove the control volume ---*/
-  RemoveCV(val_move_point);
-  
   /*--- Add a new control volume ---*/
   AddCV(val_move_point, val_number_neighbors);
   
@@ -12394,14 +13382,14 @@ void CMultiGridQueue::RedPriorityCV(unsigned long val_red_point) {
 }
 
 void CMultiGridQueue::VisualizeQueue(void) {
-  unsigned short iPoint;
-  unsigned long jPoint;
+  unsigned short iPriority;
+  long jPoint;
   
   cout << endl;
-  for (iPoint = 0; iPoint < QueueCV.size(); iPoint ++) {
-    cout << "Number of neighbors " << iPoint <<": ";
-    for (jPoint = 0; jPoint < QueueCV[iPoint].size(); jPoint ++) {
-      cout << QueueCV[iPoint][jPoint] << " ";
+  for (iPriority = 0; iPriority <= MaxPriority; iPriority ++) {
+    cout << "Number of neighbors " << iPriority <<": ";
+    for (jPoint = Head_QueueCV[iPriority]; jPoint != -1; jPoint = Next_QueueCV[jPoint]) {
+      cout << jPoint << " ";
     }
     cout << endl;
   }
@@ -12417,39 +13405,20 @@ void CMultiGridQueue::VisualizePriority(void) {
 }
 
 long CMultiGridQueue::NextCV(void) {
-  if (QueueCV.size() != 0) return QueueCV[QueueCV.size()-1][0];
-  else return -1;
+  return Head_QueueCV[MaxPriority];
 }
 
 bool CMultiGridQueue::EmptyQueue(void) {
-  unsigned short iPoint;
   
   /*--- In case there is only the no agglomerated elements,
    check if they can be agglomerated or we have already finished ---*/
-  bool check = true;
-  
-  if ( QueueCV.size() == 1 ) {
-    for (iPoint = 0; iPoint < QueueCV[0].size(); iPoint ++) {
-      if (RightCV[QueueCV[0][iPoint]]) { check = false; break; }
-    }
-  }
-  else {
-    for (iPoint = 1; iPoint < QueueCV.size(); iPoint ++)
-      if (QueueCV[iPoint].size() != 0) { check = false; break;}
-  }
+  if (MaxPriority == 0) return (nRightCV_Zero == 0);
+  else return false;
   
-  return check;
 }
 
 unsigned long CMultiGridQueue::TotalCV(void) {
-  unsigned short iPoint;
-  unsigned long TotalCV;
-  
-  TotalCV = 0;
-  for (iPoint = 0; iPoint < QueueCV.size(); iPoint ++)
-    if (QueueCV[iPoint].size() != 0) { TotalCV += QueueCV[iPoint].size(); }
-  
-  return TotalCV;
+  return nQueueCV;
 }
 
 void CMultiGridQueue::Update(unsigned long iPoint, CGeometry *fine_grid) {
@@ -103,9 +103,10 @@ CGridAdaptation::~CGridAdaptation(void) {
 }
 
 void CGridAdaptation::GetFlowSolution(CGeometry *geometry, CConfig *config) {
-	unsigned long iPoint, index;
+	unsigned long iPoint;
 	unsigned short iVar;
-  double dummy;
+  const char *Line;
+  char *Line_End;
 
 	string text_line;
 		
@@ -130,15 +131,17 @@ void CGridAdaptation::GetFlowSolution(CGeometry *geometry, CConfig *config) {
 
 	for(iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++){
 		getline(restart_file, text_line);
-		istringstream point_line(text_line);
-		
-		point_line >> index;
     
-    if (nDim == 2) point_line >> dummy >> dummy;
-    else point_line >> dummy >> dummy >> dummy;
-      
-		for (iVar = 0; iVar < nVar; iVar ++)
-			point_line >> ConsVar_Sol[iPoint][iVar];
+    /*--- Skip the index and the coordinates and read the solution, parsing
+     the line in place instead of building a string stream for each point ---*/
+    
+    Line = text_line.c_str();
+    for (iVar = 0; iVar < nDim+1; iVar ++) {
+      strtod(Line, &Line_End); Line = Line_End;
+    }
+		for (iVar = 0; iVar < nVar; iVar ++) {
+			ConsVar_Sol[iPoint][iVar] = strtod(Line, &Line_End); Line = Line_End;
+    }
 	}
 	restart_file.close();
 }
@@ -227,9 +230,10 @@ void CGridAdaptation::GetLinResidual(CGeometry *geometry, CConfig *config) {
 }
 
 void CGridAdaptation::GetAdjSolution(CGeometry *geometry, CConfig *config) {
-	unsigned long iPoint, index;
+	unsigned long iPoint;
 	unsigned short iVar;
-  double dummy;
+  const char *Line;
+  char *Line_End;
 	string text_line;
 	
 	string copy, mesh_filename;
@@ -254,15 +258,14 @@ void CGridAdaptation::GetAdjSolution(CGeometry *geometry, CConfig *config) {
   
 	for(iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++){
 		getline(restart_file,text_line);
-		istringstream point_line(text_line);
-		
-    point_line >> index;
     
-    if (nDim == 2) point_line >> dummy >> dummy;
-    else point_line >> dummy >> dummy >> dummy;
-    
-		for (iVar = 0; iVar < nVar; iVar ++)
-			point_line >> AdjVar_Sol[iPoint][iVar];
+    Line = text_line.c_str();
+    for (iVar = 0; iVar < nDim+1; iVar ++) {
+      strtod(Line, &Line_End); Line = Line_End;
+    }
+		for (iVar = 0; iVar < nVar; iVar ++) {
+			AdjVar_Sol[iPoint][iVar] = strtod(Line, &Line_End); Line = Line_End;
+    }
 	}
 	
 	restart_file.close();
@@ -3707,9 +3710,10 @@ void CGridAdaptation::SetRestart_LinSolution(CConfig *config, CPhysicalGeometry
 }
 
 void CGridAdaptation::SetSensorElem(CGeometry *geometry, CConfig *config, unsigned long max_elem) {
-	double Max_Sensor, threshold;
+	double Max_Sensor;
 	double *Sensor = new double[geometry->GetnElem()];
-	unsigned long ip_0, ip_1, ip_2, ip_3, iElem, nElem_real;
+	unsigned long ip_0, ip_1, ip_2, ip_3, iElem, nElem_real, iCandidate, nCandidate, nSorted;
+  vector<pair<double, unsigned long> > Candidate;
 	
 	/*--- Compute the the adaptation index at each element ---*/
 	Max_Sensor = 0.0;
@@ -3731,20 +3735,33 @@ void CGridAdaptation::SetSensorElem(CGeometry *geometry, CConfig *config, unsign
 		Sensor[iElem] = Sensor[iElem]/Max_Sensor;
 	}
 	
-	/*--- Selection of the elements to be adapted ---*/
-	threshold = 0.999;
+	/*--- Selection of the elements to be adapted, by decreasing sensor (ties by
+   element index). Each divided triangle or rectangle adds 3 elements, so only
+   the max_elem/3 largest values are needed: they are separated with a partial
+   sort (nth_element) and the rest is sorted only if they were not enough. ---*/
+  
+	for (iElem = 0; iElem < geometry->GetnElem(); iElem ++)
+    if (!geometry->elem[iElem]->GetDivide())
+      Candidate.push_back(make_pair(-Sensor[iElem], iElem));
+  
+  nCandidate = Candidate.size();
+  nSorted = min(nCandidate, max_elem/3+1);
+  if (nSorted < nCandidate)
+    nth_element(Candidate.begin(), Candidate.begin()+nSorted, Candidate.end());
+  sort(Candidate.begin(), Candidate.begin()+nSorted);
+  
 	nElem_real = 0;
-	while (nElem_real <= max_elem) {
-		for (iElem = 0; iElem < geometry->GetnElem(); iElem ++)
-			if ( Sensor[iElem] >= threshold && !geometry->elem[iElem]->GetDivide() ) {
-				if (geometry->elem[iElem]->GetVTK_Type() == TRIANGLE) nElem_real = nElem_real + 3;	
-				if (geometry->elem[iElem]->GetVTK_Type() == RECTANGLE) nElem_real = nElem_real + 3;	
-				if (geometry->elem[iElem]->GetVTK_Type() == TETRAHEDRON) nElem_real = nElem_real + 7;
-				geometry->elem[iElem]->SetDivide(true);
-				if (nElem_real >= max_elem) break;
-			}	
-		threshold = threshold - 0.001;
-	}
+  for (iCandidate = 0; (iCandidate < nCandidate) && (nElem_real < max_elem); iCandidate++) {
+    if (iCandidate == nSorted) {
+      sort(Candidate.begin()+nSorted, Candidate.end());
+      nSorted = nCandidate;
+    }
+    iElem = Candidate[iCandidate].second;
+    if (geometry->elem[iElem]->GetVTK_Type() == TRIANGLE) nElem_real = nElem_real + 3;
+    if (geometry->elem[iElem]->GetVTK_Type() == RECTANGLE) nElem_real = nElem_real + 3;
+    if (geometry->elem[iElem]->GetVTK_Type() == TETRAHEDRON) nElem_real = nElem_real + 7;
+    geometry->elem[iElem]->SetDivide(true);
+  }
 	
 	cout << "Number of elements to adapt: " << nElem_real << endl;
 	delete [] Sensor;
@@ -33,10 +33,103 @@ CVolumetricMovement::CVolumetricMovement(CGeometry *geometry) : CGridMovement()
 	
 	nDim = geometry->GetnDim();
   
+  StiffMatrix_Built   = false;
+  StiffMatrix_Elem    = NULL;
+  StiffMatrix_Node    = NULL;
+  Elem_Block_Ptr      = NULL;
+  Elem_Block          = NULL;
+  StiffMatrix_MatVec  = NULL;
+  StiffMatrix_Precond = NULL;
+  StiffMatrix_Solver  = NULL;
+  
+  for (unsigned short iDim = 0; iDim < 3; iDim++)
+    for (unsigned short jDim = 0; jDim < 3; jDim++)
+      Rigid_RotMatrix[iDim][jDim] = (iDim == jDim) ? 1.0 : 0.0;
+  
 }
 
 CVolumetricMovement::~CVolumetricMovement(void) {
+  
+  unsigned short iVar;
+  
+  if (StiffMatrix_Elem != NULL) {
+    for (iVar = 0; iVar < nDim*8; iVar++)
+      delete [] StiffMatrix_Elem[iVar];
+    delete [] StiffMatrix_Elem;
+  }
+  if (StiffMatrix_Node != NULL) {
+    for (iVar = 0; iVar < nDim; iVar++)
+      delete [] StiffMatrix_Node[iVar];
+    delete [] StiffMatrix_Node;
+  }
+  if (Elem_Block_Ptr != NULL) delete [] Elem_Block_Ptr;
+  if (Elem_Block != NULL)     delete [] Elem_Block;
+  
+  if (StiffMatrix_MatVec != NULL)  delete StiffMatrix_MatVec;
+  if (StiffMatrix_Precond != NULL) delete StiffMatrix_Precond;
+  if (StiffMatrix_Solver != NULL)  delete StiffMatrix_Solver;
+  
+}
 
+void CVolumetricMovement::SetStiffMatrix_Structure(CGeometry *geometry, CConfig *config) {
+  
+  unsigned short iVar, iNode, jNode, nNodes;
+  unsigned long iElem, iPoint, jPoint, nBlock;
+  
+  nDim   = geometry->GetnDim();
+  nVar   = geometry->GetnDim();
+  nPoint = geometry->GetnPoint();
+  nPointDomain = geometry->GetnPointDomain();
+  
+  /*--- Sparse structure of the matrix, solution, and r.h.s. ---*/
+  
+  LinSysSol.Initialize(nPoint, nPointDomain, nVar, 0.0);
+  LinSysRes.Initialize(nPoint, nPointDomain, nVar, 0.0);
+  StiffMatrix.Initialize(nPoint, nPointDomain, nVar, nVar, false, geometry, config);
+  
+  /*--- Position in the matrix of the point-to-point blocks of each element,
+   so the element contributions are added without searching the rows ---*/
+  
+  Elem_Block_Ptr = new unsigned long [geometry->GetnElem()+1];
+  Elem_Block_Ptr[0] = 0;
+  for (iElem = 0; iElem < geometry->GetnElem(); iElem++) {
+    nNodes = geometry->elem[iElem]->GetnNodes();
+    Elem_Block_Ptr[iElem+1] = Elem_Block_Ptr[iElem] + nNodes*nNodes;
+  }
+  
+  nBlock = Elem_Block_Ptr[geometry->GetnElem()];
+  Elem_Block = new unsigned long [nBlock];
+  for (iElem = 0; iElem < geometry->GetnElem(); iElem++) {
+    nNodes = geometry->elem[iElem]->GetnNodes();
+    for (iNode = 0; iNode < nNodes; iNode++) {
+      iPoint = geometry->elem[iElem]->GetNode(iNode);
+      for (jNode = 0; jNode < nNodes; jNode++) {
+        jPoint = geometry->elem[iElem]->GetNode(jNode);
+        Elem_Block[Elem_Block_Ptr[iElem] + iNode*nNodes + jNode] = StiffMatrix.GetBlock_Index(iPoint, jPoint);
+      }
+    }
+  }
+  
+  /*--- Element work arrays (maximum size, rectangle and hexahedron) ---*/
+  
+  StiffMatrix_Elem = new double* [nDim*8];
+  for (iVar = 0; iVar < nDim*8; iVar++)
+    StiffMatrix_Elem[iVar] = new double [nDim*8];
+  
+  StiffMatrix_Node = new double* [nVar];
+  for (iVar = 0; iVar < nVar; iVar++)
+    StiffMatrix_Node[iVar] = new double [nVar];
+  
+  /*--- Linear solver structures, they only keep a reference to the matrix
+   (the LU-SGS preconditioner is applied directly from the current matrix
+   entries, so it is valid for all the increments) ---*/
+  
+  StiffMatrix_MatVec  = new CSysMatrixVectorProduct(StiffMatrix, geometry, config);
+  StiffMatrix_Precond = new CLU_SGSPreconditioner(StiffMatrix, geometry, config);
+  StiffMatrix_Solver  = new CSysSolve();
+  
+  StiffMatrix_Built = true;
+  
 }
 
 
@@ -85,9 +178,62 @@ void CVolumetricMovement::UpdateMultiGrid(CGeometry **geometry, CConfig *config)
     if (config->GetGrid_Movement())
       geometry[iMGlevel]->SetRestricted_GridVelocity(geometry[iMGfine],config);
   }
+  
+  /*--- The coarse levels are consistent with the fine grid again ---*/
+  
+  for (unsigned short iDim = 0; iDim < 3; iDim++)
+    for (unsigned short jDim = 0; jDim < 3; jDim++)
+      Rigid_RotMatrix[iDim][jDim] = (iDim == jDim) ? 1.0 : 0.0;
  
 }
 
+void CVolumetricMovement::UpdateRigidMultiGrid(CGeometry **geometry, CConfig *config) {
+  
+  unsigned short iDim, iMGfine, iMGlevel, nMGlevel = config->GetMGLevels();
+  
+  /*--- After a rigid motion of the finest grid the coarse control volumes
+   do not change and their normals are rotated like the fine ones. The
+   coordinates and grid velocities are volume averages of the fine values,
+   which is exact for the affine field of a rigid motion. ---*/
+  
+  for (iMGlevel = 1; iMGlevel <= nMGlevel; iMGlevel++) {
+    iMGfine = iMGlevel-1;
+    geometry[iMGlevel]->SetRotation_Normal(Rigid_RotMatrix);
+    geometry[iMGlevel]->SetCoord(geometry[iMGfine]);
+    if (config->GetGrid_Movement())
+      geometry[iMGlevel]->SetRestricted_GridVelocity(geometry[iMGfine],config);
+  }
+  
+  for (iDim = 0; iDim < 3; iDim++)
+    for (unsigned short jDim = 0; jDim < 3; jDim++)
+      Rigid_RotMatrix[iDim][jDim] = (iDim == jDim) ? 1.0 : 0.0;
+  
+}
+
+void CVolumetricMovement::UpdateRigidDualGrid(CGeometry *geometry, double rotMatrix[3][3]) {
+  
+  unsigned short iDim, jDim, kDim;
+  double RotMatrix_Old[3][3];
+  
+  /*--- Rotate the edge and vertex normals of the fine grid ---*/
+  
+  geometry->SetRotation_Normal(rotMatrix);
+  
+  /*--- Accumulate the rotation for the coarse multigrid levels ---*/
+  
+  for (iDim = 0; iDim < 3; iDim++)
+    for (jDim = 0; jDim < 3; jDim++)
+      RotMatrix_Old[iDim][jDim] = Rigid_RotMatrix[iDim][jDim];
+  
+  for (iDim = 0; iDim < 3; iDim++)
+    for (jDim = 0; jDim < 3; jDim++) {
+      Rigid_RotMatrix[iDim][jDim] = 0.0;
+      for (kDim = 0; kDim < 3; kDim++)
+        Rigid_RotMatrix[iDim][jDim] += rotMatrix[iDim][kDim]*RotMatrix_Old[kDim][jDim];
+    }
+  
+}
+
 void CVolumetricMovement::SetVolume_Deformation(CGeometry *geometry, CConfig *config, bool UpdateGeo) {
   
 	unsigned long IterLinSol, Smoothing_Iter, iNonlinear_Iter;
@@ -108,21 +254,22 @@ void CVolumetricMovement::SetVolume_Deformation(CGeometry *geometry, CConfig *co
   /*--- Disable the screen output if we're running SU2_CFD ---*/
   
   if (config->GetKind_SU2() == SU2_CFD) Screen_Output = false;
-
-  /*--- Initialize the number of spatial dimensions, length of the state
-   vector (same as spatial dimensions for grid deformation), and grid nodes. ---*/
   
-  nDim   = geometry->GetnDim();
-  nVar   = geometry->GetnDim();
-  nPoint = geometry->GetnPoint();
-  nPointDomain = geometry->GetnPointDomain();
+  /*--- Radial basis function interpolation of the boundary displacements
+   (no linear system, nor deformation increments) ---*/
   
-  /*--- Initialize matrix, solution, and r.h.s. structures for the linear solver. ---*/
+  if (config->GetDeform_Method() == RBF_DEFORMATION) {
+    SetRBF_Deformation(geometry, config, UpdateGeo);
+    return;
+  }
+
+  /*--- Initialize the matrix, solution, and r.h.s. structures for the linear solver.
+   They are kept between calls (unsteady and design loops deform the same grid),
+   and the solution is used as initial guess for the next deformation. ---*/
   
   config->SetKind_Linear_Solver_Prec(LU_SGS);
-  LinSysSol.Initialize(nPoint, nPointDomain, nVar, 0.0);
-  LinSysRes.Initialize(nPoint, nPointDomain, nVar, 0.0);
-  StiffMatrix.Initialize(nPoint, nPointDomain, nVar, nVar, false, geometry, config);
+  if (!StiffMatrix_Built) SetStiffMatrix_Structure(geometry, config);
+  else if (!config->GetDeform_WarmStart()) LinSysSol.SetValZero();
   
   /*--- Loop over the total number of grid deformation iterations. The surface
    deformation can be divided into increments to help with stability. In
@@ -130,9 +277,10 @@ void CVolumetricMovement::SetVolume_Deformation(CGeometry *geometry, CConfig *co
   
   for (iNonlinear_Iter = 0; iNonlinear_Iter < config->GetGridDef_Nonlinear_Iter(); iNonlinear_Iter++) {
     
-    /*--- Initialize vector and sparse matrix ---*/
+    /*--- Initialize vector and sparse matrix (the solution of the previous
+     increment is the initial guess of the linear solver) ---*/
     
-    LinSysSol.SetValZero();
+    if (!config->GetDeform_WarmStart()) LinSysSol.SetValZero();
     LinSysRes.SetValZero();
     StiffMatrix.SetValZero();
     
@@ -163,20 +311,13 @@ void CVolumetricMovement::SetVolume_Deformation(CGeometry *geometry, CConfig *co
     StiffMatrix.SendReceive_Solution(LinSysSol, geometry, config);
     StiffMatrix.SendReceive_Solution(LinSysRes, geometry, config);
     
-    /*--- Definition of the preconditioner matrix vector multiplication, and linear solver ---*/
+    /*--- Solve the linear system. A warm-started solve is converged relative to
+     the norm of the r.h.s., as a cold start from zero, so that the initial
+     guess saves iterations without changing the deformed grid. ---*/
     
-    CMatrixVectorProduct* mat_vec = new CSysMatrixVectorProduct(StiffMatrix, geometry, config);
-    CPreconditioner* precond      = new CLU_SGSPreconditioner(StiffMatrix, geometry, config);
-    CSysSolve *system             = new CSysSolve();
-    
-    /*--- Solve the linear system ---*/
-    IterLinSol = system->FGMRES_LinSolver(LinSysRes, LinSysSol, *mat_vec, *precond, NumError, Smoothing_Iter, Screen_Output);
-
-    /*--- Deallocate memory needed by the Krylov linear solver ---*/
-    
-    delete system;
-    delete mat_vec;
-    delete precond;
+    IterLinSol = StiffMatrix_Solver->FGMRES_LinSolver(LinSysRes, LinSysSol, *StiffMatrix_MatVec, *StiffMatrix_Precond,
+                                                      NumError, Smoothing_Iter, Screen_Output,
+                                                      config->GetDeform_WarmStart());
     
     /*--- Update the grid coordinates and cell volumes using the solution
      of the linear system (usol contains the x, y, z displacements). ---*/
@@ -198,11 +339,392 @@ void CVolumetricMovement::SetVolume_Deformation(CGeometry *geometry, CConfig *co
     
   }
   
-  /*--- Deallocate vectors for the linear system. ---*/
+}
+
+void CVolumetricMovement::SetRBF_Deformation(CGeometry *geometry, CConfig *config, bool UpdateGeo) {
+  
+  unsigned short iDim, iMarker, axis = 0, Kind_SU2 = config->GetKind_SU2();
+  unsigned long iPoint, iVertex, iControl, jControl, nControl, iSelected, jSelected, nSelected = 0, nAdd, iAdd,
+  MaxPoints = config->GetDeform_RBF_MaxPoints(), index = 0;
+  double *VarCoord, *Coord, MeanCoord[3], Disp[3], Dist, Norm, MaxDisp = 0.0, MaxError = 0.0, Error, Tol, MinVolume,
+  BoxMin[3] = {0.0, 0.0, 0.0}, BoxMax[3] = {0.0, 0.0, 0.0}, new_coord, Sum, *Hold_GridFixed_Coord;
+  bool Moving, Box_Init = false;
+  vector<double> Local_Data, Control_Data, LMatrix, Values, Aux;
+  vector<unsigned long> Selected;
+  vector<bool> Used;
+  vector<pair<double, unsigned long> > Candidate;
+  
+  int rank = MASTER_NODE;
+#ifdef HAVE_MPI
+	MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+#endif
+  
+  nDim   = geometry->GetnDim();
+  nPoint = geometry->GetnPoint();
+  
+  /*--- Prescribed displacements of the boundaries, with the same conditions
+   as the FEA method (moving surfaces, fixed boundaries, free symmetry planes) ---*/
+  
+  bool *Control = new bool [nPoint];
+  double *Control_Disp = new double [nPoint*nDim];
+  for (iPoint = 0; iPoint < nPoint; iPoint++) {
+    Control[iPoint] = false;
+    for (iDim = 0; iDim < nDim; iDim++) Control_Disp[iPoint*nDim+iDim] = 0.0;
+  }
+  
+  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+    if ((config->GetMarker_All_KindBC(iMarker) != SYMMETRY_PLANE) &&
+        (config->GetMarker_All_KindBC(iMarker) != SEND_RECEIVE)) {
+      Moving = (((config->GetMarker_All_Moving(iMarker) == YES) && (Kind_SU2 == SU2_CFD)) ||
+                ((config->GetMarker_All_DV(iMarker) == YES) && (Kind_SU2 == SU2_DEF)));
+      for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
+        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        Control[iPoint] = true;
+        if (Moving) {
+          VarCoord = geometry->vertex[iMarker][iVertex]->GetVarCoord();
+          for (iDim = 0; iDim < nDim; iDim++)
+            Control_Disp[iPoint*nDim+iDim] = VarCoord[iDim];
+        }
+      }
+    }
+  }
+  
+  /*--- Don't move the nearfield plane ---*/
+  
+  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+    if (config->GetMarker_All_KindBC(iMarker) == NEARFIELD_BOUNDARY) {
+      for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
+        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        for (iDim = 0; iDim < nDim; iDim++)
+          Control_Disp[iPoint*nDim+iDim] = 0.0;
+      }
+    }
+  }
+  
+  /*--- Candidate control points (owned points only, coordinates and displacement) ---*/
+  
+  for (iPoint = 0; iPoint < nPoint; iPoint++) {
+    if (Control[iPoint] && geometry->node[iPoint]->GetDomain()) {
+      for (iDim = 0; iDim < nDim; iDim++) Local_Data.push_back(geometry->node[iPoint]->GetCoord(iDim));
+      for (iDim = 0; iDim < nDim; iDim++) Local_Data.push_back(Control_Disp[iPoint*nDim+iDim]);
+    }
+  }
+  
+#ifdef HAVE_MPI
+  
+  /*--- All the processors need the complete set of candidates (the selection
+   is repeated on each processor, so the interpolant is the same) ---*/
+  
+  int nProcessor, iProcessor;
+  unsigned long nLocal = Local_Data.size(), MaxLocal, *Buffer_Receive_n, iBuffer;
+  double *Buffer_Send, *Buffer_Receive;
+  
+  MPI_Comm_size(MPI_COMM_WORLD, &nProcessor);
+  Buffer_Receive_n = new unsigned long [nProcessor];
+  
+  MPI_Allreduce(&nLocal, &MaxLocal, 1, MPI_UNSIGNED_LONG, MPI_MAX, MPI_COMM_WORLD);
+  MPI_Allgather(&nLocal, 1, MPI_UNSIGNED_LONG, Buffer_Receive_n, 1, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+  
+  Buffer_Send = new double [MaxLocal+1];
+  Buffer_Receive = new double [nProcessor*(MaxLocal+1)];
+  for (iBuffer = 0; iBuffer < nLocal; iBuffer++) Buffer_Send[iBuffer] = Local_Data[iBuffer];
+  
+  MPI_Allgather(Buffer_Send, MaxLocal+1, MPI_DOUBLE, Buffer_Receive, MaxLocal+1, MPI_DOUBLE, MPI_COMM_WORLD);
+  
+  for (iProcessor = 0; iProcessor < nProcessor; iProcessor++)
+    for (iBuffer = 0; iBuffer < Buffer_Receive_n[iProcessor]; iBuffer++)
+      Control_Data.push_back(Buffer_Receive[iProcessor*(MaxLocal+1) + iBuffer]);
+  
+  delete [] Buffer_Send; delete [] Buffer_Receive; delete [] Buffer_Receive_n;
+  
+#else
+  
+  Control_Data = Local_Data;
+  
+#endif
+  
+  nControl = Control_Data.size()/(2*nDim);
+  
+  /*--- Maximum displacement, and size of the moving surfaces ---*/
+  
+  for (iControl = 0; iControl < nControl; iControl++) {
+    Norm = 0.0;
+    for (iDim = 0; iDim < nDim; iDim++)
+      Norm += Control_Data[(2*iControl+1)*nDim+iDim]*Control_Data[(2*iControl+1)*nDim+iDim];
+    Norm = sqrt(Norm);
+    if (Norm > MaxDisp) { MaxDisp = Norm; index = iControl; }
+    if (Norm > 0.0) {
+      for (iDim = 0; iDim < nDim; iDim++) {
+        if (!Box_Init) { BoxMin[iDim] = Control_Data[2*iControl*nDim+iDim]; BoxMax[iDim] = BoxMin[iDim]; }
+        BoxMin[iDim] = min(BoxMin[iDim], Control_Data[2*iControl*nDim+iDim]);
+        BoxMax[iDim] = max(BoxMax[iDim], Control_Data[2*iControl*nDim+iDim]);
+      }
+      Box_Init = true;
+    }
+  }
+  
+  if (MaxDisp == 0.0) {
+    delete [] Control; delete [] Control_Disp;
+    return;
+  }
+  
+  /*--- Default compact support: half the size of the moving surfaces, and at least
+   10 times the max. displacement (the kernel gradient stays below ~0.1). The
+   points farther away keep their position, and the bins of the control points
+   (see SetRBF_Bins) follow this radius ---*/
+  
+  RBF_Radius = config->GetDeform_RBF_Radius();
+  if (RBF_Radius <= 0.0) {
+    Dist = 0.0;
+    for (iDim = 0; iDim < nDim; iDim++) Dist += (BoxMax[iDim]-BoxMin[iDim])*(BoxMax[iDim]-BoxMin[iDim]);
+    RBF_Radius = max(0.5*sqrt(Dist), 10.0*MaxDisp);
+  }
+  
+  Tol = config->GetDeform_RBF_Tolerance()*MaxDisp;
+  
+  /*--- Greedy selection of the control points. The Cholesky factor of the
+   interpolation matrix is extended with each new point, the points with the
+   largest interpolation error are added (10% of the current set each time). ---*/
+  
+  Used.assign(nControl, false);
+  RBF_Coord.clear();
+  Candidate.push_back(make_pair(MaxDisp, index));
+  
+  while (true) {
+    
+    for (iAdd = 0; iAdd < Candidate.size(); iAdd++) {
+      
+      iControl = Candidate[iAdd].second;
+      Used[iControl] = true;
+      
+      /*--- New row of the Cholesky factor (forward substitution) ---*/
+      
+      Aux.resize(nSelected);
+      Sum = 0.0;
+      for (iSelected = 0; iSelected < nSelected; iSelected++) {
+        Dist = 0.0;
+        for (iDim = 0; iDim < nDim; iDim++)
+          Dist += pow(Control_Data[2*iControl*nDim+iDim] - RBF_Coord[iSelected*nDim+iDim], 2.0);
+        Aux[iSelected] = GetRBF_Kernel(sqrt(Dist));
+        for (jSelected = 0; jSelected < iSelected; jSelected++)
+          Aux[iSelected] -= LMatrix[iSelected*(iSelected+1)/2+jSelected]*Aux[jSelected];
+        Aux[iSelected] /= LMatrix[iSelected*(iSelected+1)/2+iSelected];
+        Sum += Aux[iSelected]*Aux[iSelected];
+      }
+      
+      /*--- Skip points that make the system (numerically) singular ---*/
+      
+      if (1.0 - Sum <= 1E-10) continue;
+      
+      for (iSelected = 0; iSelected < nSelected; iSelected++) LMatrix.push_back(Aux[iSelected]);
+      LMatrix.push_back(sqrt(1.0 - Sum));
+      for (iDim = 0; iDim < nDim; iDim++) {
+        RBF_Coord.push_back(Control_Data[2*iControl*nDim+iDim]);
+        Values.push_back(Control_Data[(2*iControl+1)*nDim+iDim]);
+      }
+      Selected.push_back(iControl);
+      nSelected++;
+      
+    }
+    
+    /*--- Interpolation coefficients (forward and backward substitution) ---*/
+    
+    RBF_Coeff.resize(nSelected*nDim);
+    for (iDim = 0; iDim < nDim; iDim++) {
+      for (iSelected = 0; iSelected < nSelected; iSelected++) {
+        Sum = Values[iSelected*nDim+iDim];
+        for (jSelected = 0; jSelected < iSelected; jSelected++)
+          Sum -= LMatrix[iSelected*(iSelected+1)/2+jSelected]*RBF_Coeff[jSelected*nDim+iDim];
+        RBF_Coeff[iSelected*nDim+iDim] = Sum/LMatrix[iSelected*(iSelected+1)/2+iSelected];
+      }
+      for (iSelected = nSelected; iSelected > 0; iSelected--) {
+        Sum = RBF_Coeff[(iSelected-1)*nDim+iDim];
+        for (jSelected = iSelected; jSelected < nSelected; jSelected++)
+          Sum -= LMatrix[jSelected*(jSelected+1)/2+iSelected-1]*RBF_Coeff[jSelected*nDim+iDim];
+        RBF_Coeff[(iSelected-1)*nDim+iDim] = Sum/LMatrix[(iSelected-1)*iSelected/2+iSelected-1];
+      }
+    }
+    
+    SetRBF_Bins();
+    
+    /*--- Interpolation error of the remaining candidates ---*/
+    
+    Candidate.clear();
+    MaxError = 0.0;
+    for (jControl = 0; jControl < nControl; jControl++) {
+      if (Used[jControl]) continue;
+      GetRBF_Displacement(&Control_Data[2*jControl*nDim], Disp);
+      Error = 0.0;
+      for (iDim = 0; iDim < nDim; iDim++)
+        Error = max(Error, fabs(Disp[iDim] - Control_Data[(2*jControl+1)*nDim+iDim]));
+      MaxError = max(MaxError, Error);
+      if (Error > Tol) Candidate.push_back(make_pair(-Error, jControl));
+    }
+    
+    if ((Candidate.size() == 0) || (nSelected >= MaxPoints)) break;
+    
+    nAdd = min(max(nSelected/10, (unsigned long)1), MaxPoints - nSelected);
+    nAdd = min(nAdd, (unsigned long)Candidate.size());
+    nth_element(Candidate.begin(), Candidate.begin() + (nAdd-1), Candidate.end());
+    Candidate.resize(nAdd);
+    sort(Candidate.begin(), Candidate.end());
+    
+  }
+  
+  /*--- Evaluate the interpolation at all the points of the grid, the boundaries
+   keep their prescribed displacement ---*/
+  
+  double *Point_Disp = new double [nPoint*nDim];
+  
+  for (iPoint = 0; iPoint < nPoint; iPoint++) {
+    if (Control[iPoint]) {
+      for (iDim = 0; iDim < nDim; iDim++)
+        Point_Disp[iPoint*nDim+iDim] = Control_Disp[iPoint*nDim+iDim];
+    }
+    else {
+      GetRBF_Displacement(geometry->node[iPoint]->GetCoord(), &Point_Disp[iPoint*nDim]);
+    }
+  }
+  
+  /*--- Set to zero the normal displacement of the symmetry planes ---*/
+  
+  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+    if ((config->GetMarker_All_KindBC(iMarker) == SYMMETRY_PLANE) && (nDim == 3)) {
+      
+      for (iDim = 0; iDim < nDim; iDim++) MeanCoord[iDim] = 0.0;
+      for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
+        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        Coord = geometry->node[iPoint]->GetCoord();
+        for (iDim = 0; iDim < nDim; iDim++)
+          MeanCoord[iDim] += Coord[iDim]*Coord[iDim];
+      }
+      for (iDim = 0; iDim < nDim; iDim++) MeanCoord[iDim] = sqrt(MeanCoord[iDim]);
+      
+      if ((MeanCoord[0] <= MeanCoord[1]) && (MeanCoord[0] <= MeanCoord[2])) axis = 0;
+      if ((MeanCoord[1] <= MeanCoord[0]) && (MeanCoord[1] <= MeanCoord[2])) axis = 1;
+      if ((MeanCoord[2] <= MeanCoord[0]) && (MeanCoord[2] <= MeanCoord[1])) axis = 2;
+      
+      for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
+        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        if (!Control[iPoint]) Point_Disp[iPoint*nDim+axis] = 0.0;
+      }
+    }
+  }
+  
+  /*--- Fix the location of any points in the domain, if requested ---*/
+  
+  if (config->GetHold_GridFixed()) {
+    Hold_GridFixed_Coord = config->GetHold_GridFixed_Coord();
+    for (iPoint = 0; iPoint < nPoint; iPoint++) {
+      Coord = geometry->node[iPoint]->GetCoord();
+      for (iDim = 0; iDim < nDim; iDim++)
+        if ((Coord[iDim] < Hold_GridFixed_Coord[iDim]) || (Coord[iDim] > Hold_GridFixed_Coord[iDim+3]))
+          Point_Disp[iPoint*nDim+iDim] = 0.0;
+    }
+  }
+  
+  /*--- Update the grid coordinates and cell volumes ---*/
+  
+  for (iPoint = 0; iPoint < nPoint; iPoint++)
+    for (iDim = 0; iDim < nDim; iDim++) {
+      new_coord = geometry->node[iPoint]->GetCoord(iDim) + Point_Disp[iPoint*nDim+iDim];
+      if (fabs(new_coord) < EPS*EPS) new_coord = 0.0;
+      geometry->node[iPoint]->SetCoord(iDim, new_coord);
+    }
+  
+  if (UpdateGeo)
+    UpdateDualGrid(geometry, config);
+  
+  /*--- Check for failed deformation (negative volumes). ---*/
+  
+  MinVolume = Check_Grid(geometry);
+  
+  if (rank == MASTER_NODE) {
+    cout << "RBF control points: " << nSelected << "/" << nControl << ". Max. interpolation error: " << MaxError << ". ";
+    if (nDim == 2) cout << "Min. area: " << MinVolume << "." << endl;
+    else cout << "Min. volume: " << MinVolume << "." << endl;
+  }
+  
+  delete [] Control; delete [] Control_Disp; delete [] Point_Disp;
+  
+}
+
+void CVolumetricMovement::SetRBF_Bins(void) {
+  
+  unsigned short iDim;
+  unsigned long iPoint, nPoint_RBF = RBF_Coord.size()/nDim, iBin, nBin;
+  long Bin[3];
+  double Max[3];
+  
+  /*--- Bins are larger than the support radius, so only the neighboring
+   bins have to be visited (at most 64 bins in each direction) ---*/
+  
+  for (iDim = 0; iDim < 3; iDim++) {
+    RBF_Bin_Min[iDim] = 0.0; Max[iDim] = 0.0; RBF_Bin_Size[iDim] = 1.0; RBF_nBin[iDim] = 1;
+  }
+  for (iDim = 0; iDim < nDim; iDim++) {
+    RBF_Bin_Min[iDim] = RBF_Coord[iDim]; Max[iDim] = RBF_Coord[iDim];
+    for (iPoint = 1; iPoint < nPoint_RBF; iPoint++) {
+      RBF_Bin_Min[iDim] = min(RBF_Bin_Min[iDim], RBF_Coord[iPoint*nDim+iDim]);
+      Max[iDim] = max(Max[iDim], RBF_Coord[iPoint*nDim+iDim]);
+    }
+    RBF_Bin_Size[iDim] = max(RBF_Radius, (Max[iDim]-RBF_Bin_Min[iDim])/64.0);
+    RBF_nBin[iDim] = long((Max[iDim]-RBF_Bin_Min[iDim])/RBF_Bin_Size[iDim]) + 1;
+  }
+  
+  nBin = RBF_nBin[0]*RBF_nBin[1]*RBF_nBin[2];
+  RBF_Bin_Ptr.assign(nBin+1, 0);
+  RBF_Bin_Point.resize(nPoint_RBF);
+  
+  vector<unsigned long> Point_Bin(nPoint_RBF);
+  for (iPoint = 0; iPoint < nPoint_RBF; iPoint++) {
+    for (iDim = 0; iDim < 3; iDim++) Bin[iDim] = 0;
+    for (iDim = 0; iDim < nDim; iDim++)
+      Bin[iDim] = min(long((RBF_Coord[iPoint*nDim+iDim]-RBF_Bin_Min[iDim])/RBF_Bin_Size[iDim]), RBF_nBin[iDim]-1);
+    Point_Bin[iPoint] = (Bin[0]*RBF_nBin[1] + Bin[1])*RBF_nBin[2] + Bin[2];
+    RBF_Bin_Ptr[Point_Bin[iPoint]+1]++;
+  }
+  
+  for (iBin = 0; iBin < nBin; iBin++)
+    RBF_Bin_Ptr[iBin+1] += RBF_Bin_Ptr[iBin];
+  
+  vector<unsigned long> Count(RBF_Bin_Ptr.begin(), RBF_Bin_Ptr.end()-1);
+  for (iPoint = 0; iPoint < nPoint_RBF; iPoint++)
+    RBF_Bin_Point[Count[Point_Bin[iPoint]]++] = iPoint;
+  
+}
+
+void CVolumetricMovement::GetRBF_Displacement(double *Coord, double *Disp) {
+  
+  unsigned short iDim;
+  unsigned long iPoint, index, iBin;
+  long Bin[3], BinMin[3] = {0, 0, 0}, BinMax[3] = {0, 0, 0}, i, j, k;
+  double Dist, Phi;
+  
+  for (iDim = 0; iDim < nDim; iDim++) Disp[iDim] = 0.0;
   
-  LinSysSol.~CSysVector();
-  LinSysRes.~CSysVector();
-  StiffMatrix.~CSysMatrix();
+  for (iDim = 0; iDim < nDim; iDim++) {
+    Bin[iDim] = long(floor((Coord[iDim]-RBF_Bin_Min[iDim])/RBF_Bin_Size[iDim]));
+    if ((Bin[iDim] < -1) || (Bin[iDim] > RBF_nBin[iDim])) return;
+    BinMin[iDim] = max(Bin[iDim]-1, 0L);
+    BinMax[iDim] = min(Bin[iDim]+1, RBF_nBin[iDim]-1);
+  }
+  
+  for (i = BinMin[0]; i <= BinMax[0]; i++)
+    for (j = BinMin[1]; j <= BinMax[1]; j++)
+      for (k = BinMin[2]; k <= BinMax[2]; k++) {
+        iBin = (i*RBF_nBin[1] + j)*RBF_nBin[2] + k;
+        for (index = RBF_Bin_Ptr[iBin]; index < RBF_Bin_Ptr[iBin+1]; index++) {
+          iPoint = RBF_Bin_Point[index];
+          Dist = 0.0;
+          for (iDim = 0; iDim < nDim; iDim++)
+            Dist += (Coord[iDim]-RBF_Coord[iPoint*nDim+iDim])*(Coord[iDim]-RBF_Coord[iPoint*nDim+iDim]);
+          if (Dist >= RBF_Radius*RBF_Radius) continue;
+          Phi = GetRBF_Kernel(sqrt(Dist));
+          for (iDim = 0; iDim < nDim; iDim++)
+            Disp[iDim] += Phi*RBF_Coeff[iPoint*nDim+iDim];
+        }
+      }
   
 }
 
@@ -450,23 +972,10 @@ void CVolumetricMovement::ComputeDeforming_Wall_Distance(CGeometry *geometry, CC
 
 double CVolumetricMovement::SetFEAMethodContributions_Elem(CGeometry *geometry, CConfig *config) {
   
-	unsigned short iVar, iDim, nNodes = 0, iNodes;
+	unsigned short iDim, nNodes = 0, iNodes;
 	unsigned long Point_0, Point_1, iElem, iEdge, ElemCounter = 0, PointCorners[8];
-  double *Coord_0, *Coord_1, Length, MinLength = 1E10, **StiffMatrix_Elem = NULL, Scale, CoordCorners[8][3];
-  double *Edge_Vector = new double [nDim];
-  
-  /*--- Allocate maximum size (rectangle and hexahedron) ---*/
-  
-  if (nDim == 2) {
-    StiffMatrix_Elem = new double* [8];
-    for (iVar = 0; iVar < 8; iVar++)
-      StiffMatrix_Elem[iVar] = new double [8];
-  }
-  if (nDim == 3) {
-    StiffMatrix_Elem = new double* [24];
-    for (iVar = 0; iVar < 24; iVar++)
-      StiffMatrix_Elem[iVar] = new double [24];
-  }
+  double *Coord_0, *Coord_1, Length, MinLength = 1E10, Scale, CoordCorners[8][3];
+  double Edge_Vector[3];
   
   /*--- Check the minimum edge length in the entire mesh. ---*/
   
@@ -521,7 +1030,7 @@ double CVolumetricMovement::SetFEAMethodContributions_Elem(CGeometry *geometry,
     if (nDim == 2) SetFEA_StiffMatrix2D(geometry, config, StiffMatrix_Elem, PointCorners, CoordCorners, nNodes, Scale);
     if (nDim == 3) SetFEA_StiffMatrix3D(geometry, config, StiffMatrix_Elem, PointCorners, CoordCorners, nNodes, Scale);
 
-    AddFEA_StiffMatrix(geometry, StiffMatrix_Elem, PointCorners, nNodes);
+    AddFEA_StiffMatrix(geometry, StiffMatrix_Elem, iElem, nNodes);
     
 	}
   
@@ -530,21 +1039,6 @@ double CVolumetricMovement::SetFEAMethodContributions_Elem(CGeometry *geometry,
   MPI_Allreduce(&ElemCounter_Local, &ElemCounter, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
 #endif
   
-  /*--- Deallocate memory and exit ---*/
-  
-  if (nDim == 2) {
-    for (iVar = 0; iVar < 8; iVar++)
-      delete StiffMatrix_Elem[iVar];
-    delete [] StiffMatrix_Elem;
-  }
-  if (nDim == 3) {
-    for (iVar = 0; iVar < 24; iVar++)
-      delete StiffMatrix_Elem[iVar];
-    delete [] StiffMatrix_Elem;
-  }
-  
-  delete [] Edge_Vector;
-  
   /*--- If there are no degenerate cells, use the minimum volume instead ---*/
   if (ElemCounter == 0) MinLength = Scale;
   
@@ -1269,7 +1763,7 @@ double CVolumetricMovement::GetHexa_Volume(double CoordCorners[8][3]) {
 void CVolumetricMovement::SetFEA_StiffMatrix2D(CGeometry *geometry, CConfig *config, double **StiffMatrix_Elem, unsigned long PointCorners[8], double CoordCorners[8][3], unsigned short nNodes, double scale) {
   
   double B_Matrix[3][8], D_Matrix[3][3], Aux_Matrix[8][3];
-  double Xi = 0.0, Eta = 0.0, Det = 0.0, E, Lambda = 0.0, Nu, Mu = 0.0, Avg_Wall_Dist;
+  double Xi = 0.0, Eta = 0.0, Det = 0.0, E, Lambda = 0.0, Nu, Mu = 0.0, Avg_Wall_Dist, Aux;
   unsigned short iNode, jNode, iVar, jVar, kVar, iGauss, nGauss = 0;
   double DShapeFunction[8][4] = {{0.0, 0.0, 0.0, 0.0}, {0.0, 0.0, 0.0, 0.0}, {0.0, 0.0, 0.0, 0.0}, {0.0, 0.0, 0.0, 0.0},
     {0.0, 0.0, 0.0, 0.0}, {0.0, 0.0, 0.0, 0.0}, {0.0, 0.0, 0.0, 0.0}, {0.0, 0.0, 0.0, 0.0}};
@@ -1379,21 +1873,29 @@ void CVolumetricMovement::SetFEA_StiffMatrix2D(CGeometry *geometry, CConfig *con
      matrix using Gauss integration ---*/
     
     for (iVar = 0; iVar < nNodes*nVar; iVar++) {
-      for (jVar = 0; jVar < nNodes*nVar; jVar++) {
-        for (kVar = 0; kVar < 3; kVar++) {
-          StiffMatrix_Elem[iVar][jVar] += Weight[iGauss] * Aux_Matrix[iVar][kVar]*B_Matrix[kVar][jVar] * Det;
-        }
+      for (jVar = iVar; jVar < nNodes*nVar; jVar++) {
+        Aux = 0.0;
+        for (kVar = 0; kVar < 3; kVar++)
+          Aux += Aux_Matrix[iVar][kVar]*B_Matrix[kVar][jVar];
+        StiffMatrix_Elem[iVar][jVar] += Weight[iGauss] * Aux * Det;
       }
     }
     
   }
   
+  /*--- The element stiffness matrix is symmetric (D is symmetric), only the
+   upper triangle has been integrated ---*/
+  
+  for (iVar = 0; iVar < nNodes*nVar; iVar++)
+    for (jVar = 0; jVar < iVar; jVar++)
+      StiffMatrix_Elem[iVar][jVar] = StiffMatrix_Elem[jVar][iVar];
+  
 }
 
 void CVolumetricMovement::SetFEA_StiffMatrix3D(CGeometry *geometry, CConfig *config, double **StiffMatrix_Elem, unsigned long PointCorners[8], double CoordCorners[8][3], unsigned short nNodes, double scale) {
   
   double B_Matrix[6][24], D_Matrix[6][6], Aux_Matrix[24][6];
-  double Xi = 0.0, Eta = 0.0, Mu = 0.0, Det = 0.0, E, Lambda = 0.0, Nu, Avg_Wall_Dist;
+  double Xi = 0.0, Eta = 0.0, Mu = 0.0, Det = 0.0, E, Lambda = 0.0, Nu, Avg_Wall_Dist, Aux;
   unsigned short iNode, jNode, iVar, jVar, kVar, iGauss, nGauss = 0;
   double DShapeFunction[8][4] = {{0.0, 0.0, 0.0, 0.0}, {0.0, 0.0, 0.0, 0.0}, {0.0, 0.0, 0.0, 0.0}, {0.0, 0.0, 0.0, 0.0},
     {0.0, 0.0, 0.0, 0.0}, {0.0, 0.0, 0.0, 0.0}, {0.0, 0.0, 0.0, 0.0}, {0.0, 0.0, 0.0, 0.0}};
@@ -1542,32 +2044,32 @@ void CVolumetricMovement::SetFEA_StiffMatrix3D(CGeometry *geometry, CConfig *con
      matrix using Gauss integration ---*/
     
     for (iVar = 0; iVar < nNodes*nVar; iVar++) {
-      for (jVar = 0; jVar < nNodes*nVar; jVar++) {
-        for (kVar = 0; kVar < 6; kVar++) {
-          StiffMatrix_Elem[iVar][jVar] += Weight[iGauss] * Aux_Matrix[iVar][kVar]*B_Matrix[kVar][jVar] * Det;
-        }
+      for (jVar = iVar; jVar < nNodes*nVar; jVar++) {
+        Aux = 0.0;
+        for (kVar = 0; kVar < 6; kVar++)
+          Aux += Aux_Matrix[iVar][kVar]*B_Matrix[kVar][jVar];
+        StiffMatrix_Elem[iVar][jVar] += Weight[iGauss] * Aux * Det;
       }
     }
     
   }
   
+  /*--- The element stiffness matrix is symmetric (D is symmetric), only the
+   upper triangle has been integrated ---*/
+  
+  for (iVar = 0; iVar < nNodes*nVar; iVar++)
+    for (jVar = 0; jVar < iVar; jVar++)
+      StiffMatrix_Elem[iVar][jVar] = StiffMatrix_Elem[jVar][iVar];
+  
 }
 
-void CVolumetricMovement::AddFEA_StiffMatrix(CGeometry *geometry, double **StiffMatrix_Elem, unsigned long PointCorners[8], unsigned short nNodes) {
+void CVolumetricMovement::AddFEA_StiffMatrix(CGeometry *geometry, double **StiffMatrix_Elem, unsigned long iElem, unsigned short nNodes) {
   unsigned short iVar, jVar, iDim, jDim;
-  unsigned short nVar = geometry->GetnDim();
-
-  double **StiffMatrix_Node;
-  StiffMatrix_Node = new double* [nVar];
-  for (iVar = 0; iVar < nVar; iVar++)
-    StiffMatrix_Node[iVar] = new double [nVar];
-  
-  for (iVar = 0; iVar < nVar; iVar++)
-    for (jVar = 0; jVar < nVar; jVar++)
-      StiffMatrix_Node[iVar][jVar] = 0.0;
+  unsigned long *Block = &Elem_Block[Elem_Block_Ptr[iElem]];
   
   /*--- Transform the stiffness matrix for the hexahedral element into the
-   contributions for the individual nodes relative to each other. ---*/
+   contributions for the individual nodes relative to each other (the position
+   of each block in the sparse matrix is known from the element map). ---*/
   
   for (iVar = 0; iVar < nNodes; iVar++) {
     for (jVar = 0; jVar < nNodes; jVar++) {
@@ -1578,17 +2080,11 @@ void CVolumetricMovement::AddFEA_StiffMatrix(CGeometry *geometry, double **Stiff
         }
       }
 
-      StiffMatrix.AddBlock(PointCorners[iVar], PointCorners[jVar], StiffMatrix_Node);
+      StiffMatrix.AddBlock_Index(Block[iVar*nNodes+jVar], StiffMatrix_Node);
       
     }
   }
   
-  /*--- Deallocate memory and exit ---*/
-  
-  for (iVar = 0; iVar < nVar; iVar++)
-    delete StiffMatrix_Node[iVar];
-  delete [] StiffMatrix_Node;
-  
 }
 
 void CVolumetricMovement::SetBoundaryDisplacements(CGeometry *geometry, CConfig *config) {
@@ -1886,9 +2382,10 @@ void CVolumetricMovement::Rigid_Rotation(CGeometry *geometry, CConfig *config,
     config->SetRefOriginMoment_Z(jMarker, Center[2]+rotCoord[2]);
   }
   
-	/*--- After moving all nodes, update geometry class ---*/
+	/*--- After moving all nodes, rotate the normals of the dual grid (the
+   control volumes of a rigid motion do not change) ---*/
   
-	UpdateDualGrid(geometry, config);
+	UpdateRigidDualGrid(geometry, rotMatrix);
 
 }
 
@@ -2050,9 +2547,10 @@ void CVolumetricMovement::Rigid_Pitching(CGeometry *geometry, CConfig *config, u
   
   /*--- For pitching we don't update the motion origin and moment reference origin. ---*/
 
-	/*--- After moving all nodes, update geometry class ---*/
+	/*--- After moving all nodes, rotate the normals of the dual grid (the
+   control volumes of a rigid motion do not change) ---*/
   
-	UpdateDualGrid(geometry, config);
+	UpdateRigidDualGrid(geometry, rotMatrix);
   
 }
 
@@ -2192,10 +2690,8 @@ void CVolumetricMovement::Rigid_Plunging(CGeometry *geometry, CConfig *config, u
     config->SetRefOriginMoment_Z(jMarker, Center[2]);
   }
   
-	/*--- After moving all nodes, update geometry class ---*/
-	
-  UpdateDualGrid(geometry, config);
-  
+	/*--- A translation leaves the dual grid (volumes and normals) unchanged ---*/
+
 }
 
 void CVolumetricMovement::Rigid_Translation(CGeometry *geometry, CConfig *config, unsigned short iZone, unsigned long iter) {
@@ -2310,19 +2806,30 @@ void CVolumetricMovement::Rigid_Translation(CGeometry *geometry, CConfig *config
     config->SetRefOriginMoment_Z(jMarker, Center[2]);
   }
   
-	/*--- After moving all nodes, update geometry class ---*/
-	
-  UpdateDualGrid(geometry, config);
-  
+	/*--- A translation leaves the dual grid (volumes and normals) unchanged ---*/
+
 }
 
 CSurfaceMovement::CSurfaceMovement(void) : CGridMovement() {
 	nFFDBox = 0;
   nLevel = 0;
 	FFDBoxDefinition = false;
+  FFDBox = NULL;
 }
 
-CSurfaceMovement::~CSurfaceMovement(void) {}
+CSurfaceMovement::~CSurfaceMovement(void) {
+  
+  unsigned short iFFDBox;
+  
+  /*--- Only the boxes read by SetSurface_Deformation belong to the class ---*/
+  
+  if (FFDBox != NULL) {
+    for (iFFDBox = 0; iFFDBox < nFFDBox; iFFDBox++)
+      delete FFDBox[iFFDBox];
+    delete [] FFDBox;
+  }
+  
+}
 
 void CSurfaceMovement::SetSurface_Deformation(CGeometry *geometry, CConfig *config) {
   
@@ -2334,6 +2841,16 @@ void CSurfaceMovement::SetSurface_Deformation(CGeometry *geometry, CConfig *conf
 	MPI_Comm_rank(MPI_COMM_WORLD, &rank);
 #endif
   
+  /*--- The boxes of a previous deformation (e.g. of the resident drivers of
+   the library) are read again from the grid file ---*/
+  
+  if (FFDBox != NULL) {
+    for (iFFDBox = 0; iFFDBox < nFFDBox; iFFDBox++)
+      delete FFDBox[iFFDBox];
+    delete [] FFDBox;
+    FFDBox = NULL; nFFDBox = 0;
+  }
+  
   /*--- Setting the Free Form Deformation ---*/
 
   if (config->GetDesign_Variable(0) == FFD_SETTING) {
@@ -2922,7 +3439,7 @@ void CSurfaceMovement::UpdateParametricCoord(CGeometry *geometry, CConfig *confi
 void CSurfaceMovement::SetCartesianCoord(CGeometry *geometry, CConfig *config, CFreeFormDefBox *FFDBox, unsigned short iFFDBox) {
   
 	double *CartCoordNew, Diff, my_MaxDiff = 0.0, MaxDiff,
-	*ParamCoord, VarCoord[3] = {0.0, 0.0, 0.0}, CartCoordOld[3] = {0.0, 0.0, 0.0};
+	VarCoord[3] = {0.0, 0.0, 0.0}, CartCoordOld[3] = {0.0, 0.0, 0.0};
 	unsigned short iMarker, iDim;
 	unsigned long iVertex, iPoint, iSurfacePoints;
 	int rank;
@@ -2954,14 +3471,10 @@ void CSurfaceMovement::SetCartesianCoord(CGeometry *geometry, CConfig *config, C
       
 			geometry->vertex[iMarker][iVertex]->SetVarCoord(VarCoord);
       
-			/*--- Get the parametric coordinate of the surface point ---*/
-      
-			ParamCoord = FFDBox->Get_ParametricCoord(iSurfacePoints);
-			
-			/*--- Compute the new cartesian coordinate, and set the value in
-			 the FFDBox structure ---*/
+			/*--- Compute the new cartesian coordinate using the cached Bernstein
+			 basis of the surface point, and set the value in the FFDBox structure ---*/
       
-			CartCoordNew = FFDBox->EvalCartesianCoord(ParamCoord);
+			CartCoordNew = FFDBox->EvalSurfaceCartesianCoord(iSurfacePoints);
 			FFDBox->Set_CartesianCoord(CartCoordNew, iSurfacePoints);
 			
 			/*--- Get the original cartesian coordinates of the surface point ---*/
@@ -3140,6 +3653,67 @@ void CSurfaceMovement::SetFFDCPChange(CGeometry *geometry, CConfig *config, CFre
   
 }
 
+bool CSurfaceMovement::GetFFDCPDerivative(CConfig *config, CFreeFormDefBox *FFDBox, unsigned short iDV,
+                                          unsigned long iSurfacePoints, double *val_dX) {
+	
+	double movement[3], *Basis, Weight = 1.0, Sum;
+	int index[3];
+	unsigned short iDim, iDegree, Degree[3], Offset = 0;
+	bool Design_2D = (config->GetDesign_Variable(iDV) == FFD_CONTROL_POINT_2D);
+	
+	for (iDim = 0; iDim < 3; iDim++) val_dX[iDim] = 0.0;
+	
+	if (config->GetFFDTag(iDV).compare(FFDBox->GetTag()) != 0) return false;
+	
+	/*--- Same parameters as SetFFDCPChange_2D and SetFFDCPChange, per unit of DV value ---*/
+	
+	if (Design_2D) {
+		index[0] = int(config->GetParamDV(iDV, 1));
+		index[1] = int(config->GetParamDV(iDV, 2));
+		index[2] = -1;
+		movement[0] = config->GetParamDV(iDV, 3);
+		movement[1] = config->GetParamDV(iDV, 4);
+		movement[2] = 0.0;
+	}
+	else {
+		index[0] = int(config->GetParamDV(iDV, 1));
+		index[1] = int(config->GetParamDV(iDV, 2));
+		index[2] = int(config->GetParamDV(iDV, 3));
+		movement[0] = config->GetParamDV(iDV, 4);
+		movement[1] = config->GetParamDV(iDV, 5);
+		movement[2] = config->GetParamDV(iDV, 6);
+		
+		/*--- SetFFDCPChange does not move anything if the three indices are -1 ---*/
+		
+		if ((index[0] == -1) && (index[1] == -1) && (index[2] == -1)) return true;
+	}
+	
+	/*--- A -1 index moves the whole row of control points, so the basis is summed
+	 along that direction (in 2D, the lower and upper control points are moved) ---*/
+	
+	Degree[0] = FFDBox->GetlOrder()-1; Degree[1] = FFDBox->GetmOrder()-1; Degree[2] = FFDBox->GetnOrder()-1;
+	Basis = FFDBox->GetSurfaceBasis(iSurfacePoints);
+	
+	for (iDim = 0; iDim < 3; iDim++) {
+		if (index[iDim] == -1) {
+			Sum = 0.0;
+			for (iDegree = 0; iDegree <= Degree[iDim]; iDegree++) {
+				if (Design_2D && (iDim == 2) && (iDegree > 1)) break;
+				Sum += Basis[Offset+iDegree];
+			}
+		}
+		else Sum = Basis[Offset+index[iDim]];
+		Weight *= Sum;
+		Offset += Degree[iDim]+1;
+	}
+	
+	for (iDim = 0; iDim < 3; iDim++)
+		val_dX[iDim] = Weight*movement[iDim];
+	
+	return true;
+	
+}
+
 void CSurfaceMovement::SetFFDCamber_2D(CGeometry *geometry, CConfig *config, CFreeFormDefBox *FFDBox,
 																		unsigned short iDV, bool ResetDef) {
 	double Ampl, movement[3];
@@ -3527,25 +4101,13 @@ void CSurfaceMovement::SetFFDControl_Surface(CGeometry *geometry, CConfig *confi
 	
 }
 
-void CSurfaceMovement::SetHicksHenne(CGeometry *boundary, CConfig *config, unsigned short iDV, bool ResetDef) {
-	unsigned long iVertex, Point;
+double CSurfaceMovement::GetAirfoil_AoA(CGeometry *boundary, CConfig *config) {
+	unsigned long iVertex;
 	unsigned short iMarker;
-	double VarCoord[3], VarCoord_[3], *Coord_, *Normal_, ek, fk, BumpSize = 1.0, BumpLoc = 0.0, Coord[3], Normal[3],
-  xCoord, TPCoord[2] = {0.0, 0.0}, LPCoord[2] = {0.0, 0.0}, Distance, Chord, AoA, ValCos, ValSin;
+	double *Coord_, TPCoord[2] = {0.0, 0.0}, LPCoord[2] = {0.0, 0.0}, Distance, Chord;
   
-	bool upper = true, double_surface = false;
-
-	/*--- Reset airfoil deformation if first deformation or if it required by the solver ---*/
-  
-	if ((iDV == 0) || (ResetDef == true)) {
-		for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++)
-			for (iVertex = 0; iVertex < boundary->nVertex[iMarker]; iVertex++) {
-				VarCoord[0] = 0.0; VarCoord[1] = 0.0; VarCoord[2] = 0.0;
-				boundary->vertex[iMarker][iVertex]->SetVarCoord(VarCoord);
-			}
-	}
-  
-  /*--- Compute the angle of attack to apply the deformation ---*/
+  /*--- The trailing edge is the point of largest x, the leading edge the point
+   farthest from it ---*/
   
 	for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
     if (config->GetMarker_All_DV(iMarker) == YES) {
@@ -3560,9 +4122,8 @@ void CSurfaceMovement::SetHicksHenne(CGeometry *boundary, CConfig *config, unsig
   
 #ifdef HAVE_MPI
 
-  unsigned long *Buffer_Send_nVertex, *Buffer_Receive_nVertex;
 	int iProcessor, nProcessor;
-	double *Buffer_Send_Coord, *Buffer_Receive_Coord;
+	double *Buffer_Send_Coord, *Buffer_Receive_Coord, Coord[2];
 
 	MPI_Comm_size(MPI_COMM_WORLD, &nProcessor);
   
@@ -3619,7 +4180,31 @@ void CSurfaceMovement::SetHicksHenne(CGeometry *boundary, CConfig *config, unsig
   
 #endif
   
-  AoA = atan((LPCoord[1] - TPCoord[1]) / (TPCoord[0] - LPCoord[0]))*180/PI_NUMBER;
+  return atan((LPCoord[1] - TPCoord[1]) / (TPCoord[0] - LPCoord[0]))*180/PI_NUMBER;
+  
+}
+
+void CSurfaceMovement::SetHicksHenne(CGeometry *boundary, CConfig *config, unsigned short iDV, bool ResetDef) {
+	unsigned long iVertex, Point;
+	unsigned short iMarker;
+	double VarCoord[3], VarCoord_[3], *Coord_, *Normal_, ek, fk, BumpSize = 1.0, BumpLoc = 0.0, Coord[3], Normal[3],
+  xCoord, AoA, ValCos, ValSin;
+  
+	bool upper = true, double_surface = false;
+
+	/*--- Reset airfoil deformation if first deformation or if it required by the solver ---*/
+  
+	if ((iDV == 0) || (ResetDef == true)) {
+		for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++)
+			for (iVertex = 0; iVertex < boundary->nVertex[iMarker]; iVertex++) {
+				VarCoord[0] = 0.0; VarCoord[1] = 0.0; VarCoord[2] = 0.0;
+				boundary->vertex[iMarker][iVertex]->SetVarCoord(VarCoord);
+			}
+	}
+  
+  /*--- Compute the angle of attack to apply the deformation ---*/
+  
+  AoA = GetAirfoil_AoA(boundary, config);
   
 	/*--- Perform multiple airfoil deformation ---*/
   
@@ -3686,6 +4271,57 @@ void CSurfaceMovement::SetHicksHenne(CGeometry *boundary, CConfig *config, unsig
   
 }
 
+bool CSurfaceMovement::GetHicksHenneDerivative(CConfig *config, unsigned short iDV, double val_AoA,
+                                               double *val_Coord, double *val_Normal, double *val_dX) {
+	double dX[3] = {0.0, 0.0, 0.0}, Coord[3], Normal[3], ek, fk, xCoord, ValCos, ValSin, BumpSize = 1.0, BumpLoc = 0.0;
+	double xk = config->GetParamDV(iDV, 1);
+	const double t2 = 3.0;
+	bool upper = true, double_surface = false;
+	
+	for (unsigned short iDim = 0; iDim < 3; iDim++) val_dX[iDim] = 0.0;
+	
+	if (config->GetParamDV(iDV, 0) == NO)  { upper = false; double_surface = true; }
+	if (config->GetParamDV(iDV, 0) == YES) { upper = true; double_surface = true; }
+	
+	/*--- Same bump as SetHicksHenne, per unit of DV value, in the frame of the airfoil ---*/
+	
+	ValCos = cos(val_AoA*PI_NUMBER/180.0);
+	ValSin = sin(val_AoA*PI_NUMBER/180.0);
+	
+	Coord[0] = val_Coord[0]*ValCos - val_Coord[1]*ValSin;
+	Coord[0] = max(0.0, Coord[0]);
+	Coord[1] = val_Coord[1]*ValCos + val_Coord[0]*ValSin;
+	
+	Normal[0] = val_Normal[0]*ValCos - val_Normal[1]*ValSin;
+	Normal[1] = val_Normal[1]*ValCos + val_Normal[0]*ValSin;
+	
+	if (double_surface) {
+		ek = log10(0.5)/log10(xk);
+		fk = pow( sin( PI_NUMBER * pow(Coord[0],ek) ) , t2);
+		if (( upper) && (Normal[1] > 0)) { dX[1] =  fk; }
+		if ((!upper) && (Normal[1] < 0)) { dX[1] = -fk; }
+	}
+	else {
+		xCoord = Coord[0] - BumpLoc;
+		ek = log10(0.5)/log10(xk/BumpSize);
+		fk = pow( sin( PI_NUMBER * pow(xCoord/BumpSize,ek)),t2);
+		if ((xCoord > 0.0) && (xCoord < BumpSize)) dX[1] = fk;
+	}
+	
+	if (dX[1] == 0.0) return false;
+	
+	/*--- Back to the frame of the grid ---*/
+	
+	ValCos = cos(-val_AoA*PI_NUMBER/180.0);
+	ValSin = sin(-val_AoA*PI_NUMBER/180.0);
+	
+	val_dX[0] = dX[0]*ValCos - dX[1]*ValSin;
+	val_dX[1] = dX[1]*ValCos + dX[0]*ValSin;
+	
+	return true;
+	
+}
+
 void CSurfaceMovement::SetSpherical(CGeometry *boundary, CConfig *config, unsigned short iDV, bool ResetDef) {
   
 	unsigned long iVertex, iPoint, n;
@@ -5737,6 +6373,11 @@ void CSurfaceMovement::ReadFFDInfo(CGeometry *geometry, CConfig *config, CFreeFo
             FFDBox_line >> coord[0]; FFDBox_line >> coord[1]; FFDBox_line >> coord[2];
             
             if (val_fullmesh) {  // With vertices information (mesh deformation).
+              
+              /*--- The points are numbered as in the grid file, which is not
+               the local numbering if the points were renumbered (RCM) ---*/
+              
+              iPoint = geometry->GetFile_to_Local_Point(iPoint);
               for(iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
                 jPoint =  geometry->vertex[iMarker][iVertex]->GetNode();
                 if (iPoint == jPoint) {
@@ -5868,7 +6509,7 @@ void CSurfaceMovement::WriteFFDInfo(CGeometry *geometry, CConfig *config, string
       for (iSurfacePoints = 0; iSurfacePoints < FFDBox[iFFDBox]->GetnSurfacePoint(); iSurfacePoints++) {
         iMarker = FFDBox[iFFDBox]->Get_MarkerIndex(iSurfacePoints);
         iVertex = FFDBox[iFFDBox]->Get_VertexIndex(iSurfacePoints);
-        iPoint = FFDBox[iFFDBox]->Get_PointIndex(iSurfacePoints);
+        iPoint = geometry->GetLocal_to_File_Point(FFDBox[iFFDBox]->Get_PointIndex(iSurfacePoints));
         parcoord = FFDBox[iFFDBox]->Get_ParametricCoord(iSurfacePoints);
         mesh_file << scientific << config->GetMarker_All_TagBound(iMarker) << "\t" << iPoint << "\t" << parcoord[0] << "\t" << parcoord[1] << "\t" << parcoord[2] << endl;
       }
@@ -6281,39 +6922,202 @@ double *CFreeFormDefBox::GetParametricCoord_Analytical(double *cart_coord) {
 }
 
 double *CFreeFormDefBox::EvalCartesianCoord(double *ParamCoord) {
+	unsigned short lOrder_ = lDegree+1, mOrder_ = mDegree+1, nOrder_ = nDegree+1;
+	
+	/*--- Evaluate the 1D basis of each direction once, and contract ---*/
+	
+	BasisScratch.resize(lOrder_+mOrder_+nOrder_);
+	double *uBasis = &BasisScratch[0], *vBasis = uBasis+lOrder_, *wBasis = vBasis+mOrder_;
+	
+	GetBernsteinBasis(lDegree, ParamCoord[0], uBasis);
+	GetBernsteinBasis(mDegree, ParamCoord[1], vBasis);
+	GetBernsteinBasis(nDegree, ParamCoord[2], wBasis);
+	
+	return EvalCartesianCoord(uBasis, vBasis, wBasis);
+}
+
+double *CFreeFormDefBox::EvalCartesianCoord(double *val_ubasis, double *val_vbasis, double *val_wbasis) {
 	unsigned short iDim, iDegree, jDegree, kDegree;
+	double uvBasis, Basis, *Coord;
 	
 	for (iDim = 0; iDim < nDim; iDim++)
 		cart_coord[iDim] = 0.0;
 	
-	for (iDegree = 0; iDegree <= lDegree; iDegree++)
-		for (jDegree = 0; jDegree <= mDegree; jDegree++)
-			for (kDegree = 0; kDegree <= nDegree; kDegree++)
+	for (iDegree = 0; iDegree <= lDegree; iDegree++) {
+		if (val_ubasis[iDegree] == 0.0) continue;
+		for (jDegree = 0; jDegree <= mDegree; jDegree++) {
+			uvBasis = val_ubasis[iDegree]*val_vbasis[jDegree];
+			if (uvBasis == 0.0) continue;
+			for (kDegree = 0; kDegree <= nDegree; kDegree++) {
+				Basis = uvBasis*val_wbasis[kDegree];
+				Coord = Coord_Control_Points[iDegree][jDegree][kDegree];
+				for (iDim = 0; iDim < nDim; iDim++)
+					cart_coord[iDim] += Coord[iDim]*Basis;
+			}
+		}
+	}
+	
+	return cart_coord;
+}
+
+void CFreeFormDefBox::SetSurfaceBasis(void) {
+	unsigned long iSurfacePoints, nSurfacePoints = GetnSurfacePoint();
+	unsigned short lOrder_ = lDegree+1, mOrder_ = mDegree+1, nBasis = lDegree+mDegree+nDegree+3;
+	double *Basis;
+	
+	SurfaceBasis.resize(nSurfacePoints*nBasis);
+	
+	for (iSurfacePoints = 0; iSurfacePoints < nSurfacePoints; iSurfacePoints++) {
+		Basis = &SurfaceBasis[iSurfacePoints*nBasis];
+		GetBernsteinBasis(lDegree, ParametricCoord[0][iSurfacePoints], Basis);
+		GetBernsteinBasis(mDegree, ParametricCoord[1][iSurfacePoints], Basis+lOrder_);
+		GetBernsteinBasis(nDegree, ParametricCoord[2][iSurfacePoints], Basis+lOrder_+mOrder_);
+	}
+	
+}
+
+double *CFreeFormDefBox::GetSurfaceBasis(unsigned long val_iSurfacePoints) {
+	unsigned short nBasis = lDegree+mDegree+nDegree+3;
+	
+	/*--- The cache is dropped whenever a parametric coordinate or a degree changes ---*/
+	
+	if (SurfaceBasis.size() != GetnSurfacePoint()*nBasis) SetSurfaceBasis();
+	
+	return &SurfaceBasis[val_iSurfacePoints*nBasis];
+}
+
+double *CFreeFormDefBox::EvalSurfaceCartesianCoord(unsigned long val_iSurfacePoints) {
+	unsigned short lOrder_ = lDegree+1, mOrder_ = mDegree+1;
+	
+	double *Basis = GetSurfaceBasis(val_iSurfacePoints);
+	
+	return EvalCartesianCoord(Basis, Basis+lOrder_, Basis+lOrder_+mOrder_);
+}
+
+void CFreeFormDefBox::GetBernsteinBasis(short val_n, double val_t, double *val_basis) {
+	short iDegree, jDegree;
+	double Saved, Temp, val_t1 = 1.0 - val_t;
+	
+	val_basis[0] = 1.0;
+	for (jDegree = 1; jDegree <= val_n; jDegree++) {
+		Saved = 0.0;
+		for (iDegree = 0; iDegree < jDegree; iDegree++) {
+			Temp = val_basis[iDegree];
+			val_basis[iDegree] = Saved + val_t1*Temp;
+			Saved = val_t*Temp;
+		}
+		val_basis[jDegree] = Saved;
+	}
+	
+}
+
+void CFreeFormDefBox::GetBernsteinBasisDerivative(short val_n, double val_t, short val_order, double *val_basis) {
+	short iDegree, iOrder, nDegree_;
+	
+	for (iDegree = 0; iDegree <= val_n; iDegree++)
+		val_basis[iDegree] = 0.0;
+	
+	if (val_order > val_n) return;
+	
+	/*--- Start from the basis of degree n-order and apply order times
+	 (B_i^m)' = m*(B_(i-1)^(m-1) - B_i^(m-1)), from the top index down ---*/
+	
+	GetBernsteinBasis(val_n-val_order, val_t, val_basis);
+	
+	for (iOrder = val_order-1; iOrder >= 0; iOrder--) {
+		nDegree_ = val_n - iOrder;
+		for (iDegree = nDegree_; iDegree >= 0; iDegree--)
+			val_basis[iDegree] = double(nDegree_)*(((iDegree > 0) ? val_basis[iDegree-1] : 0.0) -
+                                             ((iDegree < nDegree_) ? val_basis[iDegree] : 0.0));
+	}
+	
+}
+
+void CFreeFormDefBox::EvalCartesianDerivatives(double *uvw, double *val_X, double val_dX[3][3], double val_d2X[3][3][3]) {
+	unsigned short iDim, jDim, kDim, iDegree, jDegree, kDegree, lmn[3], Order[3], iBasis;
+	double *Basis[3][3], B[3][3], dBasis[3], d2Basis[3][3], *Coord;
+	
+	lmn[0] = lDegree; lmn[1] = mDegree; lmn[2] = nDegree;
+	
+	/*--- Value, first and second derivative of the 1D basis of each direction ---*/
+	
+	BasisScratch.resize(3*(lDegree+mDegree+nDegree+3));
+	iBasis = 0;
+	for (iDim = 0; iDim < 3; iDim++) {
+		Order[iDim] = lmn[iDim]+1;
+		for (jDim = 0; jDim < 3; jDim++) {
+			Basis[iDim][jDim] = &BasisScratch[iBasis]; iBasis += Order[iDim];
+		}
+		GetBernsteinBasis(lmn[iDim], uvw[iDim], Basis[iDim][0]);
+		GetBernsteinBasisDerivative(lmn[iDim], uvw[iDim], 1, Basis[iDim][1]);
+		GetBernsteinBasisDerivative(lmn[iDim], uvw[iDim], 2, Basis[iDim][2]);
+	}
+	
+	for (iDim = 0; iDim < nDim; iDim++) {
+		val_X[iDim] = 0.0;
+		for (jDim = 0; jDim < 3; jDim++) {
+			val_dX[iDim][jDim] = 0.0;
+			for (kDim = 0; kDim < 3; kDim++) val_d2X[iDim][jDim][kDim] = 0.0;
+		}
+	}
+	
+	for (iDegree = 0; iDegree <= lmn[0]; iDegree++)
+		for (jDegree = 0; jDegree <= lmn[1]; jDegree++)
+			for (kDegree = 0; kDegree <= lmn[2]; kDegree++) {
+				
+				/*--- B[iDim][order] is the 1D basis (or derivative) of direction iDim ---*/
+				
+				for (iDim = 0; iDim < 3; iDim++) {
+					B[0][iDim] = Basis[0][iDim][iDegree];
+					B[1][iDim] = Basis[1][iDim][jDegree];
+					B[2][iDim] = Basis[2][iDim][kDegree];
+				}
+				
+				dBasis[0] = B[0][1]*B[1][0]*B[2][0];
+				dBasis[1] = B[0][0]*B[1][1]*B[2][0];
+				dBasis[2] = B[0][0]*B[1][0]*B[2][1];
+				
+				d2Basis[0][0] = B[0][2]*B[1][0]*B[2][0];
+				d2Basis[1][1] = B[0][0]*B[1][2]*B[2][0];
+				d2Basis[2][2] = B[0][0]*B[1][0]*B[2][2];
+				d2Basis[0][1] = B[0][1]*B[1][1]*B[2][0]; d2Basis[1][0] = d2Basis[0][1];
+				d2Basis[0][2] = B[0][1]*B[1][0]*B[2][1]; d2Basis[2][0] = d2Basis[0][2];
+				d2Basis[1][2] = B[0][0]*B[1][1]*B[2][1]; d2Basis[2][1] = d2Basis[1][2];
+				
+				Coord = Coord_Control_Points[iDegree][jDegree][kDegree];
 				for (iDim = 0; iDim < nDim; iDim++) {
-					cart_coord[iDim] += Coord_Control_Points[iDegree][jDegree][kDegree][iDim]
-					* GetBernstein(lDegree, iDegree, ParamCoord[0])
-					* GetBernstein(mDegree, jDegree, ParamCoord[1])
-					* GetBernstein(nDegree, kDegree, ParamCoord[2]);
+					val_X[iDim] += Coord[iDim]*B[0][0]*B[1][0]*B[2][0];
+					for (jDim = 0; jDim < 3; jDim++) {
+						val_dX[iDim][jDim] += Coord[iDim]*dBasis[jDim];
+						for (kDim = 0; kDim < 3; kDim++)
+							val_d2X[iDim][jDim][kDim] += Coord[iDim]*d2Basis[jDim][kDim];
+					}
 				}
+			}
 	
-	return cart_coord;
 }
 
 double CFreeFormDefBox::GetBernstein(short val_n, short val_i, double val_t) {
 	double value;
 
+	short iPower;
+
 	if (val_i > val_n) { value = 0; return value; }
 	if (val_i == 0) {
 		if (val_t == 0) value = 1;
 		else if (val_t == 1) value = 0;
-		else value = Binomial(val_n,val_i)*(pow(val_t, val_i)) * pow(1.0 - val_t, val_n - val_i);
+		else { value = 1.0; for (iPower = 0; iPower < val_n; iPower++) value *= 1.0 - val_t; }
 	}
 	else if (val_i == val_n) {
 		if (val_t == 0) value = 0;
 		else if (val_t == 1) value = 1;
-		else value = pow(val_t,val_n);
+		else { value = 1.0; for (iPower = 0; iPower < val_n; iPower++) value *= val_t; }
+	}
+	else {
+		value = double(Binomial(val_n,val_i));
+		for (iPower = 0; iPower < val_i; iPower++) value *= val_t;
+		for (iPower = 0; iPower < val_n - val_i; iPower++) value *= 1.0 - val_t;
 	}
-	else value = Binomial(val_n,val_i)*(pow(val_t,val_i)) * pow(1.0-val_t, val_n - val_i);
 	
 	return value;
 }
@@ -6359,18 +7163,18 @@ double CFreeFormDefBox::GetFFDObjFunc(double *val_coord, double *xyz) {
 
 double *CFreeFormDefBox::GetFFDGradient(double *val_coord, double *xyz) {
   
-	unsigned short iDim, jDim, lmn[3];
+	unsigned short iDim, jDim;
+  double X[3], dX[3][3], d2X[3][3][3];
   
-  /*--- Set the Degree of the Berstein polynomials ---*/
+  /*--- Evaluate X(u,v,w) and its derivatives in a single tensor-product pass ---*/
   
-  lmn[0] = lDegree; lmn[1] = mDegree; lmn[2] = nDegree;
+  EvalCartesianDerivatives(val_coord, X, dX, d2X);
   
   for (iDim = 0; iDim < nDim; iDim++) Gradient[iDim] = 0.0;
   
   for (iDim = 0; iDim < nDim; iDim++)
     for (jDim = 0; jDim < nDim; jDim++)
-      Gradient[jDim] += GetDerivative2(val_coord, iDim, xyz,  lmn) *
-      GetDerivative3(val_coord, iDim, jDim, lmn);
+      Gradient[jDim] += 2.0*(X[iDim] - xyz[iDim]) * dX[iDim][jDim];
   
 	return Gradient;
   
@@ -6378,11 +7182,12 @@ double *CFreeFormDefBox::GetFFDGradient(double *val_coord, double *xyz) {
 
 void CFreeFormDefBox::GetFFDHessian(double *uvw, double *xyz, double **val_Hessian) {
   
-  unsigned short iDim, jDim, lmn[3];
+  unsigned short iDim, jDim, kDim;
+  double X[3], dX[3][3], d2X[3][3][3];
   
-  /*--- Set the Degree of the Berstein polynomials ---*/
+  /*--- Evaluate X(u,v,w) and its derivatives in a single tensor-product pass ---*/
   
-  lmn[0] = lDegree; lmn[1] = mDegree; lmn[2] = nDegree;
+  EvalCartesianDerivatives(uvw, X, dX, d2X);
   
   for (iDim = 0; iDim < nDim; iDim++)
     for (jDim = 0; jDim < nDim; jDim++)
@@ -6391,25 +7196,11 @@ void CFreeFormDefBox::GetFFDHessian(double *uvw, double *xyz, double **val_Hessi
   /*--- Note that being all the functions linear combinations of polynomials, they are C^\infty,
    and the Hessian will be symmetric; no need to compute the under-diagonal part, for example ---*/
   
-  for (iDim = 0; iDim < nDim; iDim++) {
-    val_Hessian[0][0] += 2.0 * GetDerivative3(uvw,iDim,0,lmn) * GetDerivative3(uvw,iDim,0,lmn) +
-    GetDerivative2(uvw,iDim,xyz,lmn) * GetDerivative5(uvw,iDim,0,0,lmn);
-    
-    val_Hessian[1][1] += 2.0 * GetDerivative3(uvw,iDim,1,lmn) * GetDerivative3(uvw,iDim,1,lmn) +
-    GetDerivative2(uvw,iDim,xyz,lmn) * GetDerivative5(uvw,iDim,1,1,lmn);
-    
-    val_Hessian[2][2] += 2.0 * GetDerivative3(uvw,iDim,2,lmn) * GetDerivative3(uvw,iDim,2,lmn) +
-    GetDerivative2(uvw,iDim,xyz,lmn) * GetDerivative5(uvw,iDim,2,2,lmn);
-    
-    val_Hessian[0][1] += 2.0 * GetDerivative3(uvw,iDim,0,lmn) * GetDerivative3(uvw,iDim,1,lmn) +
-    GetDerivative2(uvw,iDim,xyz,lmn) * GetDerivative5(uvw,iDim,0,1,lmn);
-    
-    val_Hessian[0][2] += 2.0 * GetDerivative3(uvw,iDim,0,lmn) * GetDerivative3(uvw,iDim,2,lmn) +
-    GetDerivative2(uvw,iDim,xyz,lmn) * GetDerivative5(uvw,iDim,0,2,lmn);
-    
-    val_Hessian[1][2] += 2.0 * GetDerivative3(uvw,iDim,1,lmn) * GetDerivative3(uvw,iDim,2,lmn) +
-    GetDerivative2(uvw,iDim,xyz,lmn) * GetDerivative5(uvw,iDim,1,2,lmn);
-  }
+  for (iDim = 0; iDim < nDim; iDim++)
+    for (jDim = 0; jDim < 3; jDim++)
+      for (kDim = jDim; kDim < 3; kDim++)
+        val_Hessian[jDim][kDim] += 2.0 * dX[iDim][jDim] * dX[iDim][kDim] +
+        2.0*(X[iDim] - xyz[iDim]) * d2X[iDim][jDim][kDim];
   
   val_Hessian[1][0] = val_Hessian[0][1];
   val_Hessian[2][0] = val_Hessian[0][2];
@@ -6535,18 +7326,18 @@ double *CFreeFormDefBox::GetParametricCoord_Iterative(double *xyz, double *Param
 
 unsigned long CFreeFormDefBox::Binomial(unsigned short n, unsigned short m) {
   
-  unsigned short i, j;
-  unsigned long binomial[1000];
+  unsigned short i;
+  unsigned long binomial = 1;
   
-	binomial[0] = 1;
-	for (i = 1; i <= n; ++i) {
-		binomial[i] = 1;
-		for(j = i-1U; j > 0; --j) {
-			binomial[j] += binomial[j-1U];
-    }
-	}
+  if (m > n) return 0;
+  if (m > n-m) m = n-m;
+  
+  /*--- Multiplicative formula, every partial product is itself a binomial coefficient ---*/
+  
+	for (i = 1; i <= m; i++)
+		binomial = (binomial*(n-m+i))/i;
 
-	return binomial[m];
+	return binomial;
   
 }
 
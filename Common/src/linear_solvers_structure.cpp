@@ -108,6 +108,7 @@ void CSysSolve::ModGramSchmidt(int i, vector<vector<double> > & Hsbg, vector<CSy
   /*--- Convergence criteria ---*/
   
   sbuf_conv[0] = Convergence;
+  CProfiler::Start(PROFILE_MPI_REDUCE);
   MPI_Reduce(sbuf_conv, rbuf_conv, 1, MPI_UNSIGNED_SHORT, MPI_SUM, MASTER_NODE, MPI_COMM_WORLD);
   MPI_Barrier(MPI_COMM_WORLD);
   
@@ -120,6 +121,7 @@ void CSysSolve::ModGramSchmidt(int i, vector<vector<double> > & Hsbg, vector<CSy
   }
   
   MPI_Bcast(sbuf_conv, 1, MPI_UNSIGNED_SHORT, MASTER_NODE, MPI_COMM_WORLD);
+  CProfiler::Stop(PROFILE_MPI_REDUCE);
   
   if (sbuf_conv[0] == 1) Convergence = true;
   else Convergence = false;
@@ -307,7 +309,7 @@ int rank = 0;
 }
 
 unsigned long CSysSolve::FGMRES_LinSolver(const CSysVector & b, CSysVector & x, CMatrixVectorProduct & mat_vec,
-                               CPreconditioner & precond, double tol, unsigned long m, bool monitoring) {
+                               CPreconditioner & precond, double tol, unsigned long m, bool monitoring, bool rhs_norm) {
 	
 int rank = 0;
 
@@ -380,9 +382,10 @@ int rank = 0;
   
   g[0] = beta;
   
-  /*--- Set the norm to the initial residual value ---*/
+  /*--- Set the norm to the initial residual value (unless the tolerance is
+   relative to the rhs, e.g. for a warm-started solve) ---*/
   
-  norm0 = beta;
+  if (!rhs_norm) norm0 = beta;
 
   /*---  Output header information including initial residual ---*/
   
@@ -594,9 +597,8 @@ unsigned long CSysSolve::BCGSTAB_LinSolver(const CSysVector & b, CSysVector & x,
 }
 
 unsigned long CSysSolve::Solve(CSysMatrix & Jacobian, CSysVector & LinSysRes, CSysVector & LinSysSol, CGeometry *geometry, CConfig *config) {
+  CProfilerTimer Profile_Timer(PROFILE_LINEAR_SOLVER);
   
-  double SolverTol = config->GetLinear_Solver_Error();
-  unsigned long MaxIter = config->GetLinear_Solver_Iter();
   unsigned long IterLinSol = 0;
   
   /*--- Solve the linear system using a Krylov subspace method ---*/
@@ -606,48 +608,9 @@ unsigned long CSysSolve::Solve(CSysMatrix & Jacobian, CSysVector & LinSysRes, CS
     
     CMatrixVectorProduct* mat_vec = new CSysMatrixVectorProduct(Jacobian, geometry, config);
     
-    CPreconditioner* precond = NULL;
-    switch (config->GetKind_Linear_Solver_Prec()) {
-      case JACOBI:
-        Jacobian.BuildJacobiPreconditioner();
-        precond = new CJacobiPreconditioner(Jacobian, geometry, config);
-        break;
-      case ILU:
-        Jacobian.BuildILUPreconditioner();
-        precond = new CILUPreconditioner(Jacobian, geometry, config);
-        break;
-      case LU_SGS:
-        precond = new CLU_SGSPreconditioner(Jacobian, geometry, config);
-        break;
-      case LINELET:
-        Jacobian.BuildJacobiPreconditioner();
-        precond = new CLineletPreconditioner(Jacobian, geometry, config);
-        break;
-    }
-    
-    switch (config->GetKind_Linear_Solver()) {
-      case BCGSTAB:
-        IterLinSol = BCGSTAB_LinSolver(LinSysRes, LinSysSol, *mat_vec, *precond, SolverTol, MaxIter, false);
-        break;
-      case FGMRES:
-        IterLinSol = FGMRES_LinSolver(LinSysRes, LinSysSol, *mat_vec, *precond, SolverTol, MaxIter, false);
-        break;
-      case RFGMRES:
-        IterLinSol = 0;
-        while (IterLinSol < config->GetLinear_Solver_Iter()) {
-          if (IterLinSol + config->GetLinear_Solver_Restart_Frequency() > config->GetLinear_Solver_Iter())
-            MaxIter = config->GetLinear_Solver_Iter() - IterLinSol;
-          IterLinSol += FGMRES_LinSolver(LinSysRes, LinSysSol, *mat_vec, *precond, SolverTol, MaxIter, false);
-          if (LinSysRes.norm() < SolverTol) break;
-          SolverTol = SolverTol*(1.0/LinSysRes.norm());
-        }
-        break;
-    }
-    
-    /*--- Dealocate memory of the Krylov subspace method ---*/
+    IterLinSol = Solve(Jacobian, *mat_vec, LinSysRes, LinSysSol, geometry, config);
     
     delete mat_vec;
-    delete precond;
     
   }
   
@@ -668,6 +631,7 @@ unsigned long CSysSolve::Solve(CSysMatrix & Jacobian, CSysVector & LinSysRes, CS
         break;
       case SMOOTHER_LINELET:
         Jacobian.BuildJacobiPreconditioner();
+        Jacobian.BuildLineletFactorization();
         Jacobian.ComputeLineletPreconditioner(LinSysRes, LinSysSol, geometry, config);
         break;
         IterLinSol = 1;
@@ -677,3 +641,59 @@ unsigned long CSysSolve::Solve(CSysMatrix & Jacobian, CSysVector & LinSysRes, CS
   return IterLinSol;
   
 }
+
+unsigned long CSysSolve::Solve(CSysMatrix & Jacobian, CMatrixVectorProduct & mat_vec, CSysVector & LinSysRes, CSysVector & LinSysSol, CGeometry *geometry, CConfig *config) {
+  CProfilerTimer Profile_Timer(PROFILE_LINEAR_SOLVER);
+  
+  double SolverTol = config->GetLinear_Solver_Error();
+  unsigned long MaxIter = config->GetLinear_Solver_Iter();
+  unsigned long IterLinSol = 0;
+  
+  /*--- The preconditioner is built from the assembled matrix ---*/
+  
+  CPreconditioner* precond = NULL;
+  switch (config->GetKind_Linear_Solver_Prec()) {
+    case JACOBI:
+      Jacobian.BuildJacobiPreconditioner();
+      precond = new CJacobiPreconditioner(Jacobian, geometry, config);
+      break;
+    case ILU:
+      Jacobian.BuildILUPreconditioner();
+      precond = new CILUPreconditioner(Jacobian, geometry, config);
+      break;
+    case LU_SGS:
+      precond = new CLU_SGSPreconditioner(Jacobian, geometry, config);
+      break;
+    case LINELET:
+      Jacobian.BuildJacobiPreconditioner();
+      Jacobian.BuildLineletFactorization();
+      precond = new CLineletPreconditioner(Jacobian, geometry, config);
+      break;
+  }
+  
+  switch (config->GetKind_Linear_Solver()) {
+    case BCGSTAB:
+      IterLinSol = BCGSTAB_LinSolver(LinSysRes, LinSysSol, mat_vec, *precond, SolverTol, MaxIter, false);
+      break;
+    case FGMRES:
+      IterLinSol = FGMRES_LinSolver(LinSysRes, LinSysSol, mat_vec, *precond, SolverTol, MaxIter, false);
+      break;
+    case RFGMRES:
+      IterLinSol = 0;
+      while (IterLinSol < config->GetLinear_Solver_Iter()) {
+        if (IterLinSol + config->GetLinear_Solver_Restart_Frequency() > config->GetLinear_Solver_Iter())
+          MaxIter = config->GetLinear_Solver_Iter() - IterLinSol;
+        IterLinSol += FGMRES_LinSolver(LinSysRes, LinSysSol, mat_vec, *precond, SolverTol, MaxIter, false);
+        if (LinSysRes.norm() < SolverTol) break;
+        SolverTol = SolverTol*(1.0/LinSysRes.norm());
+      }
+      break;
+  }
+  
+  /*--- Dealocate memory of the preconditioner ---*/
+  
+  delete precond;
+  
+  return IterLinSol;
+  
+}
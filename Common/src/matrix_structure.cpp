@@ -39,24 +39,14 @@ CSysMatrix::CSysMatrix(void) {
   /*--- Linelet preconditioner ---*/
   
   LineletBool     = NULL;
-  LineletPoint    = NULL;
-  UBlock          = NULL;
-  invUBlock       = NULL;
-  LBlock          = NULL;
-  yVector         = NULL;
-  zVector         = NULL;
-  rVector         = NULL;
-  LFBlock         = NULL;
-  LyVector        = NULL;
-  FzVector        = NULL;
-  max_nElem       = 0;
+  Linelet_invU    = NULL;
+  Linelet_L       = NULL;
+  nLinelet        = 0;
   
 }
 
 CSysMatrix::~CSysMatrix(void) {
   
-  unsigned long iElem;
-  
   /*--- Memory deallocation ---*/
   
   if (matrix != NULL)             delete [] matrix;
@@ -72,26 +62,8 @@ CSysMatrix::~CSysMatrix(void) {
   if (sum_vector != NULL)         delete [] sum_vector;
   if (invM != NULL)               delete [] invM;
   if (LineletBool != NULL)        delete [] LineletBool;
-  if (LineletPoint != NULL)       delete [] LineletPoint;
-  
-  for (iElem = 0; iElem < max_nElem; iElem++) {
-    if (UBlock[iElem] != NULL)      delete [] UBlock[iElem];
-    if (invUBlock[iElem] != NULL)   delete [] invUBlock[iElem];
-    if (LBlock[iElem] != NULL)      delete [] LBlock[iElem];
-    if (yVector[iElem] != NULL)     delete [] yVector[iElem];
-    if (zVector[iElem] != NULL)     delete [] zVector[iElem];
-    if (rVector[iElem] != NULL)     delete [] rVector[iElem];
-  }
-  if (UBlock != NULL)     delete [] UBlock;
-  if (invUBlock != NULL)  delete [] invUBlock;
-  if (LBlock != NULL)     delete [] LBlock;
-  if (yVector != NULL)    delete [] yVector;
-  if (zVector != NULL)    delete [] zVector;
-  if (rVector != NULL)    delete [] rVector;
-
-  if (LFBlock != NULL)    delete [] LFBlock;
-  if (LyVector != NULL)   delete [] LyVector;
-  if (FzVector != NULL)   delete [] FzVector;
+  if (Linelet_invU != NULL)       delete [] Linelet_invU;
+  if (Linelet_L != NULL)          delete [] Linelet_L;
   
 }
 
@@ -312,6 +284,71 @@ void CSysMatrix::AddBlock(unsigned long block_i, unsigned long block_j, double *
   
 }
 
+unsigned long CSysMatrix::GetBlock_Index(unsigned long block_i, unsigned long block_j) {
+  
+  unsigned long index;
+  
+  for (index = row_ptr[block_i]; index < row_ptr[block_i+1]; index++)
+    if (col_ind[index] == block_j) return index;
+  
+  return nnz;
+  
+}
+
+void CSysMatrix::AddBlock_Index(unsigned long block_index, double **val_block) {
+  
+  unsigned long iVar, jVar;
+  
+  if (block_index >= nnz) return;
+  
+  for (iVar = 0; iVar < nVar; iVar++)
+    for (jVar = 0; jVar < nEqn; jVar++)
+      matrix[block_index*nVar*nEqn+iVar*nEqn+jVar] += val_block[iVar][jVar];
+  
+}
+
+void CSysMatrix::SetEdge_Block(CGeometry *geometry) {
+  
+  unsigned long iEdge, iPoint, jPoint, nEdge = geometry->GetnEdge();
+  
+  /*--- The blocks of each edge are searched once, the batched edge loops add them by position
+   (the sparse structure comes from the neighbors of the points, it has the four blocks of every edge) ---*/
+  
+  Edge_Block.resize(4*nEdge);
+  for (iEdge = 0; iEdge < nEdge; iEdge++) {
+    iPoint = geometry->edge[iEdge]->GetNode(0);
+    jPoint = geometry->edge[iEdge]->GetNode(1);
+    Edge_Block[4*iEdge]   = GetBlock_Index(iPoint, iPoint);
+    Edge_Block[4*iEdge+1] = GetBlock_Index(iPoint, jPoint);
+    Edge_Block[4*iEdge+2] = GetBlock_Index(jPoint, iPoint);
+    Edge_Block[4*iEdge+3] = GetBlock_Index(jPoint, jPoint);
+  }
+  
+}
+
+void CSysMatrix::AddBlocks_Batch(unsigned long *val_edge, unsigned short val_nLane, double (*val_block_i)[EDGE_BATCH_SIZE],
+                                 double (*val_block_j)[EDGE_BATCH_SIZE], double val_sign) {
+  
+  unsigned long iEntry, nEntry = nVar*nEqn, *index;
+  unsigned short iLane;
+  double *block_ii, *block_ij, *block_ji, *block_jj;
+  
+  /*--- Same updates as AddBlock and SubtractBlock, edge by edge in the order of the batch ---*/
+  
+  for (iLane = 0; iLane < val_nLane; iLane++) {
+    index = &Edge_Block[4*val_edge[iLane]];
+    block_ii = &matrix[index[0]*nEntry]; block_ij = &matrix[index[1]*nEntry];
+    block_ji = &matrix[index[2]*nEntry]; block_jj = &matrix[index[3]*nEntry];
+    for (iEntry = 0; iEntry < nEntry; iEntry++) {
+      block_ii[iEntry] += val_sign*val_block_i[iEntry][iLane];
+      block_ij[iEntry] += val_sign*val_block_j[iEntry][iLane];
+      block_ji[iEntry] -= val_sign*val_block_i[iEntry][iLane];
+      block_jj[iEntry] -= val_sign*val_block_j[iEntry][iLane];
+    }
+  }
+  
+}
+
 void CSysMatrix::SubtractBlock(unsigned long block_i, unsigned long block_j, double **val_block) {
   
   unsigned long iVar, jVar, index, step = 0;
@@ -626,6 +663,7 @@ void CSysMatrix::DiagonalProduct(CSysVector & vec, unsigned long row_i) {
 }
 
 void CSysMatrix::SendReceive_Solution(CSysVector & x, CGeometry *geometry, CConfig *config) {
+  CProfilerTimer Profile_Timer(PROFILE_MPI_HALO);
   
   unsigned short iVar, iMarker, MarkerS, MarkerR;
   unsigned long iVertex, iPoint, nVertexS, nVertexR, nBufferS_Vector, nBufferR_Vector;
@@ -895,199 +933,82 @@ void CSysMatrix::BuildILUPreconditioner(void) {
 
 unsigned short CSysMatrix::BuildLineletPreconditioner(CGeometry *geometry, CConfig *config) {
   
-  bool *check_Point, add_point;
-  unsigned long iEdge, iPoint, jPoint, index_Point, iLinelet, iVertex, next_Point, counter, iElem;
-  unsigned short iMarker, iNode, ExtraLines = 100, MeanPoints;
-  double alpha = 0.9, weight, max_weight, *normal, area, volume_iPoint, volume_jPoint;
-  unsigned long Local_nPoints, Local_nLineLets, Global_nPoints, Global_nLineLets;
-
-  /*--- Memory allocation --*/
-
-  check_Point = new bool [geometry->GetnPoint()];
-  for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++)
-    check_Point[iPoint] = true;
+  unsigned long iPoint, iLinelet, iElem, nElem;
   
-  LineletBool = new bool[geometry->GetnPoint()];
-  for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint ++)
-    LineletBool[iPoint] = false;
+  /*--- The linelets are detected once for each grid ---*/
   
-  nLinelet = 0;
-  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
-    if ((config->GetMarker_All_KindBC(iMarker) == HEAT_FLUX              ) ||
-        (config->GetMarker_All_KindBC(iMarker) == HEAT_FLUX_CATALYTIC    ) ||
-        (config->GetMarker_All_KindBC(iMarker) == HEAT_FLUX_NONCATALYTIC ) ||
-        (config->GetMarker_All_KindBC(iMarker) == ISOTHERMAL             ) ||
-        (config->GetMarker_All_KindBC(iMarker) == ISOTHERMAL_CATALYTIC   ) ||
-        (config->GetMarker_All_KindBC(iMarker) == ISOTHERMAL_NONCATALYTIC) ||
-        (config->GetMarker_All_KindBC(iMarker) == EULER_WALL             ) ||
-        (config->GetMarker_All_KindBC(iMarker) == DISPLACEMENT_BOUNDARY)) {
-      nLinelet += geometry->nVertex[iMarker];
-    }
-  }
+  geometry->SetLinelets(config);
   
-  /*--- If the domain contains well defined Linelets ---*/
+  nLinelet = geometry->GetnLinelet();
+  nElem = geometry->GetLinelet_Ptr(nLinelet);
   
-  if (nLinelet != 0) {
-    
-    /*--- Basic initial allocation ---*/
-    
-    LineletPoint = new vector<unsigned long>[nLinelet + ExtraLines];
-    
-    /*--- Define the basic linelets, starting from each vertex ---*/
-    
-    for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
-      if ((config->GetMarker_All_KindBC(iMarker) == HEAT_FLUX              ) ||
-          (config->GetMarker_All_KindBC(iMarker) == HEAT_FLUX_CATALYTIC    ) ||
-          (config->GetMarker_All_KindBC(iMarker) == HEAT_FLUX_NONCATALYTIC ) ||
-          (config->GetMarker_All_KindBC(iMarker) == ISOTHERMAL             ) ||
-          (config->GetMarker_All_KindBC(iMarker) == ISOTHERMAL_CATALYTIC   ) ||
-          (config->GetMarker_All_KindBC(iMarker) == ISOTHERMAL_NONCATALYTIC) ||
-          (config->GetMarker_All_KindBC(iMarker) == EULER_WALL             ) ||
-          (config->GetMarker_All_KindBC(iMarker) == DISPLACEMENT_BOUNDARY)){
-        iLinelet = 0;
-        for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-          iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
-          LineletPoint[iLinelet].push_back(iPoint);
-          check_Point[iPoint] = false;
-          iLinelet++;
-        }
-      }
-    }
-    
-    /*--- Create the linelet structure ---*/
-    
-    iLinelet = 0;
-    do {
-      add_point = true;
-      index_Point = 0;
-      do {
-        
-        /*--- Compute the value of the max weight ---*/
-        
-        iPoint = LineletPoint[iLinelet][index_Point];
-        max_weight = 0.0;
-        for(iNode = 0; iNode < geometry->node[iPoint]->GetnPoint(); iNode++) {
-          jPoint = geometry->node[iPoint]->GetPoint(iNode);
-          if ((check_Point[jPoint]) && geometry->node[jPoint]->GetDomain()){
-            iEdge = geometry->FindEdge(iPoint, jPoint);
-            normal = geometry->edge[iEdge]->GetNormal();
-            if (geometry->GetnDim() == 3) area = sqrt(normal[0]*normal[0]+normal[1]*normal[1]+normal[2]*normal[2]);
-            else area = sqrt(normal[0]*normal[0]+normal[1]*normal[1]);
-            volume_iPoint = geometry->node[iPoint]->GetVolume();
-            volume_jPoint = geometry->node[jPoint]->GetVolume();
-            weight = 0.5*area*((1.0/volume_iPoint)+(1.0/volume_jPoint));
-            max_weight = max(max_weight, weight);
-          }
-        }
-        
-        /*--- Verify if any face of the control volume must be added ---*/
-        
-        add_point = false;
-        counter = 0;
-        next_Point = geometry->node[iPoint]->GetPoint(0);
-        for(iNode = 0; iNode < geometry->node[iPoint]->GetnPoint(); iNode++) {
-          jPoint = geometry->node[iPoint]->GetPoint(iNode);
-          iEdge = geometry->FindEdge(iPoint, jPoint);
-          normal = geometry->edge[iEdge]->GetNormal();
-          if (geometry->GetnDim() == 3) area = sqrt(normal[0]*normal[0]+normal[1]*normal[1]+normal[2]*normal[2]);
-          else area = sqrt(normal[0]*normal[0]+normal[1]*normal[1]);
-          volume_iPoint = geometry->node[iPoint]->GetVolume();
-          volume_jPoint = geometry->node[jPoint]->GetVolume();
-          weight = 0.5*area*((1.0/volume_iPoint)+(1.0/volume_jPoint));
-          if (((check_Point[jPoint]) && (weight/max_weight > alpha) && (geometry->node[jPoint]->GetDomain())) &&
-              ((index_Point == 0) || ((index_Point > 0) && (jPoint != LineletPoint[iLinelet][index_Point-1])))) {
-            add_point = true;
-            next_Point = jPoint;
-            counter++;
-          }
-        }
-        
-        /*--- We have arrived to an isotropic zone ---*/
-        
-        if (counter > 1) add_point = false;
-        
-        /*--- Add a typical point to the linelet, no leading edge ---*/
-        
-        if (add_point) {
-          LineletPoint[iLinelet].push_back(next_Point);
-          check_Point[next_Point] = false;
-          index_Point++;
-        }
-        
-      } while (add_point);
-      iLinelet++;
-    } while (iLinelet < nLinelet);
-    
-    /*--- Identify the points that belong to a Linelet ---*/
-    
-    for (iLinelet = 0; iLinelet < nLinelet; iLinelet++) {
-      for (iElem = 0; iElem < LineletPoint[iLinelet].size(); iElem++) {
-        iPoint = LineletPoint[iLinelet][iElem];
-        LineletBool[iPoint] = true;
-      }
-    }
-    
-    /*--- Identify the maximum number of elements in a Linelet ---*/
-    
-    max_nElem = LineletPoint[0].size();
-    for (iLinelet = 1; iLinelet < nLinelet; iLinelet++)
-      if (LineletPoint[iLinelet].size() > max_nElem)
-        max_nElem = LineletPoint[iLinelet].size();
-    
-  }
+  Linelet_Ptr.resize(nLinelet+1);
+  for (iLinelet = 0; iLinelet <= nLinelet; iLinelet++)
+    Linelet_Ptr[iLinelet] = geometry->GetLinelet_Ptr(iLinelet);
   
-  /*--- The domain doesn't have well defined linelets ---*/
+  Linelet_Point.resize(nElem);
+  for (iElem = 0; iElem < nElem; iElem++)
+    Linelet_Point[iElem] = geometry->GetLinelet_Point(iElem);
   
-  else {
-    
-    max_nElem = 0;
+  /*--- Identify the points that belong to a Linelet ---*/
   
-  }
+  LineletBool = new bool[nPoint];
+  for (iPoint = 0; iPoint < nPoint; iPoint++)
+    LineletBool[iPoint] = false;
+  for (iElem = 0; iElem < nElem; iElem++)
+    LineletBool[Linelet_Point[iElem]] = true;
   
-  /*--- Screen output ---*/
+  /*--- Position in the matrix of the diagonal block, and of the blocks that couple
+   each point with the previous one of its linelet (lower and upper) ---*/
   
-  Local_nPoints = 0;
+  Linelet_Block.assign(3*nElem, nnz);
   for (iLinelet = 0; iLinelet < nLinelet; iLinelet++) {
-    Local_nPoints += LineletPoint[iLinelet].size();
+    for (iElem = Linelet_Ptr[iLinelet]; iElem < Linelet_Ptr[iLinelet+1]; iElem++) {
+      iPoint = Linelet_Point[iElem];
+      Linelet_Block[3*iElem] = GetBlock_Index(iPoint, iPoint);
+      if (iElem > Linelet_Ptr[iLinelet]) {
+        Linelet_Block[3*iElem+1] = GetBlock_Index(iPoint, Linelet_Point[iElem-1]);
+        Linelet_Block[3*iElem+2] = GetBlock_Index(Linelet_Point[iElem-1], iPoint);
+      }
+    }
   }
-  Local_nLineLets = nLinelet;
-
-#ifndef HAVE_MPI
-  Global_nPoints = Local_nPoints;
-  Global_nLineLets = Local_nLineLets;
-#else
-  MPI_Allreduce(&Local_nPoints, &Global_nPoints, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
-  MPI_Allreduce(&Local_nLineLets, &Global_nLineLets, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
-#endif
-
-  MeanPoints = int(double(Global_nPoints)/double(Global_nLineLets));
   
-  /*--- Memory allocation --*/
-
-  UBlock = new double* [max_nElem];
-  invUBlock = new double* [max_nElem];
-  LBlock = new double* [max_nElem];
-  yVector = new double* [max_nElem];
-  zVector = new double* [max_nElem];
-  rVector = new double* [max_nElem];
-  for (iElem = 0; iElem < max_nElem; iElem++) {
-    UBlock[iElem] = new double [nVar*nVar];
-    invUBlock[iElem] = new double [nVar*nVar];
-    LBlock[iElem] = new double [nVar*nVar];
-    yVector[iElem] = new double [nVar];
-    zVector[iElem] = new double [nVar];
-    rVector[iElem] = new double [nVar];
+  /*--- Memory allocation of the factorization --*/
+  
+  Linelet_invU = new double [nElem*nVar*nVar];
+  Linelet_L = new double [nElem*nVar*nVar];
+  for (iElem = 0; iElem < nElem*nVar*nVar; iElem++) {
+    Linelet_invU[iElem] = 0.0; Linelet_L[iElem] = 0.0;
   }
   
-  LFBlock = new double [nVar*nVar];
-  LyVector = new double [nVar];
-  FzVector = new double [nVar];
+  return geometry->GetLinelet_MeanPoints();
   
-  /*--- Memory deallocation --*/
-
-  delete [] check_Point;
+}
 
-  return MeanPoints;
+void CSysMatrix::BuildLineletFactorization(void) {
+  
+  unsigned long iLinelet, iElem;
+  double *Diag;
+  
+  if (LineletBool == NULL) return;
+  
+  /*--- Block Thomas factorization of each (independent) linelet,
+   U_0 = D_0, L_k = A_(k,k-1).inv(U_(k-1)), U_k = D_k - L_k.A_(k-1,k) ---*/
+  
+  for (iLinelet = 0; iLinelet < nLinelet; iLinelet++) {
+    
+    iElem = Linelet_Ptr[iLinelet];
+    InverseBlock(&matrix[Linelet_Block[3*iElem]*nVar*nEqn], &Linelet_invU[iElem*nVar*nVar]);
+    
+    for (iElem = Linelet_Ptr[iLinelet]+1; iElem < Linelet_Ptr[iLinelet+1]; iElem++) {
+      Diag = &matrix[Linelet_Block[3*iElem]*nVar*nEqn];
+      GetMultBlockBlock(&Linelet_L[iElem*nVar*nVar], &matrix[Linelet_Block[3*iElem+1]*nVar*nEqn], &Linelet_invU[(iElem-1)*nVar*nVar]);
+      GetMultBlockBlock(block_weight, &Linelet_L[iElem*nVar*nVar], &matrix[Linelet_Block[3*iElem+2]*nVar*nEqn]);
+      GetSubsBlock(block_inverse, Diag, block_weight);
+      InverseBlock(block_inverse, &Linelet_invU[iElem*nVar*nVar]);
+    }
+    
+  }
   
 }
 
@@ -1250,9 +1171,7 @@ void CSysMatrix::ComputeLU_SGSPreconditioner(const CSysVector & vec, CSysVector
 void CSysMatrix::ComputeLineletPreconditioner(const CSysVector & vec, CSysVector & prod,
                                               CGeometry *geometry, CConfig *config) {
   
-  unsigned long iVar, jVar, nElem = 0, iLinelet, im1Point, iPoint, ip1Point, iElem;
-  long iElemLoop;
-  double *block;
+  unsigned long iVar, jVar, iLinelet, iPoint, jPoint, iElem, iBegin, iEnd;
   
   /*--- Jacobi preconditioning if there is no linelet ---*/
   
@@ -1271,69 +1190,41 @@ void CSysMatrix::ComputeLineletPreconditioner(const CSysVector & vec, CSysVector
   
   SendReceive_Solution(prod, geometry, config);
   
-  /*--- Solve linelet using a Thomas' algorithm ---*/
+  /*--- Solve each linelet with the factorization of the Thomas' algorithm
+   (BuildLineletFactorization), the substitutions are done in prod ---*/
   
   for (iLinelet = 0; iLinelet < nLinelet; iLinelet++) {
     
-    nElem = LineletPoint[iLinelet].size();
+    iBegin = Linelet_Ptr[iLinelet]; iEnd = Linelet_Ptr[iLinelet+1];
     
-    /*--- Copy vec vector to the new structure ---*/
-    
-    for (iElem = 0; iElem < nElem; iElem++) {
-      iPoint = LineletPoint[iLinelet][iElem];
-      for (iVar = 0; iVar < nVar; iVar++)
-        rVector[iElem][iVar] = vec[(const unsigned int)(iPoint*nVar+iVar)];
-    }
-    
-    /*--- Initialization (iElem = 0) ---*/
-    
-    iPoint = LineletPoint[iLinelet][0];
-    block = GetBlock(iPoint, iPoint);
-    for (iVar = 0; iVar < nVar; iVar++) {
-      yVector[0][iVar] = rVector[0][iVar];
-      for (jVar = 0; jVar < nVar; jVar++)
-        UBlock[0][iVar*nVar+jVar] = block[iVar*nVar+jVar];
-    }
+    /*--- Forward substitution, y_k = r_k - L_k.y_(k-1) ---*/
     
-    /*--- Main loop (without iElem = 0) ---*/
+    iPoint = Linelet_Point[iBegin];
+    for (iVar = 0; iVar < nVar; iVar++)
+      prod[iPoint*nVar+iVar] = vec[iPoint*nVar+iVar];
     
-    for (iElem = 1; iElem < nElem; iElem++) {
-      
-      im1Point = LineletPoint[iLinelet][iElem-1];
-      iPoint = LineletPoint[iLinelet][iElem];
-      
-      InverseBlock(UBlock[iElem-1], invUBlock[iElem-1]);
-      block = GetBlock(iPoint, im1Point); GetMultBlockBlock(LBlock[iElem], block, invUBlock[iElem-1]);
-      block = GetBlock(im1Point, iPoint); GetMultBlockBlock(LFBlock, LBlock[iElem], block);
-      block = GetBlock(iPoint, iPoint); GetSubsBlock(UBlock[iElem], block, LFBlock);
-      
-      /*--- Forward substituton ---*/
-      
-      GetMultBlockVector(LyVector, LBlock[iElem], yVector[iElem-1]);
-      GetSubsVector(yVector[iElem], rVector[iElem], LyVector);
-      
+    for (iElem = iBegin+1; iElem < iEnd; iElem++) {
+      iPoint = Linelet_Point[iElem]; jPoint = Linelet_Point[iElem-1];
+      GetMultBlockVector(aux_vector, &Linelet_L[iElem*nVar*nVar], &prod[jPoint*nVar]);
+      for (iVar = 0; iVar < nVar; iVar++)
+        prod[iPoint*nVar+iVar] = vec[iPoint*nVar+iVar] - aux_vector[iVar];
     }
     
-    /*--- Backward substituton ---*/
+    /*--- Backward substitution, z_k = inv(U_k).(y_k - A_(k,k+1).z_(k+1)) ---*/
     
-    im1Point = LineletPoint[iLinelet][nElem-1];
-    InverseBlock(UBlock[nElem-1], invUBlock[nElem-1]);
-    GetMultBlockVector(zVector[nElem-1], invUBlock[nElem-1], yVector[nElem-1]);
-    
-    for (iElemLoop = nElem-2; iElemLoop >= 0; iElemLoop--) {
-      iPoint = LineletPoint[iLinelet][iElemLoop];
-      ip1Point = LineletPoint[iLinelet][iElemLoop+1];
-      block = GetBlock(iPoint, ip1Point); GetMultBlockVector(FzVector, block, zVector[iElemLoop+1]);
-      GetSubsVector(aux_vector, yVector[iElemLoop], FzVector);
-      GetMultBlockVector(zVector[iElemLoop], invUBlock[iElemLoop], aux_vector);
-    }
-    
-    /*--- Copy zVector to the prod vector ---*/
+    iPoint = Linelet_Point[iEnd-1];
+    GetMultBlockVector(aux_vector, &Linelet_invU[(iEnd-1)*nVar*nVar], &prod[iPoint*nVar]);
+    for (iVar = 0; iVar < nVar; iVar++)
+      prod[iPoint*nVar+iVar] = aux_vector[iVar];
     
-    for (iElem = 0; iElem < nElem; iElem++) {
-      iPoint = LineletPoint[iLinelet][iElem];
+    for (iElem = iEnd-1; iElem > iBegin; iElem--) {
+      iPoint = Linelet_Point[iElem-1]; jPoint = Linelet_Point[iElem];
+      GetMultBlockVector(sum_vector, &matrix[Linelet_Block[3*iElem+2]*nVar*nEqn], &prod[jPoint*nVar]);
+      for (iVar = 0; iVar < nVar; iVar++)
+        sum_vector[iVar] = prod[iPoint*nVar+iVar] - sum_vector[iVar];
+      GetMultBlockVector(aux_vector, &Linelet_invU[(iElem-1)*nVar*nVar], sum_vector);
       for (iVar = 0; iVar < nVar; iVar++)
-        prod[(const unsigned int)(iPoint*nVar+iVar)] = zVector[iElem][iVar];
+        prod[iPoint*nVar+iVar] = aux_vector[iVar];
     }
     
   }
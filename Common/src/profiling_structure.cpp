@@ -0,0 +1,114 @@
+/*!
+ * \file profiling_structure.cpp
+ * \brief Wall-clock profiler of the solver phases.
+ * \author Aerospace Design Laboratory (Stanford University) <http://su2.stanford.edu>.
+ * \version 3.2.3 "eagle"
+ *
+ * SU2, Copyright (C) 2012-2014 Aerospace Design Laboratory (ADL).
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../include/profiling_structure.hpp"
+
+bool CProfiler::Active = false;
+unsigned short CProfiler::Depth[MAX_PROFILE_PHASES] = {0};
+double CProfiler::Start_Time[MAX_PROFILE_PHASES] = {0.0};
+double CProfiler::Total_Time[MAX_PROFILE_PHASES] = {0.0};
+unsigned long CProfiler::nCalls[MAX_PROFILE_PHASES] = {0};
+
+/*--- Names of the phases in the report, in the order of ENUM_PROFILE_PHASE ---*/
+
+static const char *Profile_Phase_Name[MAX_PROFILE_PHASES] = {
+  "setup", "iteration", "preprocessing", "convective_residual", "viscous_residual",
+  "source_residual", "boundary_residual", "gradients_limiters", "linear_solver",
+  "halo_communication", "reductions", "output"
+};
+
+void CProfiler::WriteReport(string val_filename) {
+
+  unsigned short iPhase;
+  double Mean_Time, Imbalance;
+  double Min_Time[MAX_PROFILE_PHASES], Max_Time[MAX_PROFILE_PHASES], Sum_Time[MAX_PROFILE_PHASES];
+  unsigned long Max_Calls[MAX_PROFILE_PHASES];
+  ios::fmtflags Cout_Flags;
+  streamsize Cout_Precision;
+
+  int rank = MASTER_NODE, size = SINGLE_NODE;
+
+  if (!Active) return;
+
+  /*--- Min, max and mean of each phase over all the ranks ---*/
+
+#ifdef HAVE_MPI
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+  MPI_Reduce(Total_Time, Min_Time, MAX_PROFILE_PHASES, MPI_DOUBLE, MPI_MIN, MASTER_NODE, MPI_COMM_WORLD);
+  MPI_Reduce(Total_Time, Max_Time, MAX_PROFILE_PHASES, MPI_DOUBLE, MPI_MAX, MASTER_NODE, MPI_COMM_WORLD);
+  MPI_Reduce(Total_Time, Sum_Time, MAX_PROFILE_PHASES, MPI_DOUBLE, MPI_SUM, MASTER_NODE, MPI_COMM_WORLD);
+  MPI_Reduce(nCalls, Max_Calls, MAX_PROFILE_PHASES, MPI_UNSIGNED_LONG, MPI_MAX, MASTER_NODE, MPI_COMM_WORLD);
+#else
+  for (iPhase = 0; iPhase < MAX_PROFILE_PHASES; iPhase++) {
+    Min_Time[iPhase] = Total_Time[iPhase]; Max_Time[iPhase] = Total_Time[iPhase];
+    Sum_Time[iPhase] = Total_Time[iPhase]; Max_Calls[iPhase] = nCalls[iPhase];
+  }
+#endif
+
+  if (rank != MASTER_NODE) return;
+
+  /*--- Screen summary, the load imbalance is max/mean - 1 (zero if balanced).
+   The format of cout is restored after the table. ---*/
+
+  Cout_Flags = cout.flags(); Cout_Precision = cout.precision();
+
+  cout << endl <<"--------------------------- Profiling (wall-clock) ----------------------" << endl;
+  cout << setw(20) << "Phase" << setw(10) << "Calls" << setw(12) << "Min (s)" << setw(12) << "Max (s)";
+  cout << setw(12) << "Mean (s)" << setw(12) << "Imbalance" << endl;
+
+  ofstream Profile_File(val_filename.c_str(), ios::out);
+  Profile_File.precision(6);
+  Profile_File << "{" << endl;
+  Profile_File << "  \"ranks\": " << size << "," << endl;
+  Profile_File << "  \"phases\": {" << endl;
+
+  for (iPhase = 0; iPhase < MAX_PROFILE_PHASES; iPhase++) {
+
+    Mean_Time = Sum_Time[iPhase]/double(size);
+    Imbalance = 0.0;
+    if (Mean_Time > 0.0) Imbalance = Max_Time[iPhase]/Mean_Time - 1.0;
+
+    if (Max_Calls[iPhase] > 0) {
+      cout << setw(20) << Profile_Phase_Name[iPhase] << setw(10) << Max_Calls[iPhase];
+      cout.precision(4);
+      cout << fixed << setw(12) << Min_Time[iPhase] << setw(12) << Max_Time[iPhase];
+      cout << setw(12) << Mean_Time << setw(12) << Imbalance << endl;
+    }
+
+    Profile_File << "    \"" << Profile_Phase_Name[iPhase] << "\": { \"calls\": " << Max_Calls[iPhase];
+    Profile_File << ", \"min\": " << scientific << Min_Time[iPhase] << ", \"max\": " << Max_Time[iPhase];
+    Profile_File << ", \"mean\": " << Mean_Time << ", \"imbalance\": " << Imbalance << " }";
+    if (iPhase < MAX_PROFILE_PHASES-1) Profile_File << ",";
+    Profile_File << endl;
+
+  }
+
+  Profile_File << "  }" << endl;
+  Profile_File << "}" << endl;
+  Profile_File.close();
+
+  cout.flags(Cout_Flags); cout.precision(Cout_Precision);
+
+  cout << "Profiling summary written in " << val_filename << "." << endl;
+
+}
@@ -411,7 +411,9 @@ double dotProd(const CSysVector & u, const CSysVector & v) {
   double prod = 0.0;
   
 #ifdef HAVE_MPI
+  CProfiler::Start(PROFILE_MPI_REDUCE);
   MPI_Allreduce(&loc_prod, &prod, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  CProfiler::Stop(PROFILE_MPI_REDUCE);
 #else
   prod = loc_prod;
 #endif
@@ -37,5 +37,6 @@
 #include "../../Common/include/config_structure.hpp"
 #include "../include/definition_structure.hpp"
 #include "../include/iteration_structure.hpp"
+#include "../include/driver_structure.hpp"
 
 using namespace std;
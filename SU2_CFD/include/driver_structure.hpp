@@ -0,0 +1,215 @@
+/*!
+ * \file driver_structure.hpp
+ * \brief Headers of the driver of the solution of a problem (preprocessing, iterations and output).
+ *        The subroutines and functions are in the <i>driver_structure.cpp</i> file.
+ * \author Aerospace Design Laboratory (Stanford University) <http://su2.stanford.edu>.
+ * \version 3.2.3 "eagle"
+ *
+ * SU2, Copyright (C) 2012-2014 Aerospace Design Laboratory (ADL).
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#ifdef HAVE_MPI
+  #include "mpi.h"
+#endif
+#include <fstream>
+
+#include "solver_structure.hpp"
+#include "integration_structure.hpp"
+#include "output_structure.hpp"
+#include "numerics_structure.hpp"
+#include "../../Common/include/geometry_structure.hpp"
+#include "../../Common/include/grid_movement_structure.hpp"
+#include "../../Common/include/config_structure.hpp"
+#include "../include/definition_structure.hpp"
+#include "../include/iteration_structure.hpp"
+
+using namespace std;
+
+/*!
+ * \class CDriver
+ * \brief Driver of the solution of a problem. The configuration, the grid (and its
+ *        partition), the solvers and the solution are kept in memory, so that the
+ *        grid can be deformed and the problem solved again (warm started) without
+ *        reading and preprocessing everything again, as in a design loop.
+ * \author Aerospace Design Laboratory (Stanford University) <http://su2.stanford.edu>.
+ * \version 3.2.3 "eagle"
+ */
+class CDriver {
+protected:
+
+  unsigned short nZone,   /*!< \brief Number of zones of the problem. */
+  nDim;                   /*!< \brief Number of dimensions of the problem. */
+  double StartTime;       /*!< \brief Wall clock time at the beginning of the solution (preprocessing is not included). */
+  ofstream ConvHist_file; /*!< \brief Convergence history file. */
+
+  COutput *output;                        /*!< \brief Output of the solution files (one for all zones). */
+  CIntegration ***integration_container;  /*!< \brief Integration schemes [#ZONES][#EQ_SYSTEMS]. */
+  CGeometry ***geometry_container;        /*!< \brief Geometry [#ZONES][#MG_GRIDS]. */
+  CSolver ****solver_container;           /*!< \brief Solvers [#ZONES][#MG_GRIDS][#EQ_SYSTEMS]. */
+  CNumerics *****numerics_container;      /*!< \brief Numerical methods [#ZONES][#MG_GRIDS][#EQ_SYSTEMS][#EQ_TERMS]. */
+  CConfig **config_container;             /*!< \brief Definition of the problem [#ZONES]. */
+  CSurfaceMovement **surface_movement;    /*!< \brief Surface movement of the dynamic meshes [#ZONES]. */
+  CVolumetricMovement **grid_movement;    /*!< \brief Volumetric movement of the dynamic meshes [#ZONES]. */
+  CFreeFormDefBox*** FFDBox;              /*!< \brief Free form deformation boxes of the dynamic meshes [#ZONES]. */
+
+  CSurfaceMovement *design_surface_movement;  /*!< \brief Surface deformation defined by the design variables. */
+  CVolumetricMovement *design_grid_movement;  /*!< \brief Volumetric deformation that follows the design surface deformation. */
+  double *Coord_Reference;                    /*!< \brief Coordinates of the grid as it was read, reference of the design deformations. */
+
+public:
+
+  /*!
+   * \brief Constructor of the class, it reads the configuration and the grid and does the
+   *        preprocessing of the geometry, solvers, integration schemes and numerical methods.
+   * \param[in] confFile - Configuration file name.
+   */
+  CDriver(char *confFile);
+
+  /*!
+   * \brief Destructor of the class.
+   */
+  ~CDriver(void);
+
+  /*!
+   * \brief Solve the problem (external iterations, convergence monitoring and output) starting from
+   *        the solution in memory. It may be called again after the grid has been deformed.
+   */
+  void Run(void);
+
+  /*!
+   * \brief Write the timing information and the profiling report of the solution.
+   */
+  void Postprocessing(void);
+
+  /*!
+   * \brief Set the value of a design variable, it is applied by the next call of Deform.
+   * \param[in] val_dv - Index of the design variable.
+   * \param[in] val_value - Value of the design variable (with respect to the grid that was read).
+   */
+  void SetDV_Value(unsigned short val_dv, double val_value);
+
+  /*!
+   * \brief Deform the grid (surface and volume, all multigrid levels) according to the design variables,
+   *        starting from the grid that was read, and update the geometric quantities of the solution.
+   */
+  void Deform(void);
+
+  /*!
+   * \brief Write the grid in memory (and the free form deformation boxes) to a native mesh file, one
+   *        file per partition (as SU2_DEF) with the point numbering of the grid file that was read.
+   * \param[in] val_mesh_out_filename - Name of the output mesh file.
+   */
+  void WriteMesh(string val_mesh_out_filename);
+
+  /*!
+   * \brief Copy the flow solution of another driver with the same grid and partition (e.g. the direct
+   *        solution for an adjoint problem), instead of reading it from a restart file.
+   * \param[in] direct_driver - Driver of the problem that holds the flow solution.
+   */
+  void SetFlow_Solution(CDriver *direct_driver);
+
+  /*!
+   * \brief Get the lift coefficient of the flow solution.
+   * \return Total lift coefficient.
+   */
+  double GetTotal_CLift(void);
+
+  /*!
+   * \brief Get the drag coefficient of the flow solution.
+   * \return Total drag coefficient.
+   */
+  double GetTotal_CDrag(void);
+
+};
+
+/*--- C interface of the driver, used by the Python binding (SU2_PY/SU2/run/library.py) ---*/
+
+extern "C" {
+
+  /*!
+   * \brief Initialize MPI (if it has not been done by the caller).
+   */
+  void SU2_Initialize(void);
+
+  /*!
+   * \brief Finalize MPI (if it has not been done by the caller).
+   */
+  void SU2_Finalize(void);
+
+  /*!
+   * \brief Create a driver.
+   * \param[in] confFile - Configuration file name.
+   * \return Pointer to the driver.
+   */
+  CDriver *SU2_Driver_New(char *confFile);
+
+  /*!
+   * \brief Delete a driver.
+   * \param[in] driver - Pointer to the driver.
+   */
+  void SU2_Driver_Delete(CDriver *driver);
+
+  /*!
+   * \brief Solve the problem of a driver.
+   * \param[in] driver - Pointer to the driver.
+   */
+  void SU2_Driver_Run(CDriver *driver);
+
+  /*!
+   * \brief Set the value of a design variable of a driver.
+   * \param[in] driver - Pointer to the driver.
+   * \param[in] val_dv - Index of the design variable.
+   * \param[in] val_value - Value of the design variable.
+   */
+  void SU2_Driver_SetDV_Value(CDriver *driver, unsigned short val_dv, double val_value);
+
+  /*!
+   * \brief Deform the grid of a driver according to its design variables.
+   * \param[in] driver - Pointer to the driver.
+   */
+  void SU2_Driver_Deform(CDriver *driver);
+
+  /*!
+   * \brief Write the grid of a driver to a native mesh file.
+   * \param[in] driver - Pointer to the driver.
+   * \param[in] val_mesh_out_filename - Name of the output mesh file.
+   */
+  void SU2_Driver_WriteMesh(CDriver *driver, char *val_mesh_out_filename);
+
+  /*!
+   * \brief Copy the flow solution of a driver into another one.
+   * \param[in] driver - Pointer to the driver that receives the solution.
+   * \param[in] direct_driver - Pointer to the driver that holds the solution.
+   */
+  void SU2_Driver_SetFlow_Solution(CDriver *driver, CDriver *direct_driver);
+
+  /*!
+   * \brief Get the lift coefficient of the flow solution of a driver.
+   * \param[in] driver - Pointer to the driver.
+   * \return Total lift coefficient.
+   */
+  double SU2_Driver_GetTotal_CLift(CDriver *driver);
+
+  /*!
+   * \brief Get the drag coefficient of the flow solution of a driver.
+   * \param[in] driver - Pointer to the driver.
+   * \return Total drag coefficient.
+   */
+  double SU2_Driver_GetTotal_CDrag(CDriver *driver);
+
+}
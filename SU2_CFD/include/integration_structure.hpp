@@ -56,6 +56,7 @@ protected:
 	Convergence_OneShot,	/*!< \brief To indicate if the one-shot method has converged. */
 	Convergence_FullMG;		/*!< \brief To indicate if the Full Multigrid has converged and it is necessary to add a new level. */
 	double InitResidual;	/*!< \brief Initial value of the residual to evaluate the convergence level. */
+	double SER_Residual_Old;	/*!< \brief Residual of the previous iteration for the switched evolution relaxation of the CFL. */
 
 public:
 	
@@ -94,6 +95,45 @@ public:
 	void Time_Integration(CGeometry *geometry, CSolver **solver_container, CConfig *config, 
 						  unsigned short iRKStep, unsigned short RunTime_EqSystem, unsigned long Iteration);
 	
+	/*! 
+	 * \brief Do a Jacobian-free Newton-Krylov step of the flow equations, the assembled Jacobian
+	 *        is only used as preconditioner and the step is safeguarded with a line search.
+	 * \param[in] geometry - Geometrical definition of the problem.
+	 * \param[in] solver_container - Container vector with all the solutions.
+	 * \param[in] numerics - Description of the numerical method.
+	 * \param[in] config - Definition of the particular problem.
+	 * \param[in] iMesh - Index of the mesh in multigrid computations.
+	 * \param[in] RunTime_EqSystem - System of equations which is going to be solved.
+	 */
+	void NewtonKrylov_Integration(CGeometry *geometry, CSolver **solver_container, CNumerics **numerics, CConfig *config,
+                                unsigned short iMesh, unsigned short RunTime_EqSystem);
+	
+	/*! 
+	 * \brief Evaluate the residual of the current solution without assembling the Jacobian.
+	 * \param[in] geometry - Geometrical definition of the problem.
+	 * \param[in] solver_container - Container vector with all the solutions.
+	 * \param[in] numerics - Description of the numerical method.
+	 * \param[in] config - Definition of the particular problem.
+	 * \param[in] iMesh - Index of the mesh in multigrid computations.
+	 * \param[in] RunTime_EqSystem - System of equations which is going to be solved.
+	 */
+	void Residual_Evaluation(CGeometry *geometry, CSolver **solver_container, CNumerics **numerics, CConfig *config,
+                           unsigned short iMesh, unsigned short RunTime_EqSystem);
+	
+	/*! 
+	 * \brief Adapt the CFL number of all the grids with the residual history (switched evolution relaxation).
+	 * \param[in] solver - Solution on the finest grid.
+	 * \param[in] config - Definition of the particular problem.
+	 */
+	void SetCFL_SER(CSolver *solver, CConfig *config);
+	
+	/*! 
+	 * \brief Scale the CFL number of all the grids, within the limits of the switched evolution relaxation.
+	 * \param[in] config - Definition of the particular problem.
+	 * \param[in] val_factor - Scaling factor of the CFL number.
+	 */
+	void ScaleCFL_SER(CConfig *config, double val_factor);
+	
 	/*! 
 	 * \brief Initialize the adjoint solution using the primal problem.
 	 * \param[in] geometry - Geometrical definition of the problem.
@@ -309,6 +349,60 @@ public:
 
 };
 
+/*!
+ * \class CNewtonKrylovProduct
+ * \brief Jacobian-free matrix-vector product of the pseudo-time Newton system,
+ *        (Vol/dt) v + (R(U + eps v) - R(U))/eps.
+ * \author F. Palacios.
+ * \version 3.2.3 "eagle"
+ */
+class CNewtonKrylovProduct : public CMatrixVectorProduct {
+private:
+  CIntegration *integration;    /*!< \brief Integration that evaluates the residual. */
+  CGeometry *geometry;          /*!< \brief Geometrical definition of the problem. */
+  CSolver **solver_container;   /*!< \brief Container vector with all the solutions. */
+  CNumerics **numerics;         /*!< \brief Description of the numerical method. */
+  CConfig *config;              /*!< \brief Definition of the particular problem. */
+  unsigned short iMesh,         /*!< \brief Index of the mesh. */
+  RunTime_EqSystem;             /*!< \brief System of equations which is going to be solved. */
+  CSysVector *Sol_Base,         /*!< \brief Solution where the Jacobian is linearized. */
+  *Res_Base;                    /*!< \brief Residual of the base solution. */
+  double *Delta,                /*!< \brief Vol/dt of each point. */
+  Eps_Base;                     /*!< \brief Finite difference step for a unit vector. */
+  
+public:
+  
+  /*!
+   * \brief Constructor of the class.
+   * \param[in] val_integration - Integration that evaluates the residual.
+   * \param[in] val_geometry - Geometrical definition of the problem.
+   * \param[in] val_solver_container - Container vector with all the solutions.
+   * \param[in] val_numerics - Description of the numerical method.
+   * \param[in] val_config - Definition of the particular problem.
+   * \param[in] val_iMesh - Index of the mesh in multigrid computations.
+   * \param[in] val_RunTime_EqSystem - System of equations which is going to be solved.
+   * \param[in] val_sol_base - Solution where the Jacobian is linearized.
+   * \param[in] val_res_base - Residual of the base solution.
+   * \param[in] val_delta - Vol/dt of each point.
+   */
+  CNewtonKrylovProduct(CIntegration *val_integration, CGeometry *val_geometry, CSolver **val_solver_container,
+                       CNumerics **val_numerics, CConfig *val_config, unsigned short val_iMesh,
+                       unsigned short val_RunTime_EqSystem, CSysVector & val_sol_base, CSysVector & val_res_base,
+                       double *val_delta);
+  
+  /*!
+   * \brief Destructor of the class.
+   */
+  ~CNewtonKrylovProduct(void);
+  
+  /*!
+   * \brief Operator that defines the Jacobian-free matrix-vector product.
+   * \param[in] u - CSysVector that is being multiplied by the Jacobian.
+   * \param[out] v - CSysVector that is the result of the product.
+   */
+  void operator()(const CSysVector & u, CSysVector & v) const;
+};
+
 /*!
  * \class CMultiGridIntegration
  * \brief Class for doing the numerical integration using a multigrid method.
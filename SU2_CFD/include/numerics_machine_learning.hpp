@@ -129,11 +129,19 @@ public:
   CPredictor();
   virtual  ~CPredictor();
   virtual void Predict(double *, double *){cout << "In base Predict, this is bad";};
+  // Inputs and outputs are stored point by point (nBatch x InputDim and nBatch x OutputDim).
+  // The default implementation calls Predict once per point.
+  virtual void PredictBatch(int nBatch, double *inputs, double *outputs);
+  virtual void SetFastActivation(bool val_fast){};
   int InputDim();
   int OutputDim();
 };
 
 class CScalePredictor{
+private:
+  double *scaledInputs; // Scaled copy of the inputs, so the caller's data is not modified
+  int nScaledInputs;
+  double *GetScaledInputs(int nBatch);
 public:
   CScalePredictor();
   CScalePredictor(string filename);
@@ -143,10 +151,14 @@ public:
   CScaler *OutputScaler;
 public:
   void Predict(double *inputs, double *outputs);
-  // Need to add predict method
+  void PredictBatch(int nBatch, double *inputs, double *outputs);
+  void SetFastActivation(bool val_fast);
 };
 
 class CMulPredictor : public CPredictor{
+private:
+  double *innerInputs; // Inputs of the inner predictor (the first input is the multiplier)
+  int nInnerInputs;
 public:
   CMulPredictor();
 #ifdef HAVE_JSONCPP
@@ -155,22 +167,27 @@ public:
   ~CMulPredictor();
   CPredictor* Inner;
   void Predict(double *, double *);
-  
+  void PredictBatch(int nBatch, double *inputs, double *outputs);
+  void SetFastActivation(bool val_fast);
 };
 
 class CNeurNet : public CPredictor {
 private:
   int maxNeurons; // Number of neurons in the largest layer
   int nLayers;
-  CNeuron ***neurons; // Array of arrays to pointers to neuron
   int* nNeuronsInLayer; //one list for each layer
-  int** nParameters; // Number of parameters for the neuron
-//  int inputDim;
+  int* nInputsToLayer; // Number of inputs to each layer (InputDim or size of the previous layer)
+  double** weights; // Dense weight matrix of each layer, nNeuronsInLayer x nInputsToLayer, row major
+  double** biases; // Bias vector of each layer
+  bool** tanhNeuron; // True if the neuron has a tanh activation, false if it is linear
+  bool fastTanh; // Use the rational approximation of tanh instead of the libm one
+  
+  // Work arrays of the batched forward pass, stored neuron by neuron (maxNeurons x nWork)
+  double *work1, *work2;
+  int nWork;
   
-  void processLayer(double *, int,CNeuron **, double **, int, int * ,double *);
+  void ProcessLayer(int iLayer, int nBatch, double *input, double *output);
   
-  //----
-//	int outputDim;
 	int totalNumParameters;
 public:
 	CNeurNet();
@@ -178,10 +195,9 @@ public:
   CNeurNet(Json::Value);
 #endif
 	~CNeurNet();
-//	int InputDim();
-//	int OutputDim();
 	void Predict(double *, double *);
-    double*** parameters; // Array of parameters for each neuron
+  void PredictBatch(int nBatch, double *inputs, double *outputs);
+  void SetFastActivation(bool val_fast);
 };
 
 class CSANondimInputs{
@@ -1276,6 +1276,30 @@ public:
 	 */
 	virtual void ComputeResidual(double *val_residual, double **val_Jacobian_i,
                                double **val_Jacobian_j, CConfig *config);
+
+	/*!
+	 * \brief Get if the numerical method has a batched kernel (see ComputeResidual_Batch).
+	 * \return <code>TRUE</code> if several edges can be computed together.
+	 */
+	virtual bool GetBatched(void);
+
+	/*!
+	 * \brief Copy the variables of the current edge (set with the Set* functions) into a lane of the batch.
+	 * \param[in] val_lane - Lane of the batch, smaller than EDGE_BATCH_SIZE.
+	 */
+	virtual void SetBatch_Lane(unsigned short val_lane);
+
+	/*!
+	 * \brief Compute the residual of the edges of a batch, the lanes are computed together.
+	 * \param[in] val_nLane - Number of lanes in use.
+	 * \param[out] val_residual - Residuals by lanes, [<i>nVar</i>][EDGE_BATCH_SIZE].
+	 * \param[out] val_Jacobian_i - Jacobians at node i by lanes, [<i>nVar</i> x <i>nVar</i> (by rows)][EDGE_BATCH_SIZE].
+	 * \param[out] val_Jacobian_j - Jacobians at node j by lanes, [<i>nVar</i> x <i>nVar</i> (by rows)][EDGE_BATCH_SIZE].
+	 * \param[in] config - Definition of the particular problem.
+	 */
+	virtual void ComputeResidual_Batch(unsigned short val_nLane, double (*val_residual)[EDGE_BATCH_SIZE],
+                                     double (*val_Jacobian_i)[EDGE_BATCH_SIZE], double (*val_Jacobian_j)[EDGE_BATCH_SIZE],
+                                     CConfig *config);
     
     /*!
 	 * \overload
@@ -1583,6 +1607,8 @@ private:
 	Density_j, Energy_j, SoundSpeed_j, Pressure_j, Enthalpy_j, R, RoeDensity, RoeEnthalpy, RoeSoundSpeed,
 	ProjVelocity, ProjVelocity_i, ProjVelocity_j, proj_delta_vel, delta_p, delta_rho;
 	unsigned short iDim, iVar, jVar, kVar;
+	double (*Batch_V_i)[EDGE_BATCH_SIZE], (*Batch_V_j)[EDGE_BATCH_SIZE],	/*!< \brief Primitive variables of the batch (by lanes). */
+	(*Batch_Normal)[EDGE_BATCH_SIZE], (*Batch_GridVel_i)[EDGE_BATCH_SIZE], (*Batch_GridVel_j)[EDGE_BATCH_SIZE];	/*!< \brief Normals and grid velocities of the batch. */
     
 public:
     
@@ -1607,6 +1633,30 @@ public:
 	 * \param[in] config - Definition of the particular problem.
 	 */
 	void ComputeResidual(double *val_residual, double **val_Jacobian_i, double **val_Jacobian_j, CConfig *config);
+
+	/*!
+	 * \brief The Roe scheme has a batched kernel.
+	 * \return <code>TRUE</code>.
+	 */
+	bool GetBatched(void);
+
+	/*!
+	 * \brief Copy the variables of the current edge into a lane of the batch.
+	 * \param[in] val_lane - Lane of the batch.
+	 */
+	void SetBatch_Lane(unsigned short val_lane);
+
+	/*!
+	 * \brief Compute the Roe's flux of the edges of a batch.
+	 * \param[in] val_nLane - Number of lanes in use.
+	 * \param[out] val_residual - Residuals by lanes, [<i>nVar</i>][EDGE_BATCH_SIZE].
+	 * \param[out] val_Jacobian_i - Jacobians at node i by lanes, [<i>nVar</i> x <i>nVar</i>][EDGE_BATCH_SIZE].
+	 * \param[out] val_Jacobian_j - Jacobians at node j by lanes, [<i>nVar</i> x <i>nVar</i>][EDGE_BATCH_SIZE].
+	 * \param[in] config - Definition of the particular problem.
+	 */
+	void ComputeResidual_Batch(unsigned short val_nLane, double (*val_residual)[EDGE_BATCH_SIZE],
+                             double (*val_Jacobian_i)[EDGE_BATCH_SIZE], double (*val_Jacobian_j)[EDGE_BATCH_SIZE],
+                             CConfig *config);
 };
 
 
@@ -2493,6 +2543,10 @@ private:
 	bool implicit, /*!< \brief Implicit calculation. */
 	grid_movement, /*!< \brief Modification for grid movement. */
 	stretching; /*!< \brief Stretching factor. */
+	double (*Batch_V_i)[EDGE_BATCH_SIZE], (*Batch_V_j)[EDGE_BATCH_SIZE],	/*!< \brief Primitive variables of the batch (by lanes). */
+	(*Batch_Normal)[EDGE_BATCH_SIZE], (*Batch_GridVel_i)[EDGE_BATCH_SIZE], (*Batch_GridVel_j)[EDGE_BATCH_SIZE],	/*!< \brief Normals and grid velocities of the batch. */
+	(*Batch_Und_Lapl_i)[EDGE_BATCH_SIZE], (*Batch_Und_Lapl_j)[EDGE_BATCH_SIZE],	/*!< \brief Undivided laplacians of the batch. */
+	(*Batch_Scalar_i)[EDGE_BATCH_SIZE], (*Batch_Scalar_j)[EDGE_BATCH_SIZE];	/*!< \brief Spectral radius, sensor and number of neighbors of the batch. */
     
     
 public:
@@ -2520,6 +2574,30 @@ public:
 	 */
 	void ComputeResidual(double *val_residual, double **val_Jacobian_i, double **val_Jacobian_j,
                          CConfig *config);
+
+	/*!
+	 * \brief The JST scheme has a batched kernel.
+	 * \return <code>TRUE</code>.
+	 */
+	bool GetBatched(void);
+
+	/*!
+	 * \brief Copy the variables of the current edge into a lane of the batch.
+	 * \param[in] val_lane - Lane of the batch.
+	 */
+	void SetBatch_Lane(unsigned short val_lane);
+
+	/*!
+	 * \brief Compute the JST flow residual of the edges of a batch.
+	 * \param[in] val_nLane - Number of lanes in use.
+	 * \param[out] val_residual - Residuals by lanes, [<i>nVar</i>][EDGE_BATCH_SIZE].
+	 * \param[out] val_Jacobian_i - Jacobians at node i by lanes, [<i>nVar</i> x <i>nVar</i>][EDGE_BATCH_SIZE].
+	 * \param[out] val_Jacobian_j - Jacobians at node j by lanes, [<i>nVar</i> x <i>nVar</i>][EDGE_BATCH_SIZE].
+	 * \param[in] config - Definition of the particular problem.
+	 */
+	void ComputeResidual_Batch(unsigned short val_nLane, double (*val_residual)[EDGE_BATCH_SIZE],
+                             double (*val_Jacobian_i)[EDGE_BATCH_SIZE], double (*val_Jacobian_j)[EDGE_BATCH_SIZE],
+                             CConfig *config);
 };
 
 /*!
@@ -3306,6 +3384,10 @@ private:
 	dist_ij_2,					/*!< \brief Length of the edge and face. */
 	*ProjFlux;	/*!< \brief Projection of the viscous fluxes. */
 	bool implicit;			/*!< \brief Implicit calculus. */
+	double (*Batch_V_i)[EDGE_BATCH_SIZE], (*Batch_V_j)[EDGE_BATCH_SIZE],	/*!< \brief Primitive variables of the batch (by lanes). */
+	(*Batch_Normal)[EDGE_BATCH_SIZE], (*Batch_Coord_i)[EDGE_BATCH_SIZE], (*Batch_Coord_j)[EDGE_BATCH_SIZE],	/*!< \brief Normals and coordinates of the batch. */
+	(*Batch_PrimVar_Grad_i)[EDGE_BATCH_SIZE], (*Batch_PrimVar_Grad_j)[EDGE_BATCH_SIZE],	/*!< \brief Gradients of the batch (by rows). */
+	(*Batch_turb_ke)[EDGE_BATCH_SIZE];	/*!< \brief Turbulent kinetic energy at i and j of the batch. */
     
 public:
     
@@ -3330,6 +3412,30 @@ public:
 	 * \param[in] config - Definition of the particular problem.
 	 */
 	void ComputeResidual(double *val_residual, double **val_Jacobian_i, double **val_Jacobian_j, CConfig *config);
+
+	/*!
+	 * \brief The average of gradients with correction has a batched kernel.
+	 * \return <code>TRUE</code>.
+	 */
+	bool GetBatched(void);
+
+	/*!
+	 * \brief Copy the variables of the current edge into a lane of the batch.
+	 * \param[in] val_lane - Lane of the batch.
+	 */
+	void SetBatch_Lane(unsigned short val_lane);
+
+	/*!
+	 * \brief Compute the viscous flow residual of the edges of a batch.
+	 * \param[in] val_nLane - Number of lanes in use.
+	 * \param[out] val_residual - Residuals by lanes, [<i>nVar</i>][EDGE_BATCH_SIZE].
+	 * \param[out] val_Jacobian_i - Jacobians at node i by lanes, [<i>nVar</i> x <i>nVar</i>][EDGE_BATCH_SIZE].
+	 * \param[out] val_Jacobian_j - Jacobians at node j by lanes, [<i>nVar</i> x <i>nVar</i>][EDGE_BATCH_SIZE].
+	 * \param[in] config - Definition of the particular problem.
+	 */
+	void ComputeResidual_Batch(unsigned short val_nLane, double (*val_residual)[EDGE_BATCH_SIZE],
+                             double (*val_Jacobian_i)[EDGE_BATCH_SIZE], double (*val_Jacobian_j)[EDGE_BATCH_SIZE],
+                             CConfig *config);
 };
 
 /*!
@@ -4146,6 +4252,24 @@ private:
   //double* testJacobian;
   double** DUiDXj;
   double* DNuhatDXj;
+  
+  double *netInput, *netOutput; /*!< \brief Work arrays of the network evaluation. */
+  double *PredictedOutput;      /*!< \brief Network output computed by the solver for a block of points (NULL if not available). */
+  int nSACache;                 /*!< \brief Number of Spalart-Allmaras values kept for each point of a block. */
+  double *SACache;              /*!< \brief Spalart-Allmaras terms of the points of a block, computed with the network inputs. */
+  long iSACache;                /*!< \brief Point of the block whose cached terms are used (-1 to compute them). */
+  
+  /*!
+	 * \brief Compute the Spalart-Allmaras terms and the nondimensional inputs at the current point.
+	 */
+  void SetSAResidual(void);
+  
+  /*!
+	 * \brief Load the network inputs of the current feature set into <i>netInput</i>.
+	 * \return Number of network inputs (zero if the feature set does not use the network).
+	 */
+  int SetFeatures(void);
+  
 public:
   bool isInBL;
   double fw;
@@ -4229,6 +4353,35 @@ public:
   double SAProduction, SADestruction, SACrossProduction, SASource, MLProduction, MLDestruction, MLCrossProduction, MLSource, SourceDiff;
   
   int NumResidual();
+  
+  /*!
+	 * \brief Compute the network inputs of the current point without evaluating the model,
+	 *        the Spalart-Allmaras terms are kept for ComputeResidual.
+	 * \param[out] val_netinput - Network inputs of the point.
+	 * \param[in] val_iPoint_Block - Index of the point in the block (lower than ML_BATCH_SIZE).
+	 * \return Number of network inputs (zero if the feature set does not use the network).
+	 */
+  int SetNetInput(double *val_netinput, unsigned long val_iPoint_Block);
+  
+  /*!
+	 * \brief Set the network output of the current point, already evaluated by the solver.
+	 * \param[in] val_netoutput - Network output of the point (NULL to evaluate it in ComputeResidual).
+	 * \param[in] val_iPoint_Block - Index of the point in the block, its Spalart-Allmaras terms
+	 *            were computed by SetNetInput (-1 to compute them in ComputeResidual).
+	 */
+  void SetNetOutput(double *val_netoutput, long val_iPoint_Block);
+  
+  /*!
+	 * \brief Get the machine learning model.
+	 * \return Pointer to the model.
+	 */
+  CScalePredictor* GetMLModel(void);
+  
+  /*!
+	 * \brief Check whether the feature set evaluates the machine learning model.
+	 * \return <code>TRUE</code> unless the plain Spalart-Allmaras terms are used.
+	 */
+  bool UsesMLModel(void);
 };
 
 
@@ -41,6 +41,14 @@ inline void CNumerics::ComputeResidual(double **val_Jacobian_i, double **val_Jac
 inline void CNumerics::ComputeResidual(double *val_residual, double **val_Jacobian_i, double **val_Jacobian_j, 
                                    CConfig *config) { }
 
+inline bool CNumerics::GetBatched(void) { return false; }
+
+inline void CNumerics::SetBatch_Lane(unsigned short val_lane) { }
+
+inline void CNumerics::ComputeResidual_Batch(unsigned short val_nLane, double (*val_residual)[EDGE_BATCH_SIZE],
+                                             double (*val_Jacobian_i)[EDGE_BATCH_SIZE],
+                                             double (*val_Jacobian_j)[EDGE_BATCH_SIZE], CConfig *config) { }
+
 inline void CNumerics::ComputeResidual(double *val_residual, double **val_Jacobian_i, double **val_Jacobian_j,
                                    double **val_JacobianMeanFlow_i, double **val_JacobianMeanFlow_j, CConfig *config) { }
 
@@ -430,3 +438,9 @@ inline void CNumerics::ComputeResidual(double **val_Jacobian_i, double *val_Jaco
 
 inline void CNumerics::ComputeResidual(double **val_Jacobian_i, double *val_Jacobian_mui, double ***val_Jacobian_gradi, 
 									double **val_Jacobian_j, double *val_Jacobian_muj, double ***val_Jacobian_gradj, CConfig *config) { }
+
+inline bool CUpwRoe_Flow::GetBatched(void) { return true; }
+
+inline bool CCentJST_Flow::GetBatched(void) { return true; }
+
+inline bool CAvgGradCorrected_Flow::GetBatched(void) { return true; }
@@ -102,6 +102,27 @@ protected:
 
     unsigned short nOutputVariables;  /*!< \brief Number of variables to write. */
 
+  unsigned long Derived_Counter;  /*!< \brief Number of derived fields computed, used to stamp them. */
+  unsigned long Derived_Version[MAX_DERIVED_FIELDS];  /*!< \brief Stamp of each derived field (0 if it is not valid). */
+  unsigned long Derived_Source[MAX_DERIVED_FIELDS];   /*!< \brief Stamp of the field it was computed from, for each derived field. */
+
+  bool Interface_Map;                      /*!< \brief True once the donor mapping of the coupling interface has been built. */
+  unsigned long nInterface_Target;         /*!< \brief Number of target vertices of the coupling interface in this rank. */
+  unsigned short *Interface_Target_Marker; /*!< \brief Marker of each target vertex. */
+  unsigned long *Interface_Target_Vertex;  /*!< \brief Vertex index of each target vertex. */
+  unsigned long *Interface_Donor_Slot;     /*!< \brief Position in the receive buffer of each donor (INTERFACE_NDONOR per target vertex). */
+  double *Interface_Donor_Weight;          /*!< \brief Interpolation weight of each donor (INTERFACE_NDONOR per target vertex). */
+  unsigned long nInterface_Send,           /*!< \brief Number of donor values sent by this rank in each exchange. */
+  nInterface_Receive;                      /*!< \brief Number of donor values received by this rank in each exchange. */
+  unsigned long *Interface_Send_Point;     /*!< \brief Local donor points whose values are sent, ordered by destination rank. */
+  int *Interface_nSend,                    /*!< \brief Number of donor values sent to each rank. */
+  *Interface_nReceive;                     /*!< \brief Number of donor values received from each rank. */
+
+  double **Gradient_Load_i,  /*!< \brief Buffer (MAX_PRIMVAR_GRAD x 3) to load the single precision gradient of the flow at point i. */
+  **Gradient_Load_j;         /*!< \brief Buffer (MAX_PRIMVAR_GRAD x 3) to load the single precision gradient of the flow at point j. */
+  double *Limiter_Load_i,    /*!< \brief Buffer (MAX_PRIMVAR_GRAD) to load the single precision limiter of the flow at point i. */
+  *Limiter_Load_j;           /*!< \brief Buffer (MAX_PRIMVAR_GRAD) to load the single precision limiter of the flow at point j. */
+
 public:
   
   CSysVector LinSysSol;		/*!< \brief vector to store iterative solution of implicit linear system. */
@@ -157,6 +178,51 @@ public:
 	 */
 	void SetResidual_RMS(CGeometry *geometry, CConfig *config);
     
+	/*!
+	 * \brief Invalidate all the derived fields (the solution or the grid have changed).
+	 */
+	void SetDerived_Invalid(void);
+    
+	/*!
+	 * \brief Mark a derived field as computed from the current value of the field it depends on.
+	 * \param[in] val_field - Derived field (see ENUM_DERIVED_FIELD).
+	 */
+	void SetDerived_Computed(unsigned short val_field);
+    
+	/*!
+	 * \brief Check if a derived field is up to date, otherwise it must be computed again.
+	 * \param[in] val_field - Derived field (see ENUM_DERIVED_FIELD).
+	 * \return <code>TRUE</code> if the field and the fields it depends on have not changed since it was computed.
+	 */
+	bool GetDerived_Current(unsigned short val_field);
+    
+	/*!
+	 * \brief Build the donor mapping of a coupling interface (nearest donor vertices and inverse distance weights),
+	 *        and the list of values that each rank has to send to the others.
+	 * \param[in] target_geometry - Geometry of the zone that receives the data.
+	 * \param[in] target_marker - Markers of the target zone that belong to the interface.
+	 * \param[in] donor_geometry - Geometry of the zone that provides the data.
+	 * \param[in] donor_marker - Markers of the donor zone that belong to the interface.
+	 */
+	void SetInterface_Map(CGeometry *target_geometry, bool *target_marker, CGeometry *donor_geometry, bool *donor_marker);
+    
+	/*!
+	 * \brief Move the donor values of the coupling interface to the ranks that interpolate them, in a single exchange.
+	 * \param[in] Buffer_Send - Values of the donor points in Interface_Send_Point (nInterface_Send x val_nVal).
+	 * \param[out] Buffer_Receive - Values of the donors referenced by Interface_Donor_Slot (nInterface_Receive x val_nVal).
+	 * \param[in] val_nVal - Number of values of each donor point.
+	 */
+	void SetInterface_Exchange(double *Buffer_Send, double *Buffer_Receive, unsigned short val_nVal);
+    
+	/*!
+	 * \brief Build the donor mapping of the fluid-structure interface, once at preprocessing.
+	 * \param[in] geometry - Geometry of the zone of this solver.
+	 * \param[in] config - Definition of the zone of this solver.
+	 * \param[in] donor_geometry - Geometry of the coupled zone.
+	 * \param[in] donor_config - Definition of the coupled zone.
+	 */
+	virtual void SetFSI_Interface(CGeometry **geometry, CConfig *config, CGeometry **donor_geometry, CConfig *donor_config);
+    
     /*!
 	 * \brief Set number of linear solver iterations.
 	 * \param[in] val_iterlinsolver - Number of linear iterations.
@@ -452,6 +518,19 @@ public:
 	virtual void Upwind_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics *numerics,
                                  CConfig *config, unsigned short iMesh);
     
+	/*!
+	 * \brief Upwind and viscous residuals, by default computed in separate loops over the edges.
+	 * \param[in] geometry - Geometrical definition of the problem.
+	 * \param[in] solver_container - Container vector with all the solutions.
+	 * \param[in] conv_numerics - Description of the convective numerical method.
+	 * \param[in] visc_numerics - Description of the viscous numerical method.
+	 * \param[in] config - Definition of the particular problem.
+	 * \param[in] iMesh - Index of the mesh in multigrid computations.
+	 * \param[in] iRKStep - Current step of the Runge-Kutta iteration.
+	 */
+	virtual void Upwind_Viscous_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics *conv_numerics,
+                               CNumerics *visc_numerics, CConfig *config, unsigned short iMesh, unsigned short iRKStep);
+    
 	/*!
 	 * \brief A virtual member.
 	 * \param[in] geometry - Geometrical definition of the problem.
@@ -2124,6 +2203,15 @@ protected:
 	bool space_centered,  /*!< \brief True if space centered scheeme used. */
 	euler_implicit,			/*!< \brief True if euler implicit scheme used. */
 	least_squares;        /*!< \brief True if computing gradients by least squares. */
+	bool reduce_forces_visc;  /*!< \brief True if the inviscid coefficients are reduced in Viscous_Forces (CNSSolver). */
+	double (*Res_Batch)[EDGE_BATCH_SIZE],	/*!< \brief Residuals of the lanes of a batch (EDGE_BATCH). */
+	(*Jacobian_i_Batch)[EDGE_BATCH_SIZE],	/*!< \brief Jacobians at node i of the lanes of a batch (EDGE_BATCH). */
+	(*Jacobian_j_Batch)[EDGE_BATCH_SIZE];	/*!< \brief Jacobians at node j of the lanes of a batch (EDGE_BATCH). */
+	double (*Res_Batch_Check)[EDGE_BATCH_SIZE],	/*!< \brief Edge by edge residuals of the lanes of a batch (EDGE_BATCH_CHECK). */
+	(*Jacobian_i_Batch_Check)[EDGE_BATCH_SIZE],	/*!< \brief Edge by edge Jacobians at node i of the lanes of a batch (EDGE_BATCH_CHECK). */
+	(*Jacobian_j_Batch_Check)[EDGE_BATCH_SIZE];	/*!< \brief Edge by edge Jacobians at node j of the lanes of a batch (EDGE_BATCH_CHECK). */
+	double *Res_Visc_Edge,	/*!< \brief Viscous residual of each edge (EDGE_LOOP= FUSED_REFERENCE). */
+	*Jacobian_Edge;	/*!< \brief Viscous Jacobians at nodes i and j of each edge (EDGE_LOOP= FUSED_REFERENCE). */
 	double Gamma;									/*!< \brief Fluid's Gamma constant (ratio of specific heats). */
 	double Gamma_Minus_One;				/*!< \brief Fluids's Gamma - 1.0  . */
   
@@ -2291,6 +2379,57 @@ public:
 	void Upwind_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics *numerics,
                          CConfig *config, unsigned short iMesh);
     
+	/*!
+	 * \brief Loop over the edges for the upwind residual, and optionally the viscous residual.
+	 * \param[in] geometry - Geometrical definition of the problem.
+	 * \param[in] solver_container - Container vector with all the solutions.
+	 * \param[in] numerics - Description of the convective numerical method.
+	 * \param[in] visc_numerics - Description of the viscous numerical method, <code>NULL</code> for the upwind residual only.
+	 * \param[in] config - Definition of the particular problem.
+	 * \param[in] iMesh - Index of the mesh in multigrid computations.
+	 */
+	void Upwind_Edge_Loop(CGeometry *geometry, CSolver **solver_container, CNumerics *numerics,
+                        CNumerics *visc_numerics, CConfig *config, unsigned short iMesh);
+    
+	/*!
+	 * \brief Add the residuals and Jacobians of a batch of edges (see CNumerics::ComputeResidual_Batch).
+	 * \param[in] geometry - Geometrical definition of the problem.
+	 * \param[in] val_edge - Edges of the batch.
+	 * \param[in] val_nLane - Number of edges in the batch.
+	 * \param[in] val_residual - Residuals of the edges by lanes, [<i>nVar</i>][EDGE_BATCH_SIZE].
+	 * \param[in] val_Jacobian_i - Jacobians at node i by lanes, [<i>nVar</i> x <i>nVar</i>][EDGE_BATCH_SIZE].
+	 * \param[in] val_Jacobian_j - Jacobians at node j by lanes, [<i>nVar</i> x <i>nVar</i>][EDGE_BATCH_SIZE].
+	 * \param[in] val_implicit - Add the Jacobians to the system matrix.
+	 * \param[in] val_viscous - Viscous residual (subtracted at node i), otherwise convective (added at node i).
+	 */
+	void AddResidual_Batch(CGeometry *geometry, unsigned long *val_edge, unsigned short val_nLane,
+                         double (*val_residual)[EDGE_BATCH_SIZE], double (*val_Jacobian_i)[EDGE_BATCH_SIZE],
+                         double (*val_Jacobian_j)[EDGE_BATCH_SIZE], bool val_implicit, bool val_viscous);
+    
+	/*!
+	 * \brief Compute the current edge with the edge by edge method, and keep the result for a lane of the batch (EDGE_BATCH_CHECK).
+	 * \param[in] numerics - Description of the numerical method, with the variables of the current edge.
+	 * \param[in] val_lane - Lane of the edge in the batch.
+	 * \param[in] val_implicit - Keep also the Jacobians.
+	 * \param[in] config - Definition of the particular problem.
+	 */
+	void SetBatch_Check(CNumerics *numerics, unsigned short val_lane, bool val_implicit, CConfig *config);
+    
+	/*!
+	 * \brief Compare the residuals and Jacobians of a batch with the edge by edge ones (EDGE_BATCH_CHECK), the
+	 *        edges that differ by more than EDGE_BATCH_CHECK_TOL are reported.
+	 * \param[in] geometry - Geometrical definition of the problem.
+	 * \param[in] val_edge - Edges of the batch.
+	 * \param[in] val_nLane - Number of edges in the batch.
+	 * \param[in] val_residual - Residuals of the batched kernel by lanes, [<i>nVar</i>][EDGE_BATCH_SIZE].
+	 * \param[in] val_Jacobian_i - Jacobians at node i of the batched kernel by lanes, [<i>nVar</i> x <i>nVar</i>][EDGE_BATCH_SIZE].
+	 * \param[in] val_Jacobian_j - Jacobians at node j of the batched kernel by lanes, [<i>nVar</i> x <i>nVar</i>][EDGE_BATCH_SIZE].
+	 * \param[in] val_implicit - Compare also the Jacobians.
+	 */
+	void CheckResidual_Batch(CGeometry *geometry, unsigned long *val_edge, unsigned short val_nLane,
+                           double (*val_residual)[EDGE_BATCH_SIZE], double (*val_Jacobian_i)[EDGE_BATCH_SIZE],
+                           double (*val_Jacobian_j)[EDGE_BATCH_SIZE], bool val_implicit);
+    
 	/*!
 	 * \brief Source term integration.
 	 * \param[in] geometry - Geometrical definition of the problem.
@@ -2659,6 +2798,27 @@ public:
 	 * \param[in] config - Definition of the particular problem.
 	 */
 	void Inviscid_Forces(CGeometry *geometry, CConfig *config);
+  
+  /*!
+	 * \brief Append the inviscid coefficients (all boundaries and monitored surfaces) to the buffer of a fused MPI reduction.
+	 * \param[in] config - Definition of the particular problem.
+	 * \param[in] val_buffer - Buffer of the reduction.
+	 */
+	void Pack_Forces_Inv(CConfig *config, vector<double> &val_buffer);
+  
+  /*!
+	 * \brief Read the inviscid coefficients back from the buffer of a fused MPI reduction.
+	 * \param[in] config - Definition of the particular problem.
+	 * \param[in] val_buffer - Buffer of the reduction.
+	 * \param[in] val_index - Position in the buffer, advanced past the inviscid coefficients.
+	 */
+	void Unpack_Forces_Inv(CConfig *config, vector<double> &val_buffer, unsigned long &val_index);
+  
+  /*!
+	 * \brief Set the total coefficients (all boundaries and monitored surfaces) to the inviscid ones.
+	 * \param[in] config - Definition of the particular problem.
+	 */
+	void SetTotal_Forces_Inv(CConfig *config);
 
 	/*!
 	 * \brief Provide the non dimensional lift coefficient (inviscid contribution).
@@ -3121,6 +3281,15 @@ public:
 	void SetResidual_DualTime(CGeometry *geometry, CSolver **solver_container, CConfig *config,
                               unsigned short iRKStep, unsigned short iMesh, unsigned short RunTime_EqSystem);
     
+	/*!
+	 * \brief Build the donor mapping of the fluid-structure interface, once at preprocessing.
+	 * \param[in] geometry - Geometry of the zone of this solver.
+	 * \param[in] config - Definition of the zone of this solver.
+	 * \param[in] donor_geometry - Geometry of the coupled zone.
+	 * \param[in] donor_config - Definition of the coupled zone.
+	 */
+	void SetFSI_Interface(CGeometry **geometry, CConfig *config, CGeometry **donor_geometry, CConfig *donor_config);
+    
 	/*!
 	 * \brief A virtual member.
 	 * \param[in] flow_geometry - Geometrical definition of the problem.
@@ -3293,6 +3462,21 @@ public:
 	 * \param[in] config - Definition of the particular problem.
 	 */
 	void Viscous_Forces(CGeometry *geometry, CConfig *config);
+  
+  /*!
+	 * \brief Append the viscous coefficients (all boundaries and monitored surfaces) to the buffer of a fused MPI reduction.
+	 * \param[in] config - Definition of the particular problem.
+	 * \param[in] val_buffer - Buffer of the reduction.
+	 */
+	void Pack_Forces_Visc(CConfig *config, vector<double> &val_buffer);
+  
+  /*!
+	 * \brief Read the viscous coefficients back from the buffer of a fused MPI reduction.
+	 * \param[in] config - Definition of the particular problem.
+	 * \param[in] val_buffer - Buffer of the reduction.
+	 * \param[in] val_index - Position in the buffer, advanced past the viscous coefficients.
+	 */
+	void Unpack_Forces_Visc(CConfig *config, vector<double> &val_buffer, unsigned long &val_index);
     
 	/*!
 	 * \brief Get the non dimensional lift coefficient (viscous contribution).
@@ -3352,6 +3536,19 @@ public:
 	void Viscous_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics *numerics,
                           CConfig *config, unsigned short iMesh, unsigned short iRKStep);
     
+	/*!
+	 * \brief Upwind and viscous residuals of the mean flow in a single loop over the edges.
+	 * \param[in] geometry - Geometrical definition of the problem.
+	 * \param[in] solver_container - Container vector with all the solutions.
+	 * \param[in] conv_numerics - Description of the convective numerical method.
+	 * \param[in] visc_numerics - Description of the viscous numerical method.
+	 * \param[in] config - Definition of the particular problem.
+	 * \param[in] iMesh - Index of the mesh in multigrid computations.
+	 * \param[in] iRKStep - Current step of the Runge-Kutta iteration.
+	 */
+	void Upwind_Viscous_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics *conv_numerics,
+                               CNumerics *visc_numerics, CConfig *config, unsigned short iMesh, unsigned short iRKStep);
+    
 	/*!
 	 * \brief Get the skin friction coefficient.
 	 * \param[in] val_marker - Surface marker where the coefficient is computed.
@@ -3406,6 +3603,8 @@ protected:
 	*FlowPrimVar_j,        /*!< \brief Store the flow solution at point j. */
 	*lowerlimit,            /*!< \brief contains lower limits for turbulence variables. */
 	*upperlimit;            /*!< \brief contains upper limits for turbulence variables. */
+	double *Res_Visc_Edge,	/*!< \brief Viscous residual of each edge (EDGE_LOOP= FUSED_REFERENCE). */
+	*Jacobian_Edge;	/*!< \brief Viscous Jacobians at nodes i and j of each edge (EDGE_LOOP= FUSED_REFERENCE). */
 	double Gamma;									/*!< \brief Fluid's Gamma constant (ratio of specific heats). */
 	double Gamma_Minus_One;				/*!< \brief Fluids's Gamma - 1.0  . */
     
@@ -3466,6 +3665,31 @@ public:
 	void Upwind_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics *numerics, CConfig *config,
                        unsigned short iMesh);
   
+	/*!
+	 * \brief Loop over the edges for the upwind residual, and optionally the viscous residual.
+	 * \param[in] geometry - Geometrical definition of the problem.
+	 * \param[in] solver_container - Container vector with all the solutions.
+	 * \param[in] numerics - Description of the convective numerical method.
+	 * \param[in] visc_numerics - Description of the viscous numerical method, <code>NULL</code> for the upwind residual only.
+	 * \param[in] config - Definition of the particular problem.
+	 * \param[in] iMesh - Index of the mesh in multigrid computations.
+	 */
+	void Upwind_Edge_Loop(CGeometry *geometry, CSolver **solver_container, CNumerics *numerics,
+                        CNumerics *visc_numerics, CConfig *config, unsigned short iMesh);
+    
+	/*!
+	 * \brief Upwind and viscous residuals of the turbulence model in a single loop over the edges.
+	 * \param[in] geometry - Geometrical definition of the problem.
+	 * \param[in] solver_container - Container vector with all the solutions.
+	 * \param[in] conv_numerics - Description of the convective numerical method.
+	 * \param[in] visc_numerics - Description of the viscous numerical method.
+	 * \param[in] config - Definition of the particular problem.
+	 * \param[in] iMesh - Index of the mesh in multigrid computations.
+	 * \param[in] iRKStep - Current step of the Runge-Kutta iteration.
+	 */
+	void Upwind_Viscous_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics *conv_numerics,
+                               CNumerics *visc_numerics, CConfig *config, unsigned short iMesh, unsigned short iRKStep);
+    
 	/*!
 	 * \brief Compute the viscous residuals for the turbulent equation.
 	 * \param[in] geometry - Geometrical definition of the problem.
@@ -3716,6 +3940,19 @@ public:
 class CTurbMLSolver: public CTurbSolver {
 private:
 	double nu_tilde_Inf;
+  double *NetInput,   /*!< \brief Network inputs of a block of points. */
+  *NetOutput;         /*!< \brief Network outputs of a block of points. */
+  
+  /*!
+	 * \brief Load the point data required by the source term into the numerics.
+	 * \param[in] geometry - Geometrical definition of the problem.
+	 * \param[in] solver_container - Container vector with all the solutions.
+	 * \param[in] numerics - Description of the numerical method.
+	 * \param[in] config - Definition of the particular problem.
+	 * \param[in] iPoint - Index of the point.
+	 */
+  void SetSource_Numerics(CGeometry *geometry, CSolver **solver_container, CNumerics *numerics,
+                          CConfig *config, unsigned long iPoint);
 	
 public:
 	/*!
@@ -5375,6 +5612,15 @@ private:
   double **StiffMatrix_Elem,			/*!< \brief Auxiliary matrices for storing point to point Stiffness Matrices. */
 	**StiffMatrix_Node;							/*!< \brief Auxiliary matrices for storing point to point Stiffness Matrices. */
   
+  bool Operator_Assembled;  /*!< \brief The stiffness and mass matrices have been assembled (linear elasticity, fixed mesh). */
+  double *Jacobian_Operator,  /*!< \brief Entries of the assembled Jacobian, before the boundary conditions. */
+  *StiffMatrixTime_Operator;  /*!< \brief Entries of the assembled mass matrix of the dual time stepping. */
+  
+  /*!
+   * \brief Store the assembled stiffness and mass matrices, they are reused in the next iterations.
+   */
+  void SetOperator_Assembled(void);
+  
 public:
     
 	/*!
@@ -5506,6 +5752,15 @@ public:
 	 */
   void GetSurface_Pressure(CGeometry *geometry, CConfig *config);
   
+	/*!
+	 * \brief Build the donor mapping of the fluid-structure interface, once at preprocessing.
+	 * \param[in] geometry - Geometry of the zone of this solver.
+	 * \param[in] config - Definition of the zone of this solver.
+	 * \param[in] donor_geometry - Geometry of the coupled zone.
+	 * \param[in] donor_config - Definition of the coupled zone.
+	 */
+	void SetFSI_Interface(CGeometry **geometry, CConfig *config, CGeometry **donor_geometry, CConfig *donor_config);
+    
 	/*!
 	 * \brief Set the the pressure load in the FEA solver.
 	 * \param[in] fea_geometry - Geometrical definition of the problem.
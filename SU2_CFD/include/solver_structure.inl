@@ -24,6 +24,25 @@
 
 inline void CSolver::SetIterLinSolver(unsigned short val_iterlinsolver) { IterLinSolver = val_iterlinsolver; }
 
+inline void CSolver::SetDerived_Invalid(void) {
+  for (unsigned short iField = 0; iField < MAX_DERIVED_FIELDS; iField++) Derived_Version[iField] = 0;
+}
+
+inline void CSolver::SetDerived_Computed(unsigned short val_field) {
+  Derived_Counter++;
+  Derived_Version[val_field] = Derived_Counter;
+  if (val_field == DERIVED_PRIMITIVE) Derived_Source[val_field] = 0;
+  else if (val_field == DERIVED_PRIM_GRADIENT) Derived_Source[val_field] = Derived_Version[DERIVED_PRIMITIVE];
+  else Derived_Source[val_field] = Derived_Version[DERIVED_PRIM_GRADIENT];
+}
+
+inline bool CSolver::GetDerived_Current(unsigned short val_field) {
+  if (Derived_Version[val_field] == 0) return false;
+  if (val_field == DERIVED_PRIMITIVE) return true;
+  if (val_field == DERIVED_PRIM_GRADIENT) return (Derived_Source[val_field] == Derived_Version[DERIVED_PRIMITIVE]);
+  return ((Derived_Source[val_field] == Derived_Version[DERIVED_PRIM_GRADIENT]) && GetDerived_Current(DERIVED_PRIM_GRADIENT));
+}
+
 inline unsigned short CSolver::GetnSpecies(void) { return 0; }
 
 inline void CSolver::Set_MPI_Solution_Gradient(CGeometry *geometry, CConfig *config) { }
@@ -53,6 +72,8 @@ inline void CSolver::SetResidual_DualTime(CGeometry *geometry, CSolver **solver_
 																		 
 inline void CSolver::SetFreeSurface_Distance(CGeometry *geometry, CConfig *config) { }
 
+inline void CSolver::SetFSI_Interface(CGeometry **geometry, CConfig *config, CGeometry **donor_geometry, CConfig *donor_config) { }
+
 inline void CSolver::SetFEA_Load(CSolver ***flow_solution, CGeometry **fea_geometry, CGeometry **flow_geometry, CConfig *fea_config, CConfig *flow_config) { }
 
 inline void CSolver::GetSurface_Pressure(CGeometry *geometry, CConfig *config) { }
@@ -447,6 +468,12 @@ inline void CSolver::Centered_Residual(CGeometry *geometry, CSolver **solver_con
 inline void CSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics *numerics, 
 									   CConfig *config, unsigned short iMesh) { }
 
+inline void CSolver::Upwind_Viscous_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics *conv_numerics,
+                                             CNumerics *visc_numerics, CConfig *config, unsigned short iMesh, unsigned short iRKStep) {
+  Upwind_Residual(geometry, solver_container, conv_numerics, config, iMesh);
+  Viscous_Residual(geometry, solver_container, visc_numerics, config, iMesh, iRKStep);
+}
+
 inline void CSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container, CConfig *config, unsigned short iMesh, unsigned short iRKStep, unsigned short RunTime_EqSystem, bool Output) { }
 
 inline void CSolver::SetDissipation_Switch(CGeometry *geometry, CConfig *config) { }
@@ -1480,6 +1480,20 @@ public:
 	 * \return Value of the primitive variables gradient.
 	 */
 	virtual double *GetLimiter_Primitive(void);
+
+  /*!
+	 * \brief A virtual member.
+	 * \param[in] val_buffer - Buffer (MAX_PRIMVAR_GRAD x nDim) for the gradient stored in single precision.
+	 * \return Value of the primitive variables gradient.
+	 */
+	virtual double **GetGradient_Primitive(double **val_buffer);
+
+  /*!
+	 * \brief A virtual member.
+	 * \param[in] val_buffer - Buffer (MAX_PRIMVAR_GRAD) for the limiter stored in single precision.
+	 * \return Value of the primitive variables limiter.
+	 */
+	virtual double *GetLimiter_Primitive(double *val_buffer);
   
   /*!
 	 * \brief A virtual member.
@@ -1962,6 +1976,8 @@ protected:
 	double **Gradient_Primitive;	/*!< \brief Gradient of the primitive variables (T,vx,vy,vz,P,rho). */ 
 	double **Reconst_Gradient_Primitive;
   double *Limiter_Primitive;    /*!< \brief Limiter of the primitive variables (T,vx,vy,vz,P,rho). */ 
+  float *Gradient_Primitive_Single;	/*!< \brief Gradient of the primitive variables in single precision (nPrimVarGrad x nDim). */
+  float *Limiter_Primitive_Single;	/*!< \brief Limiter of the primitive variables in single precision. */
 
   /*--- Secondary variable definition ---*/
   
@@ -2067,6 +2083,22 @@ public:
 	 */
 	double *GetLimiter_Primitive(void);
 
+  /*!
+	 * \brief Get the value of the primitive variables gradient, converted to double in the buffer if
+	 *        it is stored in single precision.
+	 * \param[in] val_buffer - Buffer (MAX_PRIMVAR_GRAD x nDim) for the conversion.
+	 * \return Value of the primitive variables gradient.
+	 */
+	double **GetGradient_Primitive(double **val_buffer);
+
+  /*!
+	 * \brief Get the value of the primitive variables limiter, converted to double in the buffer if
+	 *        it is stored in single precision.
+	 * \param[in] val_buffer - Buffer (MAX_PRIMVAR_GRAD) for the conversion.
+	 * \return Value of the primitive variables limiter.
+	 */
+	double *GetLimiter_Primitive(double *val_buffer);
+
   /*!
 	 * \brief Set to zero the gradient of the primitive variables.
 	 */
@@ -3437,6 +3469,17 @@ public:
    * \brief Calculates enthalpy per mass, \f$C^{vib-el}_{v_s}\f$, for input species (not including KE)
    */
   double CalcCvve(double val_Tve, CConfig *config, unsigned short val_Species);
+  
+  /*!
+   * \brief Calculates the mixture vib.-el. energy, \f$\rho e^{vib-el}\f$, and specific heat, \f$\rho C^{vib-el}_v\f$, in a single pass over the species.
+   * \param[in] U - Conserved variables (only the species densities are used).
+   * \param[in] val_Tve - Vib.-el. temperature.
+   * \param[in] config - Configuration settings
+   * \param[out] val_rhoEve - Mixture vib.-el. energy per volume.
+   * \param[out] val_rhoCvve - Mixture vib.-el. specific heat per volume.
+   */
+  void CalcRhoEveCvve(double *U, double val_Tve, CConfig *config,
+                      double &val_rhoEve, double &val_rhoCvve);
 
   /*!
    * \brief Calculates partial derivative of pressure w.r.t. conserved variables \f$\frac{\partial P}{\partial U}\f$
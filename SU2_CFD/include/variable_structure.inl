@@ -427,6 +427,10 @@ inline double **CVariable::GetReconstGradient_Primitive(void) { return NULL; }
 
 inline double *CVariable::GetLimiter_Primitive(void) { return NULL; }
 
+inline double **CVariable::GetGradient_Primitive(double **val_buffer) { return GetGradient_Primitive(); }
+
+inline double *CVariable::GetLimiter_Primitive(double *val_buffer) { return GetLimiter_Primitive(); }
+
 inline void CVariable::SetGradient_SecondaryZero(unsigned short val_secondaryvar) { }
 
 inline void CVariable::AddGradient_Secondary(unsigned short val_var, unsigned short val_dim, double val_value) { }
@@ -604,25 +608,58 @@ inline void CEulerVariable::SetVelocityInc_Old(double *val_velocity) {
     Solution_Old[iDim+1] = val_velocity[iDim]*Primitive[nDim+1];
 }
 
-inline void CEulerVariable::AddGradient_Primitive(unsigned short val_var, unsigned short val_dim, double val_value) { Gradient_Primitive[val_var][val_dim] += val_value; }
+inline void CEulerVariable::AddGradient_Primitive(unsigned short val_var, unsigned short val_dim, double val_value) {
+  if (Gradient_Primitive != NULL) Gradient_Primitive[val_var][val_dim] += val_value;
+  else Gradient_Primitive_Single[val_var*nDim+val_dim] += val_value;
+}
 
-inline void CEulerVariable::SubtractGradient_Primitive(unsigned short val_var, unsigned short val_dim, double val_value) { Gradient_Primitive[val_var][val_dim] -= val_value; }
+inline void CEulerVariable::SubtractGradient_Primitive(unsigned short val_var, unsigned short val_dim, double val_value) {
+  if (Gradient_Primitive != NULL) Gradient_Primitive[val_var][val_dim] -= val_value;
+  else Gradient_Primitive_Single[val_var*nDim+val_dim] -= val_value;
+}
 
-inline double CEulerVariable::GetGradient_Primitive(unsigned short val_var, unsigned short val_dim) { return Gradient_Primitive[val_var][val_dim]; }
+inline double CEulerVariable::GetGradient_Primitive(unsigned short val_var, unsigned short val_dim) {
+  if (Gradient_Primitive != NULL) return Gradient_Primitive[val_var][val_dim];
+  else return Gradient_Primitive_Single[val_var*nDim+val_dim];
+}
 inline double CEulerVariable::GetReconstGradient_Primitive(unsigned short val_var, unsigned short val_dim) { return Reconst_Gradient_Primitive[val_var][val_dim]; }
 
-inline double CEulerVariable::GetLimiter_Primitive(unsigned short val_var) { return Limiter_Primitive[val_var]; }
+inline double CEulerVariable::GetLimiter_Primitive(unsigned short val_var) {
+  if (Limiter_Primitive != NULL) return Limiter_Primitive[val_var];
+  else return Limiter_Primitive_Single[val_var];
+}
 
-inline void CEulerVariable::SetGradient_Primitive(unsigned short val_var, unsigned short val_dim, double val_value) { Gradient_Primitive[val_var][val_dim] = val_value; }
+inline void CEulerVariable::SetGradient_Primitive(unsigned short val_var, unsigned short val_dim, double val_value) {
+  if (Gradient_Primitive != NULL) Gradient_Primitive[val_var][val_dim] = val_value;
+  else Gradient_Primitive_Single[val_var*nDim+val_dim] = float(val_value);
+}
 inline void CEulerVariable::SetReconstGradient_Primitive(unsigned short val_var, unsigned short val_dim, double val_value) { Reconst_Gradient_Primitive[val_var][val_dim] = val_value; }
 
-inline void CEulerVariable::SetLimiter_Primitive(unsigned short val_var, double val_value) { Limiter_Primitive[val_var] = val_value; }
+inline void CEulerVariable::SetLimiter_Primitive(unsigned short val_var, double val_value) {
+  if (Limiter_Primitive != NULL) Limiter_Primitive[val_var] = val_value;
+  else Limiter_Primitive_Single[val_var] = float(val_value);
+}
 
 inline double **CEulerVariable::GetGradient_Primitive(void) { return Gradient_Primitive; }
 inline double **CEulerVariable::GetReconstGradient_Primitive(void) { return Reconst_Gradient_Primitive; }
 
 inline double *CEulerVariable::GetLimiter_Primitive(void) { return Limiter_Primitive; }
 
+inline double **CEulerVariable::GetGradient_Primitive(double **val_buffer) {
+  if (Gradient_Primitive_Single == NULL) return Gradient_Primitive;
+  for (unsigned short iVar = 0; iVar < nPrimVarGrad; iVar++)
+    for (unsigned short iDim = 0; iDim < nDim; iDim++)
+      val_buffer[iVar][iDim] = Gradient_Primitive_Single[iVar*nDim+iDim];
+  return val_buffer;
+}
+
+inline double *CEulerVariable::GetLimiter_Primitive(double *val_buffer) {
+  if (Limiter_Primitive_Single == NULL) return Limiter_Primitive;
+  for (unsigned short iVar = 0; iVar < nPrimVarGrad; iVar++)
+    val_buffer[iVar] = Limiter_Primitive_Single[iVar];
+  return val_buffer;
+}
+
 inline void CEulerVariable::AddGradient_Secondary(unsigned short val_var, unsigned short val_dim, double val_value) { Gradient_Secondary[val_var][val_dim] += val_value; }
 
 inline void CEulerVariable::SubtractGradient_Secondary(unsigned short val_var, unsigned short val_dim, double val_value) { Gradient_Secondary[val_var][val_dim] -= val_value; }
@@ -194,14 +194,23 @@ unsigned short GetnDim(string val_mesh_filename, unsigned short val_format) {
 
 void Geometrical_Preprocessing(CGeometry ***geometry, CConfig **config, unsigned short val_nZone) {
   
-  unsigned short iMGlevel, iZone;
-  unsigned long iPoint; 
+  unsigned short iMGlevel, iZone, nMGLevels_Built = 0, *nMGLevels_Cache;
+  unsigned long iPoint, *Geometry_Hash;
   int rank = MASTER_NODE;
+  bool *Read_Cache;
+  string *Cache_FileName;
+  ifstream *Cache_File;
 
 #ifdef HAVE_MPI
   MPI_Comm_rank(MPI_COMM_WORLD, &rank);
 #endif
   
+  Read_Cache = new bool [val_nZone];
+  nMGLevels_Cache = new unsigned short [val_nZone];
+  Geometry_Hash = new unsigned long [val_nZone];
+  Cache_FileName = new string [val_nZone];
+  Cache_File = new ifstream [val_nZone];
+  
   for (iZone = 0; iZone < val_nZone; iZone++) {
     
     /*--- Compute elements surrounding points, points surrounding points ---*/
@@ -235,12 +244,58 @@ void Geometrical_Preprocessing(CGeometry ***geometry, CConfig **config, unsigned
     geometry[iZone][MESH_0]->Check_IntElem_Orientation(config[iZone]);
     geometry[iZone][MESH_0]->Check_BoundElem_Orientation(config[iZone]);
 
+    /*--- Check if the rest of the preprocessing (edges, dual grid and
+     multigrid levels) can be read from the geometry cache, the cache must
+     match the grid of every rank ---*/
+    
+    Read_Cache[iZone] = false;
+    if (config[iZone]->GetGeometry_Cache()) {
+      
+      Cache_FileName[iZone] = config[iZone]->GetGeometry_Cache_FileName();
+      if (val_nZone > 1) {
+        ostringstream zone_suffix;
+        zone_suffix << "_zone" << iZone;
+        size_t lastindex = Cache_FileName[iZone].find_last_of(".");
+        if (lastindex == string::npos) lastindex = Cache_FileName[iZone].size();
+        Cache_FileName[iZone].insert(lastindex, zone_suffix.str());
+      }
+      
+      Geometry_Hash[iZone] = geometry[iZone][MESH_0]->GetGeometry_Hash(config[iZone]);
+      Cache_File[iZone].open(Cache_FileName[iZone].c_str(), ios::in | ios::binary);
+      if (Cache_File[iZone].is_open())
+        Read_Cache[iZone] = geometry[iZone][MESH_0]->ReadCache_Header(Cache_File[iZone], config[iZone], Geometry_Hash[iZone], nMGLevels_Cache[iZone]);
+      
+#ifdef HAVE_MPI
+      int my_Read_Cache = Read_Cache[iZone], All_Read_Cache;
+      MPI_Allreduce(&my_Read_Cache, &All_Read_Cache, 1, MPI_INT, MPI_MIN, MPI_COMM_WORLD);
+      Read_Cache[iZone] = (All_Read_Cache == 1);
+#endif
+      
+      if (!Read_Cache[iZone]) Cache_File[iZone].close();
+      if ((rank == MASTER_NODE) && Read_Cache[iZone])
+        cout << "Reading the preprocessed geometry from " << Cache_FileName[iZone] << "." << endl;
+      
+    }
+    
     /*--- Create the edge structure ---*/
     
     if (rank == MASTER_NODE) cout << "Identifying edges and vertices." << endl;
-    geometry[iZone][MESH_0]->SetEdges();
+    if (!Read_Cache[iZone]) geometry[iZone][MESH_0]->SetEdges();
     geometry[iZone][MESH_0]->SetVertex(config[iZone]);
     
+    /*--- Edges, control volumes and boundary normals from the cache ---*/
+    
+    if (Read_Cache[iZone] && !geometry[iZone][MESH_0]->ReadCache_DualGrid(Cache_File[iZone])) {
+      cout << "The geometry cache " << Cache_FileName[iZone] << " does not match the grid." << endl;
+      cout << "Remove the cache file and run again." << endl;
+#ifndef HAVE_MPI
+      exit(EXIT_FAILURE);
+#else
+      MPI_Abort(MPI_COMM_WORLD,1);
+      MPI_Finalize();
+#endif
+    }
+    
     /*--- Compute cell center of gravity ---*/
     
     if (rank == MASTER_NODE) cout << "Computing centers of gravity." << endl;
@@ -248,9 +303,11 @@ void Geometrical_Preprocessing(CGeometry ***geometry, CConfig **config, unsigned
     
     /*--- Create the control volume structures ---*/
     
-    if (rank == MASTER_NODE) cout << "Setting the control volume structure." << endl;
-    geometry[iZone][MESH_0]->SetControlVolume(config[iZone], ALLOCATE);
-    geometry[iZone][MESH_0]->SetBoundControlVolume(config[iZone], ALLOCATE);
+    if (!Read_Cache[iZone]) {
+      if (rank == MASTER_NODE) cout << "Setting the control volume structure." << endl;
+      geometry[iZone][MESH_0]->SetControlVolume(config[iZone], ALLOCATE);
+      geometry[iZone][MESH_0]->SetBoundControlVolume(config[iZone], ALLOCATE);
+    }
     
     /*--- Visualize a dual control volume if requested ---*/
     
@@ -260,8 +317,10 @@ void Geometrical_Preprocessing(CGeometry ***geometry, CConfig **config, unsigned
     
     /*--- Identify closest normal neighbor ---*/
     
-    if (rank == MASTER_NODE) cout << "Searching for the closest normal neighbors to the surfaces." << endl;
-    geometry[iZone][MESH_0]->FindNormal_Neighbor(config[iZone]);
+    if (!Read_Cache[iZone]) {
+      if (rank == MASTER_NODE) cout << "Searching for the closest normal neighbors to the surfaces." << endl;
+      geometry[iZone][MESH_0]->FindNormal_Neighbor(config[iZone]);
+    }
     
     /*--- Compute the surface curvature ---*/
     
@@ -282,13 +341,29 @@ void Geometrical_Preprocessing(CGeometry ***geometry, CConfig **config, unsigned
   
   for (iMGlevel = 1; iMGlevel <= config[ZONE_0]->GetMGLevels(); iMGlevel++) {
     
+    nMGLevels_Built = iMGlevel;
+    
     /*--- Loop over all zones at each grid level. ---*/
     
     for (iZone = 0; iZone < val_nZone; iZone++) {
       
       /*--- Create main agglomeration structure ---*/
       
-      geometry[iZone][iMGlevel] = new CMultiGridGeometry(geometry, config, iMGlevel, iZone);
+      if (Read_Cache[iZone] && (iMGlevel <= nMGLevels_Cache[iZone]))
+        geometry[iZone][iMGlevel] = new CMultiGridGeometry(geometry, config, iMGlevel, iZone, Cache_File[iZone]);
+      else {
+        if (Read_Cache[iZone]) {
+          cout << "The geometry cache " << Cache_FileName[iZone] << " does not contain the MG level " << iMGlevel << "." << endl;
+          cout << "Remove the cache file and run again." << endl;
+#ifndef HAVE_MPI
+          exit(EXIT_FAILURE);
+#else
+          MPI_Abort(MPI_COMM_WORLD,1);
+          MPI_Finalize();
+#endif
+        }
+        geometry[iZone][iMGlevel] = new CMultiGridGeometry(geometry, config, iMGlevel, iZone);
+      }
       
       /*--- Compute points surrounding points. ---*/
       
@@ -296,23 +371,62 @@ void Geometrical_Preprocessing(CGeometry ***geometry, CConfig **config, unsigned
       
       /*--- Create the edge structure ---*/
       
-      geometry[iZone][iMGlevel]->SetEdges();
+      if (!Read_Cache[iZone]) geometry[iZone][iMGlevel]->SetEdges();
       geometry[iZone][iMGlevel]->SetVertex(geometry[iZone][iMGlevel-1], config[iZone]);
       
       /*--- Create the control volume structures ---*/
       
-      geometry[iZone][iMGlevel]->SetControlVolume(config[iZone],geometry[iZone][iMGlevel-1], ALLOCATE);
-      geometry[iZone][iMGlevel]->SetBoundControlVolume(config[iZone],geometry[iZone][iMGlevel-1], ALLOCATE);
+      if (Read_Cache[iZone]) {
+        if (!geometry[iZone][iMGlevel]->ReadCache_DualGrid(Cache_File[iZone])) {
+          cout << "The geometry cache " << Cache_FileName[iZone] << " does not match the MG level " << iMGlevel << "." << endl;
+          cout << "Remove the cache file and run again." << endl;
+#ifndef HAVE_MPI
+          exit(EXIT_FAILURE);
+#else
+          MPI_Abort(MPI_COMM_WORLD,1);
+          MPI_Finalize();
+#endif
+        }
+      }
+      else {
+        geometry[iZone][iMGlevel]->SetControlVolume(config[iZone],geometry[iZone][iMGlevel-1], ALLOCATE);
+        geometry[iZone][iMGlevel]->SetBoundControlVolume(config[iZone],geometry[iZone][iMGlevel-1], ALLOCATE);
+      }
       geometry[iZone][iMGlevel]->SetCoord(geometry[iZone][iMGlevel-1]);
       
       /*--- Find closest neighbor to a surface point ---*/
       
-      geometry[iZone][iMGlevel]->FindNormal_Neighbor(config[iZone]);
+      if (!Read_Cache[iZone]) geometry[iZone][iMGlevel]->FindNormal_Neighbor(config[iZone]);
       
     }
     
   }
   
+  /*--- Write the preprocessed geometry of each zone to the cache, it includes
+   every level that has been agglomerated (also a level that has been discarded
+   because of its agglomeration rate, so the reading follows the same path) ---*/
+  
+  for (iZone = 0; iZone < val_nZone; iZone++) {
+    if (Read_Cache[iZone]) Cache_File[iZone].close();
+    else if (config[iZone]->GetGeometry_Cache()) {
+      if (rank == MASTER_NODE) cout << "Writing the preprocessed geometry to " << Cache_FileName[iZone] << "." << endl;
+      ofstream Cache_Out(Cache_FileName[iZone].c_str(), ios::out | ios::binary);
+      geometry[iZone][MESH_0]->WriteCache_Header(Cache_Out, config[iZone], Geometry_Hash[iZone], nMGLevels_Built);
+      geometry[iZone][MESH_0]->WriteCache_DualGrid(Cache_Out);
+      for (iMGlevel = 1; iMGlevel <= nMGLevels_Built; iMGlevel++) {
+        geometry[iZone][iMGlevel]->WriteCache_Agglomeration(Cache_Out, geometry[iZone][iMGlevel-1]);
+        geometry[iZone][iMGlevel]->WriteCache_DualGrid(Cache_Out);
+      }
+      Cache_Out.close();
+    }
+  }
+  
+  delete [] Read_Cache;
+  delete [] nMGLevels_Cache;
+  delete [] Geometry_Hash;
+  delete [] Cache_FileName;
+  delete [] Cache_File;
+  
   /*--- For unsteady simulations, initialize the grid volumes
    and coordinates for previous solutions. Loop over all zones/grids ---*/
   
@@ -575,7 +689,7 @@ void Numerics_Preprocessing(CNumerics ****numerics_container,
                             CSolver ***solver_container, CGeometry **geometry,
                             CConfig *config, unsigned short iZone) {
   
-  unsigned short iMGlevel, iSol, nDim,
+  unsigned short iMGlevel, iSol, iTerm, nDim,
   
   nVar_Template         = 0,
   nVar_Flow             = 0,
@@ -697,8 +811,11 @@ void Numerics_Preprocessing(CNumerics ****numerics_container,
   /*--- Definition of the Class for the numerical method: numerics_container[MESH_LEVEL][EQUATION][EQ_TERM] ---*/
   for (iMGlevel = 0; iMGlevel <= config->GetMGLevels(); iMGlevel++) {
     numerics_container[iMGlevel] = new CNumerics** [MAX_SOLS];
-    for (iSol = 0; iSol < MAX_SOLS; iSol++)
+    for (iSol = 0; iSol < MAX_SOLS; iSol++) {
       numerics_container[iMGlevel][iSol] = new CNumerics* [MAX_TERMS];
+      for (iTerm = 0; iTerm < MAX_TERMS; iTerm++)
+        numerics_container[iMGlevel][iSol][iTerm] = NULL;
+    }
   }
   
   /*--- Solver definition for the template problem ---*/
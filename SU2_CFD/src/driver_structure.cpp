@@ -0,0 +1,805 @@
+/*!
+ * \file driver_structure.cpp
+ * \brief Main subroutines of the driver of the solution of a problem.
+ * \author Aerospace Design Laboratory (Stanford University) <http://su2.stanford.edu>.
+ * \version 3.2.3 "eagle"
+ *
+ * SU2, Copyright (C) 2012-2014 Aerospace Design Laboratory (ADL).
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../include/driver_structure.hpp"
+
+CDriver::CDriver(char *confFile) {
+
+  unsigned short iMesh, iZone, iSol, iDim;
+  unsigned long iPoint;
+  int rank = MASTER_NODE;
+
+#ifdef HAVE_MPI
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+#endif
+
+  /*--- Create pointers to all of the classes that may be used throughout
+   the SU2_CFD code. In general, the pointers are instantiated down a
+   heirarchy over all zones, multigrid levels, equation sets, and equation
+   terms as described in the comments below. ---*/
+
+  output                  = NULL;
+  integration_container   = NULL;
+  geometry_container      = NULL;
+  solver_container        = NULL;
+  numerics_container      = NULL;
+  config_container        = NULL;
+  surface_movement        = NULL;
+  grid_movement           = NULL;
+  FFDBox                  = NULL;
+  design_surface_movement = NULL;
+  design_grid_movement    = NULL;
+  Coord_Reference         = NULL;
+  StartTime               = 0.0;
+
+  /*--- Read the name and format of the input mesh file ---*/
+
+  CConfig *config = NULL;
+  config = new CConfig(confFile, SU2_CFD);
+
+  /*--- Start the wall-clock profiler (if requested), the setup includes the
+   reading and preprocessing of the grid and the allocation of the solvers ---*/
+
+  CProfiler::SetActive(config->GetProfiling());
+  CProfiler::Start(PROFILE_SETUP);
+
+  /*--- Get the number of zones and dimensions from the numerical grid
+   (required for variables allocation) ---*/
+
+  nZone = GetnZone(config->GetMesh_FileName(), config->GetMesh_FileFormat(), config);
+  nDim  = GetnDim(config->GetMesh_FileName(), config->GetMesh_FileFormat());
+
+  delete config;
+
+  /*--- Definition and of the containers for all possible zones. ---*/
+
+  solver_container      = new CSolver***[nZone];
+  integration_container = new CIntegration**[nZone];
+  numerics_container    = new CNumerics****[nZone];
+  config_container      = new CConfig*[nZone];
+  geometry_container    = new CGeometry **[nZone];
+  surface_movement      = new CSurfaceMovement *[nZone];
+  grid_movement         = new CVolumetricMovement *[nZone];
+  FFDBox                = new CFreeFormDefBox**[nZone];
+
+  for (iZone = 0; iZone < nZone; iZone++) {
+    solver_container[iZone]       = NULL;
+    integration_container[iZone]  = NULL;
+    numerics_container[iZone]     = NULL;
+    config_container[iZone]       = NULL;
+    geometry_container[iZone]     = NULL;
+    surface_movement[iZone]       = NULL;
+    grid_movement[iZone]          = NULL;
+    FFDBox[iZone]                 = NULL;
+  }
+
+  /*--- Loop over all zones to initialize the various classes. In most
+   cases, nZone is equal to one. This represents the solution of a partial
+   differential equation on a single block, unstructured mesh. ---*/
+
+  for (iZone = 0; iZone < nZone; iZone++) {
+
+      /*--- Definition of the configuration option class for all zones. In this
+     constructor, the input configuration file is parsed and all options are
+     read and stored. ---*/
+
+    config_container[iZone] = new CConfig(confFile, SU2_CFD, iZone, nZone, nDim, VERB_HIGH);
+
+#ifdef HAVE_MPI
+    /*--- Change the name of the input-output files for a parallel computation ---*/
+    config_container[iZone]->SetFileNameDomain(rank+1);
+#endif
+
+    /*--- Definition of the geometry class. Within this constructor, the
+     mesh file is read and the primal grid is stored (node coords, connectivity,
+     & boundary markers. MESH_0 is the index of the finest mesh. ---*/
+
+    geometry_container[iZone] = new CGeometry *[config_container[iZone]->GetMGLevels()+1];
+    geometry_container[iZone][MESH_0] = new CPhysicalGeometry(config_container[iZone], iZone, nZone);
+
+  }
+
+  if (rank == MASTER_NODE)
+    cout << endl <<"------------------------- Geometry Preprocessing ------------------------" << endl;
+
+  /*--- Preprocessing of the geometry for all zones. In this routine, the edge-
+   based data structure is constructed, i.e. node and cell neighbors are
+   identified and linked, face areas and volumes of the dual mesh cells are
+   computed, and the multigrid levels are created using an agglomeration procedure. ---*/
+
+  Geometrical_Preprocessing(geometry_container, config_container, nZone);
+
+#ifdef HAVE_MPI
+  /*--- Synchronization point after the geometrical definition subroutine ---*/
+MPI_Barrier(MPI_COMM_WORLD);
+#endif
+
+  if (rank == MASTER_NODE)
+    cout << endl <<"------------------------- Solver Preprocessing --------------------------" << endl;
+
+  for (iZone = 0; iZone < nZone; iZone++) {
+
+    /*--- Computation of wall distances for turbulence modeling ---*/
+
+    if ( (config_container[iZone]->GetKind_Solver() == RANS) ||
+        (config_container[iZone]->GetKind_Solver() == ADJ_RANS) )
+      geometry_container[iZone][MESH_0]->ComputeWall_Distance(config_container[iZone]);
+
+    /*--- Computation of positive surface area in the z-plane which is used for
+     the calculation of force coefficient (non-dimensionalization). ---*/
+
+    geometry_container[iZone][MESH_0]->SetPositive_ZArea(config_container[iZone]);
+
+    /*--- Set the near-field, interface and actuator disk boundary conditions, if necessary. ---*/
+
+    for (iMesh = 0; iMesh <= config_container[iZone]->GetMGLevels(); iMesh++) {
+      geometry_container[iZone][iMesh]->MatchNearField(config_container[iZone]);
+      geometry_container[iZone][iMesh]->MatchInterface(config_container[iZone]);
+      geometry_container[iZone][iMesh]->MatchActuator_Disk(config_container[iZone]);
+    }
+
+    /*--- Definition of the solver class: solver_container[#ZONES][#MG_GRIDS][#EQ_SYSTEMS].
+     The solver classes are specific to a particular set of governing equations,
+     and they contain the subroutines with instructions for computing each spatial
+     term of the PDE, i.e. loops over the edges to compute convective and viscous
+     fluxes, loops over the nodes to compute source terms, and routines for
+     imposing various boundary condition type for the PDE. ---*/
+
+    solver_container[iZone] = new CSolver** [config_container[iZone]->GetMGLevels()+1];
+    for (iMesh = 0; iMesh <= config_container[iZone]->GetMGLevels(); iMesh++)
+      solver_container[iZone][iMesh] = NULL;
+
+    for (iMesh = 0; iMesh <= config_container[iZone]->GetMGLevels(); iMesh++) {
+      solver_container[iZone][iMesh] = new CSolver* [MAX_SOLS];
+      for (iSol = 0; iSol < MAX_SOLS; iSol++)
+        solver_container[iZone][iMesh][iSol] = NULL;
+    }
+    Solver_Preprocessing(solver_container[iZone], geometry_container[iZone],
+                         config_container[iZone], iZone);
+
+#ifdef HAVE_MPI
+    /*--- Synchronization point after the solution preprocessing subroutine ---*/
+    MPI_Barrier(MPI_COMM_WORLD);
+#endif
+
+    if (rank == MASTER_NODE)
+      cout << endl <<"----------------- Integration and Numerics Preprocessing ----------------" << endl;
+
+    /*--- Definition of the integration class: integration_container[#ZONES][#EQ_SYSTEMS].
+     The integration class orchestrates the execution of the spatial integration
+     subroutines contained in the solver class (including multigrid) for computing
+     the residual at each node, R(U) and then integrates the equations to a
+     steady state or time-accurately. ---*/
+
+    integration_container[iZone] = new CIntegration*[MAX_SOLS];
+    for (iSol = 0; iSol < MAX_SOLS; iSol++)
+      integration_container[iZone][iSol] = NULL;
+    Integration_Preprocessing(integration_container[iZone], geometry_container[iZone],
+                              config_container[iZone], iZone);
+
+    if (rank == MASTER_NODE) cout << "Integration Preprocessing." << endl;
+
+#ifdef HAVE_MPI
+    /*--- Synchronization point after the integration definition subroutine ---*/
+    MPI_Barrier(MPI_COMM_WORLD);
+#endif
+
+    /*--- Definition of the numerical method class:
+     numerics_container[#ZONES][#MG_GRIDS][#EQ_SYSTEMS][#EQ_TERMS].
+     The numerics class contains the implementation of the numerical methods for
+     evaluating convective or viscous fluxes between any two nodes in the edge-based
+     data structure (centered, upwind, galerkin), as well as any source terms
+     (piecewise constant reconstruction) evaluated in each dual mesh volume. ---*/
+
+    numerics_container[iZone] = new CNumerics***[config_container[iZone]->GetMGLevels()+1];
+    Numerics_Preprocessing(numerics_container[iZone], solver_container[iZone],
+                           geometry_container[iZone], config_container[iZone], iZone);
+
+    if (rank == MASTER_NODE) cout << "Numerics Preprocessing." << endl;
+
+#ifdef HAVE_MPI
+    /*--- Synchronization point after the solver definition subroutine ---*/
+    MPI_Barrier(MPI_COMM_WORLD);
+#endif
+
+    /*--- Instantiate the geometry movement classes for the solution of unsteady
+     flows on dynamic meshes, including rigid mesh transformations, dynamically
+     deforming meshes, and time-spectral preprocessing. ---*/
+
+    if (config_container[iZone]->GetGrid_Movement()) {
+      if (rank == MASTER_NODE)
+        cout << "Setting dynamic mesh structure." << endl;
+      grid_movement[iZone] = new CVolumetricMovement(geometry_container[iZone][MESH_0]);
+      FFDBox[iZone] = new CFreeFormDefBox*[MAX_NUMBER_FFD];
+      surface_movement[iZone] = new CSurfaceMovement();
+      surface_movement[iZone]->CopyBoundary(geometry_container[iZone][MESH_0], config_container[iZone]);
+      if (config_container[iZone]->GetUnsteady_Simulation() == TIME_SPECTRAL)
+        SetGrid_Movement(geometry_container[iZone], surface_movement[iZone], grid_movement[iZone],
+                         FFDBox[iZone], solver_container[iZone], config_container[iZone], iZone, 0, 0);
+    }
+
+  }
+
+  /*--- For the time-spectral solver, set the grid node velocities. ---*/
+
+  if (config_container[ZONE_0]->GetUnsteady_Simulation() == TIME_SPECTRAL)
+    SetTimeSpectral_Velocities(geometry_container, config_container, nZone);
+
+  /*--- Coupling between zones (limited to two zones at the moment) ---*/
+
+  if (nZone == 2) {
+    if (rank == MASTER_NODE)
+      cout << endl <<"--------------------- Setting Coupling Between Zones --------------------" << endl;
+    geometry_container[ZONE_0][MESH_0]->MatchZone(config_container[ZONE_0], geometry_container[ZONE_1][MESH_0],
+                                                  config_container[ZONE_1], ZONE_0, nZone);
+    geometry_container[ZONE_1][MESH_0]->MatchZone(config_container[ZONE_1], geometry_container[ZONE_0][MESH_0],
+                                                  config_container[ZONE_0], ZONE_1, nZone);
+
+    /*--- Donor mapping of the fluid-structure interface, it is built once and
+     reused by the load and displacement transfers of every coupling iteration ---*/
+
+    if ((config_container[ZONE_0]->GetKind_Solver() == FLUID_STRUCTURE_EULER) ||
+        (config_container[ZONE_0]->GetKind_Solver() == FLUID_STRUCTURE_NAVIER_STOKES)) {
+      solver_container[ZONE_0][MESH_0][FLOW_SOL]->SetFSI_Interface(geometry_container[ZONE_0], config_container[ZONE_0],
+                                                                   geometry_container[ZONE_1], config_container[ZONE_1]);
+      solver_container[ZONE_1][MESH_0][FEA_SOL]->SetFSI_Interface(geometry_container[ZONE_1], config_container[ZONE_1],
+                                                                  geometry_container[ZONE_0], config_container[ZONE_0]);
+    }
+  }
+
+  /*--- Coordinates of the grid as it was read, the design deformations
+   are always applied to this grid (see Deform) ---*/
+
+  Coord_Reference = new double [geometry_container[ZONE_0][MESH_0]->GetnPoint()*nDim];
+  for (iPoint = 0; iPoint < geometry_container[ZONE_0][MESH_0]->GetnPoint(); iPoint++)
+    for (iDim = 0; iDim < nDim; iDim++)
+      Coord_Reference[iPoint*nDim+iDim] = geometry_container[ZONE_0][MESH_0]->node[iPoint]->GetCoord(iDim);
+
+  /*--- Definition of the output class (one for all zones). The output class
+   manages the writing of all restart, volume solution, surface solution,
+   surface comma-separated value, and convergence history files (both in serial
+   and in parallel). ---*/
+
+  output = new COutput();
+
+  CProfiler::Stop(PROFILE_SETUP);
+
+}
+
+CDriver::~CDriver(void) {
+
+  unsigned short iZone, iMesh, iSol, iTerm, nMesh;
+
+  if (Coord_Reference != NULL) delete [] Coord_Reference;
+  if (design_surface_movement != NULL) delete design_surface_movement;
+  if (design_grid_movement != NULL) delete design_grid_movement;
+  if (output != NULL) delete output;
+
+  /*--- Release the containers of all zones (in the reverse order of their
+   construction), so that the drivers of the library can be created and
+   deleted repeatedly by the same process ---*/
+
+  for (iZone = 0; iZone < nZone; iZone++) {
+
+    nMesh = config_container[iZone]->GetMGLevels()+1;
+
+    if (surface_movement[iZone] != NULL) delete surface_movement[iZone];
+    if (grid_movement[iZone] != NULL) delete grid_movement[iZone];
+    if (FFDBox[iZone] != NULL) delete [] FFDBox[iZone];
+
+    if (numerics_container[iZone] != NULL) {
+      for (iMesh = 0; iMesh < nMesh; iMesh++) {
+        for (iSol = 0; iSol < MAX_SOLS; iSol++) {
+          for (iTerm = 0; iTerm < MAX_TERMS; iTerm++)
+            if (numerics_container[iZone][iMesh][iSol][iTerm] != NULL)
+              delete numerics_container[iZone][iMesh][iSol][iTerm];
+          delete [] numerics_container[iZone][iMesh][iSol];
+        }
+        delete [] numerics_container[iZone][iMesh];
+      }
+      delete [] numerics_container[iZone];
+    }
+
+    if (integration_container[iZone] != NULL) {
+      for (iSol = 0; iSol < MAX_SOLS; iSol++)
+        if (integration_container[iZone][iSol] != NULL)
+          delete integration_container[iZone][iSol];
+      delete [] integration_container[iZone];
+    }
+
+    if (solver_container[iZone] != NULL) {
+      for (iMesh = 0; iMesh < nMesh; iMesh++) {
+        for (iSol = 0; iSol < MAX_SOLS; iSol++)
+          if (solver_container[iZone][iMesh][iSol] != NULL)
+            delete solver_container[iZone][iMesh][iSol];
+        delete [] solver_container[iZone][iMesh];
+      }
+      delete [] solver_container[iZone];
+    }
+
+    if (geometry_container[iZone] != NULL) {
+      for (iMesh = 0; iMesh < nMesh; iMesh++)
+        if (geometry_container[iZone][iMesh] != NULL)
+          delete geometry_container[iZone][iMesh];
+      delete [] geometry_container[iZone];
+    }
+
+    delete config_container[iZone];
+
+  }
+
+  delete [] surface_movement;
+  delete [] grid_movement;
+  delete [] FFDBox;
+  delete [] numerics_container;
+  delete [] integration_container;
+  delete [] solver_container;
+  delete [] geometry_container;
+  delete [] config_container;
+
+}
+
+void CDriver::Run(void) {
+
+  bool StopCalc = false;
+  double StopTime = 0.0, UsedTime = 0.0;
+  unsigned long ExtIter = 0;
+  unsigned short iZone, iSol;
+  int rank = MASTER_NODE;
+
+#ifdef HAVE_MPI
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+#endif
+
+  /*--- Open the convergence history file ---*/
+
+  if (rank == MASTER_NODE)
+    output->SetHistory_Header(&ConvHist_file, config_container[ZONE_0]);
+
+  /*--- Check for an unsteady restart. Update ExtIter if necessary. ---*/
+  if (config_container[ZONE_0]->GetWrt_Unsteady() && config_container[ZONE_0]->GetRestart())
+    ExtIter = config_container[ZONE_0]->GetUnst_RestartIter();
+
+  /*--- A previous solution (e.g. of another design) may have converged, the
+   solution in memory is the initial guess of the new one ---*/
+
+  for (iZone = 0; iZone < nZone; iZone++)
+    for (iSol = 0; iSol < MAX_SOLS; iSol++)
+      if (integration_container[iZone][iSol] != NULL)
+        integration_container[iZone][iSol]->SetConvergence(false);
+
+  /*--- Main external loop of the solver. Within this loop, each iteration ---*/
+
+  if (rank == MASTER_NODE)
+    cout << endl <<"------------------------------ Begin Solver -----------------------------" << endl;
+
+  /*--- Set up a timer for performance benchmarking (preprocessing time is not included) ---*/
+
+#ifdef HAVE_MPI
+  MPI_Barrier(MPI_COMM_WORLD);
+#endif
+  StartTime = CProfiler::GetTime();
+
+  while (ExtIter < config_container[ZONE_0]->GetnExtIter()) {
+
+    CProfiler::Start(PROFILE_ITERATION);
+
+    /*--- Set a timer for each iteration. Store the current iteration and
+     update  the value of the CFL number (if there is CFL ramping specified)
+     in the config class. ---*/
+
+    for (iZone = 0; iZone < nZone; iZone++) {
+      config_container[iZone]->SetExtIter(ExtIter);
+      config_container[iZone]->UpdateCFL(ExtIter);
+    }
+
+    /*--- Read the target pressure ---*/
+
+    if (config_container[ZONE_0]->GetInvDesign_Cp() == YES)
+      output->SetCp_InverseDesign(solver_container[ZONE_0][MESH_0][FLOW_SOL],
+                                  geometry_container[ZONE_0][MESH_0], config_container[ZONE_0], ExtIter);
+
+    /*--- Read the target heat flux ---*/
+
+    if (config_container[ZONE_0]->GetInvDesign_HeatFlux() == YES)
+      output->SetHeat_InverseDesign(solver_container[ZONE_0][MESH_0][FLOW_SOL],
+                                    geometry_container[ZONE_0][MESH_0], config_container[ZONE_0], ExtIter);
+
+    /*--- Perform a single iteration of the chosen PDE solver. ---*/
+    switch (config_container[ZONE_0]->GetKind_Solver()) {
+
+      case EULER: case NAVIER_STOKES: case RANS:
+        MeanFlowIteration(output, integration_container, geometry_container,
+                          solver_container, numerics_container, config_container,
+                          surface_movement, grid_movement, FFDBox);
+        break;
+
+      case TNE2_EULER: case TNE2_NAVIER_STOKES:
+        TNE2Iteration(output, integration_container,
+                      geometry_container, solver_container,
+                      numerics_container, config_container,
+                      surface_movement, grid_movement, FFDBox);
+        break;
+
+      case FLUID_STRUCTURE_EULER: case FLUID_STRUCTURE_NAVIER_STOKES:
+        FluidStructureIteration(output, integration_container, geometry_container,
+                                solver_container, numerics_container, config_container,
+                                surface_movement, grid_movement, FFDBox);
+        break;
+
+      case WAVE_EQUATION:
+        WaveIteration(output, integration_container, geometry_container,
+                      solver_container, numerics_container, config_container,
+                      surface_movement, grid_movement, FFDBox);
+        break;
+
+      case HEAT_EQUATION:
+        HeatIteration(output, integration_container, geometry_container,
+                      solver_container, numerics_container, config_container,
+                      surface_movement, grid_movement, FFDBox);
+        break;
+
+      case POISSON_EQUATION:
+        PoissonIteration(output, integration_container, geometry_container,
+                         solver_container, numerics_container, config_container,
+                         surface_movement, grid_movement, FFDBox);
+        break;
+
+      case LINEAR_ELASTICITY:
+        FEAIteration(output, integration_container, geometry_container,
+                     solver_container, numerics_container, config_container,
+                     surface_movement, grid_movement, FFDBox);
+        break;
+
+      case ADJ_EULER: case ADJ_NAVIER_STOKES: case ADJ_RANS:
+        AdjMeanFlowIteration(output, integration_container, geometry_container,
+                             solver_container, numerics_container, config_container,
+                             surface_movement, grid_movement, FFDBox);
+        break;
+
+      case ADJ_TNE2_EULER: case ADJ_TNE2_NAVIER_STOKES:
+        AdjTNE2Iteration(output, integration_container, geometry_container,
+                         solver_container, numerics_container, config_container,
+                         surface_movement, grid_movement, FFDBox);
+        break;
+    }
+
+
+    /*--- Synchronization point after a single solver iteration. Compute the
+     wall clock time required. ---*/
+
+    CProfiler::Stop(PROFILE_ITERATION);
+
+#ifdef HAVE_MPI
+    MPI_Barrier(MPI_COMM_WORLD);
+#endif
+    StopTime = CProfiler::GetTime();
+
+    UsedTime = (StopTime - StartTime);
+
+    /*--- For specific applications, evaluate and plot the equivalent area. ---*/
+
+    if (config_container[ZONE_0]->GetEquivArea() == YES) {
+      output->SetEquivalentArea(solver_container[ZONE_0][MESH_0][FLOW_SOL],
+                                geometry_container[ZONE_0][MESH_0], config_container[ZONE_0], ExtIter);
+    }
+
+    /*--- Update the convergence history file (serial and parallel computations). ---*/
+
+    CProfiler::Start(PROFILE_OUTPUT);
+    output->SetConvergence_History(&ConvHist_file, geometry_container, solver_container,
+                                   config_container, integration_container, false, UsedTime, ZONE_0);
+    CProfiler::Stop(PROFILE_OUTPUT);
+
+    /*--- Check whether the current simulation has reached the specified
+     convergence criteria, and set StopCalc to true, if so. ---*/
+
+    switch (config_container[ZONE_0]->GetKind_Solver()) {
+      case EULER: case NAVIER_STOKES: case RANS:
+        StopCalc = integration_container[ZONE_0][FLOW_SOL]->GetConvergence(); break;
+      case TNE2_EULER: case TNE2_NAVIER_STOKES:
+        StopCalc = integration_container[ZONE_0][TNE2_SOL]->GetConvergence(); break;
+      case WAVE_EQUATION:
+        StopCalc = integration_container[ZONE_0][WAVE_SOL]->GetConvergence(); break;
+      case HEAT_EQUATION:
+        StopCalc = integration_container[ZONE_0][HEAT_SOL]->GetConvergence(); break;
+      case LINEAR_ELASTICITY:
+        StopCalc = integration_container[ZONE_0][FEA_SOL]->GetConvergence(); break;
+      case ADJ_EULER: case ADJ_NAVIER_STOKES: case ADJ_RANS:
+        StopCalc = integration_container[ZONE_0][ADJFLOW_SOL]->GetConvergence(); break;
+      case ADJ_TNE2_EULER: case ADJ_TNE2_NAVIER_STOKES:
+        StopCalc = integration_container[ZONE_0][ADJTNE2_SOL]->GetConvergence(); break;
+    }
+
+    /*--- Solution output. Determine whether a solution needs to be written
+     after the current iteration, and if so, execute the output file writing
+     routines. ---*/
+
+    if ((ExtIter+1 == config_container[ZONE_0]->GetnExtIter()) ||
+        ((ExtIter % config_container[ZONE_0]->GetWrt_Sol_Freq() == 0) && (ExtIter != 0) &&
+         !((config_container[ZONE_0]->GetUnsteady_Simulation() == DT_STEPPING_1ST) ||
+           (config_container[ZONE_0]->GetUnsteady_Simulation() == DT_STEPPING_2ND))) ||
+        (StopCalc) ||
+        (((config_container[ZONE_0]->GetUnsteady_Simulation() == DT_STEPPING_1ST) ||
+          (config_container[ZONE_0]->GetUnsteady_Simulation() == DT_STEPPING_2ND)) &&
+         ((ExtIter == 0) || (ExtIter % config_container[ZONE_0]->GetWrt_Sol_Freq_DualTime() == 0)))) {
+
+          /*--- Low-fidelity simulations (using a coarser multigrid level
+           approximation to the solution) require an interpolation back to the
+           finest grid. ---*/
+
+          if (config_container[ZONE_0]->GetLowFidelitySim()) {
+            integration_container[ZONE_0][FLOW_SOL]->SetProlongated_Solution(RUNTIME_FLOW_SYS, solver_container[ZONE_0][MESH_0], solver_container[ZONE_0][MESH_1], geometry_container[ZONE_0][MESH_0], geometry_container[ZONE_0][MESH_1], config_container[ZONE_0]);
+            integration_container[ZONE_0][FLOW_SOL]->Smooth_Solution(RUNTIME_FLOW_SYS, solver_container[ZONE_0][MESH_0], geometry_container[ZONE_0][MESH_0], 3, 1.25, config_container[ZONE_0]);
+            solver_container[ZONE_0][MESH_0][config_container[ZONE_0]->GetContainerPosition(RUNTIME_FLOW_SYS)]->Set_MPI_Solution(geometry_container[ZONE_0][MESH_0], config_container[ZONE_0]);
+            solver_container[ZONE_0][MESH_0][config_container[ZONE_0]->GetContainerPosition(RUNTIME_FLOW_SYS)]->Preprocessing(geometry_container[ZONE_0][MESH_0], solver_container[ZONE_0][MESH_0], config_container[ZONE_0], MESH_0, 0, RUNTIME_FLOW_SYS, false);
+          }
+
+          /*--- Execute the routine for writing restart, volume solution,
+           surface solution, and surface comma-separated value files. ---*/
+
+          CProfiler::Start(PROFILE_OUTPUT);
+          output->SetResult_Files(solver_container, geometry_container, config_container, ExtIter, nZone);
+          CProfiler::Stop(PROFILE_OUTPUT);
+
+          /*--- Compute the forces at different sections. ---*/
+          if (config_container[ZONE_0]->GetPlot_Section_Forces())
+            output->SetForceSections(solver_container[ZONE_0][MESH_0][FLOW_SOL],
+                                     geometry_container[ZONE_0][MESH_0], config_container[ZONE_0], ExtIter);
+
+        }
+
+    /*--- If the convergence criteria has been met, terminate the simulation. ---*/
+
+    if (StopCalc) break;
+
+    ExtIter++;
+
+  }
+
+  /*--- Output some information to the console. ---*/
+  if (rank == MASTER_NODE) {
+    cout << endl;
+
+  /*--- Print out the number of non-physical points and reconstructions ---*/
+  if (config_container[ZONE_0]->GetNonphysical_Points() > 0)
+    cout << "Warning: there are " << config_container[ZONE_0]->GetNonphysical_Points() << " non-physical points in the solution." << endl;
+  if (config_container[ZONE_0]->GetNonphysical_Reconstr() > 0)
+    cout << "Warning: " << config_container[ZONE_0]->GetNonphysical_Reconstr() << " reconstructed states for upwinding are non-physical." << endl;
+
+  /*--- Close the convergence history file. ---*/
+    ConvHist_file.close();
+    cout << "History file, closed." << endl;
+  }
+
+}
+
+void CDriver::Postprocessing(void) {
+
+  double StopTime, UsedTime;
+  int rank = MASTER_NODE;
+  int size = SINGLE_NODE;
+
+#ifdef HAVE_MPI
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+#endif
+
+  /*--- Synchronization point after a single solver iteration. Compute the
+   wall clock time required. ---*/
+
+#ifdef HAVE_MPI
+  MPI_Barrier(MPI_COMM_WORLD);
+#endif
+  StopTime = CProfiler::GetTime();
+
+  /*--- Compute/print the total time for performance benchmarking. ---*/
+
+  UsedTime = StopTime-StartTime;
+  if (rank == MASTER_NODE) {
+    cout << "\nCompleted in " << fixed << UsedTime << " seconds on "<< size;
+    if (size == 1) cout << " core." << endl; else cout << " cores." << endl;
+  }
+
+  /*--- Min/max/mean time of the phases of the solver over all the ranks ---*/
+
+  CProfiler::WriteReport(config_container[ZONE_0]->GetProfiling_FileName());
+
+}
+
+void CDriver::SetDV_Value(unsigned short val_dv, double val_value) {
+
+  config_container[ZONE_0]->SetDV_Value(val_dv, val_value);
+
+}
+
+void CDriver::Deform(void) {
+
+  unsigned short iMesh, iSol, iDim, Kind_SU2;
+  unsigned long iPoint;
+  int rank = MASTER_NODE;
+
+#ifdef HAVE_MPI
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+#endif
+
+  CConfig *config = config_container[ZONE_0];
+  CGeometry **geometry = geometry_container[ZONE_0];
+
+  if (rank == MASTER_NODE)
+    cout << endl << "------------------------- Surface grid deformation ----------------------" << endl;
+
+  if (design_surface_movement == NULL) {
+    design_surface_movement = new CSurfaceMovement();
+    design_grid_movement = new CVolumetricMovement(geometry[MESH_0]);
+  }
+
+  /*--- The values of the design variables are defined with respect to the
+   grid that was read, as in SU2_DEF ---*/
+
+  for (iPoint = 0; iPoint < geometry[MESH_0]->GetnPoint(); iPoint++)
+    for (iDim = 0; iDim < nDim; iDim++)
+      geometry[MESH_0]->node[iPoint]->SetCoord(iDim, Coord_Reference[iPoint*nDim+iDim]);
+
+  /*--- The normals of the vertices (which decide e.g. the upper and lower
+   sides of the Hicks-Henne bumps) must be those of the grid that was read ---*/
+
+  design_grid_movement->UpdateDualGrid(geometry[MESH_0], config);
+
+  /*--- The markers of the design variables (instead of the moving markers of
+   a dynamic mesh) are deformed while the grid is treated as in SU2_DEF ---*/
+
+  Kind_SU2 = config->GetKind_SU2();
+  config->SetKind_SU2(SU2_DEF);
+
+  if (rank == MASTER_NODE) cout << "Performing the deformation of the surface grid." << endl;
+  design_surface_movement->CopyBoundary(geometry[MESH_0], config);
+  design_surface_movement->SetSurface_Deformation(geometry[MESH_0], config);
+
+  if (config->GetDesign_Variable(0) != FFD_SETTING) {
+    if (rank == MASTER_NODE) cout << "Performing the deformation of the volumetric grid." << endl;
+    design_grid_movement->SetVolume_Deformation(geometry[MESH_0], config, true);
+  }
+  else design_grid_movement->UpdateDualGrid(geometry[MESH_0], config);
+
+  config->SetKind_SU2(Kind_SU2);
+
+  /*--- Update the coarse levels, the wall distance and the reference area ---*/
+
+  design_grid_movement->UpdateMultiGrid(geometry, config);
+
+  if ((config->GetKind_Solver() == RANS) || (config->GetKind_Solver() == ADJ_RANS))
+    geometry[MESH_0]->ComputeWall_Distance(config);
+  geometry[MESH_0]->SetPositive_ZArea(config);
+
+  /*--- The derived fields of the solution must be computed again on the new grid ---*/
+
+  for (iMesh = 0; iMesh <= config->GetMGLevels(); iMesh++)
+    for (iSol = 0; iSol < MAX_SOLS; iSol++)
+      if (solver_container[ZONE_0][iMesh][iSol] != NULL) solver_container[ZONE_0][iMesh][iSol]->SetDerived_Invalid();
+
+}
+
+void CDriver::WriteMesh(string val_mesh_out_filename) {
+
+  char buffer_char[50];
+  string str;
+  int rank = MASTER_NODE;
+  int size = SINGLE_NODE;
+
+#ifdef HAVE_MPI
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+#endif
+
+  /*--- Each partition writes its own file, as in SU2_DEF. The elements and
+   markers are copied from the grid file, and the points are written in the
+   numbering of that file (even if they were renumbered after reading it) ---*/
+
+  if (size > 1) sprintf (buffer_char, "_%d.su2", rank+1); else sprintf (buffer_char, ".su2");
+  str = val_mesh_out_filename; str.erase (str.end()-4, str.end()); str.append(buffer_char);
+
+  if (rank == MASTER_NODE) cout << "Writing a SU2 file of the volumetric mesh." << endl;
+  geometry_container[ZONE_0][MESH_0]->SetMeshFile(config_container[ZONE_0], str, config_container[ZONE_0]->GetMesh_FileName());
+
+  if (design_surface_movement != NULL)
+    design_surface_movement->WriteFFDInfo(geometry_container[ZONE_0][MESH_0], config_container[ZONE_0], str);
+
+}
+
+void CDriver::SetFlow_Solution(CDriver *direct_driver) {
+
+  unsigned short iMesh, iSol;
+  unsigned long iPoint;
+  unsigned short Flow_Sols[2] = {FLOW_SOL, TURB_SOL};
+
+  CSolver **solver = solver_container[ZONE_0][MESH_0];
+  CSolver **direct_solver = direct_driver->solver_container[ZONE_0][MESH_0];
+
+  /*--- Both drivers read the same grid and partition, the points have the same local numbering ---*/
+
+  for (iSol = 0; iSol < 2; iSol++)
+    if ((solver[Flow_Sols[iSol]] != NULL) && (direct_solver[Flow_Sols[iSol]] != NULL))
+      for (iPoint = 0; iPoint < geometry_container[ZONE_0][MESH_0]->GetnPoint(); iPoint++)
+        solver[Flow_Sols[iSol]]->node[iPoint]->SetSolution(direct_solver[Flow_Sols[iSol]]->node[iPoint]->GetSolution());
+
+  for (iMesh = 0; iMesh <= config_container[ZONE_0]->GetMGLevels(); iMesh++)
+    for (iSol = 0; iSol < MAX_SOLS; iSol++)
+      if (solver_container[ZONE_0][iMesh][iSol] != NULL) solver_container[ZONE_0][iMesh][iSol]->SetDerived_Invalid();
+
+}
+
+double CDriver::GetTotal_CLift(void) {
+
+  return solver_container[ZONE_0][MESH_0][FLOW_SOL]->GetTotal_CLift();
+
+}
+
+double CDriver::GetTotal_CDrag(void) {
+
+  return solver_container[ZONE_0][MESH_0][FLOW_SOL]->GetTotal_CDrag();
+
+}
+
+void SU2_Initialize(void) {
+
+#ifdef HAVE_MPI
+  int initialized;
+  MPI_Initialized(&initialized);
+  if (!initialized) {
+    MPI_Init(NULL, NULL);
+    MPI_Buffer_attach( malloc(BUFSIZE), BUFSIZE );
+  }
+#endif
+
+}
+
+void SU2_Finalize(void) {
+
+#ifdef HAVE_MPI
+  int finalized;
+  MPI_Finalized(&finalized);
+  if (!finalized) {
+    MPI_Barrier(MPI_COMM_WORLD);
+    MPI_Finalize();
+  }
+#endif
+
+}
+
+CDriver *SU2_Driver_New(char *confFile) { return new CDriver(confFile); }
+
+void SU2_Driver_Delete(CDriver *driver) { delete driver; }
+
+void SU2_Driver_Run(CDriver *driver) { driver->Run(); }
+
+void SU2_Driver_SetDV_Value(CDriver *driver, unsigned short val_dv, double val_value) { driver->SetDV_Value(val_dv, val_value); }
+
+void SU2_Driver_Deform(CDriver *driver) { driver->Deform(); }
+
+void SU2_Driver_WriteMesh(CDriver *driver, char *val_mesh_out_filename) { driver->WriteMesh(string(val_mesh_out_filename)); }
+
+void SU2_Driver_SetFlow_Solution(CDriver *driver, CDriver *direct_driver) { driver->SetFlow_Solution(direct_driver); }
+
+double SU2_Driver_GetTotal_CLift(CDriver *driver) { return driver->GetTotal_CLift(); }
+
+double SU2_Driver_GetTotal_CDrag(CDriver *driver) { return driver->GetTotal_CDrag(); }
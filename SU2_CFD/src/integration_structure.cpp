@@ -31,6 +31,7 @@ CIntegration::CIntegration(CConfig *config) {
 	Convergence = false;
 	Convergence_OneShot = false;
 	Convergence_FullMG = false;
+	SER_Residual_Old = 0.0;
 	Cauchy_Serie = new double [config->GetCauchy_Elems()+1];
 }
 
@@ -50,26 +51,42 @@ void CIntegration::Space_Integration(CGeometry *geometry,
   bool dual_time = ((config->GetUnsteady_Simulation() == DT_STEPPING_1ST) ||
                     (config->GetUnsteady_Simulation() == DT_STEPPING_2ND));
   
+  /*--- Upwind and viscous residuals of the mean flow and turbulence in a single loop over the edges ---*/
+  
+  bool fused_edge_loop = ((config->GetKind_Edge_Loop() != SEPARATE_EDGE_LOOPS) &&
+                          (config->GetKind_ConvNumScheme() == SPACE_UPWIND) &&
+                          ((RunTime_EqSystem == RUNTIME_FLOW_SYS) || (RunTime_EqSystem == RUNTIME_TURB_SYS)));
+  
   /*--- Compute inviscid residuals ---*/
   
+  CProfiler::Start(PROFILE_CONV_RESIDUAL);
   switch (config->GetKind_ConvNumScheme()) {
     case SPACE_CENTERED:
       solver_container[MainSolver]->Centered_Residual(geometry, solver_container, numerics[CONV_TERM], config, iMesh, iRKStep);
       break;
     case SPACE_UPWIND:
-      solver_container[MainSolver]->Upwind_Residual(geometry, solver_container, numerics[CONV_TERM], config, iMesh);
+      if (fused_edge_loop)
+        solver_container[MainSolver]->Upwind_Viscous_Residual(geometry, solver_container, numerics[CONV_TERM], numerics[VISC_TERM], config, iMesh, iRKStep);
+      else
+        solver_container[MainSolver]->Upwind_Residual(geometry, solver_container, numerics[CONV_TERM], config, iMesh);
       break;
   }
+  CProfiler::Stop(PROFILE_CONV_RESIDUAL);
   
   
   /*--- Compute viscous residuals ---*/
   
-  solver_container[MainSolver]->Viscous_Residual(geometry, solver_container, numerics[VISC_TERM], config, iMesh, iRKStep);
+  CProfiler::Start(PROFILE_VISC_RESIDUAL);
+  if (!fused_edge_loop)
+    solver_container[MainSolver]->Viscous_Residual(geometry, solver_container, numerics[VISC_TERM], config, iMesh, iRKStep);
+  CProfiler::Stop(PROFILE_VISC_RESIDUAL);
   
   
   /*--- Compute source term residuals ---*/
   
+  CProfiler::Start(PROFILE_SOURCE_RESIDUAL);
   solver_container[MainSolver]->Source_Residual(geometry, solver_container, numerics[SOURCE_FIRST_TERM], numerics[SOURCE_SECOND_TERM], config, iMesh);
+  CProfiler::Stop(PROFILE_SOURCE_RESIDUAL);
   
   /*--- Add viscous and convective residuals, and compute the Dual Time Source term ---*/
   
@@ -78,6 +95,7 @@ void CIntegration::Space_Integration(CGeometry *geometry,
   
   /*--- Boundary conditions that depend on other boundaries (they require MPI sincronization)---*/
   
+  CProfiler::Start(PROFILE_BOUND_RESIDUAL);
   solver_container[MainSolver]->BC_ActDisk_Boundary(geometry, solver_container, numerics[CONV_BOUND_TERM], config);
   
   
@@ -180,6 +198,7 @@ void CIntegration::Space_Integration(CGeometry *geometry,
         solver_container[MainSolver]->BC_Custom(geometry, solver_container, numerics[CONV_BOUND_TERM], config, iMarker);
         break;
     }
+  CProfiler::Stop(PROFILE_BOUND_RESIDUAL);
   
 }
 
@@ -254,6 +273,270 @@ void CIntegration::Time_Integration(CGeometry *geometry, CSolver **solver_contai
       break;
   }
   
+  /*--- The solution has been updated, the derived fields (primitive variables,
+   gradients, limiters) must be computed again ---*/
+  
+  solver_container[MainSolver]->SetDerived_Invalid();
+  
+}
+
+void CIntegration::NewtonKrylov_Integration(CGeometry *geometry, CSolver **solver_container, CNumerics **numerics,
+                                            CConfig *config, unsigned short iMesh, unsigned short RunTime_EqSystem) {
+  
+  unsigned short iVar, iLineSearch;
+  unsigned long iPoint, total_index, IterLinSol = 0;
+  double *local_Res_TruncError, Alpha = 1.0, Res_Norm, Res_Trial = 0.0;
+  
+  /*--- Line search: the step is halved (at most LineSearch_Max-1 times) until the
+   residual does not grow more than LineSearch_Growth ---*/
+  
+  const unsigned short LineSearch_Max = 4;
+  const double LineSearch_Growth = 1.5;
+  
+  unsigned short MainSolver = config->GetContainerPosition(RunTime_EqSystem);
+  CSolver *solver = solver_container[MainSolver];
+  
+  unsigned short nVar = solver->GetnVar();
+  unsigned long nPoint = geometry->GetnPoint();
+  unsigned long nPointDomain = geometry->GetnPointDomain();
+  
+  CSysVector Sol_Base(nPoint, nPointDomain, nVar, 0.0);
+  CSysVector Res_Base(nPoint, nPointDomain, nVar, 0.0);
+  CSysVector Rhs(nPoint, nPointDomain, nVar, 0.0);
+  double *Delta = new double [nPoint];
+  double *Solution = new double [nVar];
+  
+  /*--- Set maximum residual to zero ---*/
+  
+  for (iVar = 0; iVar < nVar; iVar++) {
+    solver->SetRes_RMS(iVar, 0.0);
+    solver->SetRes_Max(iVar, 0.0, 0);
+  }
+  
+  /*--- Store the base solution and residual, the right hand side (-Residual), and
+   add Vol/dt to the assembled Jacobian, which is only used as preconditioner ---*/
+  
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    
+    local_Res_TruncError = solver->node[iPoint]->GetResTruncError();
+    
+    Delta[iPoint] = geometry->node[iPoint]->GetVolume() / solver->node[iPoint]->GetDelta_Time();
+    solver->Jacobian.AddVal2Diag(iPoint, Delta[iPoint]);
+    
+    Sol_Base.SetBlock(iPoint, solver->node[iPoint]->GetSolution());
+    
+    for (iVar = 0; iVar < nVar; iVar++) {
+      total_index = iPoint*nVar + iVar;
+      Res_Base[total_index] = solver->LinSysRes[total_index];
+      Rhs[total_index] = - (solver->LinSysRes[total_index] + local_Res_TruncError[iVar]);
+      solver->LinSysSol[total_index] = 0.0;
+      solver->AddRes_RMS(iVar, Rhs[total_index]*Rhs[total_index]);
+      solver->AddRes_Max(iVar, fabs(Rhs[total_index]), geometry->node[iPoint]->GetGlobalIndex(), geometry->node[iPoint]->GetCoord());
+    }
+  }
+  
+  for (iPoint = nPointDomain; iPoint < nPoint; iPoint++) {
+    Delta[iPoint] = 0.0;
+    for (iVar = 0; iVar < nVar; iVar++)
+      solver->LinSysSol[iPoint*nVar + iVar] = 0.0;
+  }
+  
+  Res_Norm = Rhs.norm();
+  
+  /*--- Solve the Newton system with the Jacobian-free matrix-vector product ---*/
+  
+  CNewtonKrylovProduct mat_vec(this, geometry, solver_container, numerics, config, iMesh, RunTime_EqSystem,
+                               Sol_Base, Res_Base, Delta);
+  
+  CSysSolve system;
+  IterLinSol = system.Solve(solver->Jacobian, mat_vec, Rhs, solver->LinSysSol, geometry, config);
+  
+  solver->SetIterLinSolver(IterLinSol);
+  
+  /*--- Line search on the norm of the nonlinear residual ---*/
+  
+  for (iLineSearch = 0; iLineSearch < LineSearch_Max; iLineSearch++) {
+    
+    if (iLineSearch > 0) Alpha *= 0.5;
+    
+    for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+      for (iVar = 0; iVar < nVar; iVar++) {
+        total_index = iPoint*nVar + iVar;
+        Solution[iVar] = Sol_Base[total_index] + Alpha*config->GetLinear_Solver_Relax()*solver->LinSysSol[total_index];
+      }
+      solver->node[iPoint]->SetSolution(Solution);
+    }
+    
+    Residual_Evaluation(geometry, solver_container, numerics, config, iMesh, RunTime_EqSystem);
+    
+    for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+      local_Res_TruncError = solver->node[iPoint]->GetResTruncError();
+      for (iVar = 0; iVar < nVar; iVar++) {
+        total_index = iPoint*nVar + iVar;
+        Rhs[total_index] = solver->LinSysRes[total_index] + local_Res_TruncError[iVar];
+      }
+    }
+    Res_Trial = Rhs.norm();
+    
+    if (Res_Trial <= LineSearch_Growth*Res_Norm) break;
+    
+  }
+  
+  /*--- If the line search failed, reduce the CFL number, and discard the step
+   if the residual is not a number ---*/
+  
+  if (iLineSearch == LineSearch_Max) {
+    if (config->GetCFL_SER()) ScaleCFL_SER(config, 0.5);
+    if (Res_Trial != Res_Trial) {
+      for (iPoint = 0; iPoint < nPointDomain; iPoint++)
+        solver->node[iPoint]->SetSolution(Sol_Base.GetBlock(iPoint));
+    }
+  }
+  
+  /*--- MPI solution ---*/
+  
+  solver->Set_MPI_Solution(geometry, config);
+  
+  /*--- Compute the root mean square residual ---*/
+  
+  solver->SetResidual_RMS(geometry, config);
+  
+  /*--- The primitive variables and gradients belong to the last trial state ---*/
+  
+  solver->SetDerived_Invalid();
+  
+  delete [] Delta;
+  delete [] Solution;
+  
+}
+
+void CIntegration::Residual_Evaluation(CGeometry *geometry, CSolver **solver_container, CNumerics **numerics,
+                                       CConfig *config, unsigned short iMesh, unsigned short RunTime_EqSystem) {
+  
+  unsigned short MainSolver = config->GetContainerPosition(RunTime_EqSystem);
+  unsigned short Kind_TimeIntScheme = config->GetKind_TimeIntScheme_Flow();
+  
+  /*--- Evaluate the residual as an explicit scheme, so the Jacobian
+   (the preconditioner) is not reassembled ---*/
+  
+  config->SetKind_TimeIntScheme_Flow(EULER_EXPLICIT);
+  
+  solver_container[MainSolver]->Set_MPI_Solution(geometry, config);
+  solver_container[MainSolver]->Preprocessing(geometry, solver_container, config, iMesh, NO_RK_ITER, RunTime_EqSystem, false);
+  Space_Integration(geometry, solver_container, numerics, config, iMesh, NO_RK_ITER, RunTime_EqSystem);
+  
+  config->SetKind_TimeIntScheme_Flow(Kind_TimeIntScheme);
+  
+}
+
+void CIntegration::SetCFL_SER(CSolver *solver, CConfig *config) {
+  
+  unsigned short iVar;
+  double Residual = 0.0, Factor;
+  
+  for (iVar = 0; iVar < solver->GetnVar(); iVar++)
+    Residual += solver->GetRes_RMS(iVar)*solver->GetRes_RMS(iVar);
+  Residual = sqrt(Residual);
+  
+  /*--- CFL^(n+1) = CFL^n Res^(n-1)/Res^n, with a bounded growth factor ---*/
+  
+  if ((SER_Residual_Old > 0.0) && (Residual > 0.0) && (Residual == Residual)) {
+    Factor = SER_Residual_Old/Residual;
+    Factor = min(Factor, config->GetCFL_SER_Param(0));
+    Factor = max(Factor, 1.0/config->GetCFL_SER_Param(0));
+    ScaleCFL_SER(config, Factor);
+  }
+  
+  SER_Residual_Old = Residual;
+  
+}
+
+void CIntegration::ScaleCFL_SER(CConfig *config, double val_factor) {
+  
+  unsigned short iMesh;
+  double CFL_Fine = config->GetCFL(MESH_0);
+  double CFL_New = CFL_Fine*val_factor;
+  
+  CFL_New = max(CFL_New, config->GetCFL_SER_Param(1));
+  CFL_New = min(CFL_New, config->GetCFL_SER_Param(2));
+  
+  /*--- Keep the ratios between the CFL numbers of the multigrid levels ---*/
+  
+  for (iMesh = 0; iMesh <= config->GetMGLevels(); iMesh++)
+    config->SetCFL(iMesh, config->GetCFL(iMesh)*CFL_New/CFL_Fine);
+  
+}
+
+CNewtonKrylovProduct::CNewtonKrylovProduct(CIntegration *val_integration, CGeometry *val_geometry, CSolver **val_solver_container,
+                                           CNumerics **val_numerics, CConfig *val_config, unsigned short val_iMesh,
+                                           unsigned short val_RunTime_EqSystem, CSysVector & val_sol_base, CSysVector & val_res_base,
+                                           double *val_delta) {
+  integration      = val_integration;
+  geometry         = val_geometry;
+  solver_container = val_solver_container;
+  numerics         = val_numerics;
+  config           = val_config;
+  iMesh            = val_iMesh;
+  RunTime_EqSystem = val_RunTime_EqSystem;
+  Sol_Base         = &val_sol_base;
+  Res_Base         = &val_res_base;
+  Delta            = val_delta;
+  
+  /*--- eps = Eps (1 + ||U||)/||u||, the norm of u is applied in the product ---*/
+  
+  Eps_Base = config->GetNewton_Krylov_Eps()*(1.0 + Sol_Base->norm());
+}
+
+CNewtonKrylovProduct::~CNewtonKrylovProduct(void) { }
+
+void CNewtonKrylovProduct::operator()(const CSysVector & u, CSysVector & v) const {
+  
+  unsigned short iVar;
+  unsigned long iPoint, total_index;
+  double Eps, u_norm = u.norm();
+  
+  CSolver *solver = solver_container[config->GetContainerPosition(RunTime_EqSystem)];
+  unsigned short nVar = solver->GetnVar();
+  unsigned long nPoint = geometry->GetnPoint();
+  unsigned long nPointDomain = geometry->GetnPointDomain();
+  
+  if (u_norm == 0.0) { v = 0.0; return; }
+  
+  Eps = Eps_Base/u_norm;
+  
+  /*--- Perturb the solution, U + eps u ---*/
+  
+  double *Solution = new double [nVar];
+  
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    for (iVar = 0; iVar < nVar; iVar++) {
+      total_index = iPoint*nVar + iVar;
+      Solution[iVar] = (*Sol_Base)[total_index] + Eps*u[total_index];
+    }
+    solver->node[iPoint]->SetSolution(Solution);
+  }
+  
+  /*--- v = (Vol/dt) u + (R(U + eps u) - R(U))/eps ---*/
+  
+  integration->Residual_Evaluation(geometry, solver_container, numerics, config, iMesh, RunTime_EqSystem);
+  
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    for (iVar = 0; iVar < nVar; iVar++) {
+      total_index = iPoint*nVar + iVar;
+      v[total_index] = Delta[iPoint]*u[total_index] + (solver->LinSysRes[total_index] - (*Res_Base)[total_index])/Eps;
+    }
+  }
+  for (iPoint = nPointDomain; iPoint < nPoint; iPoint++)
+    for (iVar = 0; iVar < nVar; iVar++)
+      v[iPoint*nVar + iVar] = 0.0;
+  
+  /*--- Restore the base solution ---*/
+  
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++)
+    solver->node[iPoint]->SetSolution(Sol_Base->GetBlock(iPoint));
+  
+  delete [] Solution;
+  
 }
 
 void CIntegration::Convergence_Monitoring(CGeometry *geometry, CConfig *config, unsigned long Iteration, double monitor) {
@@ -80,6 +80,11 @@ void CMultiGridIntegration::MultiGrid_Iteration(CGeometry ***geometry,
                   FinestMesh, config[iZone]->GetMGCycle(), RunTime_EqSystem,
                   Iteration, iZone);
   
+  /*--- Adapt the CFL number with the residual history (switched evolution relaxation) ---*/
+  
+  if ((RunTime_EqSystem == RUNTIME_FLOW_SYS) && config[iZone]->GetCFL_SER())
+    SetCFL_SER(solver_container[iZone][FinestMesh][SolContainer_Position], config[iZone]);
+  
   /*--- Computes primitive variables and gradients in the finest mesh (useful for the next solver (turbulence) and output ---*/
   solver_container[iZone][MESH_0][SolContainer_Position]->Preprocessing(geometry[iZone][MESH_0],
                                                                         solver_container[iZone][MESH_0], config[iZone],
@@ -146,9 +151,13 @@ void CMultiGridIntegration::MultiGrid_Cycle(CGeometry ***geometry,
       
       Space_Integration(geometry[iZone][iMesh], solver_container[iZone][iMesh], numerics_container[iZone][iMesh][SolContainer_Position], config[iZone], iMesh, iRKStep, RunTime_EqSystem);
       
-      /*--- Time integration, update solution using the old solution plus the solution increment ---*/
+      /*--- Time integration, update solution using the old solution plus the solution increment,
+       or a Newton-Krylov step of the flow equations on the finest grid ---*/
       
-      Time_Integration(geometry[iZone][iMesh], solver_container[iZone][iMesh], config[iZone], iRKStep, RunTime_EqSystem, Iteration);
+      if ((iMesh == MESH_0) && (RunTime_EqSystem == RUNTIME_FLOW_SYS) && config[iZone]->GetNewton_Krylov())
+        NewtonKrylov_Integration(geometry[iZone][iMesh], solver_container[iZone][iMesh], numerics_container[iZone][iMesh][SolContainer_Position], config[iZone], iMesh, RunTime_EqSystem);
+      else
+        Time_Integration(geometry[iZone][iMesh], solver_container[iZone][iMesh], config[iZone], iRKStep, RunTime_EqSystem, Iteration);
       
       /*--- Send-Receive boundary conditions, and postprocessing ---*/
       
@@ -211,7 +220,10 @@ void CMultiGridIntegration::MultiGrid_Cycle(CGeometry ***geometry,
         }
         
         Space_Integration(geometry[iZone][iMesh], solver_container[iZone][iMesh], numerics_container[iZone][iMesh][SolContainer_Position], config[iZone], iMesh, iRKStep, RunTime_EqSystem);
-        Time_Integration(geometry[iZone][iMesh], solver_container[iZone][iMesh], config[iZone], iRKStep, RunTime_EqSystem, Iteration);
+        if ((iMesh == MESH_0) && (RunTime_EqSystem == RUNTIME_FLOW_SYS) && config[iZone]->GetNewton_Krylov())
+          NewtonKrylov_Integration(geometry[iZone][iMesh], solver_container[iZone][iMesh], numerics_container[iZone][iMesh][SolContainer_Position], config[iZone], iMesh, RunTime_EqSystem);
+        else
+          Time_Integration(geometry[iZone][iMesh], solver_container[iZone][iMesh], config[iZone], iRKStep, RunTime_EqSystem, Iteration);
         
         solver_container[iZone][iMesh][SolContainer_Position]->Postprocessing(geometry[iZone][iMesh], solver_container[iZone][iMesh], config[iZone], iMesh);
         
@@ -412,6 +424,8 @@ void CMultiGridIntegration::Smooth_Solution(unsigned short RunTime_EqSystem, CSo
     
   }
   
+  solver->SetDerived_Invalid();
+  
 }
 
 void CMultiGridIntegration::SetProlongated_Correction(CSolver *sol_fine, CGeometry *geo_fine, CConfig *config, unsigned short iMesh) {
@@ -439,6 +453,9 @@ void CMultiGridIntegration::SetProlongated_Correction(CSolver *sol_fine, CGeomet
   sol_fine->Set_MPI_Solution(geo_fine, config);
   
   delete [] Solution;
+  
+  sol_fine->SetDerived_Invalid();
+  
 }
 
 
@@ -452,6 +469,9 @@ void CMultiGridIntegration::SetProlongated_Solution(unsigned short RunTime_EqSys
       sol_fine->node[Point_Fine]->SetSolution(sol_coarse->node[Point_Coarse]->GetSolution());
     }
   }
+  
+  sol_fine->SetDerived_Invalid();
+  
 }
 
 void CMultiGridIntegration::SetForcing_Term(CSolver *sol_fine, CSolver *sol_coarse, CGeometry *geo_fine, CGeometry *geo_coarse, CConfig *config, unsigned short iMesh) {
@@ -616,6 +636,8 @@ void CMultiGridIntegration::SetRestricted_Solution(unsigned short RunTime_EqSyst
   
   delete [] Solution;
   
+  sol_coarse->SetDerived_Invalid();
+  
 }
 
 void CMultiGridIntegration::SetRestricted_Gradient(unsigned short RunTime_EqSystem, CSolver **sol_fine, CSolver **sol_coarse, CGeometry *geo_fine,
@@ -915,4 +937,6 @@ void CSingleGridIntegration::SetRestricted_Solution(unsigned short RunTime_EqSys
   
   delete [] Solution;
   
+  sol_coarse[SolContainer_Position]->SetDerived_Invalid();
+  
 }
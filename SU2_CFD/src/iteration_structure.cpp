@@ -289,12 +289,15 @@ void AdjMeanFlowIteration(COutput *output, CIntegration ***integration_container
         <<", located at point "<< solver_container[iZone][MESH_0][FLOW_SOL]->GetPoint_Max(0) << "." << endl;
       
 			/*--- Compute gradients of the flow variables, this is necessary for sensitivity computation,
-			 note that in the direct Euler problem we are not computing the gradients of the primitive variables ---*/
-      
-			if (config_container[iZone]->GetKind_Gradient_Method() == GREEN_GAUSS)
-				solver_container[iZone][MESH_0][FLOW_SOL]->SetPrimitive_Gradient_GG(geometry_container[iZone][MESH_0], config_container[iZone]);
-			if (config_container[iZone]->GetKind_Gradient_Method() == WEIGHTED_LEAST_SQUARES)
-				solver_container[iZone][MESH_0][FLOW_SOL]->SetPrimitive_Gradient_LS(geometry_container[iZone][MESH_0], config_container[iZone]);
+			 note that in the direct Euler problem we are not computing the gradients of the primitive variables
+       (they are only computed again if the primitive variables have changed since the flow preprocessing) ---*/
+      
+      if (!solver_container[iZone][MESH_0][FLOW_SOL]->GetDerived_Current(DERIVED_PRIM_GRADIENT)) {
+        if (config_container[iZone]->GetKind_Gradient_Method() == GREEN_GAUSS)
+          solver_container[iZone][MESH_0][FLOW_SOL]->SetPrimitive_Gradient_GG(geometry_container[iZone][MESH_0], config_container[iZone]);
+        if (config_container[iZone]->GetKind_Gradient_Method() == WEIGHTED_LEAST_SQUARES)
+          solver_container[iZone][MESH_0][FLOW_SOL]->SetPrimitive_Gradient_LS(geometry_container[iZone][MESH_0], config_container[iZone]);
+      }
       
 			/*--- Set contribution from cost function for boundary conditions ---*/
       
@@ -1097,9 +1100,10 @@ void SetGrid_Movement(CGeometry **geometry_container, CSurfaceMovement *surface_
                                     config_container, iZone, ExtIter);
       
       /*--- Update the multigrid structure after moving the finest grid,
-       including computing the grid velocities on the coarser levels. ---*/
+       including computing the grid velocities on the coarser levels. The
+       control volumes of the rigid motion are not recomputed. ---*/
       
-      grid_movement->UpdateMultiGrid(geometry_container, config_container);
+      grid_movement->UpdateRigidMultiGrid(geometry_container, config_container);
       
       break;
       
@@ -1243,7 +1247,7 @@ void SetGrid_Movement(CGeometry **geometry_container, CSurfaceMovement *surface_
           /*--- Update the multigrid structure after moving the finest grid,
            including computing the grid velocities on the coarser levels. ---*/
           
-          grid_movement->UpdateMultiGrid(geometry_container, config_container);
+          grid_movement->UpdateRigidMultiGrid(geometry_container, config_container);
         }
         
       }
@@ -1310,6 +1314,13 @@ void SetGrid_Movement(CGeometry **geometry_container, CSurfaceMovement *surface_
       break;
   }
   
+  /*--- The grid may have changed, the derived fields (primitive variables,
+   gradients, limiters) of all the solvers must be computed again ---*/
+  
+  for (iMGlevel = 0; iMGlevel <= nMGlevels; iMGlevel++)
+    for (unsigned short iSol = 0; iSol < MAX_SOLS; iSol++)
+      if (solver_container[iMGlevel][iSol] != NULL) solver_container[iMGlevel][iSol]->SetDerived_Invalid();
+  
 }
 
 void SetTimeSpectral(CGeometry ***geometry_container, CSolver ****solver_container,
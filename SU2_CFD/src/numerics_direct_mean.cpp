@@ -23,6 +23,546 @@
 #include "../include/numerics_structure.hpp"
 #include <limits>
 
+/*--- Tools of the batched kernels (see CNumerics::ComputeResidual_Batch). They are the
+ scalar tools of CNumerics with the number of dimensions known at compile time, on structure
+ of arrays data ([entry][EDGE_BATCH_SIZE]). In every operation the loop over the lanes of the
+ batch is the innermost loop, with unit stride and without branches (the data dependent
+ choices of the scalar versions are selects), so that it can be vectorized. The operations
+ are done in the same order as in the scalar versions. ---*/
+
+/*--- The lane loops are left to the vectorizer of the compiler (no intrinsics), "GCC unroll 1"
+ keeps GCC from unrolling them completely before it vectorizes them. ---*/
+
+static void SetBatch_Padding(double (*val_batch)[EDGE_BATCH_SIZE], unsigned short val_nRow, unsigned short val_nLane) {
+  
+  unsigned short iRow, iLane;
+  
+  /*--- The lanes that are not in use repeat the first edge of the batch ---*/
+  
+  for (iRow = 0; iRow < val_nRow; iRow++)
+    for (iLane = val_nLane; iLane < EDGE_BATCH_SIZE; iLane++)
+      val_batch[iRow][iLane] = val_batch[iRow][0];
+  
+}
+
+template <unsigned short nDim>
+static inline void GetInviscidProjFlux_Batch(double *val_density, double (*val_velocity)[EDGE_BATCH_SIZE],
+                                             double *val_pressure, double *val_enthalpy,
+                                             double (*val_normal)[EDGE_BATCH_SIZE],
+                                             double (*val_Proj_Flux)[EDGE_BATCH_SIZE]) {
+  
+  unsigned short iDim, jDim, iLane;
+  double rhou[EDGE_BATCH_SIZE];
+  
+  for (iDim = 0; iDim < nDim; iDim++) {
+#pragma GCC unroll 1
+    for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++)
+      rhou[iLane] = val_density[iLane]*val_velocity[iDim][iLane];
+    if (iDim == 0) {
+#pragma GCC unroll 1
+      for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++) {
+        val_Proj_Flux[0][iLane] = rhou[iLane]*val_normal[0][iLane];
+        val_Proj_Flux[nDim+1][iLane] = rhou[iLane]*val_enthalpy[iLane]*val_normal[0][iLane];
+      }
+      for (jDim = 0; jDim < nDim; jDim++) {
+        if (jDim == 0)
+#pragma GCC unroll 1
+          for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++)
+            val_Proj_Flux[jDim+1][iLane] = (rhou[iLane]*val_velocity[jDim][iLane]+val_pressure[iLane])*val_normal[0][iLane];
+        else
+#pragma GCC unroll 1
+          for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++)
+            val_Proj_Flux[jDim+1][iLane] = rhou[iLane]*val_velocity[jDim][iLane]*val_normal[0][iLane];
+      }
+    }
+    else {
+#pragma GCC unroll 1
+      for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++) {
+        val_Proj_Flux[0][iLane] += rhou[iLane]*val_normal[iDim][iLane];
+        val_Proj_Flux[nDim+1][iLane] += rhou[iLane]*val_enthalpy[iLane]*val_normal[iDim][iLane];
+      }
+      for (jDim = 0; jDim < nDim; jDim++) {
+        if (jDim == iDim)
+#pragma GCC unroll 1
+          for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++)
+            val_Proj_Flux[jDim+1][iLane] += (rhou[iLane]*val_velocity[jDim][iLane]+val_pressure[iLane])*val_normal[iDim][iLane];
+        else
+#pragma GCC unroll 1
+          for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++)
+            val_Proj_Flux[jDim+1][iLane] += rhou[iLane]*val_velocity[jDim][iLane]*val_normal[iDim][iLane];
+      }
+    }
+  }
+  
+}
+
+template <unsigned short nDim>
+static inline void GetInviscidProjJac_Batch(double (*val_velocity)[EDGE_BATCH_SIZE], double *val_energy,
+                                            double (*val_normal)[EDGE_BATCH_SIZE], double val_scale, double Gamma,
+                                            double Gamma_Minus_One, double (*val_Proj_Jac_Tensor)[EDGE_BATCH_SIZE]) {
+  
+  const unsigned short nVar = nDim+2;
+  unsigned short iDim, jDim, iLane;
+  double sqvel[EDGE_BATCH_SIZE], proj_vel[EDGE_BATCH_SIZE], phi[EDGE_BATCH_SIZE], a1[EDGE_BATCH_SIZE], a2;
+  
+#pragma GCC unroll 1
+  for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++) {
+    sqvel[iLane] = 0.0; proj_vel[iLane] = 0.0;
+  }
+  for (iDim = 0; iDim < nDim; iDim++)
+#pragma GCC unroll 1
+    for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++) {
+      sqvel[iLane]    += val_velocity[iDim][iLane]*val_velocity[iDim][iLane];
+      proj_vel[iLane] += val_velocity[iDim][iLane]*val_normal[iDim][iLane];
+    }
+  
+  a2 = Gamma-1.0;
+#pragma GCC unroll 1
+  for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++) {
+    phi[iLane] = 0.5*Gamma_Minus_One*sqvel[iLane];
+    a1[iLane] = Gamma*val_energy[iLane]-phi[iLane];
+    val_Proj_Jac_Tensor[0][iLane] = 0.0;
+    val_Proj_Jac_Tensor[nDim+1][iLane] = 0.0;
+    val_Proj_Jac_Tensor[(nDim+1)*nVar][iLane] = val_scale*proj_vel[iLane]*(phi[iLane]-a1[iLane]);
+    val_Proj_Jac_Tensor[(nDim+1)*nVar+nDim+1][iLane] = val_scale*Gamma*proj_vel[iLane];
+  }
+  
+  for (iDim = 0; iDim < nDim; iDim++) {
+#pragma GCC unroll 1
+    for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++) {
+      val_Proj_Jac_Tensor[iDim+1][iLane] = val_scale*val_normal[iDim][iLane];
+      val_Proj_Jac_Tensor[(iDim+1)*nVar][iLane] = val_scale*(val_normal[iDim][iLane]*phi[iLane] - val_velocity[iDim][iLane]*proj_vel[iLane]);
+      val_Proj_Jac_Tensor[(iDim+1)*nVar+nDim+1][iLane] = val_scale*a2*val_normal[iDim][iLane];
+      val_Proj_Jac_Tensor[(nDim+1)*nVar+iDim+1][iLane] = val_scale*(val_normal[iDim][iLane]*a1[iLane]-a2*val_velocity[iDim][iLane]*proj_vel[iLane]);
+    }
+    for (jDim = 0; jDim < nDim; jDim++)
+#pragma GCC unroll 1
+      for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++)
+        val_Proj_Jac_Tensor[(iDim+1)*nVar+jDim+1][iLane] = val_scale*(val_normal[jDim][iLane]*val_velocity[iDim][iLane]-a2*val_normal[iDim][iLane]*val_velocity[jDim][iLane]);
+#pragma GCC unroll 1
+    for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++)
+      val_Proj_Jac_Tensor[(iDim+1)*nVar+iDim+1][iLane] += val_scale*proj_vel[iLane];
+  }
+  
+}
+
+template <unsigned short nDim>
+static inline void GetPMatrix_Batch(double *val_density, double (*val_velocity)[EDGE_BATCH_SIZE], double *val_soundspeed,
+                                    double (*val_normal)[EDGE_BATCH_SIZE], double Gamma_Minus_One,
+                                    double (*val_p_tensor)[nDim+2][EDGE_BATCH_SIZE]);
+
+template <>
+inline void GetPMatrix_Batch<2>(double *val_density, double (*val_velocity)[EDGE_BATCH_SIZE], double *val_soundspeed,
+                                double (*val_normal)[EDGE_BATCH_SIZE], double Gamma_Minus_One,
+                                double (*val_p_tensor)[4][EDGE_BATCH_SIZE]) {
+  
+  unsigned short iLane;
+  double sqvel, rhooc, rhoxc, rho, u, v, nx, ny;
+  
+#pragma GCC unroll 1
+  for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++) {
+    
+    rho = val_density[iLane]; u = val_velocity[0][iLane]; v = val_velocity[1][iLane];
+    nx = val_normal[0][iLane]; ny = val_normal[1][iLane];
+    
+    rhooc = rho / val_soundspeed[iLane];
+    rhoxc = rho * val_soundspeed[iLane];
+    sqvel = u*u+v*v;
+    
+    val_p_tensor[0][0][iLane]=1.0;
+    val_p_tensor[0][1][iLane]=0.0;
+    val_p_tensor[0][2][iLane]=0.5*rhooc;
+    val_p_tensor[0][3][iLane]=0.5*rhooc;
+    
+    val_p_tensor[1][0][iLane]=u;
+    val_p_tensor[1][1][iLane]=rho*ny;
+    val_p_tensor[1][2][iLane]=0.5*(u*rhooc+nx*rho);
+    val_p_tensor[1][3][iLane]=0.5*(u*rhooc-nx*rho);
+    
+    val_p_tensor[2][0][iLane]=v;
+    val_p_tensor[2][1][iLane]=-rho*nx;
+    val_p_tensor[2][2][iLane]=0.5*(v*rhooc+ny*rho);
+    val_p_tensor[2][3][iLane]=0.5*(v*rhooc-ny*rho);
+    
+    val_p_tensor[3][0][iLane]=0.5*sqvel;
+    val_p_tensor[3][1][iLane]=rho*u*ny-rho*v*nx;
+    val_p_tensor[3][2][iLane]=0.5*(0.5*sqvel*rhooc+rho*u*nx+rho*v*ny+rhoxc/Gamma_Minus_One);
+    val_p_tensor[3][3][iLane]=0.5*(0.5*sqvel*rhooc-rho*u*nx-rho*v*ny+rhoxc/Gamma_Minus_One);
+    
+  }
+  
+}
+
+template <>
+inline void GetPMatrix_Batch<3>(double *val_density, double (*val_velocity)[EDGE_BATCH_SIZE], double *val_soundspeed,
+                                double (*val_normal)[EDGE_BATCH_SIZE], double Gamma_Minus_One,
+                                double (*val_p_tensor)[5][EDGE_BATCH_SIZE]) {
+  
+  unsigned short iLane;
+  double sqvel, rhooc, rhoxc, rho, u, v, w, nx, ny, nz;
+  
+#pragma GCC unroll 1
+  for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++) {
+    
+    rho = val_density[iLane]; u = val_velocity[0][iLane]; v = val_velocity[1][iLane]; w = val_velocity[2][iLane];
+    nx = val_normal[0][iLane]; ny = val_normal[1][iLane]; nz = val_normal[2][iLane];
+    
+    rhooc = rho / val_soundspeed[iLane];
+    rhoxc = rho * val_soundspeed[iLane];
+    sqvel = u*u+v*v+w*w;
+    
+    val_p_tensor[0][0][iLane]=nx;
+    val_p_tensor[0][1][iLane]=ny;
+    val_p_tensor[0][2][iLane]=nz;
+    val_p_tensor[0][3][iLane]=0.5*rhooc;
+    val_p_tensor[0][4][iLane]=0.5*rhooc;
+    
+    val_p_tensor[1][0][iLane]=u*nx;
+    val_p_tensor[1][1][iLane]=u*ny-rho*nz;
+    val_p_tensor[1][2][iLane]=u*nz+rho*ny;
+    val_p_tensor[1][3][iLane]=0.5*(u*rhooc+rho*nx);
+    val_p_tensor[1][4][iLane]=0.5*(u*rhooc-rho*nx);
+    
+    val_p_tensor[2][0][iLane]=v*nx+rho*nz;
+    val_p_tensor[2][1][iLane]=v*ny;
+    val_p_tensor[2][2][iLane]=v*nz-rho*nx;
+    val_p_tensor[2][3][iLane]=0.5*(v*rhooc+rho*ny);
+    val_p_tensor[2][4][iLane]=0.5*(v*rhooc-rho*ny);
+    
+    val_p_tensor[3][0][iLane]=w*nx-rho*ny;
+    val_p_tensor[3][1][iLane]=w*ny+rho*nx;
+    val_p_tensor[3][2][iLane]=w*nz;
+    val_p_tensor[3][3][iLane]=0.5*(w*rhooc+rho*nz);
+    val_p_tensor[3][4][iLane]=0.5*(w*rhooc-rho*nz);
+    
+    val_p_tensor[4][0][iLane]=0.5*sqvel*nx+rho*v*nz-rho*w*ny;
+    val_p_tensor[4][1][iLane]=0.5*sqvel*ny-rho*u*nz+rho*w*nx;
+    val_p_tensor[4][2][iLane]=0.5*sqvel*nz+rho*u*ny-rho*v*nx;
+    val_p_tensor[4][3][iLane]=0.5*(0.5*sqvel*rhooc+rho*(u*nx+v*ny+w*nz)+rhoxc/Gamma_Minus_One);
+    val_p_tensor[4][4][iLane]=0.5*(0.5*sqvel*rhooc-rho*(u*nx+v*ny+w*nz)+rhoxc/Gamma_Minus_One);
+    
+  }
+  
+}
+
+template <unsigned short nDim>
+static inline void GetPMatrix_inv_Batch(double *val_density, double (*val_velocity)[EDGE_BATCH_SIZE], double *val_soundspeed,
+                                        double (*val_normal)[EDGE_BATCH_SIZE], double Gamma_Minus_One,
+                                        double (*val_invp_tensor)[nDim+2][EDGE_BATCH_SIZE]);
+
+template <>
+inline void GetPMatrix_inv_Batch<2>(double *val_density, double (*val_velocity)[EDGE_BATCH_SIZE], double *val_soundspeed,
+                                    double (*val_normal)[EDGE_BATCH_SIZE], double Gamma_Minus_One,
+                                    double (*val_invp_tensor)[4][EDGE_BATCH_SIZE]) {
+  
+  unsigned short iLane;
+  double rhoxc, c2, gm1, k0orho, k1orho, gm1_o_c2, gm1_o_rhoxc, sqvel, u, v;
+  
+  gm1 = Gamma_Minus_One;
+  
+#pragma GCC unroll 1
+  for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++) {
+    
+    u = val_velocity[0][iLane]; v = val_velocity[1][iLane];
+    
+    rhoxc = val_density[iLane] * val_soundspeed[iLane];
+    c2 = val_soundspeed[iLane] * val_soundspeed[iLane];
+    k0orho = val_normal[0][iLane] / val_density[iLane];
+    k1orho = val_normal[1][iLane] / val_density[iLane];
+    gm1_o_c2 = gm1/c2;
+    gm1_o_rhoxc = gm1/rhoxc;
+    sqvel = u*u+v*v;
+    
+    val_invp_tensor[0][0][iLane]=1.0-0.5*gm1_o_c2*sqvel;
+    val_invp_tensor[0][1][iLane]=gm1_o_c2*u;
+    val_invp_tensor[0][2][iLane]=gm1_o_c2*v;
+    val_invp_tensor[0][3][iLane]=-gm1_o_c2;
+    
+    val_invp_tensor[1][0][iLane]=-k1orho*u+k0orho*v;
+    val_invp_tensor[1][1][iLane]=k1orho;
+    val_invp_tensor[1][2][iLane]=-k0orho;
+    val_invp_tensor[1][3][iLane]=0.0;
+    
+    val_invp_tensor[2][0][iLane]=-k0orho*u-k1orho*v+0.5*gm1_o_rhoxc*sqvel;
+    val_invp_tensor[2][1][iLane]=k0orho-gm1_o_rhoxc*u;
+    val_invp_tensor[2][2][iLane]=k1orho-gm1_o_rhoxc*v;
+    val_invp_tensor[2][3][iLane]=gm1_o_rhoxc;
+    
+    val_invp_tensor[3][0][iLane]=k0orho*u+k1orho*v+0.5*gm1_o_rhoxc*sqvel;
+    val_invp_tensor[3][1][iLane]=-k0orho-gm1_o_rhoxc*u;
+    val_invp_tensor[3][2][iLane]=-k1orho-gm1_o_rhoxc*v;
+    val_invp_tensor[3][3][iLane]=gm1_o_rhoxc;
+    
+  }
+  
+}
+
+template <>
+inline void GetPMatrix_inv_Batch<3>(double *val_density, double (*val_velocity)[EDGE_BATCH_SIZE], double *val_soundspeed,
+                                    double (*val_normal)[EDGE_BATCH_SIZE], double Gamma_Minus_One,
+                                    double (*val_invp_tensor)[5][EDGE_BATCH_SIZE]) {
+  
+  unsigned short iLane;
+  double rhoxc, c2, gm1, sqvel, rho, u, v, w, nx, ny, nz;
+  
+  gm1 = Gamma_Minus_One;
+  
+#pragma GCC unroll 1
+  for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++) {
+    
+    rho = val_density[iLane]; u = val_velocity[0][iLane]; v = val_velocity[1][iLane]; w = val_velocity[2][iLane];
+    nx = val_normal[0][iLane]; ny = val_normal[1][iLane]; nz = val_normal[2][iLane];
+    
+    rhoxc = rho * val_soundspeed[iLane];
+    c2 = val_soundspeed[iLane] * val_soundspeed[iLane];
+    sqvel = u*u+v*v+w*w;
+    
+    val_invp_tensor[0][0][iLane]=nx-nz*v / rho+ny*w / rho-nx*0.5*gm1*sqvel/c2;
+    val_invp_tensor[0][1][iLane]=nx*gm1*u/c2;
+    val_invp_tensor[0][2][iLane]=nz / rho+nx*gm1*v/c2;
+    val_invp_tensor[0][3][iLane]=-ny / rho+nx*gm1*w/c2;
+    val_invp_tensor[0][4][iLane]=-nx*gm1/c2;
+    
+    val_invp_tensor[1][0][iLane]=ny+nz*u / rho-nx*w / rho-ny*0.5*gm1*sqvel/c2;
+    val_invp_tensor[1][1][iLane]=-nz / rho+ny*gm1*u/c2;
+    val_invp_tensor[1][2][iLane]=ny*gm1*v/c2;
+    val_invp_tensor[1][3][iLane]=nx / rho+ny*gm1*w/c2;
+    val_invp_tensor[1][4][iLane]=-ny*gm1/c2;
+    
+    val_invp_tensor[2][0][iLane]=nz-ny*u / rho+nx*v / rho-nz*0.5*gm1*sqvel/c2;
+    val_invp_tensor[2][1][iLane]=ny / rho+nz*gm1*u/c2;
+    val_invp_tensor[2][2][iLane]=-nx / rho+nz*gm1*v/c2;
+    val_invp_tensor[2][3][iLane]=nz*gm1*w/c2;
+    val_invp_tensor[2][4][iLane]=-nz*gm1/c2;
+    
+    val_invp_tensor[3][0][iLane]=-(nx*u+ny*v+nz*w) / rho+0.5*gm1*sqvel/rhoxc;
+    val_invp_tensor[3][1][iLane]=nx / rho-gm1*u/rhoxc;
+    val_invp_tensor[3][2][iLane]=ny / rho-gm1*v/rhoxc;
+    val_invp_tensor[3][3][iLane]=nz / rho-gm1*w/rhoxc;
+    val_invp_tensor[3][4][iLane]=Gamma_Minus_One/rhoxc;
+    
+    val_invp_tensor[4][0][iLane]=(nx*u+ny*v+nz*w) / rho+0.5*gm1*sqvel/rhoxc;
+    val_invp_tensor[4][1][iLane]=-nx / rho-gm1*u/rhoxc;
+    val_invp_tensor[4][2][iLane]=-ny / rho-gm1*v/rhoxc;
+    val_invp_tensor[4][3][iLane]=-nz / rho-gm1*w/rhoxc;
+    val_invp_tensor[4][4][iLane]=Gamma_Minus_One/rhoxc;
+    
+  }
+  
+}
+
+template <unsigned short nDim>
+static inline void GetViscousProjFlux_Batch(double (*val_primvar)[EDGE_BATCH_SIZE],
+                                            double (*val_gradprimvar)[nDim][EDGE_BATCH_SIZE], double *val_turb_ke,
+                                            double (*val_normal)[EDGE_BATCH_SIZE], double *val_laminar_viscosity,
+                                            double *val_eddy_viscosity, double Gamma, double Gamma_Minus_One,
+                                            double Gas_Constant, double Prandtl_Lam, double Prandtl_Turb,
+                                            double (*val_Proj_Flux)[EDGE_BATCH_SIZE]) {
+  
+  const unsigned short nVar = nDim+2;
+  unsigned short iVar, iDim, jDim, iLane;
+  double Cp, delta_ij, *Density, total_viscosity[EDGE_BATCH_SIZE], heat_flux_factor[EDGE_BATCH_SIZE],
+  div_vel[EDGE_BATCH_SIZE], tau[nDim][nDim][EDGE_BATCH_SIZE], Flux_Tensor[nVar][nDim][EDGE_BATCH_SIZE];
+  
+  Density = val_primvar[nDim+2];
+  Cp = (Gamma / Gamma_Minus_One) * Gas_Constant;
+  
+#pragma GCC unroll 1
+  for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++) {
+    total_viscosity[iLane] = val_laminar_viscosity[iLane] + val_eddy_viscosity[iLane];
+    heat_flux_factor[iLane] = Cp * (val_laminar_viscosity[iLane]/Prandtl_Lam + val_eddy_viscosity[iLane]/Prandtl_Turb);
+    div_vel[iLane] = 0.0;
+  }
+  
+  for (iDim = 0 ; iDim < nDim; iDim++)
+#pragma GCC unroll 1
+    for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++)
+      div_vel[iLane] += val_gradprimvar[iDim+1][iDim][iLane];
+  
+  for (iDim = 0 ; iDim < nDim; iDim++)
+    for (jDim = 0 ; jDim < nDim; jDim++) {
+      delta_ij = (iDim == jDim) ? 1.0 : 0.0;
+#pragma GCC unroll 1
+      for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++)
+        tau[iDim][jDim][iLane] = total_viscosity[iLane]*( val_gradprimvar[jDim+1][iDim][iLane] + val_gradprimvar[iDim+1][jDim][iLane] )
+        - TWO3*total_viscosity[iLane]*div_vel[iLane]*delta_ij - TWO3*Density[iLane]*val_turb_ke[iLane]*delta_ij;
+    }
+  
+  /*--- Gradient of primitive variables -> [Temp vel_x vel_y vel_z Pressure] ---*/
+  
+  for (iDim = 0 ; iDim < nDim; iDim++) {
+#pragma GCC unroll 1
+    for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++) {
+      Flux_Tensor[0][iDim][iLane] = 0.0;
+      Flux_Tensor[nDim+1][iDim][iLane] = tau[iDim][0][iLane]*val_primvar[1][iLane];
+    }
+    for (jDim = 0 ; jDim < nDim; jDim++)
+#pragma GCC unroll 1
+      for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++)
+        Flux_Tensor[jDim+1][iDim][iLane] = tau[iDim][jDim][iLane];
+    for (jDim = 1 ; jDim < nDim; jDim++)
+#pragma GCC unroll 1
+      for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++)
+        Flux_Tensor[nDim+1][iDim][iLane] += tau[iDim][jDim][iLane]*val_primvar[jDim+1][iLane];
+#pragma GCC unroll 1
+    for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++)
+      Flux_Tensor[nDim+1][iDim][iLane] += heat_flux_factor[iLane]*val_gradprimvar[0][iDim][iLane];
+  }
+  
+  for (iVar = 0; iVar < nVar; iVar++) {
+#pragma GCC unroll 1
+    for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++)
+      val_Proj_Flux[iVar][iLane] = 0.0;
+    for (iDim = 0; iDim < nDim; iDim++)
+#pragma GCC unroll 1
+      for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++)
+        val_Proj_Flux[iVar][iLane] += Flux_Tensor[iVar][iDim][iLane] * val_normal[iDim][iLane];
+  }
+  
+}
+
+template <unsigned short nDim>
+static inline void GetViscousProjJacs_Batch(double (*val_Mean_PrimVar)[EDGE_BATCH_SIZE], double *val_laminar_viscosity,
+                                            double *val_eddy_viscosity, double *val_dist_ij,
+                                            double (*val_normal)[EDGE_BATCH_SIZE], double *val_dS,
+                                            double (*val_Proj_Visc_Flux)[EDGE_BATCH_SIZE], double Gamma,
+                                            double Prandtl_Lam, double Prandtl_Turb,
+                                            double (*val_Proj_Jac_Tensor_i)[EDGE_BATCH_SIZE],
+                                            double (*val_Proj_Jac_Tensor_j)[EDGE_BATCH_SIZE]) {
+  
+  const unsigned short nVar = nDim+2;
+  unsigned short iDim, iVar, iLane;
+  double theta[EDGE_BATCH_SIZE], sqvel[EDGE_BATCH_SIZE], proj_viscousflux_vel[EDGE_BATCH_SIZE], factor[EDGE_BATCH_SIZE],
+  phi[EDGE_BATCH_SIZE], phi_rho[EDGE_BATCH_SIZE], phi_p[EDGE_BATCH_SIZE], rhoovisc[EDGE_BATCH_SIZE], Density, Pressure,
+  total_viscosity, heat_flux_factor, cpoR, thetax, thetay, thetaz, etax, etay, etaz, pix, piy, piz,
+  (*Jac_i)[EDGE_BATCH_SIZE] = val_Proj_Jac_Tensor_i;
+  
+#pragma GCC unroll 1
+  for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++) {
+    theta[iLane] = 0.0; sqvel[iLane] = 0.0; proj_viscousflux_vel[iLane] = 0.0;
+  }
+  for (iDim = 0; iDim < nDim; iDim++)
+#pragma GCC unroll 1
+    for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++) {
+      theta[iLane] += val_normal[iDim][iLane]*val_normal[iDim][iLane];
+      sqvel[iLane] += val_Mean_PrimVar[iDim+1][iLane]*val_Mean_PrimVar[iDim+1][iLane];
+      proj_viscousflux_vel[iLane] += val_Proj_Visc_Flux[iDim+1][iLane]*val_Mean_PrimVar[iDim+1][iLane];
+    }
+  
+  cpoR = Gamma/(Gamma-1.0);
+  
+#pragma GCC unroll 1
+  for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++) {
+    phi[iLane] = 0.5*(Gamma-1.0)*sqvel[iLane];
+    Density = val_Mean_PrimVar[nDim+2][iLane];
+    Pressure = val_Mean_PrimVar[nDim+1][iLane];
+    total_viscosity = val_laminar_viscosity[iLane] + val_eddy_viscosity[iLane];
+    heat_flux_factor = val_laminar_viscosity[iLane]/Prandtl_Lam + val_eddy_viscosity[iLane]/Prandtl_Turb;
+    factor[iLane] = total_viscosity*val_dS[iLane]/(Density*val_dist_ij[iLane]);
+    phi_rho[iLane] = -cpoR*heat_flux_factor*Pressure/(Density*Density);
+    phi_p[iLane] = cpoR*heat_flux_factor/(Density);
+    rhoovisc[iLane] = Density/(total_viscosity);
+  }
+  
+  if (nDim == 2) {
+#pragma GCC unroll 1
+    for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++) {
+      
+      thetax = theta[iLane] + val_normal[0][iLane]*val_normal[0][iLane]/3.0;
+      thetay = theta[iLane] + val_normal[1][iLane]*val_normal[1][iLane]/3.0;
+      
+      etaz = val_normal[0][iLane]*val_normal[1][iLane]/3.0;
+      
+      pix = val_Mean_PrimVar[1][iLane]*thetax + val_Mean_PrimVar[2][iLane]*etaz;
+      piy = val_Mean_PrimVar[1][iLane]*etaz   + val_Mean_PrimVar[2][iLane]*thetay;
+      
+      Jac_i[0*nVar+0][iLane] = 0.0;
+      Jac_i[0*nVar+1][iLane] = 0.0;
+      Jac_i[0*nVar+2][iLane] = 0.0;
+      Jac_i[0*nVar+3][iLane] = 0.0;
+      Jac_i[1*nVar+0][iLane] = factor[iLane]*pix;
+      Jac_i[1*nVar+1][iLane] = -factor[iLane]*thetax;
+      Jac_i[1*nVar+2][iLane] = -factor[iLane]*etaz;
+      Jac_i[1*nVar+3][iLane] = 0.0;
+      Jac_i[2*nVar+0][iLane] = factor[iLane]*piy;
+      Jac_i[2*nVar+1][iLane] = -factor[iLane]*etaz;
+      Jac_i[2*nVar+2][iLane] = -factor[iLane]*thetay;
+      Jac_i[2*nVar+3][iLane] = 0.0;
+      
+      Jac_i[3*nVar+0][iLane] = -factor[iLane]*(rhoovisc[iLane]*theta[iLane]*(phi_rho[iLane]+phi[iLane]*phi_p[iLane]) - (pix*val_Mean_PrimVar[1][iLane]+piy*val_Mean_PrimVar[2][iLane]));
+      Jac_i[3*nVar+1][iLane] = -factor[iLane]*(pix-rhoovisc[iLane]*theta[iLane]*phi_p[iLane]*(Gamma-1.0)*val_Mean_PrimVar[1][iLane]);
+      Jac_i[3*nVar+2][iLane] = -factor[iLane]*(piy-rhoovisc[iLane]*theta[iLane]*phi_p[iLane]*(Gamma-1.0)*val_Mean_PrimVar[2][iLane]);
+      Jac_i[3*nVar+3][iLane] = -factor[iLane]*((Gamma-1.0)*rhoovisc[iLane]*theta[iLane]*phi_p[iLane]);
+      
+    }
+  }
+  else {
+#pragma GCC unroll 1
+    for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++) {
+      
+      thetax = theta[iLane] + val_normal[0][iLane]*val_normal[0][iLane]/3.0;
+      thetay = theta[iLane] + val_normal[1][iLane]*val_normal[1][iLane]/3.0;
+      thetaz = theta[iLane] + val_normal[nDim-1][iLane]*val_normal[nDim-1][iLane]/3.0;
+      
+      etax = val_normal[1][iLane]*val_normal[nDim-1][iLane]/3.0;
+      etay = val_normal[0][iLane]*val_normal[nDim-1][iLane]/3.0;
+      etaz = val_normal[0][iLane]*val_normal[1][iLane]/3.0;
+      
+      pix = val_Mean_PrimVar[1][iLane]*thetax + val_Mean_PrimVar[2][iLane]*etaz   + val_Mean_PrimVar[nDim][iLane]*etay;
+      piy = val_Mean_PrimVar[1][iLane]*etaz   + val_Mean_PrimVar[2][iLane]*thetay + val_Mean_PrimVar[nDim][iLane]*etax;
+      piz = val_Mean_PrimVar[1][iLane]*etay   + val_Mean_PrimVar[2][iLane]*etax   + val_Mean_PrimVar[nDim][iLane]*thetaz;
+      
+      Jac_i[0*nVar+0][iLane] = 0.0;
+      Jac_i[0*nVar+1][iLane] = 0.0;
+      Jac_i[0*nVar+2][iLane] = 0.0;
+      Jac_i[0*nVar+3][iLane] = 0.0;
+      Jac_i[0*nVar+nVar-1][iLane] = 0.0;
+      Jac_i[1*nVar+0][iLane] = factor[iLane]*pix;
+      Jac_i[1*nVar+1][iLane] = -factor[iLane]*thetax;
+      Jac_i[1*nVar+2][iLane] = -factor[iLane]*etaz;
+      Jac_i[1*nVar+3][iLane] = -factor[iLane]*etay;
+      Jac_i[1*nVar+nVar-1][iLane] = 0.0;
+      Jac_i[2*nVar+0][iLane] = factor[iLane]*piy;
+      Jac_i[2*nVar+1][iLane] = -factor[iLane]*etaz;
+      Jac_i[2*nVar+2][iLane] = -factor[iLane]*thetay;
+      Jac_i[2*nVar+3][iLane] = -factor[iLane]*etax;
+      Jac_i[2*nVar+nVar-1][iLane] = 0.0;
+      Jac_i[3*nVar+0][iLane] = factor[iLane]*piz;
+      Jac_i[3*nVar+1][iLane] = -factor[iLane]*etay;
+      Jac_i[3*nVar+2][iLane] = -factor[iLane]*etax;
+      Jac_i[3*nVar+3][iLane] = -factor[iLane]*thetaz;
+      Jac_i[3*nVar+nVar-1][iLane] = 0.0;
+      Jac_i[(nVar-1)*nVar+0][iLane] = -factor[iLane]*(rhoovisc[iLane]*theta[iLane]*(phi_rho[iLane]+phi[iLane]*phi_p[iLane]) - (pix*val_Mean_PrimVar[1][iLane] + piy*val_Mean_PrimVar[2][iLane] + piz*val_Mean_PrimVar[nDim][iLane]));
+      Jac_i[(nVar-1)*nVar+1][iLane] = -factor[iLane]*(pix-rhoovisc[iLane]*theta[iLane]*phi_p[iLane]*(Gamma-1)*val_Mean_PrimVar[1][iLane]);
+      Jac_i[(nVar-1)*nVar+2][iLane] = -factor[iLane]*(piy-rhoovisc[iLane]*theta[iLane]*phi_p[iLane]*(Gamma-1)*val_Mean_PrimVar[2][iLane]);
+      Jac_i[(nVar-1)*nVar+3][iLane] = -factor[iLane]*(piz-rhoovisc[iLane]*theta[iLane]*phi_p[iLane]*(Gamma-1)*val_Mean_PrimVar[nDim][iLane]);
+      Jac_i[(nVar-1)*nVar+nVar-1][iLane] = -factor[iLane]*((Gamma-1)*rhoovisc[iLane]*theta[iLane]*phi_p[iLane]);
+      
+    }
+  }
+  
+  for (iVar = 0; iVar < nVar*nVar; iVar++)
+#pragma GCC unroll 1
+    for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++)
+      val_Proj_Jac_Tensor_j[iVar][iLane] = -val_Proj_Jac_Tensor_i[iVar][iLane];
+  
+  /*--- Energy equation, contribution of the viscous flux ---*/
+  
+#pragma GCC unroll 1
+  for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++) {
+    factor[iLane] = 0.5/val_Mean_PrimVar[nDim+2][iLane];
+    val_Proj_Jac_Tensor_i[(nVar-1)*nVar][iLane] += factor[iLane]*proj_viscousflux_vel[iLane];
+    val_Proj_Jac_Tensor_j[(nVar-1)*nVar][iLane] += factor[iLane]*proj_viscousflux_vel[iLane];
+  }
+  for (iDim = 0; iDim < nDim; iDim++)
+#pragma GCC unroll 1
+    for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++) {
+      val_Proj_Jac_Tensor_i[(nVar-1)*nVar+iDim+1][iLane] += factor[iLane]*val_Proj_Visc_Flux[iDim+1][iLane];
+      val_Proj_Jac_Tensor_j[(nVar-1)*nVar+iDim+1][iLane] += factor[iLane]*val_Proj_Visc_Flux[iDim+1][iLane];
+    }
+  
+}
+
 CCentJST_Flow::CCentJST_Flow(unsigned short val_nDim, unsigned short val_nVar, CConfig *config) : CNumerics(val_nDim, val_nVar, config) {
   
   implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
@@ -45,6 +585,17 @@ CCentJST_Flow::CCentJST_Flow(unsigned short val_nDim, unsigned short val_nVar, C
   MeanVelocity = new double [nDim];
   ProjFlux = new double [nVar];
   
+  /*--- Variables of the batch of edges, stored by lanes ---*/
+  Batch_V_i = new double [nDim+5][EDGE_BATCH_SIZE];
+  Batch_V_j = new double [nDim+5][EDGE_BATCH_SIZE];
+  Batch_Normal = new double [nDim][EDGE_BATCH_SIZE];
+  Batch_GridVel_i = new double [nDim][EDGE_BATCH_SIZE];
+  Batch_GridVel_j = new double [nDim][EDGE_BATCH_SIZE];
+  Batch_Und_Lapl_i = new double [nVar][EDGE_BATCH_SIZE];
+  Batch_Und_Lapl_j = new double [nVar][EDGE_BATCH_SIZE];
+  Batch_Scalar_i = new double [3][EDGE_BATCH_SIZE];
+  Batch_Scalar_j = new double [3][EDGE_BATCH_SIZE];
+  
 }
 
 CCentJST_Flow::~CCentJST_Flow(void) {
@@ -54,6 +605,15 @@ CCentJST_Flow::~CCentJST_Flow(void) {
   delete [] Velocity_j;
   delete [] MeanVelocity;
   delete [] ProjFlux;
+  delete [] Batch_V_i;
+  delete [] Batch_V_j;
+  delete [] Batch_Normal;
+  delete [] Batch_GridVel_i;
+  delete [] Batch_GridVel_j;
+  delete [] Batch_Und_Lapl_i;
+  delete [] Batch_Und_Lapl_j;
+  delete [] Batch_Scalar_i;
+  delete [] Batch_Scalar_j;
 }
 
 void CCentJST_Flow::ComputeResidual(double *val_residual, double **val_Jacobian_i, double **val_Jacobian_j,
@@ -204,6 +764,256 @@ void CCentJST_Flow::ComputeResidual(double *val_residual, double **val_Jacobian_
   
 }
 
+template <unsigned short nDim>
+static void ComputeResidual_Batch_JST(double (*V_i)[EDGE_BATCH_SIZE], double (*V_j)[EDGE_BATCH_SIZE],
+                                      double (*Normal)[EDGE_BATCH_SIZE], double (*GridVel_i)[EDGE_BATCH_SIZE],
+                                      double (*GridVel_j)[EDGE_BATCH_SIZE], double (*Und_Lapl_i)[EDGE_BATCH_SIZE],
+                                      double (*Und_Lapl_j)[EDGE_BATCH_SIZE], double (*Scalar_i)[EDGE_BATCH_SIZE],
+                                      double (*Scalar_j)[EDGE_BATCH_SIZE], double Gamma, double Gamma_Minus_One,
+                                      double Param_p, double Param_Kappa_2, double Param_Kappa_4, bool implicit,
+                                      bool grid_movement, double (*Residual)[EDGE_BATCH_SIZE],
+                                      double (*Jacobian_i)[EDGE_BATCH_SIZE], double (*Jacobian_j)[EDGE_BATCH_SIZE]) {
+  
+  const unsigned short nVar = nDim+2;
+  unsigned short iDim, iVar, iLane;
+  
+  /*--- Primitive variables at points i and j, and the scalar inputs (spectral radius, sensor
+   and number of neighbors), read in place ---*/
+  
+  double (*Velocity_i)[EDGE_BATCH_SIZE] = &V_i[1], (*Velocity_j)[EDGE_BATCH_SIZE] = &V_j[1],
+  *Pressure_i = V_i[nDim+1], *Pressure_j = V_j[nDim+1], *Density_i = V_i[nDim+2], *Density_j = V_j[nDim+2],
+  *Enthalpy_i = V_i[nDim+3], *Enthalpy_j = V_j[nDim+3], *SoundSpeed_i = V_i[nDim+4], *SoundSpeed_j = V_j[nDim+4],
+  *Lambda_i = Scalar_i[0], *Lambda_j = Scalar_j[0], *Sensor_i = Scalar_i[1], *Sensor_j = Scalar_j[1],
+  *Neighbor_i = Scalar_i[2], *Neighbor_j = Scalar_j[2];
+  
+  double Energy_i[EDGE_BATCH_SIZE], Energy_j[EDGE_BATCH_SIZE], sq_vel_i[EDGE_BATCH_SIZE], sq_vel_j[EDGE_BATCH_SIZE],
+  U_i[nVar][EDGE_BATCH_SIZE], U_j[nVar][EDGE_BATCH_SIZE], MeanDensity[EDGE_BATCH_SIZE], MeanPressure[EDGE_BATCH_SIZE],
+  MeanEnthalpy[EDGE_BATCH_SIZE], MeanEnergy[EDGE_BATCH_SIZE], MeanVelocity[nDim][EDGE_BATCH_SIZE],
+  ProjGridVel[EDGE_BATCH_SIZE], Diff_U[nVar][EDGE_BATCH_SIZE], ProjVelocity_i[EDGE_BATCH_SIZE],
+  ProjVelocity_j[EDGE_BATCH_SIZE], Area[EDGE_BATCH_SIZE], MeanLambda[EDGE_BATCH_SIZE], Phi_i[EDGE_BATCH_SIZE],
+  Phi_j[EDGE_BATCH_SIZE], StretchingFactor[EDGE_BATCH_SIZE], Epsilon_2[EDGE_BATCH_SIZE], Epsilon_4[EDGE_BATCH_SIZE],
+  cte_0[EDGE_BATCH_SIZE], cte_1[EDGE_BATCH_SIZE], sc2, sc4;
+  
+  /*--- Energy and squared velocity at points i and j ---*/
+  
+#pragma GCC unroll 1
+  for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++) {
+    Energy_i[iLane] = Enthalpy_i[iLane] - Pressure_i[iLane]/Density_i[iLane];
+    Energy_j[iLane] = Enthalpy_j[iLane] - Pressure_j[iLane]/Density_j[iLane];
+    sq_vel_i[iLane] = 0.0; sq_vel_j[iLane] = 0.0;
+  }
+  for (iDim = 0; iDim < nDim; iDim++)
+#pragma GCC unroll 1
+    for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++) {
+      sq_vel_i[iLane] += 0.5*Velocity_i[iDim][iLane]*Velocity_i[iDim][iLane];
+      sq_vel_j[iLane] += 0.5*Velocity_j[iDim][iLane]*Velocity_j[iDim][iLane];
+    }
+  
+  /*--- Recompute conservative variables ---*/
+  
+#pragma GCC unroll 1
+  for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++) {
+    U_i[0][iLane] = Density_i[iLane]; U_j[0][iLane] = Density_j[iLane];
+    U_i[nDim+1][iLane] = Density_i[iLane]*Energy_i[iLane]; U_j[nDim+1][iLane] = Density_j[iLane]*Energy_j[iLane];
+  }
+  for (iDim = 0; iDim < nDim; iDim++)
+#pragma GCC unroll 1
+    for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++) {
+      U_i[iDim+1][iLane] = Density_i[iLane]*Velocity_i[iDim][iLane];
+      U_j[iDim+1][iLane] = Density_j[iLane]*Velocity_j[iDim][iLane];
+    }
+  
+  /*--- Mean values of the variables, and residual of the inviscid flux ---*/
+  
+#pragma GCC unroll 1
+  for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++) {
+    MeanDensity[iLane] = 0.5*(Density_i[iLane]+Density_j[iLane]);
+    MeanPressure[iLane] = 0.5*(Pressure_i[iLane]+Pressure_j[iLane]);
+    MeanEnthalpy[iLane] = 0.5*(Enthalpy_i[iLane]+Enthalpy_j[iLane]);
+    MeanEnergy[iLane] = 0.5*(Energy_i[iLane]+Energy_j[iLane]);
+  }
+  for (iDim = 0; iDim < nDim; iDim++)
+#pragma GCC unroll 1
+    for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++)
+      MeanVelocity[iDim][iLane] = 0.5*(Velocity_i[iDim][iLane]+Velocity_j[iDim][iLane]);
+  
+  GetInviscidProjFlux_Batch<nDim>(MeanDensity, MeanVelocity, MeanPressure, MeanEnthalpy, Normal, Residual);
+  
+  if (implicit) {
+    GetInviscidProjJac_Batch<nDim>(MeanVelocity, MeanEnergy, Normal, 0.5, Gamma, Gamma_Minus_One, Jacobian_i);
+    for (iVar = 0; iVar < nVar*nVar; iVar++)
+#pragma GCC unroll 1
+      for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++)
+        Jacobian_j[iVar][iLane] = Jacobian_i[iVar][iLane];
+  }
+  
+  /*--- Adjustment due to grid motion ---*/
+  
+  if (grid_movement) {
+#pragma GCC unroll 1
+    for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++)
+      ProjGridVel[iLane] = 0.0;
+    for (iDim = 0; iDim < nDim; iDim++)
+#pragma GCC unroll 1
+      for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++)
+        ProjGridVel[iLane] += 0.5*(GridVel_i[iDim][iLane]+GridVel_j[iDim][iLane])*Normal[iDim][iLane];
+    for (iVar = 0; iVar < nVar; iVar++) {
+#pragma GCC unroll 1
+      for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++)
+        Residual[iVar][iLane] -= ProjGridVel[iLane] * 0.5*(U_i[iVar][iLane]+U_j[iVar][iLane]);
+      if (implicit)
+#pragma GCC unroll 1
+        for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++) {
+          Jacobian_i[iVar*nVar+iVar][iLane] -= 0.5*ProjGridVel[iLane];
+          Jacobian_j[iVar*nVar+iVar][iLane] -= 0.5*ProjGridVel[iLane];
+        }
+    }
+  }
+  
+  /*--- Differences btw. conservative variables, with a correction for the enthalpy ---*/
+  
+  for (iVar = 0; iVar < nVar-1; iVar++)
+#pragma GCC unroll 1
+    for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++)
+      Diff_U[iVar][iLane] = U_i[iVar][iLane]-U_j[iVar][iLane];
+#pragma GCC unroll 1
+  for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++)
+    Diff_U[nVar-1][iLane] = Density_i[iLane]*Enthalpy_i[iLane]-Density_j[iLane]*Enthalpy_j[iLane];
+  
+  /*--- Local spectral radius and stretching factor ---*/
+  
+#pragma GCC unroll 1
+  for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++) {
+    ProjVelocity_i[iLane] = 0.0; ProjVelocity_j[iLane] = 0.0; Area[iLane] = 0.0;
+  }
+  for (iDim = 0; iDim < nDim; iDim++)
+#pragma GCC unroll 1
+    for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++) {
+      ProjVelocity_i[iLane] += Velocity_i[iDim][iLane]*Normal[iDim][iLane];
+      ProjVelocity_j[iLane] += Velocity_j[iDim][iLane]*Normal[iDim][iLane];
+      Area[iLane] += Normal[iDim][iLane]*Normal[iDim][iLane];
+    }
+  
+  if (grid_movement)
+#pragma GCC unroll 1
+    for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++) {
+      ProjVelocity_i[iLane] -= ProjGridVel[iLane];
+      ProjVelocity_j[iLane] -= ProjGridVel[iLane];
+    }
+  
+#pragma GCC unroll 1
+  for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++) {
+    Area[iLane] = sqrt(Area[iLane]);
+    MeanLambda[iLane] = 0.5*((fabs(ProjVelocity_i[iLane])+SoundSpeed_i[iLane]*Area[iLane]) +
+                             (fabs(ProjVelocity_j[iLane])+SoundSpeed_j[iLane]*Area[iLane]));
+  }
+  
+#pragma GCC unroll 1
+  for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++) {
+    Phi_i[iLane] = pow(Lambda_i[iLane]/(4.0*MeanLambda[iLane]), Param_p);
+    Phi_j[iLane] = pow(Lambda_j[iLane]/(4.0*MeanLambda[iLane]), Param_p);
+  }
+  
+#pragma GCC unroll 1
+  for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++) {
+    StretchingFactor[iLane] = 4.0*Phi_i[iLane]*Phi_j[iLane]/(Phi_i[iLane]+Phi_j[iLane]);
+    sc2 = 3.0*(Neighbor_i[iLane]+Neighbor_j[iLane])/(Neighbor_i[iLane]*Neighbor_j[iLane]);
+    sc4 = sc2*sc2/4.0;
+    Epsilon_2[iLane] = Param_Kappa_2*0.5*(Sensor_i[iLane]+Sensor_j[iLane])*sc2;
+    Epsilon_4[iLane] = max(0.0, Param_Kappa_4-Epsilon_2[iLane])*sc4;
+  }
+  
+  /*--- Artificial dissipation ---*/
+  
+  for (iVar = 0; iVar < nVar; iVar++)
+#pragma GCC unroll 1
+    for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++)
+      Residual[iVar][iLane] += (Epsilon_2[iLane]*Diff_U[iVar][iLane] - Epsilon_4[iLane]*(Und_Lapl_i[iVar][iLane]-Und_Lapl_j[iVar][iLane]))
+      *StretchingFactor[iLane]*MeanLambda[iLane];
+  
+  if (implicit) {
+    
+#pragma GCC unroll 1
+    for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++) {
+      cte_0[iLane] = (Epsilon_2[iLane] + Epsilon_4[iLane]*(Neighbor_i[iLane]+1.0))*StretchingFactor[iLane]*MeanLambda[iLane];
+      cte_1[iLane] = (Epsilon_2[iLane] + Epsilon_4[iLane]*(Neighbor_j[iLane]+1.0))*StretchingFactor[iLane]*MeanLambda[iLane];
+    }
+    
+    for (iVar = 0; iVar < (nVar-1); iVar++)
+#pragma GCC unroll 1
+      for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++) {
+        Jacobian_i[iVar*nVar+iVar][iLane] += cte_0[iLane];
+        Jacobian_j[iVar*nVar+iVar][iLane] -= cte_1[iLane];
+      }
+    
+#pragma GCC unroll 1
+    for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++) {
+      Jacobian_i[(nVar-1)*nVar][iLane] += cte_0[iLane]*Gamma_Minus_One*sq_vel_i[iLane];
+      Jacobian_i[(nVar-1)*nVar+nVar-1][iLane] += cte_0[iLane]*Gamma;
+      Jacobian_j[(nVar-1)*nVar][iLane] -= cte_1[iLane]*Gamma_Minus_One*sq_vel_j[iLane];
+      Jacobian_j[(nVar-1)*nVar+nVar-1][iLane] -= cte_1[iLane]*Gamma;
+    }
+    for (iDim = 0; iDim < nDim; iDim++)
+#pragma GCC unroll 1
+      for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++) {
+        Jacobian_i[(nVar-1)*nVar+iDim+1][iLane] -= cte_0[iLane]*Gamma_Minus_One*Velocity_i[iDim][iLane];
+        Jacobian_j[(nVar-1)*nVar+iDim+1][iLane] += cte_1[iLane]*Gamma_Minus_One*Velocity_j[iDim][iLane];
+      }
+    
+  }
+  
+}
+
+void CCentJST_Flow::SetBatch_Lane(unsigned short val_lane) {
+  
+  unsigned short iPrim, iDim, iVar;
+  
+  for (iPrim = 0; iPrim < nDim+5; iPrim++) {
+    Batch_V_i[iPrim][val_lane] = V_i[iPrim];
+    Batch_V_j[iPrim][val_lane] = V_j[iPrim];
+  }
+  for (iDim = 0; iDim < nDim; iDim++) {
+    Batch_Normal[iDim][val_lane] = Normal[iDim];
+    if (grid_movement) {
+      Batch_GridVel_i[iDim][val_lane] = GridVel_i[iDim];
+      Batch_GridVel_j[iDim][val_lane] = GridVel_j[iDim];
+    }
+  }
+  for (iVar = 0; iVar < nVar; iVar++) {
+    Batch_Und_Lapl_i[iVar][val_lane] = Und_Lapl_i[iVar];
+    Batch_Und_Lapl_j[iVar][val_lane] = Und_Lapl_j[iVar];
+  }
+  Batch_Scalar_i[0][val_lane] = Lambda_i;          Batch_Scalar_j[0][val_lane] = Lambda_j;
+  Batch_Scalar_i[1][val_lane] = Sensor_i;          Batch_Scalar_j[1][val_lane] = Sensor_j;
+  Batch_Scalar_i[2][val_lane] = double(Neighbor_i); Batch_Scalar_j[2][val_lane] = double(Neighbor_j);
+  
+}
+
+void CCentJST_Flow::ComputeResidual_Batch(unsigned short val_nLane, double (*val_residual)[EDGE_BATCH_SIZE],
+                                          double (*val_Jacobian_i)[EDGE_BATCH_SIZE], double (*val_Jacobian_j)[EDGE_BATCH_SIZE],
+                                          CConfig *config) {
+  
+  SetBatch_Padding(Batch_V_i, nDim+5, val_nLane);        SetBatch_Padding(Batch_V_j, nDim+5, val_nLane);
+  SetBatch_Padding(Batch_Normal, nDim, val_nLane);
+  if (grid_movement) {
+    SetBatch_Padding(Batch_GridVel_i, nDim, val_nLane); SetBatch_Padding(Batch_GridVel_j, nDim, val_nLane);
+  }
+  SetBatch_Padding(Batch_Und_Lapl_i, nVar, val_nLane);   SetBatch_Padding(Batch_Und_Lapl_j, nVar, val_nLane);
+  SetBatch_Padding(Batch_Scalar_i, 3, val_nLane);        SetBatch_Padding(Batch_Scalar_j, 3, val_nLane);
+  
+  if (nDim == 2)
+    ComputeResidual_Batch_JST<2>(Batch_V_i, Batch_V_j, Batch_Normal, Batch_GridVel_i, Batch_GridVel_j,
+                                 Batch_Und_Lapl_i, Batch_Und_Lapl_j, Batch_Scalar_i, Batch_Scalar_j, Gamma, Gamma_Minus_One,
+                                 Param_p, Param_Kappa_2, Param_Kappa_4, implicit, grid_movement,
+                                 val_residual, val_Jacobian_i, val_Jacobian_j);
+  else
+    ComputeResidual_Batch_JST<3>(Batch_V_i, Batch_V_j, Batch_Normal, Batch_GridVel_i, Batch_GridVel_j,
+                                 Batch_Und_Lapl_i, Batch_Und_Lapl_j, Batch_Scalar_i, Batch_Scalar_j, Gamma, Gamma_Minus_One,
+                                 Param_p, Param_Kappa_2, Param_Kappa_4, implicit, grid_movement,
+                                 val_residual, val_Jacobian_i, val_Jacobian_j);
+  
+}
+
 CCentJST_KE_Flow::CCentJST_KE_Flow(unsigned short val_nDim, unsigned short val_nVar, CConfig *config) : CNumerics(val_nDim, val_nVar, config) {
 
   implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
@@ -1150,6 +1960,13 @@ CUpwRoe_Flow::CUpwRoe_Flow(unsigned short val_nDim, unsigned short val_nVar, CCo
     P_Tensor[iVar] = new double [nVar];
     invP_Tensor[iVar] = new double [nVar];
   }
+  
+  /*--- Variables of the batch of edges, stored by lanes ---*/
+  Batch_V_i = new double [nDim+4][EDGE_BATCH_SIZE];
+  Batch_V_j = new double [nDim+4][EDGE_BATCH_SIZE];
+  Batch_Normal = new double [nDim][EDGE_BATCH_SIZE];
+  Batch_GridVel_i = new double [nDim][EDGE_BATCH_SIZE];
+  Batch_GridVel_j = new double [nDim][EDGE_BATCH_SIZE];
 }
 
 CUpwRoe_Flow::~CUpwRoe_Flow(void) {
@@ -1170,6 +1987,11 @@ CUpwRoe_Flow::~CUpwRoe_Flow(void) {
   }
   delete [] P_Tensor;
   delete [] invP_Tensor;
+  delete [] Batch_V_i;
+  delete [] Batch_V_j;
+  delete [] Batch_Normal;
+  delete [] Batch_GridVel_i;
+  delete [] Batch_GridVel_j;
   
 }
 
@@ -1376,6 +2198,287 @@ void CUpwRoe_Flow::ComputeResidual(double *val_residual, double **val_Jacobian_i
   
 }
 
+template <unsigned short nDim>
+static void ComputeResidual_Batch_Roe(double (*V_i)[EDGE_BATCH_SIZE], double (*V_j)[EDGE_BATCH_SIZE],
+                                      double (*Normal)[EDGE_BATCH_SIZE], double (*GridVel_i)[EDGE_BATCH_SIZE],
+                                      double (*GridVel_j)[EDGE_BATCH_SIZE], double Gamma, double Gamma_Minus_One,
+                                      double Delta, bool implicit, bool grid_movement, double (*Residual)[EDGE_BATCH_SIZE],
+                                      double (*Jacobian_i)[EDGE_BATCH_SIZE], double (*Jacobian_j)[EDGE_BATCH_SIZE]) {
+  
+  const unsigned short nVar = nDim+2;
+  unsigned short iDim, iVar, jVar, kVar, iLane;
+  
+  /*--- Primitive variables at points i and j, read in place ---*/
+  
+  double (*Velocity_i)[EDGE_BATCH_SIZE] = &V_i[1], (*Velocity_j)[EDGE_BATCH_SIZE] = &V_j[1],
+  *Pressure_i = V_i[nDim+1], *Pressure_j = V_j[nDim+1], *Density_i = V_i[nDim+2], *Density_j = V_j[nDim+2],
+  *Enthalpy_i = V_i[nDim+3], *Enthalpy_j = V_j[nDim+3];
+  
+  double Area[EDGE_BATCH_SIZE], UnitNormal[nDim][EDGE_BATCH_SIZE], Energy_i[EDGE_BATCH_SIZE], Energy_j[EDGE_BATCH_SIZE],
+  U_i[nVar][EDGE_BATCH_SIZE], U_j[nVar][EDGE_BATCH_SIZE], R[EDGE_BATCH_SIZE], RoeDensity[EDGE_BATCH_SIZE],
+  RoeVelocity[nDim][EDGE_BATCH_SIZE], RoeSoundSpeed[EDGE_BATCH_SIZE], sq_vel[EDGE_BATCH_SIZE],
+  ProjFlux_i[nVar][EDGE_BATCH_SIZE], ProjFlux_j[nVar][EDGE_BATCH_SIZE], P_Tensor[nVar][nVar][EDGE_BATCH_SIZE],
+  invP_Tensor[nVar][nVar][EDGE_BATCH_SIZE], Lambda[nVar][EDGE_BATCH_SIZE], MaxLambda[EDGE_BATCH_SIZE],
+  ProjVelocity[EDGE_BATCH_SIZE], ProjGridVel[EDGE_BATCH_SIZE], delta_vel[nDim][EDGE_BATCH_SIZE],
+  proj_delta_vel[EDGE_BATCH_SIZE], delta_p[EDGE_BATCH_SIZE], delta_rho[EDGE_BATCH_SIZE], delta_wave[nVar][EDGE_BATCH_SIZE],
+  Diff_U[nVar][EDGE_BATCH_SIZE], Proj_ModJac_Tensor_ij[EDGE_BATCH_SIZE], RoeEnthalpy;
+  
+  /*--- Face area and unit normal ---*/
+  
+#pragma GCC unroll 1
+  for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++)
+    Area[iLane] = 0.0;
+  for (iDim = 0; iDim < nDim; iDim++)
+#pragma GCC unroll 1
+    for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++)
+      Area[iLane] += Normal[iDim][iLane]*Normal[iDim][iLane];
+#pragma GCC unroll 1
+  for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++)
+    Area[iLane] = sqrt(Area[iLane]);
+  
+  for (iDim = 0; iDim < nDim; iDim++)
+#pragma GCC unroll 1
+    for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++)
+      UnitNormal[iDim][iLane] = Normal[iDim][iLane]/Area[iLane];
+  
+  /*--- Recompute conservative variables ---*/
+  
+#pragma GCC unroll 1
+  for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++) {
+    Energy_i[iLane] = Enthalpy_i[iLane] - Pressure_i[iLane]/Density_i[iLane];
+    Energy_j[iLane] = Enthalpy_j[iLane] - Pressure_j[iLane]/Density_j[iLane];
+    U_i[0][iLane] = Density_i[iLane]; U_j[0][iLane] = Density_j[iLane];
+    U_i[nDim+1][iLane] = Density_i[iLane]*Energy_i[iLane]; U_j[nDim+1][iLane] = Density_j[iLane]*Energy_j[iLane];
+  }
+  for (iDim = 0; iDim < nDim; iDim++)
+#pragma GCC unroll 1
+    for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++) {
+      U_i[iDim+1][iLane] = Density_i[iLane]*Velocity_i[iDim][iLane];
+      U_j[iDim+1][iLane] = Density_j[iLane]*Velocity_j[iDim][iLane];
+    }
+  
+  /*--- Roe-averaged variables at interface between i & j ---*/
+  
+#pragma GCC unroll 1
+  for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++) {
+    R[iLane] = sqrt(fabs(Density_j[iLane]/Density_i[iLane]));
+    RoeDensity[iLane] = R[iLane]*Density_i[iLane];
+    sq_vel[iLane] = 0.0;
+  }
+  for (iDim = 0; iDim < nDim; iDim++)
+#pragma GCC unroll 1
+    for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++) {
+      RoeVelocity[iDim][iLane] = (R[iLane]*Velocity_j[iDim][iLane]+Velocity_i[iDim][iLane])/(R[iLane]+1);
+      sq_vel[iLane] += RoeVelocity[iDim][iLane]*RoeVelocity[iDim][iLane];
+    }
+#pragma GCC unroll 1
+  for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++) {
+    RoeEnthalpy = (R[iLane]*Enthalpy_j[iLane]+Enthalpy_i[iLane])/(R[iLane]+1);
+    RoeSoundSpeed[iLane] = sqrt((Gamma-1)*(RoeEnthalpy-0.5*sq_vel[iLane]));
+  }
+  
+  /*--- Projected fluxes, P and Lambda (with the unit normal) ---*/
+  
+  GetInviscidProjFlux_Batch<nDim>(Density_i, Velocity_i, Pressure_i, Enthalpy_i, Normal, ProjFlux_i);
+  GetInviscidProjFlux_Batch<nDim>(Density_j, Velocity_j, Pressure_j, Enthalpy_j, Normal, ProjFlux_j);
+  
+  GetPMatrix_Batch<nDim>(RoeDensity, RoeVelocity, RoeSoundSpeed, UnitNormal, Gamma_Minus_One, P_Tensor);
+  
+#pragma GCC unroll 1
+  for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++)
+    ProjVelocity[iLane] = 0.0;
+  for (iDim = 0; iDim < nDim; iDim++)
+#pragma GCC unroll 1
+    for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++)
+      ProjVelocity[iLane] += RoeVelocity[iDim][iLane]*UnitNormal[iDim][iLane];
+  
+  if (grid_movement) {
+#pragma GCC unroll 1
+    for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++)
+      ProjGridVel[iLane] = 0.0;
+    for (iDim = 0; iDim < nDim; iDim++)
+#pragma GCC unroll 1
+      for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++)
+        ProjGridVel[iLane] += 0.5*(GridVel_i[iDim][iLane]+GridVel_j[iDim][iLane])*UnitNormal[iDim][iLane];
+#pragma GCC unroll 1
+    for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++)
+      ProjVelocity[iLane] -= ProjGridVel[iLane];
+  }
+  
+  for (iDim = 0; iDim < nDim; iDim++)
+#pragma GCC unroll 1
+    for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++)
+      Lambda[iDim][iLane] = ProjVelocity[iLane];
+#pragma GCC unroll 1
+  for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++) {
+    Lambda[nVar-2][iLane] = ProjVelocity[iLane] + RoeSoundSpeed[iLane];
+    Lambda[nVar-1][iLane] = ProjVelocity[iLane] - RoeSoundSpeed[iLane];
+  }
+  
+  /*--- Mavriplis entropy correction, the absolute value is taken directly (select by lanes) ---*/
+  
+#pragma GCC unroll 1
+  for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++)
+    MaxLambda[iLane] = fabs(ProjVelocity[iLane]) + RoeSoundSpeed[iLane];
+  for (iVar = 0; iVar < nVar; iVar++)
+#pragma GCC unroll 1
+    for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++)
+      Lambda[iVar][iLane] = max(fabs(Lambda[iVar][iLane]), Delta*MaxLambda[iLane]);
+  
+  /*--- Projected grid velocity with the normal (not unit) for the conservative variables ---*/
+  
+  if (grid_movement) {
+#pragma GCC unroll 1
+    for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++)
+      ProjGridVel[iLane] = 0.0;
+    for (iDim = 0; iDim < nDim; iDim++)
+#pragma GCC unroll 1
+      for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++)
+        ProjGridVel[iLane] += 0.5*(GridVel_i[iDim][iLane]+GridVel_j[iDim][iLane])*Normal[iDim][iLane];
+  }
+  
+  if (!implicit) {
+    
+    /*--- Wave amplitudes (characteristics) ---*/
+    
+#pragma GCC unroll 1
+    for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++)
+      proj_delta_vel[iLane] = 0.0;
+    for (iDim = 0; iDim < nDim; iDim++)
+#pragma GCC unroll 1
+      for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++) {
+        delta_vel[iDim][iLane] = Velocity_j[iDim][iLane] - Velocity_i[iDim][iLane];
+        proj_delta_vel[iLane] += delta_vel[iDim][iLane]*Normal[iDim][iLane];
+      }
+#pragma GCC unroll 1
+    for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++) {
+      delta_p[iLane] = Pressure_j[iLane] - Pressure_i[iLane];
+      delta_rho[iLane] = Density_j[iLane] - Density_i[iLane];
+      proj_delta_vel[iLane] = proj_delta_vel[iLane]/Area[iLane];
+      delta_wave[0][iLane] = delta_rho[iLane] - delta_p[iLane]/(RoeSoundSpeed[iLane]*RoeSoundSpeed[iLane]);
+      delta_wave[nVar-2][iLane] = proj_delta_vel[iLane] + delta_p[iLane]/(RoeDensity[iLane]*RoeSoundSpeed[iLane]);
+      delta_wave[nVar-1][iLane] = -proj_delta_vel[iLane] + delta_p[iLane]/(RoeDensity[iLane]*RoeSoundSpeed[iLane]);
+    }
+    if (nDim == 2) {
+#pragma GCC unroll 1
+      for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++)
+        delta_wave[1][iLane] = UnitNormal[1][iLane]*delta_vel[0][iLane]-UnitNormal[0][iLane]*delta_vel[1][iLane];
+    } else {
+#pragma GCC unroll 1
+      for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++) {
+        delta_wave[1][iLane] = UnitNormal[0][iLane]*delta_vel[nDim-1][iLane]-UnitNormal[nDim-1][iLane]*delta_vel[0][iLane];
+        delta_wave[nVar-3][iLane] = UnitNormal[1][iLane]*delta_vel[0][iLane]-UnitNormal[0][iLane]*delta_vel[1][iLane];
+      }
+    }
+    
+    /*--- Roe's flux approximation ---*/
+    
+    for (iVar = 0; iVar < nVar; iVar++) {
+#pragma GCC unroll 1
+      for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++)
+        Residual[iVar][iLane] = 0.5*(ProjFlux_i[iVar][iLane]+ProjFlux_j[iVar][iLane]);
+      for (jVar = 0; jVar < nVar; jVar++)
+#pragma GCC unroll 1
+        for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++)
+          Residual[iVar][iLane] -= 0.5*Lambda[jVar][iLane]*delta_wave[jVar][iLane]*P_Tensor[iVar][jVar][iLane]*Area[iLane];
+    }
+    
+    if (grid_movement)
+      for (iVar = 0; iVar < nVar; iVar++)
+#pragma GCC unroll 1
+        for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++)
+          Residual[iVar][iLane] -= ProjGridVel[iLane] * 0.5*(U_i[iVar][iLane]+U_j[iVar][iLane]);
+    
+  }
+  else {
+    
+    /*--- Inverse P, and Jacobians of the inviscid flux (scale = 0.5) ---*/
+    
+    GetPMatrix_inv_Batch<nDim>(RoeDensity, RoeVelocity, RoeSoundSpeed, UnitNormal, Gamma_Minus_One, invP_Tensor);
+    
+    GetInviscidProjJac_Batch<nDim>(Velocity_i, Energy_i, Normal, 0.5, Gamma, Gamma_Minus_One, Jacobian_i);
+    GetInviscidProjJac_Batch<nDim>(Velocity_j, Energy_j, Normal, 0.5, Gamma, Gamma_Minus_One, Jacobian_j);
+    
+    for (iVar = 0; iVar < nVar; iVar++)
+#pragma GCC unroll 1
+      for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++)
+        Diff_U[iVar][iLane] = U_j[iVar][iLane]-U_i[iVar][iLane];
+    
+    /*--- Roe's flux approximation, |Proj_ModJac_Tensor| = P x |Lambda| x inverse P ---*/
+    
+    for (iVar = 0; iVar < nVar; iVar++) {
+#pragma GCC unroll 1
+      for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++)
+        Residual[iVar][iLane] = 0.5*(ProjFlux_i[iVar][iLane]+ProjFlux_j[iVar][iLane]);
+      for (jVar = 0; jVar < nVar; jVar++) {
+#pragma GCC unroll 1
+        for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++)
+          Proj_ModJac_Tensor_ij[iLane] = 0.0;
+        for (kVar = 0; kVar < nVar; kVar++)
+#pragma GCC unroll 1
+          for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++)
+            Proj_ModJac_Tensor_ij[iLane] += P_Tensor[iVar][kVar][iLane]*Lambda[kVar][iLane]*invP_Tensor[kVar][jVar][iLane];
+#pragma GCC unroll 1
+        for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++) {
+          Residual[iVar][iLane] -= 0.5*Proj_ModJac_Tensor_ij[iLane]*Diff_U[jVar][iLane]*Area[iLane];
+          Jacobian_i[iVar*nVar+jVar][iLane] += 0.5*Proj_ModJac_Tensor_ij[iLane]*Area[iLane];
+          Jacobian_j[iVar*nVar+jVar][iLane] -= 0.5*Proj_ModJac_Tensor_ij[iLane]*Area[iLane];
+        }
+      }
+    }
+    
+    if (grid_movement)
+      for (iVar = 0; iVar < nVar; iVar++)
+#pragma GCC unroll 1
+        for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++) {
+          Residual[iVar][iLane] -= ProjGridVel[iLane] * 0.5*(U_i[iVar][iLane]+U_j[iVar][iLane]);
+          Jacobian_i[iVar*nVar+iVar][iLane] -= 0.5*ProjGridVel[iLane];
+          Jacobian_j[iVar*nVar+iVar][iLane] -= 0.5*ProjGridVel[iLane];
+        }
+    
+  }
+  
+}
+
+void CUpwRoe_Flow::SetBatch_Lane(unsigned short val_lane) {
+  
+  unsigned short iPrim, iDim;
+  
+  for (iPrim = 0; iPrim < nDim+4; iPrim++) {
+    Batch_V_i[iPrim][val_lane] = V_i[iPrim];
+    Batch_V_j[iPrim][val_lane] = V_j[iPrim];
+  }
+  for (iDim = 0; iDim < nDim; iDim++) {
+    Batch_Normal[iDim][val_lane] = Normal[iDim];
+    if (grid_movement) {
+      Batch_GridVel_i[iDim][val_lane] = GridVel_i[iDim];
+      Batch_GridVel_j[iDim][val_lane] = GridVel_j[iDim];
+    }
+  }
+  
+}
+
+void CUpwRoe_Flow::ComputeResidual_Batch(unsigned short val_nLane, double (*val_residual)[EDGE_BATCH_SIZE],
+                                         double (*val_Jacobian_i)[EDGE_BATCH_SIZE], double (*val_Jacobian_j)[EDGE_BATCH_SIZE],
+                                         CConfig *config) {
+  
+  double Delta = config->GetEntropyFix_Coeff();
+  
+  SetBatch_Padding(Batch_V_i, nDim+4, val_nLane);      SetBatch_Padding(Batch_V_j, nDim+4, val_nLane);
+  SetBatch_Padding(Batch_Normal, nDim, val_nLane);
+  if (grid_movement) {
+    SetBatch_Padding(Batch_GridVel_i, nDim, val_nLane); SetBatch_Padding(Batch_GridVel_j, nDim, val_nLane);
+  }
+  
+  if (nDim == 2)
+    ComputeResidual_Batch_Roe<2>(Batch_V_i, Batch_V_j, Batch_Normal, Batch_GridVel_i, Batch_GridVel_j, Gamma, Gamma_Minus_One,
+                                 Delta, implicit, grid_movement, val_residual, val_Jacobian_i, val_Jacobian_j);
+  else
+    ComputeResidual_Batch_Roe<3>(Batch_V_i, Batch_V_j, Batch_Normal, Batch_GridVel_i, Batch_GridVel_j, Gamma, Gamma_Minus_One,
+                                 Delta, implicit, grid_movement, val_residual, val_Jacobian_i, val_Jacobian_j);
+  
+}
+
 CUpwGeneralRoe_Flow::CUpwGeneralRoe_Flow(unsigned short val_nDim, unsigned short val_nVar, CConfig *config) : CNumerics(val_nDim, val_nVar, config) {
 
   implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
@@ -2891,6 +3994,16 @@ CAvgGradCorrected_Flow::CAvgGradCorrected_Flow(unsigned short val_nDim, unsigned
   
   Edge_Vector = new double [nDim];
   
+  /*--- Variables of the batch of edges, stored by lanes ---*/
+  Batch_V_i = new double [nDim+7][EDGE_BATCH_SIZE];
+  Batch_V_j = new double [nDim+7][EDGE_BATCH_SIZE];
+  Batch_Normal = new double [nDim][EDGE_BATCH_SIZE];
+  Batch_Coord_i = new double [nDim][EDGE_BATCH_SIZE];
+  Batch_Coord_j = new double [nDim][EDGE_BATCH_SIZE];
+  Batch_PrimVar_Grad_i = new double [(nDim+1)*nDim][EDGE_BATCH_SIZE];
+  Batch_PrimVar_Grad_j = new double [(nDim+1)*nDim][EDGE_BATCH_SIZE];
+  Batch_turb_ke = new double [2][EDGE_BATCH_SIZE];
+  
 }
 
 CAvgGradCorrected_Flow::~CAvgGradCorrected_Flow(void) {
@@ -2900,6 +4013,14 @@ CAvgGradCorrected_Flow::~CAvgGradCorrected_Flow(void) {
   delete [] Mean_PrimVar;
   delete [] Proj_Mean_GradPrimVar_Edge;
   delete [] Edge_Vector;
+  delete [] Batch_V_i;
+  delete [] Batch_V_j;
+  delete [] Batch_Normal;
+  delete [] Batch_Coord_i;
+  delete [] Batch_Coord_j;
+  delete [] Batch_PrimVar_Grad_i;
+  delete [] Batch_PrimVar_Grad_j;
+  delete [] Batch_turb_ke;
   
   for (iVar = 0; iVar < nDim+1; iVar++)
     delete [] Mean_GradPrimVar[iVar];
@@ -2990,6 +4111,159 @@ void CAvgGradCorrected_Flow::ComputeResidual(double *val_residual, double **val_
   
 }
 
+template <unsigned short nDim>
+static void ComputeResidual_Batch_AvgGradCorrected(double (*V_i)[EDGE_BATCH_SIZE], double (*V_j)[EDGE_BATCH_SIZE],
+                                                   double (*Normal)[EDGE_BATCH_SIZE], double (*Coord_i)[EDGE_BATCH_SIZE],
+                                                   double (*Coord_j)[EDGE_BATCH_SIZE], double (*PrimVar_Grad_i)[EDGE_BATCH_SIZE],
+                                                   double (*PrimVar_Grad_j)[EDGE_BATCH_SIZE], double (*turb_ke)[EDGE_BATCH_SIZE],
+                                                   double Gamma, double Gamma_Minus_One, double Gas_Constant,
+                                                   double Prandtl_Lam, double Prandtl_Turb, bool implicit,
+                                                   double (*Residual)[EDGE_BATCH_SIZE], double (*Jacobian_i)[EDGE_BATCH_SIZE],
+                                                   double (*Jacobian_j)[EDGE_BATCH_SIZE]) {
+  
+  const unsigned short nVar = nDim+2;
+  unsigned short iDim, iVar, iLane;
+  double Area[EDGE_BATCH_SIZE], UnitNormal[nDim][EDGE_BATCH_SIZE], Edge_Vector[nDim][EDGE_BATCH_SIZE],
+  dist_ij_2[EDGE_BATCH_SIZE], dist_ij_2_safe[EDGE_BATCH_SIZE], Edge_Flag[EDGE_BATCH_SIZE], dist_ij[EDGE_BATCH_SIZE],
+  Mean_PrimVar[nDim+3][EDGE_BATCH_SIZE], Mean_GradPrimVar[nDim+1][nDim][EDGE_BATCH_SIZE], Proj_Mean_GradPrimVar_Edge[EDGE_BATCH_SIZE],
+  Mean_Laminar_Viscosity[EDGE_BATCH_SIZE], Mean_Eddy_Viscosity[EDGE_BATCH_SIZE], Mean_turb_ke[EDGE_BATCH_SIZE];
+  
+  /*--- Normalized normal vector, and vector going from iPoint to jPoint ---*/
+  
+#pragma GCC unroll 1
+  for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++) {
+    Area[iLane] = 0.0; dist_ij_2[iLane] = 0.0;
+  }
+  for (iDim = 0; iDim < nDim; iDim++)
+#pragma GCC unroll 1
+    for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++) {
+      Area[iLane] += Normal[iDim][iLane]*Normal[iDim][iLane];
+      Edge_Vector[iDim][iLane] = Coord_j[iDim][iLane]-Coord_i[iDim][iLane];
+      dist_ij_2[iLane] += Edge_Vector[iDim][iLane]*Edge_Vector[iDim][iLane];
+    }
+  
+  /*--- The edges of zero length have no correction and zero Jacobians (as in the scalar version),
+   the division by the distance is done with a nonzero value and the result is discarded ---*/
+  
+#pragma GCC unroll 1
+  for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++) {
+    Area[iLane] = sqrt(Area[iLane]);
+    dist_ij_2_safe[iLane] = (dist_ij_2[iLane] != 0.0) ? dist_ij_2[iLane] : 1.0;
+    Edge_Flag[iLane] = (dist_ij_2[iLane] != 0.0) ? 1.0 : 0.0;
+  }
+  
+  for (iDim = 0; iDim < nDim; iDim++)
+#pragma GCC unroll 1
+    for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++)
+      UnitNormal[iDim][iLane] = Normal[iDim][iLane]/Area[iLane];
+  
+  /*--- Mean primitive variables, viscosities and turbulent kinetic energy ---*/
+  
+  for (iVar = 0; iVar < nDim+3; iVar++)
+#pragma GCC unroll 1
+    for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++)
+      Mean_PrimVar[iVar][iLane] = 0.5*(V_i[iVar][iLane]+V_j[iVar][iLane]);
+  
+#pragma GCC unroll 1
+  for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++) {
+    Mean_Laminar_Viscosity[iLane] = 0.5*(V_i[nDim+5][iLane] + V_j[nDim+5][iLane]);
+    Mean_Eddy_Viscosity[iLane]    = 0.5*(V_i[nDim+6][iLane] + V_j[nDim+6][iLane]);
+    Mean_turb_ke[iLane]           = 0.5*(turb_ke[0][iLane] + turb_ke[1][iLane]);
+  }
+  
+  /*--- Mean gradient, corrected with the projection in the direction of the edge ---*/
+  
+  for (iVar = 0; iVar < nDim+1; iVar++) {
+#pragma GCC unroll 1
+    for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++)
+      Proj_Mean_GradPrimVar_Edge[iLane] = 0.0;
+    for (iDim = 0; iDim < nDim; iDim++)
+#pragma GCC unroll 1
+      for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++) {
+        Mean_GradPrimVar[iVar][iDim][iLane] = 0.5*(PrimVar_Grad_i[iVar*nDim+iDim][iLane] + PrimVar_Grad_j[iVar*nDim+iDim][iLane]);
+        Proj_Mean_GradPrimVar_Edge[iLane] += Mean_GradPrimVar[iVar][iDim][iLane]*Edge_Vector[iDim][iLane];
+      }
+    for (iDim = 0; iDim < nDim; iDim++)
+#pragma GCC unroll 1
+      for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++)
+        Mean_GradPrimVar[iVar][iDim][iLane] -= Edge_Flag[iLane]*(Proj_Mean_GradPrimVar_Edge[iLane] -
+        (V_j[iVar][iLane]-V_i[iVar][iLane]))*Edge_Vector[iDim][iLane] / dist_ij_2_safe[iLane];
+  }
+  
+  /*--- Projected flux tensor, and implicit part ---*/
+  
+  GetViscousProjFlux_Batch<nDim>(Mean_PrimVar, Mean_GradPrimVar, Mean_turb_ke, Normal, Mean_Laminar_Viscosity,
+                                 Mean_Eddy_Viscosity, Gamma, Gamma_Minus_One, Gas_Constant, Prandtl_Lam,
+                                 Prandtl_Turb, Residual);
+  
+  if (implicit) {
+    
+#pragma GCC unroll 1
+    for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++)
+      dist_ij[iLane] = sqrt(dist_ij_2_safe[iLane]);
+    
+    GetViscousProjJacs_Batch<nDim>(Mean_PrimVar, Mean_Laminar_Viscosity, Mean_Eddy_Viscosity, dist_ij,
+                                   UnitNormal, Area, Residual, Gamma, Prandtl_Lam, Prandtl_Turb,
+                                   Jacobian_i, Jacobian_j);
+    
+    for (iVar = 0; iVar < nVar*nVar; iVar++)
+#pragma GCC unroll 1
+      for (iLane = 0; iLane < EDGE_BATCH_SIZE; iLane++) {
+        Jacobian_i[iVar][iLane] = (dist_ij_2[iLane] != 0.0) ? Jacobian_i[iVar][iLane] : 0.0;
+        Jacobian_j[iVar][iLane] = (dist_ij_2[iLane] != 0.0) ? Jacobian_j[iVar][iLane] : 0.0;
+      }
+    
+  }
+  
+}
+
+void CAvgGradCorrected_Flow::SetBatch_Lane(unsigned short val_lane) {
+  
+  unsigned short iPrim, iVar, iDim;
+  
+  for (iPrim = 0; iPrim < nDim+7; iPrim++) {
+    Batch_V_i[iPrim][val_lane] = V_i[iPrim];
+    Batch_V_j[iPrim][val_lane] = V_j[iPrim];
+  }
+  for (iDim = 0; iDim < nDim; iDim++) {
+    Batch_Normal[iDim][val_lane] = Normal[iDim];
+    Batch_Coord_i[iDim][val_lane] = Coord_i[iDim];
+    Batch_Coord_j[iDim][val_lane] = Coord_j[iDim];
+  }
+  for (iVar = 0; iVar < nDim+1; iVar++)
+    for (iDim = 0; iDim < nDim; iDim++) {
+      Batch_PrimVar_Grad_i[iVar*nDim+iDim][val_lane] = PrimVar_Grad_i[iVar][iDim];
+      Batch_PrimVar_Grad_j[iVar*nDim+iDim][val_lane] = PrimVar_Grad_j[iVar][iDim];
+    }
+  Batch_turb_ke[0][val_lane] = turb_ke_i;
+  Batch_turb_ke[1][val_lane] = turb_ke_j;
+  
+}
+
+void CAvgGradCorrected_Flow::ComputeResidual_Batch(unsigned short val_nLane, double (*val_residual)[EDGE_BATCH_SIZE],
+                                                   double (*val_Jacobian_i)[EDGE_BATCH_SIZE], double (*val_Jacobian_j)[EDGE_BATCH_SIZE],
+                                                   CConfig *config) {
+  
+  SetBatch_Padding(Batch_V_i, nDim+7, val_nLane);        SetBatch_Padding(Batch_V_j, nDim+7, val_nLane);
+  SetBatch_Padding(Batch_Normal, nDim, val_nLane);
+  SetBatch_Padding(Batch_Coord_i, nDim, val_nLane);      SetBatch_Padding(Batch_Coord_j, nDim, val_nLane);
+  SetBatch_Padding(Batch_PrimVar_Grad_i, (nDim+1)*nDim, val_nLane);
+  SetBatch_Padding(Batch_PrimVar_Grad_j, (nDim+1)*nDim, val_nLane);
+  SetBatch_Padding(Batch_turb_ke, 2, val_nLane);
+  
+  if (nDim == 2)
+    ComputeResidual_Batch_AvgGradCorrected<2>(Batch_V_i, Batch_V_j, Batch_Normal, Batch_Coord_i, Batch_Coord_j,
+                                              Batch_PrimVar_Grad_i, Batch_PrimVar_Grad_j, Batch_turb_ke, Gamma,
+                                              Gamma_Minus_One, Gas_Constant, Prandtl_Lam, Prandtl_Turb, implicit,
+                                              val_residual, val_Jacobian_i, val_Jacobian_j);
+  else
+    ComputeResidual_Batch_AvgGradCorrected<3>(Batch_V_i, Batch_V_j, Batch_Normal, Batch_Coord_i, Batch_Coord_j,
+                                              Batch_PrimVar_Grad_i, Batch_PrimVar_Grad_j, Batch_turb_ke, Gamma,
+                                              Gamma_Minus_One, Gas_Constant, Prandtl_Lam, Prandtl_Turb, implicit,
+                                              val_residual, val_Jacobian_i, val_Jacobian_j);
+  
+}
+
 CAvgGradCorrectedArtComp_Flow::CAvgGradCorrectedArtComp_Flow(unsigned short val_nDim, unsigned short val_nVar, CConfig *config) : CNumerics(val_nDim, val_nVar, config) {
   
   implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
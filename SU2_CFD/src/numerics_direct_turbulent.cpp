@@ -1021,6 +1021,30 @@ CSourcePieceWise_TurbML::CSourcePieceWise_TurbML(unsigned short val_nDim, unsign
   CScalePredictor* Pred = new CScalePredictor(readFile);
   this->MLModel = Pred;
   cout << "ML File successfully read " << endl;
+  
+  /* Work arrays of the network evaluation */
+  if ((MLModel->Pred != NULL) && (MLModel->Pred->OutputDim() > int(MAX_ML_OUTPUTS))){
+    cout << "The ML turbulence model has more than " << MAX_ML_OUTPUTS << " outputs." << endl;
+    exit(EXIT_FAILURE);
+  }
+  netInput = new double[MAX_ML_INPUTS];
+  netOutput = new double[MAX_ML_OUTPUTS];
+  PredictedOutput = NULL;
+  
+  /* Spalart-Allmaras terms of a block of points: the four residuals, the
+   Jacobian, the corrected vorticity of the inputs and the five other outputs */
+  nSACache = 11;
+  SACache = new double[ML_BATCH_SIZE*nSACache];
+  iSACache = -1;
+  
+  /* The rational approximation of tanh is requested as an extra option */
+  unsigned short nStrings = config->GetNumML_Turb_Model_Extra();
+  string *extraString = config->GetML_Turb_Model_Extra();
+  for (int i = 0; i < nStrings; i++){
+    if ((extraString[i].compare("FastTanh") == 0) && (MLModel->Pred != NULL)){
+      MLModel->SetFastActivation(true);
+    }
+  }
 }
 
 CSourcePieceWise_TurbML::~CSourcePieceWise_TurbML(void) {
@@ -1045,9 +1069,12 @@ CSourcePieceWise_TurbML::~CSourcePieceWise_TurbML(void) {
   delete DNuhatDXj;
   
   delete SANondimInputs;
+  delete [] netInput;
+  delete [] netOutput;
+  delete [] SACache;
 }
 
-void CSourcePieceWise_TurbML::ComputeResidual(double *val_residual, double **val_Jacobian_i, double **val_Jacobian_j, CConfig *config) {
+void CSourcePieceWise_TurbML::SetSAResidual(void) {
   if (incompressible) {
     Density_i = V_i[nDim+1];
     Laminar_Viscosity_i = V_i[nDim+3];
@@ -1069,9 +1096,6 @@ void CSourcePieceWise_TurbML::ComputeResidual(double *val_residual, double **val
     NondimResidualDiff[i] = 0;
   }
   
-  val_residual[0] = 0.0;
-  val_Jacobian_i[0][0] = 0.0;
-  
   NuhatGradNorm = 0;
   for (int i =0; i < nDim; i++){
     for (int j=0; j < nDim; j++){
@@ -1084,7 +1108,22 @@ void CSourcePieceWise_TurbML::ComputeResidual(double *val_residual, double **val
   /* Call Spalart-Allmaras (for comparison) */
   SAInputs->Set(DUiDXj, DNuhatDXj, rotating_frame, transition, dist_i, Laminar_Viscosity_i, Density_i, TurbVar_i[0], intermittency);
   
-  SpalartAllmarasSourceTerm(SAInputs, SAConstants,SAResidual, SAJacobian, SAOtherOutputs);
+  if (iSACache < 0){
+    SpalartAllmarasSourceTerm(SAInputs, SAConstants,SAResidual, SAJacobian, SAOtherOutputs);
+  }else{
+    // The terms were computed with the network inputs of the block
+    double *cache = &SACache[iSACache*nSACache];
+    for (int i = 0; i < nResidual; i++){
+      SAResidual[i] = cache[i];
+    }
+    SAJacobian[0] = cache[4];
+    SAInputs->Omega = cache[5];
+    SAOtherOutputs->fw = cache[6];
+    SAOtherOutputs->mul_production = cache[7];
+    SAOtherOutputs->mul_destruction = cache[8];
+    SAOtherOutputs->mul_crossproduction = cache[9];
+    SAOtherOutputs->Omega = cache[10];
+  }
   this->SANondimInputs -> Set(SAInputs);
 
   for (int i=0; i < nResidual; i++){
@@ -1092,99 +1131,136 @@ void CSourcePieceWise_TurbML::ComputeResidual(double *val_residual, double **val
   }
   SANondimInputs->NondimensionalizeSource(nResidual, SANondimResidual);
   
-  
   fw = SAOtherOutputs->fw;
-  
-  // Need the individual terms of the NuHat Norm
-  double dNuHatDXBar = DNuhatDXj[0] / sqrt(SANondimInputs->SourceNondim);
-  double dNuHatDYBar = DNuhatDXj[1] / sqrt(SANondimInputs->SourceNondim);
-  double dUDXBar = DUiDXj[0][0] / SANondimInputs->OmegaNondim;
-  double dVDXBar = DUiDXj[1][0] / SANondimInputs->OmegaNondim;
-  double dUDYBar = DUiDXj[0][1] / SANondimInputs->OmegaNondim;
-  double dVDYBar = DUiDXj[1][1] / SANondimInputs->OmegaNondim;
-  double Turbulent_Kinematic_Viscosity = TurbVar_i[0];
-//  double Laminar_Kinematic_Viscosity = Laminar_Viscosity_i / Density_i;
+}
+
+int CSourcePieceWise_TurbML::SetFeatures(void) {
   
   int nInputMLVariables = 0;
-  int nOutputMLVariables = 0;
-  double* netInput = NULL;
-  double* netOutput = NULL;
   
   if (featureset.compare("SA") == 0){
-    // Set the output equal to the spalart allmaras output.
-    for (int i = 0; i < nResidual; i++){
-      Residual[i] = SAResidual[i];
-      NondimResidual[i] = SANondimResidual[i];
-    }
-  }else if (featureset.compare("nondim_production")==0){
+    nInputMLVariables = 0;
+  }else if ((featureset.compare("nondim_production")==0) ||
+            (featureset.compare("nondim_destruction")==0) ||
+            (featureset.compare("fw")==0) ||
+            (featureset.compare("mul_destruction")==0) ||
+            (featureset.compare("mul_production")==0)){
     nInputMLVariables = 2;
-    nOutputMLVariables = 1;
-    netInput = new double[nInputMLVariables];
-    netOutput = new double[nOutputMLVariables];
-    
     netInput[0] = SANondimInputs->Chi;
     netInput[1] = SANondimInputs->OmegaBar;
-    
-    // Predict using Nnet
-    MLModel->Predict(netInput, netOutput);
-
-    // Gather all the appropriate variables
-    NondimResidual[0] = netOutput[0];
-    NondimResidual[1] = SANondimResidual[1];
-    NondimResidual[2] = SANondimResidual[2];
-    NondimResidual[3] = NondimResidual[0] - NondimResidual[1] + NondimResidual[2];
-    
-    for (int i=0; i < nResidual; i++){
-      Residual[i] = NondimResidual[i];
-      //cout << "NondimResidual " << i <<" "<< NondimResidual[i] << endl;
-    }
-    SANondimInputs->DimensionalizeSource(nResidual, Residual);
-    /*
-    for (int i=0; i < nResidual; i++){
-      cout << "DimResidual " << i << " " << Residual[i] << endl;
-    }
-     */
   }else if(featureset.compare("nondim_production_log") == 0){
     nInputMLVariables = 2;
-    nOutputMLVariables = 1;
-    netInput = new double[nInputMLVariables];
-    netOutput = new double[nOutputMLVariables];
-    
     netInput[0] = log10(SANondimInputs->Chi);
     netInput[1] = log10(SANondimInputs->OmegaBar);
-    
-    // Predict using Nnet
-    MLModel->Predict(netInput, netOutput);
-    
-    // Gather all the appropriate variables
-    NondimResidual[0] = netOutput[0];
-    NondimResidual[1] = SANondimResidual[1];
-    NondimResidual[2] = SANondimResidual[2];
-    NondimResidual[3] = NondimResidual[0] - NondimResidual[1] + NondimResidual[2];
-    
-    for (int i=0; i < nResidual; i++){
-      Residual[i] = NondimResidual[i];
-//      cout << "NondimResidual " << i << NondimResidual[i] << endl;
-    }
-    
-    SANondimInputs->DimensionalizeSource(nResidual, Residual);
-  /*
-    for (int i=0; i < nResidual; i++){
-      cout << "DimResidual " << i << Residual[i] << endl;
-    }
-   */
   }else if(featureset.compare("nondim_production_logchi") == 0){
     nInputMLVariables = 2;
-    nOutputMLVariables = 1;
-    netInput = new double[nInputMLVariables];
-    netOutput = new double[nOutputMLVariables];
-    
     netInput[0] = log10(SANondimInputs->Chi);
     netInput[1] = SANondimInputs->OmegaBar;
-    
-    // Predict using Nnet
-    MLModel->Predict(netInput, netOutput);
-    
+  }else if((featureset.compare("production")==0) ||
+           (featureset.compare("destruction")==0)){
+    nInputMLVariables = 3;
+    netInput[0] = SANondimInputs->SourceNondim;
+    netInput[1] = SANondimInputs->Chi;
+    netInput[2] = SANondimInputs->OmegaBar;
+  }else if (featureset.compare("nondim_crossproduction")==0){
+    nInputMLVariables = 2;
+    netInput[0] = SANondimInputs->Chi;
+    netInput[1] = SANondimInputs->NuHatGradNormBar;
+  }else if(featureset.compare("cross_production")==0){
+    nInputMLVariables = 3;
+    netInput[0] = SANondimInputs->SourceNondim;
+    netInput[1] = SANondimInputs->Chi;
+    netInput[2] = SANondimInputs->NuHatGradNormBar;
+  }else if (featureset.compare("nondim_source")==0){
+    nInputMLVariables = 3;
+    netInput[0] = SANondimInputs->Chi;
+    netInput[1] = SANondimInputs->OmegaBar;
+    netInput[2] = SANondimInputs->NuHatGradNormBar;
+  }else if(featureset.compare("source")==0){
+    nInputMLVariables = 4;
+    netInput[0] = SANondimInputs->SourceNondim;
+    netInput[1] = SANondimInputs->Chi;
+    netInput[2] = SANondimInputs->OmegaBar;
+    netInput[3] = SANondimInputs->NuHatGradNormBar;
+  }else if(featureset.compare("source_all")==0){
+    // Need the individual terms of the NuHat Norm
+    nInputMLVariables = 8;
+    netInput[0] = SANondimInputs->SourceNondim;
+    netInput[1] = SANondimInputs->Chi;
+    netInput[2] = DNuhatDXj[0] / sqrt(SANondimInputs->SourceNondim);
+    netInput[3] = DNuhatDXj[1] / sqrt(SANondimInputs->SourceNondim);
+    netInput[4] = DUiDXj[0][0] / SANondimInputs->OmegaNondim;
+    netInput[5] = DUiDXj[0][1] / SANondimInputs->OmegaNondim;
+    netInput[6] = DUiDXj[1][0] / SANondimInputs->OmegaNondim;
+    netInput[7] = DUiDXj[1][1] / SANondimInputs->OmegaNondim;
+  }else if (featureset.compare("fw_hifi")==0){
+    throw("doesn't work");
+  }else if (featureset.compare("fw_hifi_2")==0){
+    nInputMLVariables = 2;
+    // Karthik nondimensionalizes by d / vhat whereas I do by /(v + vhat)
+    netInput[0] = SANondimInputs->Chi;
+    netInput[1] = SANondimInputs->OmegaBar * (1 + 1/SANondimInputs->Chi);
+  }else{
+    cout << "None of the conditions met" << endl;
+    cout << "featureset is " << featureset << endl;
+    throw "ML_Turb_Model_Nondimensionalization not recognized";
+  }
+  
+  return nInputMLVariables;
+}
+
+int CSourcePieceWise_TurbML::SetNetInput(double *val_netinput, unsigned long val_iPoint_Block) {
+  iSACache = -1;
+  SetSAResidual();
+  
+  // Keep the Spalart-Allmaras terms, ComputeResidual does not evaluate them again
+  double *cache = &SACache[val_iPoint_Block*nSACache];
+  for (int i = 0; i < nResidual; i++){
+    cache[i] = SAResidual[i];
+  }
+  cache[4] = SAJacobian[0];
+  cache[5] = SAInputs->Omega;
+  cache[6] = SAOtherOutputs->fw;
+  cache[7] = SAOtherOutputs->mul_production;
+  cache[8] = SAOtherOutputs->mul_destruction;
+  cache[9] = SAOtherOutputs->mul_crossproduction;
+  cache[10] = SAOtherOutputs->Omega;
+  
+  int nInputMLVariables = SetFeatures();
+  for (int i = 0; i < nInputMLVariables; i++){
+    val_netinput[i] = netInput[i];
+  }
+  return nInputMLVariables;
+}
+
+void CSourcePieceWise_TurbML::ComputeResidual(double *val_residual, double **val_Jacobian_i, double **val_Jacobian_j, CConfig *config) {
+  
+  val_residual[0] = 0.0;
+  val_Jacobian_i[0][0] = 0.0;
+  
+  SetSAResidual();
+  
+  double Turbulent_Kinematic_Viscosity = TurbVar_i[0];
+  
+  /* Evaluate the model, unless the solver already did it for a block of points */
+  int nInputMLVariables = SetFeatures();
+  if (nInputMLVariables > 0){
+    if (PredictedOutput != NULL){
+      netOutput[0] = PredictedOutput[0];
+    }else{
+      MLModel->Predict(netInput, netOutput);
+    }
+  }
+  
+  if (featureset.compare("SA") == 0){
+    // Set the output equal to the spalart allmaras output.
+    for (int i = 0; i < nResidual; i++){
+      Residual[i] = SAResidual[i];
+      NondimResidual[i] = SANondimResidual[i];
+    }
+  }else if ((featureset.compare("nondim_production")==0) ||
+            (featureset.compare("nondim_production_log")==0) ||
+            (featureset.compare("nondim_production_logchi")==0)){
     // Gather all the appropriate variables
     NondimResidual[0] = netOutput[0];
     NondimResidual[1] = SANondimResidual[1];
@@ -1196,33 +1272,11 @@ void CSourcePieceWise_TurbML::ComputeResidual(double *val_residual, double **val
     }
     SANondimInputs->DimensionalizeSource(nResidual, Residual);
   }else if(featureset.compare("production")==0){
-//    cout <<"In production" << endl;
-    nInputMLVariables = 3;
-    nOutputMLVariables = 1;
-    netInput = new double[nInputMLVariables];
-    netOutput = new double[nOutputMLVariables];
-    
-    netInput[0] = SANondimInputs->SourceNondim;
-    netInput[1] = SANondimInputs->Chi;
-    netInput[2] = SANondimInputs->OmegaBar;
-    
-//    cout << "Net inputs ";
-//    for (int i = 0; i < 3; i++){
-//      cout << "\t" << netInput[i];
-//    }
-//    cout << endl;
-    
-    // Predict using Nnet
-    MLModel->Predict(netInput, netOutput);
-    
     // Gather the appropriate values
     Residual[0] = netOutput[0];
     Residual[1] = SAResidual[1];
     Residual[2] = SAResidual[2];
     Residual[3] = Residual[0] - Residual[1] + Residual[2];
-
-//    cout << "ML Production " << Residual[0] << endl;
-//    cout << "SA Production " << SAResidual[0] << endl;
     
     for (int i=0; i < nResidual; i++){
       NondimResidual[i] = Residual[i];
@@ -1230,17 +1284,6 @@ void CSourcePieceWise_TurbML::ComputeResidual(double *val_residual, double **val
     SANondimInputs->NondimensionalizeSource(nResidual, NondimResidual);
     
   }else if (featureset.compare("nondim_destruction")==0){
-    nInputMLVariables = 2;
-    nOutputMLVariables = 1;
-    
-    netInput = new double[nInputMLVariables];
-    netOutput = new double[nOutputMLVariables];
-    
-    netInput[0] = SANondimInputs->Chi;
-    netInput[1] = SANondimInputs->OmegaBar;
-    
-    MLModel->Predict(netInput, netOutput);
-    
     NondimResidual[0] = SANondimResidual[0];
     NondimResidual[1] = netOutput[0];
     NondimResidual[2] = SANondimResidual[2];
@@ -1251,43 +1294,17 @@ void CSourcePieceWise_TurbML::ComputeResidual(double *val_residual, double **val
     }
     SANondimInputs->DimensionalizeSource(nResidual, Residual);
   }else if(featureset.compare("destruction")==0){
-      nInputMLVariables = 3;
-      nOutputMLVariables = 1;
-      netInput = new double[nInputMLVariables];
-      netOutput = new double[nOutputMLVariables];
+    // Gather the appropriate values
+    Residual[0] = SAResidual[0];
+    Residual[1] = netOutput[0];
+    Residual[2] = SAResidual[2];
+    Residual[3] = Residual[0] - Residual[1] + Residual[2];
     
-      netInput[0] = SANondimInputs->SourceNondim;
-      netInput[1] = SANondimInputs->Chi;
-      netInput[2] = SANondimInputs->OmegaBar;
-      
-      // Predict using Nnet
-      MLModel->Predict(netInput, netOutput);
-      
-      // Gather the appropriate values
-      Residual[0] = SAResidual[0];
-      Residual[1] = netOutput[0];
-      Residual[2] = SAResidual[2];
-      Residual[3] = Residual[0] - Residual[1] + Residual[2];
-      
-      for (int i=0; i < nResidual; i++){
-        NondimResidual[i] = Residual[i];
-      }
-      SANondimInputs->NondimensionalizeSource(nResidual, NondimResidual);
+    for (int i=0; i < nResidual; i++){
+      NondimResidual[i] = Residual[i];
+    }
+    SANondimInputs->NondimensionalizeSource(nResidual, NondimResidual);
   }else if (featureset.compare("nondim_crossproduction")==0){
-    nInputMLVariables = 2;
-    nOutputMLVariables = 1;
-    netInput = new double[nInputMLVariables];
-    netOutput = new double[nOutputMLVariables];
-    
-    netInput[0] = SANondimInputs->Chi;
-    netInput[1] = SANondimInputs->NuHatGradNormBar;
-    
-    //cout << "IN nondim_crossproduction " << endl;
-    //  cout << "chi " << netInput[0] <<  endl;
-    //    cout << "grad norm bar "<< netInput[1] << endl;
-    
-    MLModel->Predict(netInput, netOutput);
-    
     NondimResidual[0] = SANondimResidual[0];
     NondimResidual[1] = SANondimResidual[1];
     NondimResidual[2] = netOutput[0];
@@ -1298,18 +1315,6 @@ void CSourcePieceWise_TurbML::ComputeResidual(double *val_residual, double **val
     }
     SANondimInputs->DimensionalizeSource(nResidual, Residual);
   }else if(featureset.compare("cross_production")==0){
-    nInputMLVariables = 3;
-    nOutputMLVariables = 1;
-    netInput = new double[nInputMLVariables];
-    netOutput = new double[nOutputMLVariables];
-    
-    netInput[0] = SANondimInputs->SourceNondim;
-    netInput[1] = SANondimInputs->Chi;
-    netInput[2] = SANondimInputs->NuHatGradNormBar;
-    
-    // Predict using Nnet
-    MLModel->Predict(netInput, netOutput);
-    
     // Gather the appropriate values
     Residual[0] = SAResidual[0];
     Residual[1] = SAResidual[1];
@@ -1321,18 +1326,6 @@ void CSourcePieceWise_TurbML::ComputeResidual(double *val_residual, double **val
     }
     SANondimInputs->NondimensionalizeSource(nResidual, NondimResidual);
   }else if (featureset.compare("nondim_source")==0){
-    nInputMLVariables = 3;
-    nOutputMLVariables = 1;
-    netInput = new double[nInputMLVariables];
-    netOutput = new double[nOutputMLVariables];
-    
-    netInput[0] = SANondimInputs->Chi;
-    netInput[1] = SANondimInputs->OmegaBar;
-    netInput[2] = SANondimInputs->NuHatGradNormBar;
-  
-    // Predict using Nnet
-    MLModel->Predict(netInput, netOutput);
-    
     NondimResidual[0] = 0;
     NondimResidual[1] = 0;
     NondimResidual[2] = 0;
@@ -1342,21 +1335,8 @@ void CSourcePieceWise_TurbML::ComputeResidual(double *val_residual, double **val
       Residual[i] = NondimResidual[i];
     }
     SANondimInputs->DimensionalizeSource(nResidual, Residual);
-  }else if(featureset.compare("source")==0){
-    nInputMLVariables =4;
-    nOutputMLVariables = 1;
-    netInput = new double[nInputMLVariables];
-    netOutput = new double[nOutputMLVariables];
-    
-    netInput[0] = SANondimInputs->SourceNondim;
-    netInput[1] = SANondimInputs->Chi;
-    netInput[2] = SANondimInputs->OmegaBar;
-    netInput[3] = SANondimInputs->NuHatGradNormBar;
-    
-    
-    // Predict using Nnet
-    MLModel->Predict(netInput, netOutput);
-    
+  }else if((featureset.compare("source")==0) ||
+           (featureset.compare("source_all")==0)){
     // Gather the appropriate values
     Residual[0] = 0;
     Residual[1] = 0;
@@ -1367,92 +1347,8 @@ void CSourcePieceWise_TurbML::ComputeResidual(double *val_residual, double **val
       NondimResidual[i] = Residual[i];
     }
     SANondimInputs->NondimensionalizeSource(nResidual, NondimResidual);
-  }else if(featureset.compare("source_all")==0){
-    nInputMLVariables = 8;
-    nOutputMLVariables = 1;
-    netInput = new double[nInputMLVariables];
-    netOutput = new double[nOutputMLVariables];
-    
-    netInput[0] = SANondimInputs->SourceNondim;
-    netInput[1] = SANondimInputs->Chi;
-    netInput[2] = dNuHatDXBar;
-    netInput[3] = dNuHatDYBar;
-    netInput[4] = dUDXBar;
-    netInput[5] = dUDYBar;
-    netInput[6] = dVDXBar;
-    netInput[7] = dVDYBar;
-    
-    // Predict using Nnet
-    MLModel->Predict(netInput, netOutput);
-    
-    // Gather the appropriate values
-    Residual[0] = 0;
-    Residual[1] = 0;
-    Residual[2] = 0;
-    Residual[3] = netOutput[0];
-    
-    for (int i=0; i < nResidual; i++){
-      NondimResidual[i] = Residual[i];
-    }
-    SANondimInputs->NondimensionalizeSource(nResidual, NondimResidual);
-    
-  }else if (featureset.compare("fw_hifi")==0){
-    throw("doesn't work");
-    nInputMLVariables = 2;
-    nOutputMLVariables = 1;
-    netInput = new double[nInputMLVariables];
-    netOutput = new double[nOutputMLVariables];
-    
-    double chi = SANondimInputs->Chi;
-    double omegaBar = SANondimInputs->OmegaBar;
-    // Karthik nondimensionalizes by d / vhat whereas I do by /(v + vhat)
-    omegaBar *= 1 + 1/chi;
-    
-    netInput[0] = chi;
-    netInput[1] = omegaBar;
-    
-    MLModel->Predict(netInput, netOutput);
-    
-    double safw = SAOtherOutputs->fw;
-    double newfw = netOutput[0];
-    if (newfw < -1){
-      newfw = 1;
-    }
-    if (newfw > 6){
-      newfw = 6;
-    }
-    // The output is the value of fw. Need to replace the destruction term with the new computation
-    double turbKinVisc = SAInputs->Turbulent_Kinematic_Viscosity;
-    double dist2 = SAInputs->dist * SAInputs->dist;
-    double newdestruction = SAConstants->cw1 * (newfw +safw) * turbKinVisc * turbKinVisc / dist2;
-    
-    for (int i= 0; i < nResidual; i++){
-      Residual[i] = SAResidual[i];
-    }
-    Residual[1] = newdestruction;
-    Residual[3] = Residual[0] - Residual[1] + Residual[2];
-    
-    for (int i= 0; i < nResidual; i++){
-      NondimResidual[i] = Residual[i];
-    }
-    SANondimInputs->NondimensionalizeSource(nResidual, NondimResidual);
     
   }else if (featureset.compare("fw_hifi_2")==0){
-    nInputMLVariables = 2;
-    nOutputMLVariables = 1;
-    netInput = new double[nInputMLVariables];
-    netOutput = new double[nOutputMLVariables];
-    
-    double chi = SANondimInputs->Chi;
-    double omegaBar = SANondimInputs->OmegaBar;
-    // Karthik nondimensionalizes by d / vhat whereas I do by /(v + vhat)
-    omegaBar *= 1 + 1/chi;
-    
-    netInput[0] = chi;
-    netInput[1] = omegaBar;
-    
-    MLModel->Predict(netInput, netOutput);
-    
     double safw = SAOtherOutputs->fw;
     double newfw = netOutput[0];
     // The output is the value of fw. Need to replace the destruction term with the new computation
@@ -1472,16 +1368,6 @@ void CSourcePieceWise_TurbML::ComputeResidual(double *val_residual, double **val
     SANondimInputs->NondimensionalizeSource(nResidual, NondimResidual);
     
   }else if(featureset.compare("fw") == 0){
-    nInputMLVariables = 2;
-    nOutputMLVariables = 1;
-    netInput = new double[nInputMLVariables];
-    netOutput = new double[nOutputMLVariables];
-    double chi = SANondimInputs->Chi;
-    double omegaBar = SANondimInputs->OmegaBar;
-    netInput[0] = chi;
-    netInput[1] = omegaBar;
-    MLModel->Predict(netInput, netOutput);
-    
     // The output is fw. Replicate the destruction term.
     double fw_ml = netOutput[0];
     double mul_dest = SAConstants->cw1 * fw_ml;
@@ -1494,16 +1380,6 @@ void CSourcePieceWise_TurbML::ComputeResidual(double *val_residual, double **val
     }
     SANondimInputs->NondimensionalizeSource(nResidual, NondimResidual);
   }else if(featureset.compare("mul_destruction") == 0){
-    nInputMLVariables = 2;
-    nOutputMLVariables = 1;
-    netInput = new double[nInputMLVariables];
-    netOutput = new double[nOutputMLVariables];
-    double chi = SANondimInputs->Chi;
-    double omegaBar = SANondimInputs->OmegaBar;
-    netInput[0] = chi;
-    netInput[1] = omegaBar;
-    MLModel->Predict(netInput, netOutput);
-    
     // The output is a multiplier to the destruction term. Replicate the
     // destruction term
     double mul_dest = netOutput[0];
@@ -1516,15 +1392,6 @@ void CSourcePieceWise_TurbML::ComputeResidual(double *val_residual, double **val
     }
     SANondimInputs->NondimensionalizeSource(nResidual, NondimResidual);
   }else if(featureset.compare("mul_production")==0){
-    nInputMLVariables = 2;
-    nOutputMLVariables = 1;
-    netInput = new double[nInputMLVariables];
-    netOutput = new double[nOutputMLVariables];
-    double chi = SANondimInputs->Chi;
-    double omegaBar = SANondimInputs->OmegaBar;
-    netInput[0] = chi;
-    netInput[1] = omegaBar;
-    MLModel->Predict(netInput, netOutput);
     // The output is a multiplier to the destruction term. Replicate the
     // production term
     double mul_prod = netOutput[0];
@@ -1537,13 +1404,7 @@ void CSourcePieceWise_TurbML::ComputeResidual(double *val_residual, double **val
     }
     SANondimInputs->NondimensionalizeSource(nResidual, NondimResidual);
     
-  }else{
-    cout << "None of the conditions met" << endl;
-    cout << "featureset is " << featureset << endl;
-    throw "ML_Turb_Model_Nondimensionalization not recognized";
   }
-  delete [] netInput;
-  delete [] netOutput;
   
   // Hack if the wall distance is too low
   if (dist_i < 1e-6){
@@ -1627,3 +1488,16 @@ void CSourcePieceWise_TurbML::ComputeResidual(double *val_residual, double **val
 int CSourcePieceWise_TurbML::NumResidual(){
   return this->nResidual;
 }
+
+void CSourcePieceWise_TurbML::SetNetOutput(double *val_netoutput, long val_iPoint_Block){
+  PredictedOutput = val_netoutput;
+  iSACache = val_iPoint_Block;
+}
+
+CScalePredictor* CSourcePieceWise_TurbML::GetMLModel(void){
+  return MLModel;
+}
+
+bool CSourcePieceWise_TurbML::UsesMLModel(void){
+  return (featureset.compare("SA") != 0);
+}
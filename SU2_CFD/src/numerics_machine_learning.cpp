@@ -239,16 +239,32 @@ int CPredictor::OutputDim(){
   return this->outputDim;
 }
 
-CMulPredictor::CMulPredictor(){}
+void CPredictor::PredictBatch(int nBatch, double *inputs, double *outputs){
+  for (int b = 0; b < nBatch; b++){
+    this->Predict(&inputs[b*this->inputDim], &outputs[b*this->outputDim]);
+  }
+  return;
+}
+
+CMulPredictor::CMulPredictor(){
+  this->Inner = NULL;
+  this->innerInputs = NULL;
+  this->nInnerInputs = 0;
+}
 #ifdef HAVE_JSONCPP
 CMulPredictor::CMulPredictor(Json::Value json){
   this->Inner = parse_predictor(json["Inner"]);
   this->inputDim = this->Inner->InputDim() + 1;
   this->outputDim = this->Inner->OutputDim();
+  this->innerInputs = NULL;
+  this->nInnerInputs = 0;
 }
 #endif
 
-CMulPredictor::~CMulPredictor(){}
+CMulPredictor::~CMulPredictor(){
+  delete this->Inner;
+  delete [] this->innerInputs;
+}
 
 void CMulPredictor::Predict(double * input, double * output){
   double * secondInput = &input[1];
@@ -259,7 +275,48 @@ void CMulPredictor::Predict(double * input, double * output){
   return;
 }
 
-CNeurNet::CNeurNet(){}
+void CMulPredictor::PredictBatch(int nBatch, double *inputs, double *outputs){
+  int nInner = this->inputDim - 1;
+  
+  // Strip the multiplier so the inner predictor sees contiguous inputs
+  if (this->nInnerInputs < nBatch*nInner){
+    delete [] this->innerInputs;
+    this->nInnerInputs = nBatch*nInner;
+    this->innerInputs = new double[this->nInnerInputs];
+  }
+  for (int b = 0; b < nBatch; b++){
+    for (int i = 0; i < nInner; i++){
+      this->innerInputs[b*nInner + i] = inputs[b*this->inputDim + i + 1];
+    }
+  }
+  
+  this->Inner->PredictBatch(nBatch, this->innerInputs, outputs);
+  
+  for (int b = 0; b < nBatch; b++){
+    for (int i = 0; i < this->outputDim; i++){
+      outputs[b*this->outputDim + i] *= inputs[b*this->inputDim];
+    }
+  }
+  return;
+}
+
+void CMulPredictor::SetFastActivation(bool val_fast){
+  this->Inner->SetFastActivation(val_fast);
+}
+
+CNeurNet::CNeurNet(){
+  this->nLayers = 0;
+  this->maxNeurons = 0;
+  this->nNeuronsInLayer = NULL;
+  this->nInputsToLayer = NULL;
+  this->weights = NULL;
+  this->biases = NULL;
+  this->tanhNeuron = NULL;
+  this->fastTanh = false;
+  this->work1 = NULL;
+  this->work2 = NULL;
+  this->nWork = 0;
+}
 
 #ifdef HAVE_JSONCPP
 CNeurNet::CNeurNet(Json::Value json){
@@ -277,13 +334,16 @@ CNeurNet::CNeurNet(Json::Value json){
   }
   this->nLayers = nLayers;
   
-  // Allocate memory for neuron and parameters by layer
+  // Allocate memory for the dense representation of each layer
   this->nNeuronsInLayer = new int[nLayers];
-  this->nParameters = new int *[nLayers];
-  this->neurons = new CNeuron **[nLayers];
-  this->parameters = new double**[nLayers];
-  
-  // Per layer, get the number of neurons in the layer and then read in the neurons
+  this->nInputsToLayer = new int[nLayers];
+  this->weights = new double*[nLayers];
+  this->biases = new double*[nLayers];
+  this->tanhNeuron = new bool*[nLayers];
+  
+  // Per layer, get the number of neurons in the layer and then read in the
+  // weights and the bias of every neuron. The parameters of a neuron are its
+  // input weights followed by the bias.
   for (int i = 0; i < nLayers; i++){
     Json::Value layer = layers[i];
     Json::Value parameterLayer = parameters[i];
@@ -298,133 +358,172 @@ CNeurNet::CNeurNet(Json::Value json){
         cout << "Size of initial layer is not equal to input dimension" << endl;
       }
     }
-    this->neurons[i] = new CNeuron *[neuronsInLayer];
-    this->nParameters[i] = new int[neuronsInLayer];
-    this->parameters[i] = new double *[neuronsInLayer];
+    int inputsToLayer = (i == 0) ? this->inputDim : this->nNeuronsInLayer[i-1];
+    this->nInputsToLayer[i] = inputsToLayer;
+    this->weights[i] = new double[neuronsInLayer*inputsToLayer];
+    this->biases[i] = new double[neuronsInLayer];
+    this->tanhNeuron[i] = new bool[neuronsInLayer];
     
-    // Loop over all the neurons in the layer and add the parameters and neuron itself
     for (int j = 0; j < neuronsInLayer; j++){
       Json::Value neuron = layer[j];
       
       // get the parameters
       int nParametersInNeuron = parameterLayer[j].size();
-      this->nParameters[i][j] = nParametersInNeuron;
-      this->parameters[i][j] = new double [nParametersInNeuron];
-      for (int k = 0; k < nParametersInNeuron; k++){
-        
-        double val = parameterLayer[j][k].asDouble();
-        this->parameters[i][j][k] = val;
-        /*
-        long *ptrFloatAsInt =(long *)( &val);
-        cout.precision(16);
-        cout << hex;
-        cout << "params: i = " << i << "\tj = " << j << "\tk = " << k << "\tparam = " << *ptrFloatAsInt << endl;
-         */
+      if (nParametersInNeuron != inputsToLayer + 1){
+        cout << "neuron " << j << " of layer " << i << " has " << nParametersInNeuron;
+        cout << " parameters, expected " << inputsToLayer + 1 << endl;
+        exit(EXIT_FAILURE);
+      }
+      for (int k = 0; k < inputsToLayer; k++){
+        this->weights[i][j*inputsToLayer + k] = parameterLayer[j][k].asDouble();
       }
+      this->biases[i][j] = parameterLayer[j][nParametersInNeuron-1].asDouble();
       
-      // get the neurons
+      // get the neuron activation
       string type = neuron["Type"].asString();
-      if (type.compare("github.com/reggo/reggo/supervised/nnet/SumNeuron") == 0){
-        this->neurons[i][j] = new CSumNeuron(neuron["Value"]);
-      }else{
+      if (type.compare("github.com/reggo/reggo/supervised/nnet/SumNeuron") != 0){
         cout << "neuron type unknown: " << type << endl;
+        exit(EXIT_FAILURE);
+      }
+      string activator = neuron["Value"]["Type"].asString();
+      if (activator.compare("github.com/reggo/reggo/supervised/nnet/Tanh") == 0){
+        this->tanhNeuron[i][j] = true;
+      }else if(activator.compare("github.com/reggo/reggo/supervised/nnet/Linear") == 0){
+        this->tanhNeuron[i][j] = false;
+      }else{
+        cout << "Unknown activator type: " << activator << endl;
+        exit(EXIT_FAILURE);
       }
     }
-    // TODO: Should add in extra checking for num parameters and such
   }
   
   // Find the maximum number of neurons
-  this->maxNeurons = 0;
+  this->maxNeurons = this->inputDim;
   for (int i = 0; i < this->nLayers; i++){
     if (this->maxNeurons < this->nNeuronsInLayer[i]){
       this->maxNeurons = this->nNeuronsInLayer[i];
     }
   }
+  
+  this->fastTanh = false;
+  this->work1 = NULL;
+  this->work2 = NULL;
+  this->nWork = 0;
 }
 #endif
 
 CNeurNet::~CNeurNet(){
   
   for (int i = 0; i < this->nLayers; i++){
-    for (int j = 0; j < this->nNeuronsInLayer[i]; j++){
-      delete [] this-> parameters[i][j];
-      delete [] this->neurons[i][j];
-    }
-    delete [] this->nParameters[i];
-    delete [] this->parameters[i];
-    delete [] this->neurons[i];
+    delete [] this->weights[i];
+    delete [] this->biases[i];
+    delete [] this->tanhNeuron[i];
   }
+  delete [] this->weights;
+  delete [] this->biases;
+  delete [] this->tanhNeuron;
   delete [] this->nNeuronsInLayer;
-  delete [] this->neurons;
-  delete [] this->parameters;
-  delete [] this->nParameters;
-}
-
-void CNeurNet::processLayer(double * input, int nInput, CNeuron **neurons, double **parameters, int nNeurons, int * nParameters, double *output){
-  for (int i = 0; i < nNeurons; i++){
-    double combination = neurons[i]->Combine(parameters[i], nParameters[i], input, nInput);
-    output[i] = neurons[i]->Activate(combination);
+  delete [] this->nInputsToLayer;
+  delete [] this->work1;
+  delete [] this->work2;
+}
+
+void CNeurNet::SetFastActivation(bool val_fast){
+  this->fastTanh = val_fast;
+}
+
+/* Rational approximation of tanh on [-7.9, 7.9] (saturated outside),
+ accurate to single precision. It has no branches or library calls, so the
+ loops over the batch that use it can be vectorized. */
+static inline double FastTanh(double x){
+  const double clamp = 7.90531110763549805;
+  x = (x > clamp) ? clamp : x;
+  x = (x < -clamp) ? -clamp : x;
+  double x2 = x * x;
+  double p = -2.76076847742355e-16;
+  p = p * x2 + 2.00018790482477e-13;
+  p = p * x2 - 8.60467152213735e-11;
+  p = p * x2 + 5.12229709037114e-08;
+  p = p * x2 + 1.48572235717979e-05;
+  p = p * x2 + 6.37261928875436e-04;
+  p = p * x2 + 4.89352455891786e-03;
+  p = p * x;
+  double q = 1.19825839466702e-06;
+  q = q * x2 + 1.18534705686654e-04;
+  q = q * x2 + 2.26843463243900e-03;
+  q = q * x2 + 4.89352518554385e-03;
+  return p / q;
+}
+
+/* Dense layer over a batch, output = act(W * input + b). Input and output are
+ stored neuron by neuron (nInputs x nBatch and nNeurons x nBatch), so the
+ innermost loops run over contiguous points of the batch. */
+void CNeurNet::ProcessLayer(int iLayer, int nBatch, double *input, double *output){
+  int nNeurons = this->nNeuronsInLayer[iLayer];
+  int nInputs = this->nInputsToLayer[iLayer];
+  double *W = this->weights[iLayer];
+  
+  for (int j = 0; j < nNeurons; j++){
+    double *out = &output[j*nBatch];
+    for (int b = 0; b < nBatch; b++) out[b] = 0.0;
+    for (int k = 0; k < nInputs; k++){
+      double w = W[j*nInputs + k];
+      double *in = &input[k*nBatch];
+      for (int b = 0; b < nBatch; b++) out[b] += w * in[b];
+    }
+    
+    // Add in the bias term and activate
+    double bias = this->biases[iLayer][j];
+    if (!this->tanhNeuron[iLayer][j]){
+      for (int b = 0; b < nBatch; b++) out[b] += bias;
+    }else if (this->fastTanh){
+      for (int b = 0; b < nBatch; b++) out[b] = 1.7159 * FastTanh(2.0/3.0 * (out[b] + bias));
+    }else{
+      for (int b = 0; b < nBatch; b++) out[b] = 1.7159 * tanh(2.0/3.0 * (out[b] + bias));
+    }
   }
   return;
 }
 
-void CNeurNet::Predict(double * input, double * output){
-  double * prevTmpOutput = new double[this->maxNeurons];
-  double *tmpOutput = new double[this->maxNeurons];
-  
-  int nLayers = this->nLayers;
+void CNeurNet::PredictBatch(int nBatch, double *inputs, double *outputs){
   
-  /*
-  cout << "Input is:" << endl;
-  for (int i=0; i < this->InputDim(); i++){
-    cout << input[i] << endl;
+  if (this->nWork < nBatch){
+    delete [] this->work1;
+    delete [] this->work2;
+    this->nWork = nBatch;
+    this->work1 = new double[this->maxNeurons*nBatch];
+    this->work2 = new double[this->maxNeurons*nBatch];
   }
-  cout << "Done input" << endl;
-   */
   
-  if (nLayers == 1){
-    this->processLayer(input, this->inputDim, this->neurons[0], this->parameters[0], this->nNeuronsInLayer[0], this->nParameters[0], output);
-    return;
+  // Transpose the inputs to the neuron-major layout
+  for (int b = 0; b < nBatch; b++){
+    for (int k = 0; k < this->inputDim; k++){
+      this->work1[k*nBatch + b] = inputs[b*this->inputDim + k];
+    }
   }
   
-  // First layer uses the real input as the input
-  this->processLayer(input, this->inputDim, this->neurons[0], this->parameters[0], this->nNeuronsInLayer[0], this->nParameters[0], tmpOutput);
-  
-  /*
-  cout << "First layer tmp output" << endl;
-  for (int i = 0; i < this->nNeuronsInLayer[0]; i++){
-    cout << tmpOutput[i] << endl;
-    double tmp = tmpOutput[i];
-    long *ptrFloatAsInt =(long *)( &tmp);
-    cout << hex;
-    cout << *ptrFloatAsInt << endl;
-    cout << dec;
-  }
-  cout << "done tmp output" << endl;
-   */
-  
-  // Middle layers use the previous output as input
-  for (int i= 1; i < nLayers -1; i++){
-    double *tmp;
-    tmp = prevTmpOutput;
-    prevTmpOutput = tmpOutput;
-    tmpOutput = tmp;
-    
-    int inputDim = this->nNeuronsInLayer[i-1];
-    processLayer(prevTmpOutput, inputDim, this->neurons[i], this->parameters[i], this->nNeuronsInLayer[i], this->nParameters[i], tmpOutput);
+  // Each layer uses the previous output as input
+  double *layerInput = this->work1, *layerOutput = this->work2, *tmp;
+  for (int i = 0; i < this->nLayers; i++){
+    this->ProcessLayer(i, nBatch, layerInput, layerOutput);
+    tmp = layerInput;
+    layerInput = layerOutput;
+    layerOutput = tmp;
   }
-  int layer = nLayers -1;
-  int inputDim = this->nNeuronsInLayer[nLayers-2];
   
   // Last layer has the actual output
-  processLayer(tmpOutput, inputDim, this->neurons[layer], this->parameters[layer], this->nNeuronsInLayer[layer],this->nParameters[layer], output);
-  
-  // Clean up garbage
-  delete [] prevTmpOutput;
-  delete [] tmpOutput;
+  for (int b = 0; b < nBatch; b++){
+    for (int j = 0; j < this->outputDim; j++){
+      outputs[b*this->outputDim + j] = layerInput[j*nBatch + b];
+    }
+  }
   return;
 }
 
+void CNeurNet::Predict(double * input, double * output){
+  this->PredictBatch(1, input, output);
+}
+
 
 
 // get_file_contents gets all of the file contents and returns them as a string
@@ -448,10 +547,22 @@ string get_file_contents(string filename){
 }
 
 // TODO: Separate filename from parse script. (make a function of a Node)
-CScalePredictor::CScalePredictor(){}
+CScalePredictor::CScalePredictor(){
+  this->Pred = NULL;
+  this->InputScaler = NULL;
+  this->OutputScaler = NULL;
+  this->scaledInputs = NULL;
+  this->nScaledInputs = 0;
+}
 #ifdef HAVE_JSONCPP
 CScalePredictor::CScalePredictor(string filename){
   
+  this->Pred = NULL;
+  this->InputScaler = NULL;
+  this->OutputScaler = NULL;
+  this->scaledInputs = NULL;
+  this->nScaledInputs = 0;
+  
   if (filename.compare("none")==0) {
     return;
   }
@@ -534,18 +645,48 @@ CScalePredictor::~CScalePredictor(){
   delete this->Pred;
   delete this->InputScaler;
   delete this->OutputScaler;
+  delete [] this->scaledInputs;
   return;
 }
+
+double *CScalePredictor::GetScaledInputs(int nBatch){
+  int nInputs = nBatch * this->Pred->InputDim();
+  if (this->nScaledInputs < nInputs){
+    delete [] this->scaledInputs;
+    this->nScaledInputs = nInputs;
+    this->scaledInputs = new double[nInputs];
+  }
+  return this->scaledInputs;
+}
+
 void CScalePredictor::Predict(double *input, double *output){
-  // Scale the input
-  this->InputScaler->Scale(input);
+  this->PredictBatch(1, input, output);
+}
+
+void CScalePredictor::PredictBatch(int nBatch, double *inputs, double *outputs){
+  int inputDim = this->Pred->InputDim();
+  int outputDim = this->Pred->OutputDim();
+  double *scaled = this->GetScaledInputs(nBatch);
+  
+  // Scale a copy of the inputs
+  for (int i = 0; i < nBatch*inputDim; i++){
+    scaled[i] = inputs[i];
+  }
+  for (int b = 0; b < nBatch; b++){
+    this->InputScaler->Scale(&scaled[b*inputDim]);
+  }
   
   // Call the predict method
-  this->Pred->Predict(input, output);
+  this->Pred->PredictBatch(nBatch, scaled, outputs);
   
   // Unscale
-  this->InputScaler->Unscale(input);
-	this->OutputScaler->Unscale(output);
+  for (int b = 0; b < nBatch; b++){
+    this->OutputScaler->Unscale(&outputs[b*outputDim]);
+  }
+}
+
+void CScalePredictor::SetFastActivation(bool val_fast){
+  this->Pred->SetFastActivation(val_fast);
 }
 
 CSANondimInputs::CSANondimInputs(int nDim){
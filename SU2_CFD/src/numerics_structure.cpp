@@ -40,7 +40,8 @@ CNumerics::CNumerics(unsigned short val_nDim, unsigned short val_nVar,
 	UnitNormal = new double [nDim];
 	UnitNormald = new double [nDim];
 
-	Normal = new double [nDim];
+	/*--- The normal is not owned, SetNormal points it to the geometry ---*/
+	Normal = NULL;
 	Flux_Tensor = new double* [nVar];
 	for (iVar = 0; iVar < (nVar); iVar++)
 		Flux_Tensor[iVar] = new double [nDim];
@@ -78,6 +79,7 @@ CNumerics::CNumerics(unsigned short val_nDim, unsigned short val_nVar,
   sumdFdYjh   = NULL;
   sumdFdYieve = NULL;
   sumdFdYjeve = NULL;
+  var         = NULL;
   
   if ((config->GetKind_Solver() == TNE2_EULER)            ||
       (config->GetKind_Solver() == TNE2_NAVIER_STOKES)    ||
@@ -112,8 +114,8 @@ CNumerics::CNumerics(unsigned short val_nDim, unsigned short val_nVar,
 
 CNumerics::~CNumerics(void) {
 
-  delete [] Normal;
 	delete [] UnitNormal;
+	delete [] UnitNormald;
 
 	delete [] U_n;
 	delete [] U_nM1;
@@ -122,7 +124,7 @@ CNumerics::~CNumerics(void) {
 	// visc
 	delete [] Proj_Flux_Tensor;
 
-	for (unsigned short iVar = 0; iVar < nDim+3; iVar++) {
+	for (unsigned short iVar = 0; iVar < nVar; iVar++) {
 		delete [] Flux_Tensor[iVar];
 	}
 	delete [] Flux_Tensor;
@@ -133,18 +135,15 @@ CNumerics::~CNumerics(void) {
 	}
 	delete [] tau;
 	delete [] delta;
-	delete [] Normal;
-	delete [] Enthalpy_formation;
-	delete [] Theta_v;
   if (Ys != NULL) delete [] Ys;
   if (dFdYi != NULL) {
     for (unsigned short iSpecies = 0; iSpecies < nSpecies; iSpecies++)
-      delete dFdYi[iSpecies];
+      delete [] dFdYi[iSpecies];
     delete [] dFdYi;
   }
   if (dFdYj != NULL) {
     for (unsigned short iSpecies = 0; iSpecies < nSpecies; iSpecies++)
-      delete dFdYj[iSpecies];
+      delete [] dFdYj[iSpecies];
     delete [] dFdYj;
   }
   if (sumdFdYih != NULL) delete [] sumdFdYih;
@@ -154,13 +153,10 @@ CNumerics::~CNumerics(void) {
   if (Diffusion_Coeff_i != NULL) delete [] Diffusion_Coeff_i;
   if (Diffusion_Coeff_j != NULL) delete [] Diffusion_Coeff_j;
   if (Vector != NULL) delete [] Vector;
-  if (var != NULL) delete [] var;
-
-	unsigned short iVar;
-	for (iVar = 0; iVar < nVar; iVar++) {
-		delete [] dVdU[iVar];
-	}
-	delete [] dVdU;
+  if (var != NULL) delete var;
+  
+  delete [] l;
+  delete [] m;
 
 }
 
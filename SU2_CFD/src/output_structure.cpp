@@ -446,6 +446,9 @@ void COutput::SetSurfaceCSV_Adjoint(CConfig *config, CGeometry *geometry, CSolve
   SurfAdj_file.precision(15);
   SurfAdj_file.open(cstr, ios::out);
   
+  /*--- The point column uses the global numbering (as SU2_DOT expects),
+   the local one may have been renumbered (Cuthill-McKee) ---*/
+  
   if (geometry->GetnDim() == 2) {
     SurfAdj_file <<  "\"Point\",\"Sensitivity\",\"PsiRho\",\"Phi_x\",\"Phi_y\",\"PsiE\",\"x_coord\",\"y_coord\"" << endl;
     for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
@@ -464,7 +467,7 @@ void COutput::SetSurfaceCSV_Adjoint(CConfig *config, CGeometry *geometry, CSolve
             yCoord *= 12.0;
           }
           
-          SurfAdj_file << scientific << iPoint << ", " << AdjSolver->GetCSensitivity(iMarker,iVertex) << ", " << Solution[0] << ", "
+          SurfAdj_file << scientific << geometry->node[iPoint]->GetGlobalIndex() << ", " << AdjSolver->GetCSensitivity(iMarker,iVertex) << ", " << Solution[0] << ", "
           << Solution[1] << ", " << Solution[2] << ", " << Solution[3] <<", " << xCoord <<", "<< yCoord << endl;
         }
     }
@@ -490,7 +493,7 @@ void COutput::SetSurfaceCSV_Adjoint(CConfig *config, CGeometry *geometry, CSolve
             zCoord *= 12.0;
           }
           
-          SurfAdj_file << scientific << iPoint << ", " << AdjSolver->GetCSensitivity(iMarker,iVertex) << ", " << Solution[0] << ", "
+          SurfAdj_file << scientific << geometry->node[iPoint]->GetGlobalIndex() << ", " << AdjSolver->GetCSensitivity(iMarker,iVertex) << ", " << Solution[0] << ", "
           << Solution[1] << ", " << Solution[2] << ", " << Solution[3] << ", " << Solution[4] << ", "<< xCoord <<", "<< yCoord <<", "<< zCoord << endl;
         }
     }
@@ -2121,6 +2124,7 @@ void COutput::MergeSolution(CConfig *config, CGeometry *geometry, CSolver **solv
   
   unsigned long nTotalPoints = 0;
   int SendRecv, RecvFrom;
+  double Limiter_Load[MAX_PRIMVAR_GRAD];
   
   /*--- First, create a structure to locate any periodic halo nodes ---*/
   int *Local_Halo = new int[geometry->GetnPoint()];
@@ -2240,7 +2244,7 @@ void COutput::MergeSolution(CConfig *config, CGeometry *geometry, CSolver **solv
       /*--- Limiters (first, second and third system of equations) ---*/
       if (config->GetWrt_Limiters()) {
         
-        if (solver[FirstIndex]->node[iPoint]->GetLimiter_Primitive() != NULL) {
+        if (solver[FirstIndex]->node[iPoint]->GetLimiter_Primitive(Limiter_Load) != NULL) {
           for (iVar = 0; iVar < nVar_First; iVar++) {
             Data[jVar][jPoint] = solver[FirstIndex]->node[iPoint]->GetLimiter_Primitive(iVar);
             jVar++;
@@ -3904,27 +3908,44 @@ void COutput::SetRestart(CConfig *config, CGeometry *geometry, CSolver **solver,
   
   restart_file << endl;
   
+  /*--- In serial, the merged data follows the local numbering of the points,
+   which differs from the global one if the points have been renumbered. The
+   restart file is always written in the global order. ---*/
+  
+  unsigned long jPoint, *Local_Point = new unsigned long [geometry->GetGlobal_nPointDomain()];
+  for (iPoint = 0; iPoint < geometry->GetGlobal_nPointDomain(); iPoint++)
+    Local_Point[iPoint] = iPoint;
+  
+#ifndef HAVE_MPI
+  for (iPoint = 0; iPoint < geometry->GetnPointDomain(); iPoint++)
+    Local_Point[geometry->node[iPoint]->GetGlobalIndex()] = iPoint;
+#endif
+  
   /*--- Write the restart file ---*/
   
   for (iPoint = 0; iPoint < geometry->GetGlobal_nPointDomain(); iPoint++) {
     
+    jPoint = Local_Point[iPoint];
+    
     /*--- Index of the point ---*/
     restart_file << iPoint << "\t";
     
     /*--- Write the grid coordinates first ---*/
     for (iDim = 0; iDim < nDim; iDim++) {
-      restart_file << scientific << Coords[iDim][iPoint] << "\t";
+      restart_file << scientific << Coords[iDim][jPoint] << "\t";
     }
     
     /*--- Loop over the variables and write the values to file ---*/
     for (iVar = 0; iVar < nVar_Total; iVar++) {
-      restart_file << scientific << Data[iVar][iPoint] << "\t";
+      restart_file << scientific << Data[iVar][jPoint] << "\t";
     }
     restart_file << endl;
   }
   
   restart_file.close();
   
+  delete [] Local_Point;
+  
 }
 
 void COutput::DeallocateCoordinates(CConfig *config, CGeometry *geometry) {
@@ -2368,7 +2368,7 @@ void CAdjEulerSolver::Inviscid_Sensitivity(CGeometry *geometry, CSolver **solver
             Area += Normal[iDim]*Normal[iDim];
           Area = sqrt(Area);
           
-          PrimVar_Grad = solver_container[FLOW_SOL]->node[iPoint]->GetGradient_Primitive();
+          PrimVar_Grad = solver_container[FLOW_SOL]->node[iPoint]->GetGradient_Primitive(Gradient_Load_i);
           ConsVar_Grad = solver_container[FLOW_SOL]->node[iPoint]->GetGradient();
           ConsPsi_Grad = node[iPoint]->GetAuxVarGradient();
           ConsPsi = node[iPoint]->GetAuxVar();
@@ -2661,17 +2661,16 @@ void CAdjEulerSolver::Inviscid_Sensitivity(CGeometry *geometry, CSolver **solver
   
 #ifdef HAVE_MPI
   
-  double MyTotal_Sens_Geo   = Total_Sens_Geo;     Total_Sens_Geo = 0.0;
-  double MyTotal_Sens_Mach  = Total_Sens_Mach;    Total_Sens_Mach = 0.0;
-  double MyTotal_Sens_AoA   = Total_Sens_AoA;     Total_Sens_AoA = 0.0;
-  double MyTotal_Sens_Press = Total_Sens_Press;   Total_Sens_Press = 0.0;
-  double MyTotal_Sens_Temp  = Total_Sens_Temp;    Total_Sens_Temp = 0.0;
+  /*--- Reduce all the sensitivities with a single collective ---*/
   
-  MPI_Allreduce(&MyTotal_Sens_Geo, &Total_Sens_Geo, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  MPI_Allreduce(&MyTotal_Sens_Mach, &Total_Sens_Mach, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  MPI_Allreduce(&MyTotal_Sens_AoA, &Total_Sens_AoA, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  MPI_Allreduce(&MyTotal_Sens_Press, &Total_Sens_Press, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  MPI_Allreduce(&MyTotal_Sens_Temp, &Total_Sens_Temp, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  double MyTotal_Sens[5], Total_Sens[5];
+  MyTotal_Sens[0] = Total_Sens_Geo;   MyTotal_Sens[1] = Total_Sens_Mach;  MyTotal_Sens[2] = Total_Sens_AoA;
+  MyTotal_Sens[3] = Total_Sens_Press; MyTotal_Sens[4] = Total_Sens_Temp;
+  
+  MPI_Allreduce(MyTotal_Sens, Total_Sens, 5, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  
+  Total_Sens_Geo   = Total_Sens[0]; Total_Sens_Mach  = Total_Sens[1]; Total_Sens_AoA = Total_Sens[2];
+  Total_Sens_Press = Total_Sens[3]; Total_Sens_Temp  = Total_Sens[4];
   
 #endif
   
@@ -4881,7 +4880,7 @@ void CAdjNSSolver::Source_Residual(CGeometry *geometry, CSolver **solver_contain
     
     numerics->SetPrimitive(solver_container[FLOW_SOL]->node[iPoint]->GetPrimitive(), NULL);
     
-    numerics->SetPrimVarGradient(solver_container[FLOW_SOL]->node[iPoint]->GetGradient_Primitive(), NULL);
+    numerics->SetPrimVarGradient(solver_container[FLOW_SOL]->node[iPoint]->GetGradient_Primitive(Gradient_Load_i), NULL);
 
     /*--- Gradient of adjoint variables ---*/
     
@@ -4942,8 +4941,8 @@ void CAdjNSSolver::Source_Residual(CGeometry *geometry, CSolver **solver_contain
 
       /*--- Gradient of primitive variables w/o reconstruction ---*/
       
-      second_numerics->SetPrimVarGradient(solver_container[FLOW_SOL]->node[iPoint]->GetGradient_Primitive(),
-                                        solver_container[FLOW_SOL]->node[jPoint]->GetGradient_Primitive());
+      second_numerics->SetPrimVarGradient(solver_container[FLOW_SOL]->node[iPoint]->GetGradient_Primitive(Gradient_Load_i),
+                                        solver_container[FLOW_SOL]->node[jPoint]->GetGradient_Primitive(Gradient_Load_j));
 
       /*--- Viscosity ---*/
 
@@ -5086,7 +5085,7 @@ void CAdjNSSolver::Viscous_Sensitivity(CGeometry *geometry, CSolver **solver_con
         if (geometry->node[iPoint]->GetDomain()) {
           
           PsiVar_Grad = node[iPoint]->GetGradient();
-          PrimVar_Grad = solver_container[FLOW_SOL]->node[iPoint]->GetGradient_Primitive();
+          PrimVar_Grad = solver_container[FLOW_SOL]->node[iPoint]->GetGradient_Primitive(Gradient_Load_i);
           
           if (compressible) Laminar_Viscosity = solver_container[FLOW_SOL]->node[iPoint]->GetLaminarViscosity();
           if (incompressible || freesurface) Laminar_Viscosity = solver_container[FLOW_SOL]->node[iPoint]->GetLaminarViscosityInc();
@@ -5570,17 +5569,16 @@ void CAdjNSSolver::Viscous_Sensitivity(CGeometry *geometry, CSolver **solver_con
   
 #ifdef HAVE_MPI
   
-  double MyTotal_Sens_Geo   = Total_Sens_Geo;     Total_Sens_Geo = 0.0;
-  double MyTotal_Sens_Mach  = Total_Sens_Mach;    Total_Sens_Mach = 0.0;
-  double MyTotal_Sens_AoA   = Total_Sens_AoA;     Total_Sens_AoA = 0.0;
-  double MyTotal_Sens_Press = Total_Sens_Press;   Total_Sens_Press = 0.0;
-  double MyTotal_Sens_Temp  = Total_Sens_Temp;    Total_Sens_Temp = 0.0;
+  /*--- Reduce all the sensitivities with a single collective ---*/
+  
+  double MyTotal_Sens[5], Total_Sens[5];
+  MyTotal_Sens[0] = Total_Sens_Geo;   MyTotal_Sens[1] = Total_Sens_Mach;  MyTotal_Sens[2] = Total_Sens_AoA;
+  MyTotal_Sens[3] = Total_Sens_Press; MyTotal_Sens[4] = Total_Sens_Temp;
+  
+  MPI_Allreduce(MyTotal_Sens, Total_Sens, 5, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
   
-  MPI_Allreduce(&MyTotal_Sens_Geo, &Total_Sens_Geo, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  MPI_Allreduce(&MyTotal_Sens_Mach, &Total_Sens_Mach, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  MPI_Allreduce(&MyTotal_Sens_AoA, &Total_Sens_AoA, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  MPI_Allreduce(&MyTotal_Sens_Press, &Total_Sens_Press, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  MPI_Allreduce(&MyTotal_Sens_Temp, &Total_Sens_Temp, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  Total_Sens_Geo   = Total_Sens[0]; Total_Sens_Mach  = Total_Sens[1]; Total_Sens_AoA = Total_Sens[2];
+  Total_Sens_Press = Total_Sens[3]; Total_Sens_Temp  = Total_Sens[4];
   
 #endif
   
@@ -6099,14 +6097,14 @@ void CAdjNSSolver::BC_Isothermal_Wall(CGeometry *geometry, CSolver **solver_cont
       Thermal_Conductivity = Cp * ( Laminar_Viscosity/Prandtl_Lam
                                    +Eddy_Viscosity/Prandtl_Turb);
       
-      GradV = solver_container[FLOW_SOL]->node[iPoint]->GetGradient_Primitive();
+      GradV = solver_container[FLOW_SOL]->node[iPoint]->GetGradient_Primitive(Gradient_Load_i);
       
       /*--- Calculate Dirichlet condition for energy equation ---*/
       if (!heat_flux_obj) {
         q = 0.0;
       }
       else {
-        GradT = solver_container[FLOW_SOL]->node[iPoint]->GetGradient_Primitive()[0];
+        GradT = solver_container[FLOW_SOL]->node[iPoint]->GetGradient_Primitive(Gradient_Load_i)[0];
         kGTdotn = 0;
         Xi = solver_container[FLOW_SOL]->GetTotal_MaxHeatFlux();
         Xi = 1.0;
@@ -6131,8 +6129,8 @@ void CAdjNSSolver::BC_Isothermal_Wall(CGeometry *geometry, CSolver **solver_cont
         
         /*--- Acquire gradient information ---*/
         PsiVar_Grad = node[iPoint]->GetGradient();
-        GradP    = solver_container[FLOW_SOL]->node[iPoint]->GetGradient_Primitive()[nVar-1];
-        GradDens = solver_container[FLOW_SOL]->node[iPoint]->GetGradient_Primitive()[nVar];
+        GradP    = solver_container[FLOW_SOL]->node[iPoint]->GetGradient_Primitive(Gradient_Load_i)[nVar-1];
+        GradDens = solver_container[FLOW_SOL]->node[iPoint]->GetGradient_Primitive(Gradient_Load_i)[nVar];
         
         /*--- Acqure flow information ---*/
         rho = solver_container[FLOW_SOL]->node[iPoint]->GetDensity();
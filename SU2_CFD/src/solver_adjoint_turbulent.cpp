@@ -729,7 +729,7 @@ void CAdjTurbSolver::Source_Residual(CGeometry *geometry, CSolver **solver_conta
     numerics->SetConservative(U_i, NULL);
     
     /*--- Gradient of primitive variables w/o reconstruction ---*/
-    GradPrimVar_i = solver_container[FLOW_SOL]->node[iPoint]->GetGradient_Primitive();
+    GradPrimVar_i = solver_container[FLOW_SOL]->node[iPoint]->GetGradient_Primitive(Gradient_Load_i);
     numerics->SetPrimVarGradient(GradPrimVar_i, NULL);
     
     /*--- Laminar viscosity of the fluid ---*/
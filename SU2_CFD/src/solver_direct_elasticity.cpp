@@ -22,7 +22,13 @@
 
 #include "../include/solver_structure.hpp"
 
-CFEASolver::CFEASolver(void) : CSolver() { }
+CFEASolver::CFEASolver(void) : CSolver() {
+  
+  Operator_Assembled = false;
+  Jacobian_Operator = NULL;
+  StiffMatrixTime_Operator = NULL;
+  
+}
 
 CFEASolver::CFEASolver(CGeometry *geometry, CConfig *config) : CSolver() {
   
@@ -82,7 +88,11 @@ CFEASolver::CFEASolver(CGeometry *geometry, CConfig *config) : CSolver() {
     }
 	}
   
-	/*--- Initialization of matrix structures ---*/
+	/*--- Initialization of matrix structures, the assembled operator is stored after the first iteration ---*/
+  
+  Operator_Assembled = false;
+  Jacobian_Operator = NULL;
+  StiffMatrixTime_Operator = NULL;
   
   StiffMatrixSpace.Initialize(nPoint, nPointDomain, nVar, nVar, false, geometry, config);
 	StiffMatrixTime.Initialize(nPoint, nPointDomain, nVar, nVar, false, geometry, config);
@@ -230,6 +240,9 @@ CFEASolver::~CFEASolver(void) {
 		delete [] cvector[iVar];
 	delete [] cvector;
   
+  if (Jacobian_Operator != NULL) delete [] Jacobian_Operator;
+  if (StiffMatrixTime_Operator != NULL) delete [] StiffMatrixTime_Operator;
+  
 }
 
 void CFEASolver::Preprocessing(CGeometry *geometry, CSolver **solver_container, CConfig *config, unsigned short iMesh, unsigned short iRKStep, unsigned short RunTime_EqSystem, bool Output) {
@@ -244,17 +257,46 @@ void CFEASolver::Preprocessing(CGeometry *geometry, CSolver **solver_container,
     LinSysAux.SetBlock_Zero(iPoint);
 	}
 	
-	/*--- Set matrix entries to zero ---*/
+	/*--- Set matrix entries to zero, or to the assembled operator (the boundary
+   conditions modify the rows of the Jacobian in each iteration) ---*/
   
 	StiffMatrixSpace.SetValZero();
-	StiffMatrixTime.SetValZero();
-	Jacobian.SetValZero();
+  if (Operator_Assembled) {
+    Jacobian.SetVal(Jacobian_Operator);
+    if (StiffMatrixTime_Operator != NULL) StiffMatrixTime.SetVal(StiffMatrixTime_Operator);
+    else StiffMatrixTime.SetValZero();
+  }
+  else {
+    StiffMatrixTime.SetValZero();
+    Jacobian.SetValZero();
+  }
+  
+}
+
+void CFEASolver::SetOperator_Assembled(void) {
+  
+  /*--- Store the entries of the Jacobian and of the mass matrix of the dual time stepping ---*/
+  
+  if (Jacobian_Operator == NULL) Jacobian_Operator = new double [Jacobian.GetnVal()];
+  Jacobian.GetVal(Jacobian_Operator);
+  
+  if (StiffMatrixTime_Operator == NULL) StiffMatrixTime_Operator = new double [StiffMatrixTime.GetnVal()];
+  StiffMatrixTime.GetVal(StiffMatrixTime_Operator);
+  
+  Operator_Assembled = true;
   
 }
 
 void CFEASolver::Source_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics *numerics, CNumerics *second_numerics,
                                  CConfig *config, unsigned short iMesh) {
   
+  bool dual_time = ((config->GetUnsteady_Simulation() == DT_STEPPING_1ST) ||
+                    (config->GetUnsteady_Simulation() == DT_STEPPING_2ND));
+  
+  /*--- The mass matrix is only assembled in the first iteration ---*/
+  
+  if (Operator_Assembled) return;
+  
   if (config->GetUnsteady_Simulation() != STEADY) {
     
     unsigned long iElem, Point_0 = 0, Point_1 = 0, Point_2 = 0, Point_3 = 0;
@@ -466,6 +508,10 @@ void CFEASolver::Source_Residual(CGeometry *geometry, CSolver **solver_container
     
   }
   
+  /*--- The operator is complete, except with dual time stepping (see SetResidual_DualTime) ---*/
+  
+  if (!dual_time) SetOperator_Assembled();
+  
 }
 
 void CFEASolver::Viscous_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics *numerics,
@@ -475,97 +521,111 @@ void CFEASolver::Viscous_Residual(CGeometry *geometry, CSolver **solver_containe
 	unsigned long iElem, PointCorners[8], iPoint, total_index;
 	double CoordCorners[8][3];
   
-	for (iElem = 0; iElem < geometry->GetnElem(); iElem++) {
-    
-    if (geometry->elem[iElem]->GetVTK_Type() == TRIANGLE)     nNodes = 3;
-    if (geometry->elem[iElem]->GetVTK_Type() == RECTANGLE)    nNodes = 4;
-    if (geometry->elem[iElem]->GetVTK_Type() == TETRAHEDRON)  nNodes = 4;
-    if (geometry->elem[iElem]->GetVTK_Type() == PYRAMID)      nNodes = 5;
-    if (geometry->elem[iElem]->GetVTK_Type() == WEDGE)        nNodes = 6;
-    if (geometry->elem[iElem]->GetVTK_Type() == HEXAHEDRON)   nNodes = 8;
+  /*--- The stiffness matrix of linear elasticity on a fixed mesh does not change, it is
+   only assembled in the first iteration (see SetOperator_Assembled) ---*/
+  
+  if (!Operator_Assembled) {
     
-    for (iNodes = 0; iNodes < nNodes; iNodes++) {
-      PointCorners[iNodes] = geometry->elem[iElem]->GetNode(iNodes);
-      for (iDim = 0; iDim < nDim; iDim++) {
-        CoordCorners[iNodes][iDim] = geometry->node[PointCorners[iNodes]]->GetCoord(iDim);
+    for (iElem = 0; iElem < geometry->GetnElem(); iElem++) {
+      
+      if (geometry->elem[iElem]->GetVTK_Type() == TRIANGLE)     nNodes = 3;
+      if (geometry->elem[iElem]->GetVTK_Type() == RECTANGLE)    nNodes = 4;
+      if (geometry->elem[iElem]->GetVTK_Type() == TETRAHEDRON)  nNodes = 4;
+      if (geometry->elem[iElem]->GetVTK_Type() == PYRAMID)      nNodes = 5;
+      if (geometry->elem[iElem]->GetVTK_Type() == WEDGE)        nNodes = 6;
+      if (geometry->elem[iElem]->GetVTK_Type() == HEXAHEDRON)   nNodes = 8;
+      
+      for (iNodes = 0; iNodes < nNodes; iNodes++) {
+        PointCorners[iNodes] = geometry->elem[iElem]->GetNode(iNodes);
+        for (iDim = 0; iDim < nDim; iDim++) {
+          CoordCorners[iNodes][iDim] = geometry->node[PointCorners[iNodes]]->GetCoord(iDim);
+        }
       }
-    }
-    
-    if (nDim == 2) numerics->SetFEA_StiffMatrix2D(StiffMatrix_Elem, CoordCorners, nNodes);
-    if (nDim == 3) numerics->SetFEA_StiffMatrix3D(StiffMatrix_Elem, CoordCorners, nNodes);
-    
-    /*--- Initialization of the auxiliar matrix ---*/
-    
-    for (iVar = 0; iVar < nVar; iVar++)
-      for (jVar = 0; jVar < nVar; jVar++)
-        StiffMatrix_Node[iVar][jVar] = 0.0;
-    
-    /*--- Steady simulation ---*/
-    
-    if (config->GetUnsteady_Simulation() == STEADY) {
-
-      /*--- Transform the stiffness matrix into the
-       contributions for the individual nodes relative to each other. ---*/
       
-      for (iVar = 0; iVar < nNodes; iVar++) {
-        for (jVar = 0; jVar < nNodes; jVar++) {
-          for (iDim = 0; iDim < nVar; iDim++) {
-            for (jDim = 0; jDim < nVar; jDim++) {
-              StiffMatrix_Node[iDim][jDim] = StiffMatrix_Elem[(iVar*nDim)+iDim][(jVar*nDim)+jDim];
+      if (nDim == 2) numerics->SetFEA_StiffMatrix2D(StiffMatrix_Elem, CoordCorners, nNodes);
+      if (nDim == 3) numerics->SetFEA_StiffMatrix3D(StiffMatrix_Elem, CoordCorners, nNodes);
+      
+      /*--- Initialization of the auxiliar matrix ---*/
+      
+      for (iVar = 0; iVar < nVar; iVar++)
+        for (jVar = 0; jVar < nVar; jVar++)
+          StiffMatrix_Node[iVar][jVar] = 0.0;
+      
+      /*--- Steady simulation ---*/
+      
+      if (config->GetUnsteady_Simulation() == STEADY) {
+        
+        /*--- Transform the stiffness matrix into the
+         contributions for the individual nodes relative to each other. ---*/
+        
+        for (iVar = 0; iVar < nNodes; iVar++) {
+          for (jVar = 0; jVar < nNodes; jVar++) {
+            for (iDim = 0; iDim < nVar; iDim++) {
+              for (jDim = 0; jDim < nVar; jDim++) {
+                StiffMatrix_Node[iDim][jDim] = StiffMatrix_Elem[(iVar*nDim)+iDim][(jVar*nDim)+jDim];
+              }
             }
+            Jacobian.AddBlock(PointCorners[iVar], PointCorners[jVar], StiffMatrix_Node);
+            
           }
-          Jacobian.AddBlock(PointCorners[iVar], PointCorners[jVar], StiffMatrix_Node);
-          
         }
       }
-    }
-    
-    /*--- Unsteady simulation ---*/
-
-    else {
       
-      if (nDim == 2) {
-        StiffMatrix_Node[0][2] = -1.0;
-        StiffMatrix_Node[1][3] = -1.0;
-      }
-      if (nDim == 3) {
-        StiffMatrix_Node[0][3] = -1.0;
-        StiffMatrix_Node[1][4] = -1.0;
-        StiffMatrix_Node[2][5] = -1.0;
-      }
+      /*--- Unsteady simulation ---*/
       
-      for (iVar = 0; iVar < nNodes; iVar++) {
-        for (jVar = 0; jVar < nNodes; jVar++) {
-          for (iDim = 0; iDim < nDim; iDim++) {
-            for (jDim = 0; jDim < nDim; jDim++) {
-              StiffMatrix_Node[nDim+iDim][jDim] = StiffMatrix_Elem[(iVar*nDim)+iDim][(jVar*nDim)+jDim];
+      else {
+        
+        if (nDim == 2) {
+          StiffMatrix_Node[0][2] = -1.0;
+          StiffMatrix_Node[1][3] = -1.0;
+        }
+        if (nDim == 3) {
+          StiffMatrix_Node[0][3] = -1.0;
+          StiffMatrix_Node[1][4] = -1.0;
+          StiffMatrix_Node[2][5] = -1.0;
+        }
+        
+        for (iVar = 0; iVar < nNodes; iVar++) {
+          for (jVar = 0; jVar < nNodes; jVar++) {
+            for (iDim = 0; iDim < nDim; iDim++) {
+              for (jDim = 0; jDim < nDim; jDim++) {
+                StiffMatrix_Node[nDim+iDim][jDim] = StiffMatrix_Elem[(iVar*nDim)+iDim][(jVar*nDim)+jDim];
+              }
             }
+            Jacobian.AddBlock(PointCorners[iVar], PointCorners[jVar], StiffMatrix_Node);
           }
-          Jacobian.AddBlock(PointCorners[iVar], PointCorners[jVar], StiffMatrix_Node);
         }
+        
       }
       
-      for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++) {
-        for (iVar = 0; iVar < nVar; iVar++) {
-          total_index = iPoint*nVar+iVar;
-          LinSysSol[total_index] = node[iPoint]->GetSolution(iVar);
-          LinSysAux[total_index] = 0.0;
-        }
+    }
+    
+  }
+  
+  /*--- Unsteady simulation, contribution of the stiffness matrix to the residual
+   (only the right hand side is updated in each iteration) ---*/
+  
+  if (config->GetUnsteady_Simulation() != STEADY) {
+    
+    for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++) {
+      for (iVar = 0; iVar < nVar; iVar++) {
+        total_index = iPoint*nVar+iVar;
+        LinSysSol[total_index] = node[iPoint]->GetSolution(iVar);
+        LinSysAux[total_index] = 0.0;
       }
-      
-      StiffMatrixSpace.MatrixVectorProduct(LinSysSol, LinSysAux);
-      
-      for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++) {
-        for (iVar = 0; iVar < nVar; iVar++) {
-          total_index = iPoint*nVar+iVar;
-          Residual[iVar] = LinSysAux[total_index];
-        }
-        LinSysRes.SubtractBlock(iPoint, Residual);
+    }
+    
+    StiffMatrixSpace.MatrixVectorProduct(LinSysSol, LinSysAux);
+    
+    for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++) {
+      for (iVar = 0; iVar < nVar; iVar++) {
+        total_index = iPoint*nVar+iVar;
+        Residual[iVar] = LinSysAux[total_index];
       }
-      
+      LinSysRes.SubtractBlock(iPoint, Residual);
     }
     
-	}
+  }
   
 }
 
@@ -1007,7 +1067,14 @@ void CFEASolver::BC_Pressure(CGeometry *geometry, CSolver **solver_container, CN
 }
 
 void CFEASolver::BC_Flow_Load(CGeometry *geometry, CSolver **solver_container, CNumerics *numerics, CConfig *config,
-                              unsigned short val_marker) { }
+                              unsigned short val_marker) {
+  
+  /*--- The flow pressure has been interpolated at the vertices of the
+   marker (SetFEA_Load), it is integrated like a pressure boundary ---*/
+  
+  BC_Pressure(geometry, solver_container, numerics, config, val_marker);
+  
+}
 
 
 void CFEASolver::Postprocessing(CGeometry *geometry, CSolver **solver_container, CConfig *config, unsigned short iMesh) {
@@ -1111,100 +1178,107 @@ void CFEASolver::SetResidual_DualTime(CGeometry *geometry, CSolver **solver_cont
 	
 	/*--- Loop through elements to compute contributions from the matrix
    blocks involving time. These contributions are also added to the
-   Jacobian w/ the time step. Spatial source terms are also computed. ---*/
+   Jacobian w/ the time step. Spatial source terms are also computed.
+   The time step is constant, the matrices are only assembled in the first iteration. ---*/
   
-	for (iElem = 0; iElem < geometry->GetnElem(); iElem++) {
+	if (!Operator_Assembled) {
 		
-    /*--- Get node numbers and their coordinate vectors ---*/
-		Point_0 = geometry->elem[iElem]->GetNode(0);	Coord_0 = geometry->node[Point_0]->GetCoord();
-		Point_1 = geometry->elem[iElem]->GetNode(1);	Coord_1 = geometry->node[Point_1]->GetCoord();
-		Point_2 = geometry->elem[iElem]->GetNode(2);	Coord_2 = geometry->node[Point_2]->GetCoord();
-		if (nDim == 3) { Point_3 = geometry->elem[iElem]->GetNode(3);	Coord_3 = geometry->node[Point_3]->GetCoord(); }
+		for (iElem = 0; iElem < geometry->GetnElem(); iElem++) {
 		
-		if (nDim == 2) {
+	    /*--- Get node numbers and their coordinate vectors ---*/
+			Point_0 = geometry->elem[iElem]->GetNode(0);	Coord_0 = geometry->node[Point_0]->GetCoord();
+			Point_1 = geometry->elem[iElem]->GetNode(1);	Coord_1 = geometry->node[Point_1]->GetCoord();
+			Point_2 = geometry->elem[iElem]->GetNode(2);	Coord_2 = geometry->node[Point_2]->GetCoord();
+			if (nDim == 3) { Point_3 = geometry->elem[iElem]->GetNode(3);	Coord_3 = geometry->node[Point_3]->GetCoord(); }
+		
+			if (nDim == 2) {
 			
-			for (iDim = 0; iDim < nDim; iDim++) {
-				a[iDim] = Coord_0[iDim]-Coord_2[iDim];
-				b[iDim] = Coord_1[iDim]-Coord_2[iDim];
+				for (iDim = 0; iDim < nDim; iDim++) {
+					a[iDim] = Coord_0[iDim]-Coord_2[iDim];
+					b[iDim] = Coord_1[iDim]-Coord_2[iDim];
+				}
+			
+				/*--- Compute element area ---*/
+				Area_Local = 0.5*fabs(a[0]*b[1]-a[1]*b[0]);
 			}
+			else {
 			
-			/*--- Compute element area ---*/
-			Area_Local = 0.5*fabs(a[0]*b[1]-a[1]*b[0]);
-		}
-		else {
+				for (iDim = 0; iDim < nDim; iDim++) {
+					a[iDim] = Coord_0[iDim]-Coord_2[iDim];
+					b[iDim] = Coord_1[iDim]-Coord_2[iDim];
+					c[iDim] = Coord_3[iDim]-Coord_2[iDim];
+				}
+				d[0] = a[1]*b[2]-a[2]*b[1]; d[1] = -(a[0]*b[2]-a[2]*b[0]); d[2] = a[0]*b[1]-a[1]*b[0];
 			
-			for (iDim = 0; iDim < nDim; iDim++) {
-				a[iDim] = Coord_0[iDim]-Coord_2[iDim];
-				b[iDim] = Coord_1[iDim]-Coord_2[iDim];
-				c[iDim] = Coord_3[iDim]-Coord_2[iDim];
+				/*--- Compute element volume ---*/
+				Volume_Local = fabs(c[0]*d[0] + c[1]*d[1] + c[2]*d[2])/6.0;
 			}
-			d[0] = a[1]*b[2]-a[2]*b[1]; d[1] = -(a[0]*b[2]-a[2]*b[0]); d[2] = a[0]*b[1]-a[1]*b[0];
-			
-			/*--- Compute element volume ---*/
-			Volume_Local = fabs(c[0]*d[0] + c[1]*d[1] + c[2]*d[2])/6.0;
-		}
 		
-		/*----------------------------------------------------------------*/
-		/*--- Block contributions to the Jacobian (includes time step) ---*/
-		/*----------------------------------------------------------------*/
+			/*----------------------------------------------------------------*/
+			/*--- Block contributions to the Jacobian (includes time step) ---*/
+			/*----------------------------------------------------------------*/
 		
-		for (iVar = 0; iVar < nVar; iVar++)
-			for (jVar = 0; jVar < nVar; jVar++)
-				StiffMatrix_Node[iVar][jVar] = 0.0;
+			for (iVar = 0; iVar < nVar; iVar++)
+				for (jVar = 0; jVar < nVar; jVar++)
+					StiffMatrix_Node[iVar][jVar] = 0.0;
 		
-		if (config->GetUnsteady_Simulation() == DT_STEPPING_1ST) TimeJac = 1.0/Time_Num;
-		if (config->GetUnsteady_Simulation() == DT_STEPPING_2ND) TimeJac = 3.0/(2.0*Time_Num);
+			if (config->GetUnsteady_Simulation() == DT_STEPPING_1ST) TimeJac = 1.0/Time_Num;
+			if (config->GetUnsteady_Simulation() == DT_STEPPING_2ND) TimeJac = 3.0/(2.0*Time_Num);
 		
-		/*--- Diagonal value identity matrix ---*/
-		if (nDim == 2) {
-			StiffMatrix_Node[0][0] = 1.0*TimeJac;
-			StiffMatrix_Node[1][1] = 1.0*TimeJac;
-		}
-		else {
-			StiffMatrix_Node[0][0] = 1.0*TimeJac;
-			StiffMatrix_Node[1][1] = 1.0*TimeJac;
-			StiffMatrix_Node[2][2] = 1.0*TimeJac;
-		}
+			/*--- Diagonal value identity matrix ---*/
+			if (nDim == 2) {
+				StiffMatrix_Node[0][0] = 1.0*TimeJac;
+				StiffMatrix_Node[1][1] = 1.0*TimeJac;
+			}
+			else {
+				StiffMatrix_Node[0][0] = 1.0*TimeJac;
+				StiffMatrix_Node[1][1] = 1.0*TimeJac;
+				StiffMatrix_Node[2][2] = 1.0*TimeJac;
+			}
 		
-		/*--- Diagonal value ---*/
-		if (nDim == 2) {
-			StiffMatrix_Node[2][2] = Density*(2.0/12.0)*(Area_Local*TimeJac);
-			StiffMatrix_Node[3][3] = Density*(2.0/12.0)*(Area_Local*TimeJac);
-		}
-		else {
-			StiffMatrix_Node[3][3] = Density*(2.0/20.0)*(Volume_Local*TimeJac);
-			StiffMatrix_Node[4][4] = Density*(2.0/20.0)*(Volume_Local*TimeJac);
-			StiffMatrix_Node[5][5] = Density*(2.0/20.0)*(Volume_Local*TimeJac);
-		}
-    Jacobian.AddBlock(Point_0, Point_0, StiffMatrix_Node); StiffMatrixTime.AddBlock(Point_0, Point_0, StiffMatrix_Node);
-		Jacobian.AddBlock(Point_1, Point_1, StiffMatrix_Node); StiffMatrixTime.AddBlock(Point_1, Point_1, StiffMatrix_Node);
-		Jacobian.AddBlock(Point_2, Point_2, StiffMatrix_Node); StiffMatrixTime.AddBlock(Point_2, Point_2, StiffMatrix_Node);
-		if (nDim == 3) { Jacobian.AddBlock(Point_3, Point_3, StiffMatrix_Node); StiffMatrixTime.AddBlock(Point_2, Point_2, StiffMatrix_Node); }
+			/*--- Diagonal value ---*/
+			if (nDim == 2) {
+				StiffMatrix_Node[2][2] = Density*(2.0/12.0)*(Area_Local*TimeJac);
+				StiffMatrix_Node[3][3] = Density*(2.0/12.0)*(Area_Local*TimeJac);
+			}
+			else {
+				StiffMatrix_Node[3][3] = Density*(2.0/20.0)*(Volume_Local*TimeJac);
+				StiffMatrix_Node[4][4] = Density*(2.0/20.0)*(Volume_Local*TimeJac);
+				StiffMatrix_Node[5][5] = Density*(2.0/20.0)*(Volume_Local*TimeJac);
+			}
+	    Jacobian.AddBlock(Point_0, Point_0, StiffMatrix_Node); StiffMatrixTime.AddBlock(Point_0, Point_0, StiffMatrix_Node);
+			Jacobian.AddBlock(Point_1, Point_1, StiffMatrix_Node); StiffMatrixTime.AddBlock(Point_1, Point_1, StiffMatrix_Node);
+			Jacobian.AddBlock(Point_2, Point_2, StiffMatrix_Node); StiffMatrixTime.AddBlock(Point_2, Point_2, StiffMatrix_Node);
+			if (nDim == 3) { Jacobian.AddBlock(Point_3, Point_3, StiffMatrix_Node); StiffMatrixTime.AddBlock(Point_2, Point_2, StiffMatrix_Node); }
 		
-		/*--- Off Diagonal value ---*/
-		if (nDim == 2) {
-			StiffMatrix_Node[2][2] = Density*(1.0/12.0)*(Area_Local*TimeJac);
-			StiffMatrix_Node[3][3] = Density*(1.0/12.0)*(Area_Local*TimeJac);
-		}
-		else {
-			StiffMatrix_Node[3][3] = Density*(1.0/20.0)*(Volume_Local*TimeJac);
-			StiffMatrix_Node[4][4] = Density*(1.0/20.0)*(Volume_Local*TimeJac);
-			StiffMatrix_Node[5][5] = Density*(1.0/20.0)*(Volume_Local*TimeJac);
-		}
-		Jacobian.AddBlock(Point_0, Point_1, StiffMatrix_Node); StiffMatrixTime.AddBlock(Point_0, Point_1, StiffMatrix_Node);
-		Jacobian.AddBlock(Point_0, Point_2, StiffMatrix_Node); StiffMatrixTime.AddBlock(Point_0, Point_2, StiffMatrix_Node);
-		Jacobian.AddBlock(Point_1, Point_0, StiffMatrix_Node); StiffMatrixTime.AddBlock(Point_1, Point_0, StiffMatrix_Node);
-		Jacobian.AddBlock(Point_1, Point_2, StiffMatrix_Node); StiffMatrixTime.AddBlock(Point_1, Point_2, StiffMatrix_Node);
-		Jacobian.AddBlock(Point_2, Point_0, StiffMatrix_Node); StiffMatrixTime.AddBlock(Point_2, Point_0, StiffMatrix_Node);
-		Jacobian.AddBlock(Point_2, Point_1, StiffMatrix_Node); StiffMatrixTime.AddBlock(Point_2, Point_1, StiffMatrix_Node);
-		if (nDim == 3) {
-			Jacobian.AddBlock(Point_0, Point_3, StiffMatrix_Node); StiffMatrixTime.AddBlock(Point_0, Point_3, StiffMatrix_Node);
-			Jacobian.AddBlock(Point_1, Point_3, StiffMatrix_Node); StiffMatrixTime.AddBlock(Point_1, Point_3, StiffMatrix_Node);
-			Jacobian.AddBlock(Point_2, Point_3, StiffMatrix_Node); StiffMatrixTime.AddBlock(Point_2, Point_3, StiffMatrix_Node);
-			Jacobian.AddBlock(Point_3, Point_0, StiffMatrix_Node); StiffMatrixTime.AddBlock(Point_3, Point_0, StiffMatrix_Node);
-			Jacobian.AddBlock(Point_3, Point_1, StiffMatrix_Node); StiffMatrixTime.AddBlock(Point_3, Point_1, StiffMatrix_Node);
-			Jacobian.AddBlock(Point_3, Point_2, StiffMatrix_Node); StiffMatrixTime.AddBlock(Point_3, Point_2, StiffMatrix_Node);
+			/*--- Off Diagonal value ---*/
+			if (nDim == 2) {
+				StiffMatrix_Node[2][2] = Density*(1.0/12.0)*(Area_Local*TimeJac);
+				StiffMatrix_Node[3][3] = Density*(1.0/12.0)*(Area_Local*TimeJac);
+			}
+			else {
+				StiffMatrix_Node[3][3] = Density*(1.0/20.0)*(Volume_Local*TimeJac);
+				StiffMatrix_Node[4][4] = Density*(1.0/20.0)*(Volume_Local*TimeJac);
+				StiffMatrix_Node[5][5] = Density*(1.0/20.0)*(Volume_Local*TimeJac);
+			}
+			Jacobian.AddBlock(Point_0, Point_1, StiffMatrix_Node); StiffMatrixTime.AddBlock(Point_0, Point_1, StiffMatrix_Node);
+			Jacobian.AddBlock(Point_0, Point_2, StiffMatrix_Node); StiffMatrixTime.AddBlock(Point_0, Point_2, StiffMatrix_Node);
+			Jacobian.AddBlock(Point_1, Point_0, StiffMatrix_Node); StiffMatrixTime.AddBlock(Point_1, Point_0, StiffMatrix_Node);
+			Jacobian.AddBlock(Point_1, Point_2, StiffMatrix_Node); StiffMatrixTime.AddBlock(Point_1, Point_2, StiffMatrix_Node);
+			Jacobian.AddBlock(Point_2, Point_0, StiffMatrix_Node); StiffMatrixTime.AddBlock(Point_2, Point_0, StiffMatrix_Node);
+			Jacobian.AddBlock(Point_2, Point_1, StiffMatrix_Node); StiffMatrixTime.AddBlock(Point_2, Point_1, StiffMatrix_Node);
+			if (nDim == 3) {
+				Jacobian.AddBlock(Point_0, Point_3, StiffMatrix_Node); StiffMatrixTime.AddBlock(Point_0, Point_3, StiffMatrix_Node);
+				Jacobian.AddBlock(Point_1, Point_3, StiffMatrix_Node); StiffMatrixTime.AddBlock(Point_1, Point_3, StiffMatrix_Node);
+				Jacobian.AddBlock(Point_2, Point_3, StiffMatrix_Node); StiffMatrixTime.AddBlock(Point_2, Point_3, StiffMatrix_Node);
+				Jacobian.AddBlock(Point_3, Point_0, StiffMatrix_Node); StiffMatrixTime.AddBlock(Point_3, Point_0, StiffMatrix_Node);
+				Jacobian.AddBlock(Point_3, Point_1, StiffMatrix_Node); StiffMatrixTime.AddBlock(Point_3, Point_1, StiffMatrix_Node);
+				Jacobian.AddBlock(Point_3, Point_2, StiffMatrix_Node); StiffMatrixTime.AddBlock(Point_3, Point_2, StiffMatrix_Node);
+			}
 		}
+		
+		SetOperator_Assembled();
+		
 	}
 	
 	unsigned long iPoint, total_index;
@@ -1450,5 +1524,63 @@ void CFEASolver::GetSurface_Pressure(CGeometry *geometry, CConfig *config) {
   
 }
 
+void CFEASolver::SetFSI_Interface(CGeometry **geometry, CConfig *config, CGeometry **donor_geometry, CConfig *donor_config) {
+  
+  unsigned short iMarker;
+  
+  /*--- The flow load markers of the structure receive the pressure
+   of the moving markers of the flow ---*/
+  
+  bool *Target_Marker = new bool [config->GetnMarker_All()];
+  bool *Donor_Marker = new bool [donor_config->GetnMarker_All()];
+  
+  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++)
+    Target_Marker[iMarker] = (config->GetMarker_All_KindBC(iMarker) == FLOWLOAD_BOUNDARY);
+  for (iMarker = 0; iMarker < donor_config->GetnMarker_All(); iMarker++)
+    Donor_Marker[iMarker] = (donor_config->GetMarker_All_Moving(iMarker) == YES);
+  
+  SetInterface_Map(geometry[MESH_0], Target_Marker, donor_geometry[MESH_0], Donor_Marker);
+  
+  delete [] Target_Marker;
+  delete [] Donor_Marker;
+  
+}
+
 void CFEASolver::SetFEA_Load(CSolver ***flow_solution, CGeometry **fea_geometry, CGeometry **flow_geometry,
-                             CConfig *fea_config, CConfig *flow_config) { }
+                             CConfig *fea_config, CConfig *flow_config) {
+  
+  unsigned short iMarker, iDonor;
+  unsigned long iVertex, iPoint, iTarget, iSend;
+  double Pressure;
+  
+  if (!Interface_Map) SetFSI_Interface(fea_geometry, fea_config, flow_geometry, flow_config);
+  
+  /*--- Pressure of the flow points requested by the other ranks ---*/
+  
+  double *Buffer_Send = new double [nInterface_Send];
+  double *Buffer_Receive = new double [nInterface_Receive];
+  
+  for (iSend = 0; iSend < nInterface_Send; iSend++)
+    Buffer_Send[iSend] = flow_solution[MESH_0][FLOW_SOL]->node[Interface_Send_Point[iSend]]->GetPressure();
+  
+  SetInterface_Exchange(Buffer_Send, Buffer_Receive, 1);
+  
+  /*--- Interpolate the pressure at the flow load vertices, it is
+   integrated over the boundary elements in BC_Flow_Load ---*/
+  
+  for (iTarget = 0; iTarget < nInterface_Target; iTarget++) {
+    iMarker = Interface_Target_Marker[iTarget];
+    iVertex = Interface_Target_Vertex[iTarget];
+    iPoint = fea_geometry[MESH_0]->vertex[iMarker][iVertex]->GetNode();
+    
+    Pressure = 0.0;
+    for (iDonor = 0; iDonor < INTERFACE_NDONOR; iDonor++)
+      Pressure += Interface_Donor_Weight[iTarget*INTERFACE_NDONOR+iDonor]*Buffer_Receive[Interface_Donor_Slot[iTarget*INTERFACE_NDONOR+iDonor]];
+    
+    node[iPoint]->SetFlow_Pressure(Pressure);
+  }
+  
+  delete [] Buffer_Send;
+  delete [] Buffer_Receive;
+  
+}
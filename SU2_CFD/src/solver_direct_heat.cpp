@@ -131,12 +131,29 @@ CHeatSolver::CHeatSolver(CGeometry *geometry, CConfig *config) : CSolver() {
 		unsigned long index;
 		string text_line;
     
-		for(unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
-			getline(restart_file,text_line);
+		/*--- The restart file is in global order, map each line to its local point ---*/
+		long *Global2Local = new long[geometry->GetGlobal_nPointDomain()];
+		long iPoint_Local; unsigned long iPoint_Global = 0;
+		for (iPoint = 0; iPoint < geometry->GetGlobal_nPointDomain(); iPoint++)
+			Global2Local[iPoint] = -1;
+		for (iPoint = 0; iPoint < geometry->GetnPointDomain(); iPoint++)
+			Global2Local[geometry->node[iPoint]->GetGlobalIndex()] = iPoint;
+    
+		while (getline(restart_file,text_line)) {
 			istringstream point_line(text_line);
-			point_line >> index >> Solution[0] >> Solution[1];
-			node[iPoint] = new CHeatVariable(Solution, nDim, nVar, config);
+			iPoint_Local = Global2Local[iPoint_Global];
+			if (iPoint_Local >= 0) {
+				point_line >> index >> Solution[0] >> Solution[1];
+				node[iPoint_Local] = new CHeatVariable(Solution, nDim, nVar, config);
+			}
+			iPoint_Global++;
 		}
+    
+		/*--- Halo points, set by the first send/receive ---*/
+		for (iPoint = geometry->GetnPointDomain(); iPoint < nPoint; iPoint++)
+			node[iPoint] = new CHeatVariable(Solution, nDim, nVar, config);
+    
+		delete [] Global2Local;
 		restart_file.close();
 	}
   
@@ -66,6 +66,15 @@ CEulerSolver::CEulerSolver(void) : CSolver()  {
   Primitive = NULL; Primitive_i = NULL; Primitive_j = NULL;
   CharacPrimVar = NULL;
   
+  /*--- The inviscid coefficients are reduced in Inviscid_Forces,
+   CNSSolver overwrites this flag ---*/
+  
+  reduce_forces_visc = false;
+  
+  Res_Batch = NULL; Jacobian_i_Batch = NULL; Jacobian_j_Batch = NULL;
+  Res_Batch_Check = NULL; Jacobian_i_Batch_Check = NULL; Jacobian_j_Batch_Check = NULL;
+  Res_Visc_Edge = NULL; Jacobian_Edge = NULL;
+  
   /*--- Fixed CL mode initialization (cauchy criteria) ---*/
   Cauchy_Value = 0;
 	Cauchy_Func = 0;
@@ -128,6 +137,12 @@ CEulerSolver::CEulerSolver(CGeometry *geometry, CConfig *config, unsigned short
   CharacPrimVar = NULL;
   Cauchy_Serie = NULL;
   
+  reduce_forces_visc = false;
+  
+  Res_Batch = NULL; Jacobian_i_Batch = NULL; Jacobian_j_Batch = NULL;
+  Res_Batch_Check = NULL; Jacobian_i_Batch_Check = NULL; Jacobian_j_Batch_Check = NULL;
+  Res_Visc_Edge = NULL; Jacobian_Edge = NULL;
+  
   /*--- Set the gamma value ---*/
   
   Gamma = config->GetGamma();
@@ -247,10 +262,27 @@ CEulerSolver::CEulerSolver(CGeometry *geometry, CConfig *config, unsigned short
       if (rank == MASTER_NODE) cout << "Compute linelet structure. " << nLineLets << " elements in each line (average)." << endl;
     }
     
+    /*--- Position of the blocks of each edge, for the batched edge loops ---*/
+    
+    if (config->GetEdge_Batch()) Jacobian.SetEdge_Block(geometry);
+    
   } else {
     if (rank == MASTER_NODE) cout << "Explicit scheme. No Jacobian structure (Euler). MG level: " << iMesh <<"." << endl;
   }
   
+  /*--- Work arrays of the batched edge loops (EDGE_BATCH) ---*/
+  
+  if (config->GetEdge_Batch()) {
+    Res_Batch = new double [nVar][EDGE_BATCH_SIZE];
+    Jacobian_i_Batch = new double [nVar*nVar][EDGE_BATCH_SIZE];
+    Jacobian_j_Batch = new double [nVar*nVar][EDGE_BATCH_SIZE];
+    if (config->GetEdge_Batch_Check()) {
+      Res_Batch_Check = new double [nVar][EDGE_BATCH_SIZE];
+      Jacobian_i_Batch_Check = new double [nVar*nVar][EDGE_BATCH_SIZE];
+      Jacobian_j_Batch_Check = new double [nVar*nVar][EDGE_BATCH_SIZE];
+    }
+  }
+  
   /*--- Define some auxiliary vectors for computing flow variable gradients by least squares ---*/
   
   if (config->GetKind_Gradient_Method() == WEIGHTED_LEAST_SQUARES) {
@@ -583,6 +615,14 @@ CEulerSolver::~CEulerSolver(void) {
   if (Primitive != NULL)        delete [] Primitive;
   if (Primitive_i != NULL)      delete [] Primitive_i;
   if (Primitive_j != NULL)      delete [] Primitive_j;
+  if (Res_Batch != NULL)        delete [] Res_Batch;
+  if (Jacobian_i_Batch != NULL) delete [] Jacobian_i_Batch;
+  if (Jacobian_j_Batch != NULL) delete [] Jacobian_j_Batch;
+  if (Res_Batch_Check != NULL)  delete [] Res_Batch_Check;
+  if (Jacobian_i_Batch_Check != NULL) delete [] Jacobian_i_Batch_Check;
+  if (Jacobian_j_Batch_Check != NULL) delete [] Jacobian_j_Batch_Check;
+  if (Res_Visc_Edge != NULL)    delete [] Res_Visc_Edge;
+  if (Jacobian_Edge != NULL)    delete [] Jacobian_Edge;
   
   if (LowMach_Precontioner != NULL) {
     for (iVar = 0; iVar < nVar; iVar ++)
@@ -638,6 +678,8 @@ CEulerSolver::~CEulerSolver(void) {
 }
 
 void CEulerSolver::Set_MPI_Solution(CGeometry *geometry, CConfig *config) {
+  CProfilerTimer Profile_Timer(PROFILE_MPI_HALO);
+  
   unsigned short iVar, iMarker, iPeriodic_Index, MarkerS, MarkerR;
   unsigned long iVertex, iPoint, nVertexS, nVertexR, nBufferS_Vector, nBufferR_Vector;
   double rotMatrix[3][3], *angles, theta, cosTheta, sinTheta, phi, cosPhi, sinPhi, psi, cosPsi, sinPsi, *Buffer_Receive_U = NULL, *Buffer_Send_U = NULL;
@@ -753,6 +795,8 @@ void CEulerSolver::Set_MPI_Solution(CGeometry *geometry, CConfig *config) {
 }
 
 void CEulerSolver::Set_MPI_Solution_Old(CGeometry *geometry, CConfig *config) {
+  CProfilerTimer Profile_Timer(PROFILE_MPI_HALO);
+  
   unsigned short iVar, iMarker, iPeriodic_Index, MarkerS, MarkerR;
   unsigned long iVertex, iPoint, nVertexS, nVertexR, nBufferS_Vector, nBufferR_Vector;
   double rotMatrix[3][3], *angles, theta, cosTheta, sinTheta, phi, cosPhi, sinPhi, psi, cosPsi, sinPsi,
@@ -868,6 +912,8 @@ void CEulerSolver::Set_MPI_Solution_Old(CGeometry *geometry, CConfig *config) {
 }
 
 void CEulerSolver::Set_MPI_Undivided_Laplacian(CGeometry *geometry, CConfig *config) {
+  CProfilerTimer Profile_Timer(PROFILE_MPI_HALO);
+  
   unsigned short iVar, iMarker, iPeriodic_Index, MarkerS, MarkerR;
   unsigned long iVertex, iPoint, nVertexS, nVertexR, nBufferS_Vector, nBufferR_Vector;
   double rotMatrix[3][3], *angles, theta, cosTheta, sinTheta, phi, cosPhi, sinPhi, psi, cosPsi, sinPsi,
@@ -984,6 +1030,8 @@ void CEulerSolver::Set_MPI_Undivided_Laplacian(CGeometry *geometry, CConfig *con
 }
 
 void CEulerSolver::Set_MPI_MaxEigenvalue(CGeometry *geometry, CConfig *config) {
+  CProfilerTimer Profile_Timer(PROFILE_MPI_HALO);
+  
   unsigned short iMarker, MarkerS, MarkerR, *Buffer_Receive_Neighbor = NULL, *Buffer_Send_Neighbor = NULL;
   unsigned long iVertex, iPoint, nVertexS, nVertexR, nBufferS_Vector, nBufferR_Vector;
   double *Buffer_Receive_Lambda = NULL, *Buffer_Send_Lambda = NULL;
@@ -1062,6 +1110,8 @@ void CEulerSolver::Set_MPI_MaxEigenvalue(CGeometry *geometry, CConfig *config) {
 }
 
 void CEulerSolver::Set_MPI_Dissipation_Switch(CGeometry *geometry, CConfig *config) {
+  CProfilerTimer Profile_Timer(PROFILE_MPI_HALO);
+  
   unsigned short iMarker, MarkerS, MarkerR;
   unsigned long iVertex, iPoint, nVertexS, nVertexR, nBufferS_Vector, nBufferR_Vector;
   double *Buffer_Receive_Lambda = NULL, *Buffer_Send_Lambda = NULL;
@@ -1131,6 +1181,8 @@ void CEulerSolver::Set_MPI_Dissipation_Switch(CGeometry *geometry, CConfig *conf
 }
 
 void CEulerSolver::Set_MPI_Solution_Gradient(CGeometry *geometry, CConfig *config) {
+  CProfilerTimer Profile_Timer(PROFILE_MPI_HALO);
+  
   unsigned short iVar, iDim, iMarker, iPeriodic_Index, MarkerS, MarkerR;
   unsigned long iVertex, iPoint, nVertexS, nVertexR, nBufferS_Vector, nBufferR_Vector;
   double rotMatrix[3][3], *angles, theta, cosTheta, sinTheta, phi, cosPhi, sinPhi, psi, cosPsi, sinPsi,
@@ -1253,6 +1305,8 @@ void CEulerSolver::Set_MPI_Solution_Gradient(CGeometry *geometry, CConfig *confi
 }
 
 void CEulerSolver::Set_MPI_Solution_Limiter(CGeometry *geometry, CConfig *config) {
+  CProfilerTimer Profile_Timer(PROFILE_MPI_HALO);
+  
   unsigned short iVar, iMarker, iPeriodic_Index, MarkerS, MarkerR;
   unsigned long iVertex, iPoint, nVertexS, nVertexR, nBufferS_Vector, nBufferR_Vector;
   double rotMatrix[3][3], *angles, theta, cosTheta, sinTheta, phi, cosPhi, sinPhi, psi, cosPsi, sinPsi,
@@ -1373,6 +1427,8 @@ void CEulerSolver::Set_MPI_Solution_Limiter(CGeometry *geometry, CConfig *config
 }
 
 void CEulerSolver::Set_MPI_Primitive_ReconstGradient(CGeometry *geometry, CConfig *config) {
+  CProfilerTimer Profile_Timer(PROFILE_MPI_HALO);
+  
    unsigned short iVar, iDim, iMarker, iPeriodic_Index, MarkerS, MarkerR;
   unsigned long iVertex, iPoint, nVertexS, nVertexR, nBufferS_Vector, nBufferR_Vector;
   double rotMatrix[3][3], *angles, theta, cosTheta, sinTheta, phi, cosPhi, sinPhi, psi, cosPsi, sinPsi,
@@ -1497,6 +1553,8 @@ void CEulerSolver::Set_MPI_Primitive_ReconstGradient(CGeometry *geometry, CConfi
 
 
 void CEulerSolver::Set_MPI_Primitive_Gradient(CGeometry *geometry, CConfig *config) {
+  CProfilerTimer Profile_Timer(PROFILE_MPI_HALO);
+  
   unsigned short iVar, iDim, iMarker, iPeriodic_Index, MarkerS, MarkerR;
   unsigned long iVertex, iPoint, nVertexS, nVertexR, nBufferS_Vector, nBufferR_Vector;
   double rotMatrix[3][3], *angles, theta, cosTheta, sinTheta, phi, cosPhi, sinPhi, psi, cosPsi, sinPsi,
@@ -1621,6 +1679,8 @@ void CEulerSolver::Set_MPI_Primitive_Gradient(CGeometry *geometry, CConfig *conf
 
 
 void CEulerSolver::Set_MPI_Primitive_Limiter(CGeometry *geometry, CConfig *config) {
+  CProfilerTimer Profile_Timer(PROFILE_MPI_HALO);
+  
   unsigned short iVar, iMarker, iPeriodic_Index, MarkerS, MarkerR;
   unsigned long iVertex, iPoint, nVertexS, nVertexR, nBufferS_Vector, nBufferR_Vector;
   double rotMatrix[3][3], *angles, theta, cosTheta, sinTheta, phi, cosPhi, sinPhi, psi, cosPsi, sinPsi,
@@ -1741,6 +1801,8 @@ void CEulerSolver::Set_MPI_Primitive_Limiter(CGeometry *geometry, CConfig *confi
 }
 
 void CEulerSolver::Set_MPI_Secondary_Gradient(CGeometry *geometry, CConfig *config) {
+  CProfilerTimer Profile_Timer(PROFILE_MPI_HALO);
+  
   unsigned short iVar, iDim, iMarker, iPeriodic_Index, MarkerS, MarkerR;
   unsigned long iVertex, iPoint, nVertexS, nVertexR, nBufferS_Vector, nBufferR_Vector;
   double rotMatrix[3][3], *angles, theta, cosTheta, sinTheta, phi, cosPhi, sinPhi, psi, cosPsi, sinPsi,
@@ -1863,6 +1925,8 @@ void CEulerSolver::Set_MPI_Secondary_Gradient(CGeometry *geometry, CConfig *conf
 }
 
 void CEulerSolver::Set_MPI_Secondary_Limiter(CGeometry *geometry, CConfig *config) {
+  CProfilerTimer Profile_Timer(PROFILE_MPI_HALO);
+  
   unsigned short iVar, iMarker, MarkerS, MarkerR;
   unsigned long iVertex, iPoint, nVertexS, nVertexR, nBufferS_Vector, nBufferR_Vector;
   double *Buffer_Receive_Limit = NULL, *Buffer_Send_Limit = NULL;
@@ -2832,6 +2896,7 @@ void CEulerSolver::SetInitialCondition(CGeometry **geometry, CSolver ***solver_c
 }
 
 void CEulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container, CConfig *config, unsigned short iMesh, unsigned short iRKStep, unsigned short RunTime_EqSystem, bool Output) {
+  CProfilerTimer Profile_Timer(PROFILE_PREPROCESSING);
   
   unsigned long iPoint, ErrorCounter = 0;
   bool RightSol = true;
@@ -2890,6 +2955,8 @@ void CEulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container
     
   }
   
+  SetDerived_Computed(DERIVED_PRIMITIVE);
+  
   /*--- Upwind second order reconstruction ---*/
   
   if ((second_order && !center) && ((iMesh == MESH_0) || low_fidelity)) {
@@ -3160,12 +3227,14 @@ void CEulerSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_container,
 void CEulerSolver::Centered_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics *numerics,
                                      CConfig *config, unsigned short iMesh, unsigned short iRKStep) {
   
-  unsigned long iEdge, iPoint, jPoint;
+  unsigned long iEdge, iPoint, jPoint, Edge_Batch[EDGE_BATCH_SIZE];
+  unsigned short nLane = 0;
   
   bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
   bool second_order = ((config->GetKind_Centered_Flow() == JST) && (iMesh == MESH_0));
   bool low_fidelity = (config->GetLowFidelitySim() && (iMesh == MESH_1));
   bool grid_movement = config->GetGrid_Movement();
+  bool batch = (config->GetEdge_Batch() && numerics->GetBatched() && (second_order || low_fidelity));
   
   for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
     
@@ -3196,6 +3265,22 @@ void CEulerSolver::Centered_Residual(CGeometry *geometry, CSolver **solver_conta
       numerics->SetGridVel(geometry->node[iPoint]->GetGridVel(), geometry->node[jPoint]->GetGridVel());
     }
     
+    /*--- Batched computation, the batch is computed when it is full or at the last edge ---*/
+    
+    if (batch) {
+      numerics->SetBatch_Lane(nLane);
+      if (config->GetEdge_Batch_Check()) SetBatch_Check(numerics, nLane, implicit, config);
+      Edge_Batch[nLane] = iEdge; nLane++;
+      if ((nLane == EDGE_BATCH_SIZE) || (iEdge == geometry->GetnEdge()-1)) {
+        numerics->ComputeResidual_Batch(nLane, Res_Batch, Jacobian_i_Batch, Jacobian_j_Batch, config);
+        if (config->GetEdge_Batch_Check())
+          CheckResidual_Batch(geometry, Edge_Batch, nLane, Res_Batch, Jacobian_i_Batch, Jacobian_j_Batch, implicit);
+        AddResidual_Batch(geometry, Edge_Batch, nLane, Res_Batch, Jacobian_i_Batch, Jacobian_j_Batch, implicit, false);
+        nLane = 0;
+      }
+      continue;
+    }
+    
     /*--- Compute residuals, and Jacobians ---*/
     
     numerics->ComputeResidual(Res_Conv, Jacobian_i, Jacobian_j, config);
@@ -3219,10 +3304,108 @@ void CEulerSolver::Centered_Residual(CGeometry *geometry, CSolver **solver_conta
 void CEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics *numerics,
                                    CConfig *config, unsigned short iMesh) {
   
+  Upwind_Edge_Loop(geometry, solver_container, numerics, NULL, config, iMesh);
+  
+}
+
+void CEulerSolver::AddResidual_Batch(CGeometry *geometry, unsigned long *val_edge, unsigned short val_nLane,
+                                     double (*val_residual)[EDGE_BATCH_SIZE], double (*val_Jacobian_i)[EDGE_BATCH_SIZE],
+                                     double (*val_Jacobian_j)[EDGE_BATCH_SIZE], bool val_implicit, bool val_viscous) {
+  
+  unsigned long iPoint, jPoint;
+  unsigned short iLane, iVar;
+  
+  /*--- Same updates as the edge by edge loops, in the order of the edges ---*/
+  
+  for (iLane = 0; iLane < val_nLane; iLane++) {
+    
+    iPoint = geometry->edge[val_edge[iLane]]->GetNode(0);
+    jPoint = geometry->edge[val_edge[iLane]]->GetNode(1);
+    
+    for (iVar = 0; iVar < nVar; iVar++)
+      Res_Conv[iVar] = val_residual[iVar][iLane];
+    
+    if (!val_viscous) {
+      LinSysRes.AddBlock(iPoint, Res_Conv);
+      LinSysRes.SubtractBlock(jPoint, Res_Conv);
+    }
+    else {
+      LinSysRes.SubtractBlock(iPoint, Res_Conv);
+      LinSysRes.AddBlock(jPoint, Res_Conv);
+    }
+    
+  }
+  
+  /*--- The Jacobian blocks are added by their position in the matrix, stored for each edge
+   in the constructor (the viscous terms subtract the blocks of the first point) ---*/
+  
+  if (val_implicit)
+    Jacobian.AddBlocks_Batch(val_edge, val_nLane, val_Jacobian_i, val_Jacobian_j, (val_viscous ? -1.0 : 1.0));
+  
+}
+
+void CEulerSolver::SetBatch_Check(CNumerics *numerics, unsigned short val_lane, bool val_implicit, CConfig *config) {
+  
+  unsigned short iVar, jVar;
+  
+  /*--- The variables of the edge are still set in the numerics (the lane is a copy) ---*/
+  
+  numerics->ComputeResidual(Res_Conv, Jacobian_i, Jacobian_j, config);
+  
+  for (iVar = 0; iVar < nVar; iVar++) {
+    Res_Batch_Check[iVar][val_lane] = Res_Conv[iVar];
+    if (val_implicit) {
+      for (jVar = 0; jVar < nVar; jVar++) {
+        Jacobian_i_Batch_Check[iVar*nVar+jVar][val_lane] = Jacobian_i[iVar][jVar];
+        Jacobian_j_Batch_Check[iVar*nVar+jVar][val_lane] = Jacobian_j[iVar][jVar];
+      }
+    }
+  }
+  
+}
+
+void CEulerSolver::CheckResidual_Batch(CGeometry *geometry, unsigned long *val_edge, unsigned short val_nLane,
+                                       double (*val_residual)[EDGE_BATCH_SIZE], double (*val_Jacobian_i)[EDGE_BATCH_SIZE],
+                                       double (*val_Jacobian_j)[EDGE_BATCH_SIZE], bool val_implicit) {
+  
+  unsigned short iLane, iEntry;
+  double Diff, MaxDiff_Res, MaxDiff_Jac;
+  
+  for (iLane = 0; iLane < val_nLane; iLane++) {
+    
+    /*--- Largest difference, relative to the edge by edge value (absolute below one) ---*/
+    
+    MaxDiff_Res = 0.0; MaxDiff_Jac = 0.0;
+    for (iEntry = 0; iEntry < nVar; iEntry++) {
+      Diff = fabs(val_residual[iEntry][iLane]-Res_Batch_Check[iEntry][iLane])/max(fabs(Res_Batch_Check[iEntry][iLane]), 1.0);
+      MaxDiff_Res = max(MaxDiff_Res, Diff);
+    }
+    if (val_implicit) {
+      for (iEntry = 0; iEntry < nVar*nVar; iEntry++) {
+        Diff = fabs(val_Jacobian_i[iEntry][iLane]-Jacobian_i_Batch_Check[iEntry][iLane])/max(fabs(Jacobian_i_Batch_Check[iEntry][iLane]), 1.0);
+        MaxDiff_Jac = max(MaxDiff_Jac, Diff);
+        Diff = fabs(val_Jacobian_j[iEntry][iLane]-Jacobian_j_Batch_Check[iEntry][iLane])/max(fabs(Jacobian_j_Batch_Check[iEntry][iLane]), 1.0);
+        MaxDiff_Jac = max(MaxDiff_Jac, Diff);
+      }
+    }
+    
+    if ((MaxDiff_Res > EDGE_BATCH_CHECK_TOL) || (MaxDiff_Jac > EDGE_BATCH_CHECK_TOL))
+      cout << "EDGE_BATCH_CHECK: edge " << val_edge[iLane] << " (points " << geometry->edge[val_edge[iLane]]->GetNode(0)
+      << ", " << geometry->edge[val_edge[iLane]]->GetNode(1) << "), difference of the residual " << MaxDiff_Res
+      << ", of the Jacobians " << MaxDiff_Jac << "." << endl;
+    
+  }
+  
+}
+
+void CEulerSolver::Upwind_Edge_Loop(CGeometry *geometry, CSolver **solver_container, CNumerics *numerics,
+                                    CNumerics *visc_numerics, CConfig *config, unsigned short iMesh) {
+  
   double **Gradient_i, **Gradient_j, Project_Grad_i, Project_Grad_j,
   *V_i, *V_j, *S_i, *S_j, *Limiter_i = NULL, *Limiter_j = NULL, YDistance, GradHidrosPress, sqvel;
-  unsigned long iEdge, iPoint, jPoint, counter_local = 0, counter_global = 0;
-  unsigned short iDim, iVar;
+  unsigned long iEdge, iPoint, jPoint, counter_local = 0, counter_global = 0, nEdge = geometry->GetnEdge(),
+  Edge_Batch[EDGE_BATCH_SIZE];
+  unsigned short iDim, iVar, jVar, nLane = 0;
   bool neg_density_i = false, neg_density_j = false, neg_pressure_i = false, neg_pressure_j = false;
   
   bool implicit         = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
@@ -3235,8 +3418,16 @@ void CEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_contain
   bool grid_movement    = config->GetGrid_Movement();
   bool roe_turkel       = (config->GetKind_Upwind_Flow() == TURKEL);
   bool sdwls = (config->GetKind_Reconst_Gradient_Method() == WLS || config->GetKind_Reconst_Gradient_Method() == SDWLS_QR || config->GetKind_Reconst_Gradient_Method() == SDWLS_DIRECT);
+  bool viscous          = (visc_numerics != NULL);
+  bool sst              = (config->GetKind_Turb_Model() == SST);
+  bool reference        = (viscous && (config->GetKind_Edge_Loop() == FUSED_EDGE_LOOP_REFERENCE));
+  bool batch            = (config->GetEdge_Batch() && numerics->GetBatched() && !viscous && !roe_turkel);
   
-  for(iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
+  /*--- In the reference mode the viscous fluxes are stored by edge (in the arrays
+   allocated by the constructor), and added after all the convective ones (same
+   summation order as separate loops) ---*/
+  
+  for(iEdge = 0; iEdge < nEdge; iEdge++) {
     
     /*--- Points in edge and normal vectors ---*/
     
@@ -3278,13 +3469,13 @@ void CEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_contain
 		Gradient_i = node[iPoint]->GetReconstGradient_Primitive();
 		Gradient_j = node[jPoint]->GetReconstGradient_Primitive();
 	  } else {
-		Gradient_i = node[iPoint]->GetGradient_Primitive();
-		Gradient_j = node[jPoint]->GetGradient_Primitive();
+		Gradient_i = node[iPoint]->GetGradient_Primitive(Gradient_Load_i);
+		Gradient_j = node[jPoint]->GetGradient_Primitive(Gradient_Load_j);
 	  }
       
       if (limiter) {
-    	Limiter_i = node[iPoint]->GetLimiter_Primitive();
-        Limiter_j = node[jPoint]->GetLimiter_Primitive();
+    	Limiter_i = node[iPoint]->GetLimiter_Primitive(Limiter_Load_i);
+        Limiter_j = node[jPoint]->GetLimiter_Primitive(Limiter_Load_j);
       }
       
       for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
@@ -3412,11 +3603,11 @@ void CEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_contain
           Vector_j[iDim] = 0.5*(geometry->node[iPoint]->GetCoord(iDim) - geometry->node[jPoint]->GetCoord(iDim));
         }
         
-        Gradient_i = node[iPoint]->GetGradient_Primitive();
-        Gradient_j = node[jPoint]->GetGradient_Primitive();
+        Gradient_i = node[iPoint]->GetGradient_Primitive(Gradient_Load_i);
+        Gradient_j = node[jPoint]->GetGradient_Primitive(Gradient_Load_j);
         if (limiter) {
-          Limiter_i = node[iPoint]->GetLimiter_Primitive();
-          Limiter_j = node[jPoint]->GetLimiter_Primitive();
+          Limiter_i = node[iPoint]->GetLimiter_Primitive(Limiter_Load_i);
+          Limiter_j = node[jPoint]->GetLimiter_Primitive(Limiter_Load_j);
         }
         
         /*--- Note that the pressure reconstruction always includes the hydrostatic gradient,
@@ -3453,6 +3644,22 @@ void CEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_contain
       
     }
     
+    /*--- Batched computation, the batch is computed when it is full or at the last edge ---*/
+    
+    if (batch) {
+      numerics->SetBatch_Lane(nLane);
+      if (config->GetEdge_Batch_Check()) SetBatch_Check(numerics, nLane, implicit, config);
+      Edge_Batch[nLane] = iEdge; nLane++;
+      if ((nLane == EDGE_BATCH_SIZE) || (iEdge == nEdge-1)) {
+        numerics->ComputeResidual_Batch(nLane, Res_Batch, Jacobian_i_Batch, Jacobian_j_Batch, config);
+        if (config->GetEdge_Batch_Check())
+          CheckResidual_Batch(geometry, Edge_Batch, nLane, Res_Batch, Jacobian_i_Batch, Jacobian_j_Batch, implicit);
+        AddResidual_Batch(geometry, Edge_Batch, nLane, Res_Batch, Jacobian_i_Batch, Jacobian_j_Batch, implicit, false);
+        nLane = 0;
+      }
+      continue;
+    }
+    
     /*--- Compute the residual ---*/
     
     numerics->ComputeResidual(Res_Conv, Jacobian_i, Jacobian_j, config);
@@ -3478,6 +3685,70 @@ void CEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_contain
       node[jPoint]->SetPreconditioner_Beta(numerics->GetPrecond_Beta());
     }
     
+    if (!viscous) continue;
+    
+    /*--- Viscous flux of the same edge (see CNSSolver::Viscous_Residual) ---*/
+    
+    visc_numerics->SetCoord(geometry->node[iPoint]->GetCoord(), geometry->node[jPoint]->GetCoord());
+    visc_numerics->SetNormal(geometry->edge[iEdge]->GetNormal());
+    visc_numerics->SetPrimitive(node[iPoint]->GetPrimitive(), node[jPoint]->GetPrimitive());
+    visc_numerics->SetPrimVarGradient(node[iPoint]->GetGradient_Primitive(Gradient_Load_i), node[jPoint]->GetGradient_Primitive(Gradient_Load_j));
+    if (sst)
+      visc_numerics->SetTurbKineticEnergy(solver_container[TURB_SOL]->node[iPoint]->GetSolution(0),
+                                          solver_container[TURB_SOL]->node[jPoint]->GetSolution(0));
+    
+    visc_numerics->ComputeResidual(Res_Visc, Jacobian_i, Jacobian_j, config);
+    
+    if (reference) {
+      for (iVar = 0; iVar < nVar; iVar++) {
+        Res_Visc_Edge[iEdge*nVar+iVar] = Res_Visc[iVar];
+        if (implicit) {
+          for (jVar = 0; jVar < nVar; jVar++) {
+            Jacobian_Edge[(2*iEdge)*nVar*nVar+iVar*nVar+jVar]   = Jacobian_i[iVar][jVar];
+            Jacobian_Edge[(2*iEdge+1)*nVar*nVar+iVar*nVar+jVar] = Jacobian_j[iVar][jVar];
+          }
+        }
+      }
+      continue;
+    }
+    
+    LinSysRes.SubtractBlock(iPoint, Res_Visc);
+    LinSysRes.AddBlock(jPoint, Res_Visc);
+    
+    if (implicit) {
+      Jacobian.SubtractBlock(iPoint, iPoint, Jacobian_i);
+      Jacobian.SubtractBlock(iPoint, jPoint, Jacobian_j);
+      Jacobian.AddBlock(jPoint, iPoint, Jacobian_i);
+      Jacobian.AddBlock(jPoint, jPoint, Jacobian_j);
+    }
+    
+  }
+  
+  /*--- Reference mode, add the stored viscous fluxes in edge order ---*/
+  
+  if (reference) {
+    
+    for (iEdge = 0; iEdge < nEdge; iEdge++) {
+      
+      iPoint = geometry->edge[iEdge]->GetNode(0); jPoint = geometry->edge[iEdge]->GetNode(1);
+      
+      LinSysRes.SubtractBlock(iPoint, &Res_Visc_Edge[iEdge*nVar]);
+      LinSysRes.AddBlock(jPoint, &Res_Visc_Edge[iEdge*nVar]);
+      
+      if (implicit) {
+        for (iVar = 0; iVar < nVar; iVar++)
+          for (jVar = 0; jVar < nVar; jVar++) {
+            Jacobian_i[iVar][jVar] = Jacobian_Edge[(2*iEdge)*nVar*nVar+iVar*nVar+jVar];
+            Jacobian_j[iVar][jVar] = Jacobian_Edge[(2*iEdge+1)*nVar*nVar+iVar*nVar+jVar];
+          }
+        Jacobian.SubtractBlock(iPoint, iPoint, Jacobian_i);
+        Jacobian.SubtractBlock(iPoint, jPoint, Jacobian_j);
+        Jacobian.AddBlock(jPoint, iPoint, Jacobian_i);
+        Jacobian.AddBlock(jPoint, jPoint, Jacobian_j);
+      }
+      
+    }
+    
   }
   
   /*--- Warning message about non-physical reconstructions ---*/
@@ -4264,106 +4535,96 @@ void CEulerSolver::Inviscid_Forces(CGeometry *geometry, CConfig *config) {
   
 #ifdef HAVE_MPI
   
-  /*--- Add AllBound information using all the nodes ---*/
-  
-  double MyAllBound_CDrag_Inv        = AllBound_CDrag_Inv;        AllBound_CDrag_Inv = 0.0;
-  double MyAllBound_CLift_Inv       = AllBound_CLift_Inv;        AllBound_CLift_Inv = 0.0;
-  double MyAllBound_CSideForce_Inv   = AllBound_CSideForce_Inv;   AllBound_CSideForce_Inv = 0.0;
-  double MyAllBound_CEff_Inv         = AllBound_CEff_Inv;         AllBound_CEff_Inv = 0.0;
-  double MyAllBound_CMx_Inv          = AllBound_CMx_Inv;          AllBound_CMx_Inv = 0.0;
-  double MyAllBound_CMy_Inv          = AllBound_CMy_Inv;          AllBound_CMy_Inv = 0.0;
-  double MyAllBound_CMz_Inv          = AllBound_CMz_Inv;          AllBound_CMz_Inv = 0.0;
-  double MyAllBound_CFx_Inv          = AllBound_CFx_Inv;          AllBound_CFx_Inv = 0.0;
-  double MyAllBound_CFy_Inv         = AllBound_CFy_Inv;          AllBound_CFy_Inv = 0.0;
-  double MyAllBound_CFz_Inv          = AllBound_CFz_Inv;          AllBound_CFz_Inv = 0.0;
-  double MyAllBound_CT_Inv           = AllBound_CT_Inv;           AllBound_CT_Inv = 0.0;
-  double MyAllBound_CQ_Inv           = AllBound_CQ_Inv;           AllBound_CQ_Inv = 0.0;
-  double MyAllBound_CMerit_Inv       = AllBound_CMerit_Inv;       AllBound_CMerit_Inv = 0.0;
-  double MyAllBound_CNearFieldOF_Inv = AllBound_CNearFieldOF_Inv; AllBound_CNearFieldOF_Inv = 0.0;
-  
-  MPI_Allreduce(&MyAllBound_CDrag_Inv, &AllBound_CDrag_Inv, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  MPI_Allreduce(&MyAllBound_CLift_Inv, &AllBound_CLift_Inv, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  MPI_Allreduce(&MyAllBound_CSideForce_Inv, &AllBound_CSideForce_Inv, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  AllBound_CEff_Inv = AllBound_CLift_Inv / (AllBound_CDrag_Inv + EPS);
-  MPI_Allreduce(&MyAllBound_CMx_Inv, &AllBound_CMx_Inv, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  MPI_Allreduce(&MyAllBound_CMy_Inv, &AllBound_CMy_Inv, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  MPI_Allreduce(&MyAllBound_CMz_Inv, &AllBound_CMz_Inv, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  MPI_Allreduce(&MyAllBound_CFx_Inv, &AllBound_CFx_Inv, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  MPI_Allreduce(&MyAllBound_CFy_Inv, &AllBound_CFy_Inv, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  MPI_Allreduce(&MyAllBound_CFz_Inv, &AllBound_CFz_Inv, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  MPI_Allreduce(&MyAllBound_CT_Inv, &AllBound_CT_Inv, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  MPI_Allreduce(&MyAllBound_CQ_Inv, &AllBound_CQ_Inv, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  AllBound_CMerit_Inv = AllBound_CT_Inv / (AllBound_CQ_Inv + EPS);
-  MPI_Allreduce(&MyAllBound_CNearFieldOF_Inv, &AllBound_CNearFieldOF_Inv, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  
-  /*--- Add the forces on the surfaces using all the nodes ---*/
-  
-  double *MySurface_CLift_Inv      = NULL;
-  double *MySurface_CDrag_Inv      = NULL;
-  double *MySurface_CSideForce_Inv = NULL;
-  double *MySurface_CFx_Inv        = NULL;
-  double *MySurface_CFy_Inv        = NULL;
-  double *MySurface_CFz_Inv        = NULL;
-  double *MySurface_CMx_Inv        = NULL;
-  double *MySurface_CMy_Inv        = NULL;
-  double *MySurface_CMz_Inv        = NULL;
-  
-  MySurface_CLift_Inv      = new double[config->GetnMarker_Monitoring()];
-  MySurface_CDrag_Inv      = new double[config->GetnMarker_Monitoring()];
-  MySurface_CSideForce_Inv = new double[config->GetnMarker_Monitoring()];
-  MySurface_CFx_Inv        = new double[config->GetnMarker_Monitoring()];
-  MySurface_CFy_Inv        = new double[config->GetnMarker_Monitoring()];
-  MySurface_CFz_Inv        = new double[config->GetnMarker_Monitoring()];
-  MySurface_CMx_Inv        = new double[config->GetnMarker_Monitoring()];
-  MySurface_CMy_Inv        = new double[config->GetnMarker_Monitoring()];
-  MySurface_CMz_Inv        = new double[config->GetnMarker_Monitoring()];
+  /*--- Add AllBound information using all the nodes. The coefficients of all
+   the boundaries and of the monitored surfaces are packed in one buffer and
+   reduced with a single collective. For the Navier-Stokes solver the reduction
+   is done in Viscous_Forces, together with the viscous coefficients. ---*/
   
-  for (iMarker_Monitoring = 0; iMarker_Monitoring < config->GetnMarker_Monitoring(); iMarker_Monitoring++) {
-    MySurface_CLift_Inv[iMarker_Monitoring]      = Surface_CLift_Inv[iMarker_Monitoring];
-    MySurface_CDrag_Inv[iMarker_Monitoring]      = Surface_CDrag_Inv[iMarker_Monitoring];
-    MySurface_CSideForce_Inv[iMarker_Monitoring] = Surface_CSideForce_Inv[iMarker_Monitoring];
-    MySurface_CFx_Inv[iMarker_Monitoring]        = Surface_CFx_Inv[iMarker_Monitoring];
-    MySurface_CFy_Inv[iMarker_Monitoring]        = Surface_CFy_Inv[iMarker_Monitoring];
-    MySurface_CFz_Inv[iMarker_Monitoring]        = Surface_CFz_Inv[iMarker_Monitoring];
-    MySurface_CMx_Inv[iMarker_Monitoring]        = Surface_CMx_Inv[iMarker_Monitoring];
-    MySurface_CMy_Inv[iMarker_Monitoring]        = Surface_CMy_Inv[iMarker_Monitoring];
-    MySurface_CMz_Inv[iMarker_Monitoring]        = Surface_CMz_Inv[iMarker_Monitoring];
+  if (!reduce_forces_visc) {
+    vector<double> MyForces, Forces;
+    unsigned long iForce = 0;
     
-    Surface_CLift_Inv[iMarker_Monitoring]      = 0.0;
-    Surface_CDrag_Inv[iMarker_Monitoring]      = 0.0;
-    Surface_CSideForce_Inv[iMarker_Monitoring] = 0.0;
-    Surface_CFx_Inv[iMarker_Monitoring]        = 0.0;
-    Surface_CFy_Inv[iMarker_Monitoring]        = 0.0;
-    Surface_CFz_Inv[iMarker_Monitoring]        = 0.0;
-    Surface_CMx_Inv[iMarker_Monitoring]        = 0.0;
-    Surface_CMy_Inv[iMarker_Monitoring]        = 0.0;
-    Surface_CMz_Inv[iMarker_Monitoring]        = 0.0;
+    Pack_Forces_Inv(config, MyForces);
+    Forces.resize(MyForces.size());
+    CProfiler::Start(PROFILE_MPI_REDUCE);
+    MPI_Allreduce(&MyForces[0], &Forces[0], MyForces.size(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+    CProfiler::Stop(PROFILE_MPI_REDUCE);
+    Unpack_Forces_Inv(config, Forces, iForce);
   }
   
-  MPI_Allreduce(MySurface_CLift_Inv, Surface_CLift_Inv, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  MPI_Allreduce(MySurface_CDrag_Inv, Surface_CDrag_Inv, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  MPI_Allreduce(MySurface_CSideForce_Inv, Surface_CSideForce_Inv, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  MPI_Allreduce(MySurface_CFx_Inv, Surface_CFx_Inv, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  MPI_Allreduce(MySurface_CFy_Inv, Surface_CFy_Inv, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  MPI_Allreduce(MySurface_CFz_Inv, Surface_CFz_Inv, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  MPI_Allreduce(MySurface_CMx_Inv, Surface_CMx_Inv, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  MPI_Allreduce(MySurface_CMy_Inv, Surface_CMy_Inv, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  MPI_Allreduce(MySurface_CMz_Inv, Surface_CMz_Inv, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  
-  delete [] MySurface_CLift_Inv;
-  delete [] MySurface_CDrag_Inv;
-  delete [] MySurface_CSideForce_Inv;
-  delete [] MySurface_CFx_Inv;
-  delete [] MySurface_CFy_Inv;
-  delete [] MySurface_CFz_Inv;
-  delete [] MySurface_CMx_Inv;
-  delete [] MySurface_CMy_Inv;
-  delete [] MySurface_CMz_Inv;
-  
 #endif
   
   /*--- Update the total coefficients (note that all the nodes have the same value) ---*/
   
+  SetTotal_Forces_Inv(config);
+  
+}
+
+void CEulerSolver::Pack_Forces_Inv(CConfig *config, vector<double> &val_buffer) {
+  unsigned short iMarker_Monitoring;
+  
+  val_buffer.push_back(AllBound_CDrag_Inv);
+  val_buffer.push_back(AllBound_CLift_Inv);
+  val_buffer.push_back(AllBound_CSideForce_Inv);
+  val_buffer.push_back(AllBound_CMx_Inv);
+  val_buffer.push_back(AllBound_CMy_Inv);
+  val_buffer.push_back(AllBound_CMz_Inv);
+  val_buffer.push_back(AllBound_CFx_Inv);
+  val_buffer.push_back(AllBound_CFy_Inv);
+  val_buffer.push_back(AllBound_CFz_Inv);
+  val_buffer.push_back(AllBound_CT_Inv);
+  val_buffer.push_back(AllBound_CQ_Inv);
+  val_buffer.push_back(AllBound_CNearFieldOF_Inv);
+  
+  for (iMarker_Monitoring = 0; iMarker_Monitoring < config->GetnMarker_Monitoring(); iMarker_Monitoring++) {
+    val_buffer.push_back(Surface_CLift_Inv[iMarker_Monitoring]);
+    val_buffer.push_back(Surface_CDrag_Inv[iMarker_Monitoring]);
+    val_buffer.push_back(Surface_CSideForce_Inv[iMarker_Monitoring]);
+    val_buffer.push_back(Surface_CFx_Inv[iMarker_Monitoring]);
+    val_buffer.push_back(Surface_CFy_Inv[iMarker_Monitoring]);
+    val_buffer.push_back(Surface_CFz_Inv[iMarker_Monitoring]);
+    val_buffer.push_back(Surface_CMx_Inv[iMarker_Monitoring]);
+    val_buffer.push_back(Surface_CMy_Inv[iMarker_Monitoring]);
+    val_buffer.push_back(Surface_CMz_Inv[iMarker_Monitoring]);
+  }
+  
+}
+
+void CEulerSolver::Unpack_Forces_Inv(CConfig *config, vector<double> &val_buffer, unsigned long &val_index) {
+  unsigned short iMarker_Monitoring;
+  
+  AllBound_CDrag_Inv        = val_buffer[val_index++];
+  AllBound_CLift_Inv        = val_buffer[val_index++];
+  AllBound_CSideForce_Inv   = val_buffer[val_index++];
+  AllBound_CMx_Inv          = val_buffer[val_index++];
+  AllBound_CMy_Inv          = val_buffer[val_index++];
+  AllBound_CMz_Inv          = val_buffer[val_index++];
+  AllBound_CFx_Inv          = val_buffer[val_index++];
+  AllBound_CFy_Inv          = val_buffer[val_index++];
+  AllBound_CFz_Inv          = val_buffer[val_index++];
+  AllBound_CT_Inv           = val_buffer[val_index++];
+  AllBound_CQ_Inv           = val_buffer[val_index++];
+  AllBound_CNearFieldOF_Inv = val_buffer[val_index++];
+  AllBound_CEff_Inv         = AllBound_CLift_Inv / (AllBound_CDrag_Inv + EPS);
+  AllBound_CMerit_Inv       = AllBound_CT_Inv / (AllBound_CQ_Inv + EPS);
+  
+  for (iMarker_Monitoring = 0; iMarker_Monitoring < config->GetnMarker_Monitoring(); iMarker_Monitoring++) {
+    Surface_CLift_Inv[iMarker_Monitoring]      = val_buffer[val_index++];
+    Surface_CDrag_Inv[iMarker_Monitoring]      = val_buffer[val_index++];
+    Surface_CSideForce_Inv[iMarker_Monitoring] = val_buffer[val_index++];
+    Surface_CFx_Inv[iMarker_Monitoring]        = val_buffer[val_index++];
+    Surface_CFy_Inv[iMarker_Monitoring]        = val_buffer[val_index++];
+    Surface_CFz_Inv[iMarker_Monitoring]        = val_buffer[val_index++];
+    Surface_CMx_Inv[iMarker_Monitoring]        = val_buffer[val_index++];
+    Surface_CMy_Inv[iMarker_Monitoring]        = val_buffer[val_index++];
+    Surface_CMz_Inv[iMarker_Monitoring]        = val_buffer[val_index++];
+  }
+  
+}
+
+void CEulerSolver::SetTotal_Forces_Inv(CConfig *config) {
+  unsigned short iMarker_Monitoring;
+  
   Total_CDrag         = AllBound_CDrag_Inv;
   Total_CLift         = AllBound_CLift_Inv;
   Total_CSideForce    = AllBound_CSideForce_Inv;
@@ -4575,10 +4836,61 @@ void CEulerSolver::ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solver
 }
 
 void CEulerSolver::SetPrimitive_Gradient_GG(CGeometry *geometry, CConfig *config) {
+  CProfilerTimer Profile_Timer(PROFILE_GRADIENT);
+  
   unsigned long iPoint, jPoint, iEdge, iVertex;
-  unsigned short iDim, iVar, iMarker;
+  unsigned short iDim, iVar, iMarker, iNeigh;
   double *PrimVar_Vertex, *PrimVar_i, *PrimVar_j, PrimVar_Average,
-  Partial_Gradient, Partial_Res, *Normal;
+  Partial_Gradient, Partial_Res, *Normal, Sign, Volume, Gradient_Sum[MAX_PRIMVAR_GRAD][3];
+  long iVertex_Point;
+  
+  /*--- If the gradient is stored in single precision, the sums of each point
+   are done in double over its edges and boundary faces, and rounded once ---*/
+  if (config->GetSingle_Precision_Gradient()) {
+    
+    for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+      
+      for (iVar = 0; iVar < nPrimVarGrad; iVar++)
+        for (iDim = 0; iDim < nDim; iDim++)
+          Gradient_Sum[iVar][iDim] = 0.0;
+      
+      /*--- Edges of the point, the normal points from the first to the second node ---*/
+      for (iNeigh = 0; iNeigh < geometry->node[iPoint]->GetnPoint(); iNeigh++) {
+        jPoint = geometry->node[iPoint]->GetPoint(iNeigh);
+        iEdge = geometry->node[iPoint]->GetEdge(iNeigh);
+        Normal = geometry->edge[iEdge]->GetNormal();
+        Sign = (geometry->edge[iEdge]->GetNode(0) == iPoint) ? 1.0 : -1.0;
+        for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
+          PrimVar_Average = 0.5 * ( node[iPoint]->GetPrimitive(iVar) + node[jPoint]->GetPrimitive(iVar) );
+          for (iDim = 0; iDim < nDim; iDim++)
+            Gradient_Sum[iVar][iDim] += Sign*PrimVar_Average*Normal[iDim];
+        }
+      }
+      
+      /*--- Boundary faces of the point ---*/
+      for (iMarker = 0; iMarker < geometry->GetnMarker(); iMarker++) {
+        iVertex_Point = geometry->node[iPoint]->GetVertex(iMarker);
+        if (iVertex_Point != -1) {
+          Normal = geometry->vertex[iMarker][iVertex_Point]->GetNormal();
+          for (iVar = 0; iVar < nPrimVarGrad; iVar++)
+            for (iDim = 0; iDim < nDim; iDim++)
+              Gradient_Sum[iVar][iDim] -= node[iPoint]->GetPrimitive(iVar)*Normal[iDim];
+        }
+      }
+      
+      Volume = geometry->node[iPoint]->GetVolume();
+      for (iVar = 0; iVar < nPrimVarGrad; iVar++)
+        for (iDim = 0; iDim < nDim; iDim++)
+          node[iPoint]->SetGradient_Primitive(iVar, iDim, Gradient_Sum[iVar][iDim] / Volume);
+      
+    }
+    
+    Set_MPI_Primitive_Gradient(geometry, config);
+    
+    SetDerived_Computed(DERIVED_PRIM_GRADIENT);
+    
+    return;
+  }
   
   /*--- Gradient primitive variables compressible (temp, vx, vy, vz, P, rho)
    Gradient primitive variables incompressible (rho, vx, vy, vz, beta) ---*/
@@ -4648,9 +4960,12 @@ void CEulerSolver::SetPrimitive_Gradient_GG(CGeometry *geometry, CConfig *config
   
   Set_MPI_Primitive_Gradient(geometry, config);
   
+  SetDerived_Computed(DERIVED_PRIM_GRADIENT);
+  
 }
 
 void CEulerSolver::SetPrimitive_Reconst_Gradient_WLS(CGeometry *geometry, CConfig *config) {
+  CProfilerTimer Profile_Timer(PROFILE_GRADIENT);
   
   unsigned short iVar, iDim, jDim, iNeigh , iMarker;
   unsigned long iPoint, jPoint, iEdge, iVertex;
@@ -4869,6 +5184,7 @@ void CEulerSolver::SetPrimitive_Reconst_Gradient_WLS(CGeometry *geometry, CConfi
 
 
 void CEulerSolver::SetPrimitive_Reconst_Gradient_SDWLS_QR(CGeometry *geometry, CConfig *config) {
+  CProfilerTimer Profile_Timer(PROFILE_GRADIENT);
   
   unsigned short iVar, iDim, jDim, iNeigh , iMarker;
   unsigned long iPoint, jPoint, iEdge, iVertex;
@@ -5309,6 +5625,7 @@ if (nDim==2) {
 
 
 void CEulerSolver::SetPrimitive_Reconst_Gradient_SDWLS_DIRECT(CGeometry *geometry, CConfig *config) {
+  CProfilerTimer Profile_Timer(PROFILE_GRADIENT);
   
  
   unsigned short iVar, iDim, jDim, iNeigh , iMarker;
@@ -5403,6 +5720,7 @@ void CEulerSolver::SetPrimitive_Reconst_Gradient_SDWLS_DIRECT(CGeometry *geometr
 
 
 void CEulerSolver::SetPrimitive_Gradient_LS(CGeometry *geometry, CConfig *config) {
+  CProfilerTimer Profile_Timer(PROFILE_GRADIENT);
   
   unsigned short iVar, iDim, jDim, iNeigh;
   unsigned long iPoint, jPoint;
@@ -5535,10 +5853,13 @@ void CEulerSolver::SetPrimitive_Gradient_LS(CGeometry *geometry, CConfig *config
   
   Set_MPI_Primitive_Gradient(geometry, config);
   
+  SetDerived_Computed(DERIVED_PRIM_GRADIENT);
+  
 }
 
 
 void CEulerSolver::SetPrimitive_Limiter(CGeometry *geometry, CConfig *config) {
+  CProfilerTimer Profile_Timer(PROFILE_GRADIENT);
   
   unsigned long iEdge, iPoint, jPoint;
   unsigned short iVar, iDim;
@@ -5590,8 +5911,8 @@ void CEulerSolver::SetPrimitive_Limiter(CGeometry *geometry, CConfig *config) {
       
       iPoint     = geometry->edge[iEdge]->GetNode(0);
       jPoint     = geometry->edge[iEdge]->GetNode(1);
-      Gradient_i = node[iPoint]->GetGradient_Primitive();
-      Gradient_j = node[jPoint]->GetGradient_Primitive();
+      Gradient_i = node[iPoint]->GetGradient_Primitive(Gradient_Load_i);
+      Gradient_j = node[jPoint]->GetGradient_Primitive(Gradient_Load_j);
       Coord_i    = geometry->node[iPoint]->GetCoord();
       Coord_j    = geometry->node[jPoint]->GetCoord();
       
@@ -5658,8 +5979,8 @@ void CEulerSolver::SetPrimitive_Limiter(CGeometry *geometry, CConfig *config) {
       
       iPoint     = geometry->edge[iEdge]->GetNode(0);
       jPoint     = geometry->edge[iEdge]->GetNode(1);
-      Gradient_i = node[iPoint]->GetGradient_Primitive();
-      Gradient_j = node[jPoint]->GetGradient_Primitive();
+      Gradient_i = node[iPoint]->GetGradient_Primitive(Gradient_Load_i);
+      Gradient_j = node[jPoint]->GetGradient_Primitive(Gradient_Load_j);
       Coord_i    = geometry->node[iPoint]->GetCoord();
       Coord_j    = geometry->node[jPoint]->GetCoord();
       
@@ -5704,9 +6025,13 @@ void CEulerSolver::SetPrimitive_Limiter(CGeometry *geometry, CConfig *config) {
   
   Set_MPI_Primitive_Limiter(geometry, config);
   
+  SetDerived_Computed(DERIVED_PRIM_LIMITER);
+  
 }
 
 void CEulerSolver::SetSecondary_Gradient_GG(CGeometry *geometry, CConfig *config) {
+  CProfilerTimer Profile_Timer(PROFILE_GRADIENT);
+  
   unsigned long iPoint, jPoint, iEdge, iVertex;
   unsigned short iDim, iVar, iMarker;
   double *SecondaryVar_Vertex, *SecondaryVar_i, *SecondaryVar_j, SecondaryVar_Average,
@@ -5783,6 +6108,7 @@ void CEulerSolver::SetSecondary_Gradient_GG(CGeometry *geometry, CConfig *config
 }
 
 void CEulerSolver::SetSecondary_Gradient_LS(CGeometry *geometry, CConfig *config) {
+  CProfilerTimer Profile_Timer(PROFILE_GRADIENT);
   
   unsigned short iVar, iDim, jDim, iNeigh;
   unsigned long iPoint, jPoint;
@@ -5920,6 +6246,7 @@ void CEulerSolver::SetSecondary_Gradient_LS(CGeometry *geometry, CConfig *config
 
 
 void CEulerSolver::SetSecondary_Limiter(CGeometry *geometry, CConfig *config) {
+  CProfilerTimer Profile_Timer(PROFILE_GRADIENT);
   
   unsigned long iEdge, iPoint, jPoint;
   unsigned short iVar, iDim;
@@ -7129,8 +7456,8 @@ void CEulerSolver::BC_Far_Field(CGeometry *geometry, CSolver **solver_container,
         
         /*--- Primitive variables, and gradient ---*/
         visc_numerics->SetPrimitive(V_domain, V_infty);
-        visc_numerics->SetPrimVarGradient(node[iPoint]->GetGradient_Primitive(),
-                                          node[iPoint]->GetGradient_Primitive());
+        visc_numerics->SetPrimVarGradient(node[iPoint]->GetGradient_Primitive(Gradient_Load_i),
+                                          node[iPoint]->GetGradient_Primitive(Gradient_Load_i));
         
         /*--- Turbulent kinetic energy ---*/
         if (config->GetKind_Turb_Model() == SST)
@@ -7625,7 +7952,7 @@ void CEulerSolver::BC_Riemann(CGeometry *geometry, CSolver **solver_container,
 
         /*--- Primitive variables, and gradient ---*/
         visc_numerics->SetPrimitive(V_domain, V_boundary);
-        visc_numerics->SetPrimVarGradient(node[iPoint]->GetGradient_Primitive(), node[iPoint]->GetGradient_Primitive());
+        visc_numerics->SetPrimVarGradient(node[iPoint]->GetGradient_Primitive(Gradient_Load_i), node[iPoint]->GetGradient_Primitive(Gradient_Load_i));
 
         /*--- Turbulent kinetic energy ---*/
         if (config->GetKind_Turb_Model() == SST)
@@ -7787,7 +8114,7 @@ void CEulerSolver::BC_Xinlet(CGeometry *geometry, CSolver **solver_container,
         
         /*--- Primitive variables, and gradient ---*/
         visc_numerics->SetPrimitive(V_domain, V_inlet);
-        visc_numerics->SetPrimVarGradient(node[iPoint]->GetGradient_Primitive(), node[iPoint]->GetGradient_Primitive());
+        visc_numerics->SetPrimVarGradient(node[iPoint]->GetGradient_Primitive(Gradient_Load_i), node[iPoint]->GetGradient_Primitive(Gradient_Load_i));
         
         /*--- Turbulent kinetic energy ---*/
         if (config->GetKind_Turb_Model() == SST)
@@ -7940,7 +8267,7 @@ void CEulerSolver::BC_Xoutlet(CGeometry *geometry, CSolver **solver_container,
         
         /*--- Primitive variables, and gradient ---*/
         visc_numerics->SetPrimitive(V_domain, V_outlet);
-        visc_numerics->SetPrimVarGradient(node[iPoint]->GetGradient_Primitive(), node[iPoint]->GetGradient_Primitive());
+        visc_numerics->SetPrimVarGradient(node[iPoint]->GetGradient_Primitive(Gradient_Load_i), node[iPoint]->GetGradient_Primitive(Gradient_Load_i));
         
         /*--- Turbulent kinetic energy ---*/
         if (config->GetKind_Turb_Model() == SST)
@@ -8260,7 +8587,7 @@ void CEulerSolver::BC_Inlet(CGeometry *geometry, CSolver **solver_container,
         
         /*--- Primitive variables, and gradient ---*/
         visc_numerics->SetPrimitive(V_domain, V_inlet);
-        visc_numerics->SetPrimVarGradient(node[iPoint]->GetGradient_Primitive(), node[iPoint]->GetGradient_Primitive());
+        visc_numerics->SetPrimVarGradient(node[iPoint]->GetGradient_Primitive(Gradient_Load_i), node[iPoint]->GetGradient_Primitive(Gradient_Load_i));
         
         /*--- Turbulent kinetic energy ---*/
         if (config->GetKind_Turb_Model() == SST)
@@ -8501,7 +8828,7 @@ void CEulerSolver::BC_Outlet(CGeometry *geometry, CSolver **solver_container,
         
         /*--- Primitive variables, and gradient ---*/
         visc_numerics->SetPrimitive(V_domain, V_outlet);
-        visc_numerics->SetPrimVarGradient(node[iPoint]->GetGradient_Primitive(), node[iPoint]->GetGradient_Primitive());
+        visc_numerics->SetPrimVarGradient(node[iPoint]->GetGradient_Primitive(Gradient_Load_i), node[iPoint]->GetGradient_Primitive(Gradient_Load_i));
         
         /*--- Turbulent kinetic energy ---*/
         if (config->GetKind_Turb_Model() == SST)
@@ -8633,7 +8960,7 @@ void CEulerSolver::BC_Supersonic_Inlet(CGeometry *geometry, CSolver **solver_con
         
         /*--- Primitive variables, and gradient ---*/
         visc_numerics->SetPrimitive(V_domain, V_inlet);
-        visc_numerics->SetPrimVarGradient(node[iPoint]->GetGradient_Primitive(), node[iPoint]->GetGradient_Primitive());
+        visc_numerics->SetPrimVarGradient(node[iPoint]->GetGradient_Primitive(Gradient_Load_i), node[iPoint]->GetGradient_Primitive(Gradient_Load_i));
         
         /*--- Turbulent kinetic energy ---*/
         if (config->GetKind_Turb_Model() == SST)
@@ -8802,7 +9129,7 @@ void CEulerSolver::BC_Nacelle_Inflow(CGeometry *geometry, CSolver **solver_conta
         /*--- Primitive variables, and gradient ---*/
         
         visc_numerics->SetPrimitive(V_domain, V_inflow);
-        visc_numerics->SetPrimVarGradient(node[iPoint]->GetGradient_Primitive(), node[iPoint]->GetGradient_Primitive());
+        visc_numerics->SetPrimVarGradient(node[iPoint]->GetGradient_Primitive(Gradient_Load_i), node[iPoint]->GetGradient_Primitive(Gradient_Load_i));
         
         /*--- Turbulent kinetic energy ---*/
         
@@ -9017,7 +9344,7 @@ void CEulerSolver::BC_Nacelle_Exhaust(CGeometry *geometry, CSolver **solver_cont
         /*--- Primitive variables, and gradient ---*/
         
         visc_numerics->SetPrimitive(V_domain, V_exhaust);
-        visc_numerics->SetPrimVarGradient(node[iPoint]->GetGradient_Primitive(), node[iPoint]->GetGradient_Primitive());
+        visc_numerics->SetPrimVarGradient(node[iPoint]->GetGradient_Primitive(Gradient_Load_i), node[iPoint]->GetGradient_Primitive(Gradient_Load_i));
         
         /*--- Turbulent kinetic energy ---*/
         
@@ -9680,105 +10007,81 @@ void CEulerSolver::SetResidual_DualTime(CGeometry *geometry, CSolver **solver_co
   
 }
 
+void CEulerSolver::SetFSI_Interface(CGeometry **geometry, CConfig *config, CGeometry **donor_geometry, CConfig *donor_config) {
+  
+  unsigned short iMarker;
+  
+  /*--- The moving markers of the flow receive the displacements of
+   the flow load markers of the structure ---*/
+  
+  bool *Target_Marker = new bool [config->GetnMarker_All()];
+  bool *Donor_Marker = new bool [donor_config->GetnMarker_All()];
+  
+  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++)
+    Target_Marker[iMarker] = (config->GetMarker_All_Moving(iMarker) == YES);
+  for (iMarker = 0; iMarker < donor_config->GetnMarker_All(); iMarker++)
+    Donor_Marker[iMarker] = (donor_config->GetMarker_All_KindBC(iMarker) == FLOWLOAD_BOUNDARY);
+  
+  SetInterface_Map(geometry[MESH_0], Target_Marker, donor_geometry[MESH_0], Donor_Marker);
+  
+  delete [] Target_Marker;
+  delete [] Donor_Marker;
+  
+}
+
 void CEulerSolver::SetFlow_Displacement(CGeometry **flow_geometry, CVolumetricMovement *flow_grid_movement,
                                         CConfig *flow_config, CConfig *fea_config, CGeometry **fea_geometry, CSolver ***fea_solution) {
-  //  unsigned short iMarker, iDim;
-  //  unsigned long iVertex, iPoint;
-  //  double *Coord, VarCoord[3];
-  //
-  //#ifndef HAVE_MPI
-  //  unsigned long iPoint_Donor;
-  //  double *CoordDonor, *DisplacementDonor;
-  //
-  //  for (iMarker = 0; iMarker < flow_config->GetnMarker_All(); iMarker++) {
-  //    if (flow_config->GetMarker_All_Moving(iMarker) == YES) {
-  //      for(iVertex = 0; iVertex < flow_geometry[MESH_0]->nVertex[iMarker]; iVertex++) {
-  //        iPoint = flow_geometry[MESH_0]->vertex[iMarker][iVertex]->GetNode();
-  //        iPoint_Donor = flow_geometry[MESH_0]->vertex[iMarker][iVertex]->GetDonorPoint();
-  //        Coord = flow_geometry[MESH_0]->node[iPoint]->GetCoord();
-  //        CoordDonor = fea_geometry[MESH_0]->node[iPoint_Donor]->GetCoord();
-  //        DisplacementDonor = fea_solution[MESH_0][FEA_SOL]->node[iPoint_Donor]->GetSolution();
-  //
-  //        for (iDim = 0; iDim < nDim; iDim++)
-  //          VarCoord[iDim] = (CoordDonor[iDim]+DisplacementDonor[iDim])-Coord[iDim];
-  //
-  //        flow_geometry[MESH_0]->vertex[iMarker][iVertex]->SetVarCoord(VarCoord);
-  //      }
-  //    }
-  //  }
-  //  flow_grid_movement->SetVolume_Deformation(flow_geometry[MESH_0], flow_config, true);
-  //
-  //#else
-  //
-  //  int rank = MPI::COMM_WORLD.Get_rank(), jProcessor;
-  //  double *Buffer_Send_Coord = new double [nDim];
-  //  double *Buffer_Receive_Coord = new double [nDim];
-  //  unsigned long jPoint;
-  //
-  //  /*--- Do the send process, by the moment we are sending each
-  //   node individually, this must be changed ---*/
-  //  for (iMarker = 0; iMarker < fea_config->GetnMarker_All(); iMarker++) {
-  //    if (fea_config->GetMarker_All_KindBC(iMarker) == LOAD_BOUNDARY) {
-  //      for(iVertex = 0; iVertex < fea_geometry[MESH_0]->nVertex[iMarker]; iVertex++) {
-  //        iPoint = fea_geometry[MESH_0]->vertex[iMarker][iVertex]->GetNode();
-  //
-  //        if (fea_geometry[MESH_0]->node[iPoint]->GetDomain()) {
-  //
-  //          /*--- Find the associate pair to the original node (index and processor) ---*/
-  //          jPoint = fea_geometry[MESH_0]->vertex[iMarker][iVertex]->GetPeriodicPointDomain()[0];
-  //          jProcessor = fea_geometry[MESH_0]->vertex[iMarker][iVertex]->GetPeriodicPointDomain()[1];
-  //
-  //          /*--- We only send the pressure that belong to other boundary ---*/
-  //          if (jProcessor != rank) {
-  //            for (iDim = 0; iDim < nDim; iDim++)
-  //              Buffer_Send_Coord[iDim] = fea_geometry[MESH_0]->node[iPoint]->GetCoord(iDim);
-  //
-  //            MPI::COMM_WORLD.Bsend(Buffer_Send_Coord, nDim, MPI::DOUBLE, jProcessor, iPoint);
-  //          }
-  //
-  //        }
-  //      }
-  //    }
-  //  }
-  //
-  //  /*--- Now the loop is over the fea points ---*/
-  //  for (iMarker = 0; iMarker < flow_config->GetnMarker_All(); iMarker++) {
-  //    if ((flow_config->GetMarker_All_KindBC(iMarker) == EULER_WALL) &&
-  //        (flow_config->GetMarker_All_Moving(iMarker) == YES)) {
-  //      for(iVertex = 0; iVertex < flow_geometry[MESH_0]->nVertex[iMarker]; iVertex++) {
-  //        iPoint = flow_geometry[MESH_0]->vertex[iMarker][iVertex]->GetNode();
-  //        if (flow_geometry[MESH_0]->node[iPoint]->GetDomain()) {
-  //
-  //          /*--- Find the associate pair to the original node ---*/
-  //          jPoint = flow_geometry[MESH_0]->vertex[iMarker][iVertex]->GetPeriodicPointDomain()[0];
-  //          jProcessor = flow_geometry[MESH_0]->vertex[iMarker][iVertex]->GetPeriodicPointDomain()[1];
-  //
-  //          /*--- We only receive the information that belong to other boundary ---*/
-  //          if (jProcessor != rank)
-  //            MPI::COMM_WORLD.Recv(Buffer_Receive_Coord, nDim, MPI::DOUBLE, jProcessor, jPoint);
-  //          else {
-  //            for (iDim = 0; iDim < nDim; iDim++)
-  //              Buffer_Send_Coord[iDim] = fea_geometry[MESH_0]->node[jPoint]->GetCoord(iDim);
-  //          }
-  //
-  //          /*--- Store the solution for both points ---*/
-  //          Coord = flow_geometry[MESH_0]->node[iPoint]->GetCoord();
-  //
-  //          for (iDim = 0; iDim < nDim; iDim++)
-  //            VarCoord[iDim] = Buffer_Send_Coord[iDim]-Coord[iDim];
-  //
-  //          flow_geometry[MESH_0]->vertex[iMarker][iVertex]->SetVarCoord(VarCoord);
-  //
-  //
-  //        }
-  //      }
-  //    }
-  //  }
-  //  delete[] Buffer_Send_Coord;
-  //  delete[] Buffer_Receive_Coord;
-  //
-  //#endif
-  //
+  
+  unsigned short iMarker, iDim, iDonor;
+  unsigned long iVertex, iPoint, iTarget, iSend, iSlot;
+  double *Coord, *Coord_Donor, *Displacement_Donor, VarCoord[3] = {0.0, 0.0, 0.0}, Weight;
+  
+  if (!Interface_Map) SetFSI_Interface(flow_geometry, flow_config, fea_geometry, fea_config);
+  
+  /*--- Deformed position of the structural points requested by the other ranks ---*/
+  
+  double *Buffer_Send = new double [nInterface_Send*nDim];
+  double *Buffer_Receive = new double [nInterface_Receive*nDim];
+  
+  for (iSend = 0; iSend < nInterface_Send; iSend++) {
+    iPoint = Interface_Send_Point[iSend];
+    Coord_Donor = fea_geometry[MESH_0]->node[iPoint]->GetCoord();
+    Displacement_Donor = fea_solution[MESH_0][FEA_SOL]->node[iPoint]->GetSolution();
+    for (iDim = 0; iDim < nDim; iDim++)
+      Buffer_Send[iSend*nDim+iDim] = Coord_Donor[iDim] + Displacement_Donor[iDim];
+  }
+  
+  SetInterface_Exchange(Buffer_Send, Buffer_Receive, nDim);
+  
+  /*--- Interpolate the deformed position at the moving vertices of the flow ---*/
+  
+  for (iTarget = 0; iTarget < nInterface_Target; iTarget++) {
+    iMarker = Interface_Target_Marker[iTarget];
+    iVertex = Interface_Target_Vertex[iTarget];
+    iPoint = flow_geometry[MESH_0]->vertex[iMarker][iVertex]->GetNode();
+    Coord = flow_geometry[MESH_0]->node[iPoint]->GetCoord();
+    
+    for (iDim = 0; iDim < nDim; iDim++) VarCoord[iDim] = -Coord[iDim];
+    for (iDonor = 0; iDonor < INTERFACE_NDONOR; iDonor++) {
+      iSlot = Interface_Donor_Slot[iTarget*INTERFACE_NDONOR+iDonor];
+      Weight = Interface_Donor_Weight[iTarget*INTERFACE_NDONOR+iDonor];
+      for (iDim = 0; iDim < nDim; iDim++)
+        VarCoord[iDim] += Weight*Buffer_Receive[iSlot*nDim+iDim];
+    }
+    
+    flow_geometry[MESH_0]->vertex[iMarker][iVertex]->SetVarCoord(VarCoord);
+  }
+  
+  delete [] Buffer_Send;
+  delete [] Buffer_Receive;
+  
+  /*--- Deform the volume grid, and update the coarse levels ---*/
+  
+  flow_grid_movement->SetVolume_Deformation(flow_geometry[MESH_0], flow_config, true);
+  flow_grid_movement->UpdateMultiGrid(flow_geometry, flow_config);
+  
+  SetDerived_Invalid();
+  
 }
 
 void CEulerSolver::LoadRestart(CGeometry **geometry, CSolver ***solver, CConfig *config, int val_iter) {
@@ -10190,6 +10493,11 @@ CNSSolver::CNSSolver(void) : CEulerSolver() {
   MomentViscous = NULL;
   CSkinFriction = NULL;
   
+  /*--- The inviscid coefficients are reduced together with the viscous
+   ones in Viscous_Forces, whatever the kind of problem ---*/
+  
+  reduce_forces_visc = true;
+  
 }
 
 CNSSolver::CNSSolver(CGeometry *geometry, CConfig *config, unsigned short iMesh) : CEulerSolver() {
@@ -10238,6 +10546,11 @@ CNSSolver::CNSSolver(CGeometry *geometry, CConfig *config, unsigned short iMesh)
   CSkinFriction = NULL;
   Cauchy_Serie = NULL;
   
+  /*--- The inviscid coefficients are reduced together with the viscous
+   ones in Viscous_Forces, whatever the kind of problem ---*/
+  
+  reduce_forces_visc = true;
+  
   int rank = MASTER_NODE;
 #ifdef HAVE_MPI
   MPI_Comm_rank(MPI_COMM_WORLD, &rank);
@@ -10349,11 +10662,37 @@ CNSSolver::CNSSolver(CGeometry *geometry, CConfig *config, unsigned short iMesh)
       if (rank == MASTER_NODE) cout << "Compute linelet structure. " << nLineLets << " elements in each line (average)." << endl;
     }
     
+    /*--- Position of the blocks of each edge, for the batched edge loops ---*/
+    
+    if (config->GetEdge_Batch()) Jacobian.SetEdge_Block(geometry);
+    
   } else {
     if (rank == MASTER_NODE)
       cout << "Explicit scheme. No Jacobian structure (Navier-Stokes). MG level: " << iMesh <<"." << endl;
   }
   
+  /*--- Work arrays of the batched edge loops (EDGE_BATCH) ---*/
+  
+  if (config->GetEdge_Batch()) {
+    Res_Batch = new double [nVar][EDGE_BATCH_SIZE];
+    Jacobian_i_Batch = new double [nVar*nVar][EDGE_BATCH_SIZE];
+    Jacobian_j_Batch = new double [nVar*nVar][EDGE_BATCH_SIZE];
+    if (config->GetEdge_Batch_Check()) {
+      Res_Batch_Check = new double [nVar][EDGE_BATCH_SIZE];
+      Jacobian_i_Batch_Check = new double [nVar*nVar][EDGE_BATCH_SIZE];
+      Jacobian_j_Batch_Check = new double [nVar*nVar][EDGE_BATCH_SIZE];
+    }
+  }
+  
+  /*--- Viscous fluxes of the edges, stored until all the convective ones are
+   added (EDGE_LOOP= FUSED_REFERENCE) ---*/
+  
+  if (config->GetKind_Edge_Loop() == FUSED_EDGE_LOOP_REFERENCE) {
+    Res_Visc_Edge = new double [geometry->GetnEdge()*nVar];
+    if (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT)
+      Jacobian_Edge = new double [2*geometry->GetnEdge()*nVar*nVar];
+  }
+  
   /*--- Define some auxiliary vectors for computing flow variable gradients by least squares ---*/
   if (config->GetKind_Gradient_Method() == WEIGHTED_LEAST_SQUARES) {
     
@@ -10743,6 +11082,7 @@ CNSSolver::~CNSSolver(void) {
 }
 
 void CNSSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container, CConfig *config, unsigned short iMesh, unsigned short iRKStep, unsigned short RunTime_EqSystem, bool Output) {
+  CProfilerTimer Profile_Timer(PROFILE_PREPROCESSING);
   
   unsigned long iPoint, ErrorCounter = 0;
   double eddy_visc = 0.0, turb_ke = 0.0;
@@ -10811,6 +11151,8 @@ void CNSSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container, C
     
   }
   
+  SetDerived_Computed(DERIVED_PRIMITIVE);
+  
   /*--- Artificial dissipation ---*/
   
   if (center) {
@@ -11073,12 +11415,21 @@ void CNSSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_container, CC
   
 }
 
+void CNSSolver::Upwind_Viscous_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics *conv_numerics,
+                                        CNumerics *visc_numerics, CConfig *config, unsigned short iMesh, unsigned short iRKStep) {
+  
+  Upwind_Edge_Loop(geometry, solver_container, conv_numerics, visc_numerics, config, iMesh);
+  
+}
+
 void CNSSolver::Viscous_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics *numerics,
                                  CConfig *config, unsigned short iMesh, unsigned short iRKStep) {
   
-  unsigned long iPoint, jPoint, iEdge;
+  unsigned long iPoint, jPoint, iEdge, Edge_Batch[EDGE_BATCH_SIZE];
+  unsigned short nLane = 0;
   
   bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  bool batch = (config->GetEdge_Batch() && numerics->GetBatched());
   
   for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
     
@@ -11092,7 +11443,7 @@ void CNSSolver::Viscous_Residual(CGeometry *geometry, CSolver **solver_container
     /*--- Primitive variables, and gradient ---*/
     
     numerics->SetPrimitive(node[iPoint]->GetPrimitive(), node[jPoint]->GetPrimitive());
-    numerics->SetPrimVarGradient(node[iPoint]->GetGradient_Primitive(), node[jPoint]->GetGradient_Primitive());
+    numerics->SetPrimVarGradient(node[iPoint]->GetGradient_Primitive(Gradient_Load_i), node[jPoint]->GetGradient_Primitive(Gradient_Load_j));
     
     /*--- Turbulent kinetic energy ---*/
     
@@ -11100,6 +11451,22 @@ void CNSSolver::Viscous_Residual(CGeometry *geometry, CSolver **solver_container
       numerics->SetTurbKineticEnergy(solver_container[TURB_SOL]->node[iPoint]->GetSolution(0),
                                      solver_container[TURB_SOL]->node[jPoint]->GetSolution(0));
     
+    /*--- Batched computation, the batch is computed when it is full or at the last edge ---*/
+    
+    if (batch) {
+      numerics->SetBatch_Lane(nLane);
+      if (config->GetEdge_Batch_Check()) SetBatch_Check(numerics, nLane, implicit, config);
+      Edge_Batch[nLane] = iEdge; nLane++;
+      if ((nLane == EDGE_BATCH_SIZE) || (iEdge == geometry->GetnEdge()-1)) {
+        numerics->ComputeResidual_Batch(nLane, Res_Batch, Jacobian_i_Batch, Jacobian_j_Batch, config);
+        if (config->GetEdge_Batch_Check())
+          CheckResidual_Batch(geometry, Edge_Batch, nLane, Res_Batch, Jacobian_i_Batch, Jacobian_j_Batch, implicit);
+        AddResidual_Batch(geometry, Edge_Batch, nLane, Res_Batch, Jacobian_i_Batch, Jacobian_j_Batch, implicit, true);
+        nLane = 0;
+      }
+      continue;
+    }
+    
     /*--- Compute and update residual ---*/
     
     numerics->ComputeResidual(Res_Visc, Jacobian_i, Jacobian_j, config);
@@ -11219,7 +11586,7 @@ void CNSSolver::Viscous_Forces(CGeometry *geometry, CConfig *config) {
         Coord_Normal = geometry->node[iPointNormal]->GetCoord();
         
         Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
-        Grad_PrimVar = node[iPoint]->GetGradient_Primitive();
+        Grad_PrimVar = node[iPoint]->GetGradient_Primitive(Gradient_Load_i);
         if (compressible) {
           Viscosity = node[iPoint]->GetLaminarViscosity();
           Density = node[iPoint]->GetDensity();
@@ -11388,104 +11755,27 @@ void CNSSolver::Viscous_Forces(CGeometry *geometry, CConfig *config) {
   
 #ifdef HAVE_MPI
   
-  /*--- Add AllBound information using all the nodes ---*/
-  
-  double MyAllBound_CDrag_Visc        = AllBound_CDrag_Visc;                      AllBound_CDrag_Visc = 0.0;
-  double MyAllBound_CLift_Visc        = AllBound_CLift_Visc;                      AllBound_CLift_Visc = 0.0;
-  double MyAllBound_CSideForce_Visc   = AllBound_CSideForce_Visc;                 AllBound_CSideForce_Visc = 0.0;
-  double MyAllBound_CEff_Visc         = AllBound_CEff_Visc;                       AllBound_CEff_Visc = 0.0;
-  double MyAllBound_CMx_Visc          = AllBound_CMx_Visc;                        AllBound_CMx_Visc = 0.0;
-  double MyAllBound_CMy_Visc          = AllBound_CMy_Visc;                        AllBound_CMy_Visc = 0.0;
-  double MyAllBound_CMz_Visc          = AllBound_CMz_Visc;                        AllBound_CMz_Visc = 0.0;
-  double MyAllBound_CFx_Visc          = AllBound_CFx_Visc;                        AllBound_CFx_Visc = 0.0;
-  double MyAllBound_CFy_Visc          = AllBound_CFy_Visc;                        AllBound_CFy_Visc = 0.0;
-  double MyAllBound_CFz_Visc          = AllBound_CFz_Visc;                        AllBound_CFz_Visc = 0.0;
-  double MyAllBound_CT_Visc           = AllBound_CT_Visc;                         AllBound_CT_Visc = 0.0;
-  double MyAllBound_CQ_Visc           = AllBound_CQ_Visc;                         AllBound_CQ_Visc = 0.0;
-  double MyAllBound_CMerit_Visc       = AllBound_CMerit_Visc;                     AllBound_CMerit_Visc = 0.0;
-  double MyAllBound_HeatFlux_Visc     = AllBound_HeatFlux_Visc;                       AllBound_HeatFlux_Visc = 0.0;
-  double MyAllBound_MaxHeatFlux_Visc  = pow(AllBound_MaxHeatFlux_Visc, MaxNorm);  AllBound_MaxHeatFlux_Visc = 0.0;
-  
-  MPI_Allreduce(&MyAllBound_CDrag_Visc, &AllBound_CDrag_Visc, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  MPI_Allreduce(&MyAllBound_CLift_Visc, &AllBound_CLift_Visc, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  MPI_Allreduce(&MyAllBound_CSideForce_Visc, &AllBound_CSideForce_Visc, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  AllBound_CEff_Visc = AllBound_CLift_Visc / (AllBound_CDrag_Visc + EPS);
-  MPI_Allreduce(&MyAllBound_CMx_Visc, &AllBound_CMx_Visc, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  MPI_Allreduce(&MyAllBound_CMy_Visc, &AllBound_CMy_Visc, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  MPI_Allreduce(&MyAllBound_CMz_Visc, &AllBound_CMz_Visc, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  MPI_Allreduce(&MyAllBound_CFx_Visc, &AllBound_CFx_Visc, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  MPI_Allreduce(&MyAllBound_CFy_Visc, &AllBound_CFy_Visc, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  MPI_Allreduce(&MyAllBound_CFz_Visc, &AllBound_CFz_Visc, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  MPI_Allreduce(&MyAllBound_CT_Visc, &AllBound_CT_Visc, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  MPI_Allreduce(&MyAllBound_CQ_Visc, &AllBound_CQ_Visc, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  AllBound_CMerit_Visc = AllBound_CT_Visc / (AllBound_CQ_Visc + EPS);
-  MPI_Allreduce(&MyAllBound_HeatFlux_Visc, &AllBound_HeatFlux_Visc, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  MPI_Allreduce(&MyAllBound_MaxHeatFlux_Visc, &AllBound_MaxHeatFlux_Visc, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  AllBound_MaxHeatFlux_Visc = pow(AllBound_MaxHeatFlux_Visc, 1.0/MaxNorm);
+  /*--- Add AllBound information using all the nodes. The inviscid coefficients
+   (left local by Inviscid_Forces) and the viscous ones, for all the boundaries
+   and the monitored surfaces, are reduced together with a single collective ---*/
   
-  /*--- Add the forces on the surfaces using all the nodes ---*/
-  double *MySurface_CLift_Visc      = NULL;
-  double *MySurface_CDrag_Visc      = NULL;
-  double *MySurface_CSideForce_Visc = NULL;
-  double *MySurface_CFx_Visc        = NULL;
-  double *MySurface_CFy_Visc        = NULL;
-  double *MySurface_CFz_Visc        = NULL;
-  double *MySurface_CMx_Visc        = NULL;
-  double *MySurface_CMy_Visc        = NULL;
-  double *MySurface_CMz_Visc        = NULL;
-  
-  MySurface_CLift_Visc      = new double[config->GetnMarker_Monitoring()];
-  MySurface_CDrag_Visc      = new double[config->GetnMarker_Monitoring()];
-  MySurface_CSideForce_Visc = new double[config->GetnMarker_Monitoring()];
-  MySurface_CFx_Visc        = new double[config->GetnMarker_Monitoring()];
-  MySurface_CFy_Visc        = new double[config->GetnMarker_Monitoring()];
-  MySurface_CFz_Visc        = new double[config->GetnMarker_Monitoring()];
-  MySurface_CMx_Visc        = new double[config->GetnMarker_Monitoring()];
-  MySurface_CMy_Visc        = new double[config->GetnMarker_Monitoring()];
-  MySurface_CMz_Visc        = new double[config->GetnMarker_Monitoring()];
+  vector<double> MyForces, Forces;
+  unsigned long iForce = 0;
   
-  for (iMarker_Monitoring = 0; iMarker_Monitoring < config->GetnMarker_Monitoring(); iMarker_Monitoring++) {
-    
-    MySurface_CLift_Visc[iMarker_Monitoring]      = Surface_CLift_Visc[iMarker_Monitoring];
-    MySurface_CDrag_Visc[iMarker_Monitoring]      = Surface_CDrag_Visc[iMarker_Monitoring];
-    MySurface_CSideForce_Visc[iMarker_Monitoring] = Surface_CSideForce_Visc[iMarker_Monitoring];
-    MySurface_CFx_Visc[iMarker_Monitoring]        = Surface_CFx_Visc[iMarker_Monitoring];
-    MySurface_CFy_Visc[iMarker_Monitoring]        = Surface_CFy_Visc[iMarker_Monitoring];
-    MySurface_CFz_Visc[iMarker_Monitoring]        = Surface_CFz_Visc[iMarker_Monitoring];
-    MySurface_CMx_Visc[iMarker_Monitoring]        = Surface_CMx_Visc[iMarker_Monitoring];
-    MySurface_CMy_Visc[iMarker_Monitoring]        = Surface_CMy_Visc[iMarker_Monitoring];
-    MySurface_CMz_Visc[iMarker_Monitoring]        = Surface_CMz_Visc[iMarker_Monitoring];
-    
-    Surface_CLift_Visc[iMarker_Monitoring]      = 0.0;
-    Surface_CDrag_Visc[iMarker_Monitoring]      = 0.0;
-    Surface_CSideForce_Visc[iMarker_Monitoring] = 0.0;
-    Surface_CFx_Visc[iMarker_Monitoring]        = 0.0;
-    Surface_CFy_Visc[iMarker_Monitoring]        = 0.0;
-    Surface_CFz_Visc[iMarker_Monitoring]        = 0.0;
-    Surface_CMx_Visc[iMarker_Monitoring]        = 0.0;
-    Surface_CMy_Visc[iMarker_Monitoring]        = 0.0;
-    Surface_CMz_Visc[iMarker_Monitoring]        = 0.0;
-  }
+  AllBound_MaxHeatFlux_Visc = pow(AllBound_MaxHeatFlux_Visc, MaxNorm);
+  
+  Pack_Forces_Inv(config, MyForces);
+  Pack_Forces_Visc(config, MyForces);
+  Forces.resize(MyForces.size());
+  CProfiler::Start(PROFILE_MPI_REDUCE);
+  MPI_Allreduce(&MyForces[0], &Forces[0], MyForces.size(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  CProfiler::Stop(PROFILE_MPI_REDUCE);
+  Unpack_Forces_Inv(config, Forces, iForce);
+  Unpack_Forces_Visc(config, Forces, iForce);
+  
+  AllBound_MaxHeatFlux_Visc = pow(AllBound_MaxHeatFlux_Visc, 1.0/MaxNorm);
   
-  MPI_Allreduce(MySurface_CLift_Visc, Surface_CLift_Visc, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  MPI_Allreduce(MySurface_CDrag_Visc, Surface_CDrag_Visc, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  MPI_Allreduce(MySurface_CSideForce_Visc, Surface_CSideForce_Visc, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  MPI_Allreduce(MySurface_CFx_Visc, Surface_CFx_Visc, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  MPI_Allreduce(MySurface_CFy_Visc, Surface_CFy_Visc, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  MPI_Allreduce(MySurface_CFz_Visc, Surface_CFz_Visc, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  MPI_Allreduce(MySurface_CMx_Visc, Surface_CMx_Visc, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  MPI_Allreduce(MySurface_CMy_Visc, Surface_CMy_Visc, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  MPI_Allreduce(MySurface_CMz_Visc, Surface_CMz_Visc, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  
-  delete [] MySurface_CLift_Visc;
-  delete [] MySurface_CDrag_Visc;
-  delete [] MySurface_CSideForce_Visc;
-  delete [] MySurface_CFx_Visc;
-  delete [] MySurface_CFy_Visc;
-  delete [] MySurface_CFz_Visc;
-  delete [] MySurface_CMx_Visc;
-  delete [] MySurface_CMy_Visc;
-  delete [] MySurface_CMz_Visc;
+  SetTotal_Forces_Inv(config);
   
 #endif
   
@@ -11523,6 +11813,70 @@ void CNSSolver::Viscous_Forces(CGeometry *geometry, CConfig *config) {
   
 }
 
+void CNSSolver::Pack_Forces_Visc(CConfig *config, vector<double> &val_buffer) {
+  unsigned short iMarker_Monitoring;
+  
+  val_buffer.push_back(AllBound_CDrag_Visc);
+  val_buffer.push_back(AllBound_CLift_Visc);
+  val_buffer.push_back(AllBound_CSideForce_Visc);
+  val_buffer.push_back(AllBound_CMx_Visc);
+  val_buffer.push_back(AllBound_CMy_Visc);
+  val_buffer.push_back(AllBound_CMz_Visc);
+  val_buffer.push_back(AllBound_CFx_Visc);
+  val_buffer.push_back(AllBound_CFy_Visc);
+  val_buffer.push_back(AllBound_CFz_Visc);
+  val_buffer.push_back(AllBound_CT_Visc);
+  val_buffer.push_back(AllBound_CQ_Visc);
+  val_buffer.push_back(AllBound_HeatFlux_Visc);
+  val_buffer.push_back(AllBound_MaxHeatFlux_Visc);
+  
+  for (iMarker_Monitoring = 0; iMarker_Monitoring < config->GetnMarker_Monitoring(); iMarker_Monitoring++) {
+    val_buffer.push_back(Surface_CLift_Visc[iMarker_Monitoring]);
+    val_buffer.push_back(Surface_CDrag_Visc[iMarker_Monitoring]);
+    val_buffer.push_back(Surface_CSideForce_Visc[iMarker_Monitoring]);
+    val_buffer.push_back(Surface_CFx_Visc[iMarker_Monitoring]);
+    val_buffer.push_back(Surface_CFy_Visc[iMarker_Monitoring]);
+    val_buffer.push_back(Surface_CFz_Visc[iMarker_Monitoring]);
+    val_buffer.push_back(Surface_CMx_Visc[iMarker_Monitoring]);
+    val_buffer.push_back(Surface_CMy_Visc[iMarker_Monitoring]);
+    val_buffer.push_back(Surface_CMz_Visc[iMarker_Monitoring]);
+  }
+  
+}
+
+void CNSSolver::Unpack_Forces_Visc(CConfig *config, vector<double> &val_buffer, unsigned long &val_index) {
+  unsigned short iMarker_Monitoring;
+  
+  AllBound_CDrag_Visc        = val_buffer[val_index++];
+  AllBound_CLift_Visc        = val_buffer[val_index++];
+  AllBound_CSideForce_Visc   = val_buffer[val_index++];
+  AllBound_CMx_Visc          = val_buffer[val_index++];
+  AllBound_CMy_Visc          = val_buffer[val_index++];
+  AllBound_CMz_Visc          = val_buffer[val_index++];
+  AllBound_CFx_Visc          = val_buffer[val_index++];
+  AllBound_CFy_Visc          = val_buffer[val_index++];
+  AllBound_CFz_Visc          = val_buffer[val_index++];
+  AllBound_CT_Visc           = val_buffer[val_index++];
+  AllBound_CQ_Visc           = val_buffer[val_index++];
+  AllBound_HeatFlux_Visc     = val_buffer[val_index++];
+  AllBound_MaxHeatFlux_Visc  = val_buffer[val_index++];
+  AllBound_CEff_Visc         = AllBound_CLift_Visc / (AllBound_CDrag_Visc + EPS);
+  AllBound_CMerit_Visc       = AllBound_CT_Visc / (AllBound_CQ_Visc + EPS);
+  
+  for (iMarker_Monitoring = 0; iMarker_Monitoring < config->GetnMarker_Monitoring(); iMarker_Monitoring++) {
+    Surface_CLift_Visc[iMarker_Monitoring]      = val_buffer[val_index++];
+    Surface_CDrag_Visc[iMarker_Monitoring]      = val_buffer[val_index++];
+    Surface_CSideForce_Visc[iMarker_Monitoring] = val_buffer[val_index++];
+    Surface_CFx_Visc[iMarker_Monitoring]        = val_buffer[val_index++];
+    Surface_CFy_Visc[iMarker_Monitoring]        = val_buffer[val_index++];
+    Surface_CFz_Visc[iMarker_Monitoring]        = val_buffer[val_index++];
+    Surface_CMx_Visc[iMarker_Monitoring]        = val_buffer[val_index++];
+    Surface_CMy_Visc[iMarker_Monitoring]        = val_buffer[val_index++];
+    Surface_CMz_Visc[iMarker_Monitoring]        = val_buffer[val_index++];
+  }
+  
+}
+
 void CNSSolver::BC_HeatFlux_Wall(CGeometry *geometry, CSolver **solver_container, CNumerics *conv_numerics, CNumerics *visc_numerics, CConfig *config, unsigned short val_marker) {
   
   /*--- Local variables ---*/
@@ -11618,7 +11972,7 @@ void CNSSolver::BC_HeatFlux_Wall(CGeometry *geometry, CSolver **solver_container
           eddy_viscosity    = node[iPoint]->GetEddyViscosityInc();
         }
         total_viscosity   = laminar_viscosity + eddy_viscosity;
-        grad_primvar      = node[iPoint]->GetGradient_Primitive();
+        grad_primvar      = node[iPoint]->GetGradient_Primitive(Gradient_Load_i);
         
         /*--- Turbulent kinetic energy ---*/
         if (config->GetKind_Turb_Model() == SST)
@@ -11844,7 +12198,7 @@ void CNSSolver::BC_Xwall(CGeometry *geometry, CSolver **solver_container, CNumer
           eddy_viscosity    = node[iPoint]->GetEddyViscosityInc();
         }
         total_viscosity   = laminar_viscosity + eddy_viscosity;
-        grad_primvar      = node[iPoint]->GetGradient_Primitive();
+        grad_primvar      = node[iPoint]->GetGradient_Primitive(Gradient_Load_i);
         
         /*--- Turbulent kinetic energy ---*/
         if (config->GetKind_Turb_Model() == SST)
@@ -12150,7 +12504,7 @@ void CNSSolver::BC_Isothermal_Wall(CGeometry *geometry, CSolver **solver_contain
         }
         
         total_viscosity   = laminar_viscosity + eddy_viscosity;
-        grad_primvar      = node[iPoint]->GetGradient_Primitive();
+        grad_primvar      = node[iPoint]->GetGradient_Primitive(Gradient_Load_i);
         
         /*--- Turbulent kinetic energy ---*/
         
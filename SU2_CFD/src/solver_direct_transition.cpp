@@ -168,13 +168,30 @@ CTransLMSolver::CTransLMSolver(CGeometry *geometry, CConfig *config, unsigned sh
 			exit(EXIT_FAILURE);
 		}
 		
-		for(iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++) {
-			getline(restart_file,text_line);
+		/*--- The restart file is in global order, map each line to its local point ---*/
+		long *Global2Local = new long[geometry->GetGlobal_nPointDomain()];
+		long iPoint_Local; unsigned long iPoint_Global = 0;
+		for (iPoint = 0; iPoint < geometry->GetGlobal_nPointDomain(); iPoint++)
+			Global2Local[iPoint] = -1;
+		for (iPoint = 0; iPoint < geometry->GetnPointDomain(); iPoint++)
+			Global2Local[geometry->node[iPoint]->GetGlobalIndex()] = iPoint;
+		
+		while (getline(restart_file,text_line)) {
 			istringstream point_line(text_line);
-			if (nDim == 2) point_line >> index >> dull_val >> dull_val >> dull_val >> dull_val >> dull_val >> dull_val >> Solution[0];
-			if (nDim == 3) point_line >> index >> dull_val >> dull_val >> dull_val >> dull_val >> dull_val >> dull_val >> dull_val >> dull_val >> Solution[0];
-			node[iPoint] = new CTurbSAVariable(Solution[0], 0, nDim, nVar, config);
+			iPoint_Local = Global2Local[iPoint_Global];
+			if (iPoint_Local >= 0) {
+				if (nDim == 2) point_line >> index >> dull_val >> dull_val >> dull_val >> dull_val >> dull_val >> dull_val >> Solution[0];
+				if (nDim == 3) point_line >> index >> dull_val >> dull_val >> dull_val >> dull_val >> dull_val >> dull_val >> dull_val >> dull_val >> Solution[0];
+				node[iPoint_Local] = new CTurbSAVariable(Solution[0], 0, nDim, nVar, config);
+			}
+			iPoint_Global++;
 		}
+		
+		/*--- Halo points, set by the first send/receive ---*/
+		for (iPoint = geometry->GetnPointDomain(); iPoint < geometry->GetnPoint(); iPoint++)
+			node[iPoint] = new CTurbSAVariable(Solution[0], 0, nDim, nVar, config);
+		
+		delete [] Global2Local;
 		restart_file.close();
 	}
 
@@ -392,7 +409,7 @@ void CTransLMSolver::Source_Residual(CGeometry *geometry, CSolver **solver_conta
 		numerics->SetConservative(solver_container[FLOW_SOL]->node[iPoint]->GetSolution(), NULL);
 		
 		/*--- Gradient of the primitive and conservative variables ---*/
-		numerics->SetPrimVarGradient(solver_container[FLOW_SOL]->node[iPoint]->GetGradient_Primitive(), NULL);
+		numerics->SetPrimVarGradient(solver_container[FLOW_SOL]->node[iPoint]->GetGradient_Primitive(Gradient_Load_i), NULL);
 		
 		/*--- Laminar and eddy viscosity ---*/
 		numerics->SetLaminarViscosity(solver_container[FLOW_SOL]->node[iPoint]->GetLaminarViscosity(), 0.0);
@@ -29,6 +29,8 @@ CTurbSolver::CTurbSolver(void) : CSolver() {
   FlowPrimVar_j = NULL;
   lowerlimit = NULL;
   upperlimit = NULL;
+  Res_Visc_Edge = NULL;
+  Jacobian_Edge = NULL;
   
 }
 
@@ -42,6 +44,8 @@ CTurbSolver::CTurbSolver(CConfig *config) : CSolver() {
   FlowPrimVar_j = NULL;
   lowerlimit = NULL;
   upperlimit = NULL;
+  Res_Visc_Edge = NULL;
+  Jacobian_Edge = NULL;
   
 }
 
@@ -51,10 +55,14 @@ CTurbSolver::~CTurbSolver(void) {
   if (FlowPrimVar_j != NULL) delete [] FlowPrimVar_j;
   if (lowerlimit != NULL) delete [] lowerlimit;
   if (upperlimit != NULL) delete [] upperlimit;
+  if (Res_Visc_Edge != NULL) delete [] Res_Visc_Edge;
+  if (Jacobian_Edge != NULL) delete [] Jacobian_Edge;
   
 }
 
 void CTurbSolver::Set_MPI_Solution(CGeometry *geometry, CConfig *config) {
+  CProfilerTimer Profile_Timer(PROFILE_MPI_HALO);
+  
   unsigned short iVar, iMarker, MarkerS, MarkerR;
   unsigned long iVertex, iPoint, nVertexS, nVertexR, nBufferS_Vector, nBufferR_Vector, nBufferS_Scalar, nBufferR_Scalar;
   double *Buffer_Receive_U = NULL, *Buffer_Send_U = NULL, *Buffer_Receive_muT = NULL, *Buffer_Send_muT = NULL;
@@ -140,6 +148,8 @@ void CTurbSolver::Set_MPI_Solution(CGeometry *geometry, CConfig *config) {
 }
 
 void CTurbSolver::Set_MPI_Solution_Old(CGeometry *geometry, CConfig *config) {
+  CProfilerTimer Profile_Timer(PROFILE_MPI_HALO);
+  
   unsigned short iVar, iMarker, MarkerS, MarkerR;
   unsigned long iVertex, iPoint, nVertexS, nVertexR, nBufferS_Vector, nBufferR_Vector;
   double *Buffer_Receive_U = NULL, *Buffer_Send_U = NULL;
@@ -213,6 +223,8 @@ void CTurbSolver::Set_MPI_Solution_Old(CGeometry *geometry, CConfig *config) {
 }
 
 void CTurbSolver::Set_MPI_Solution_Gradient(CGeometry *geometry, CConfig *config) {
+  CProfilerTimer Profile_Timer(PROFILE_MPI_HALO);
+  
   unsigned short iVar, iDim, iMarker, iPeriodic_Index, MarkerS, MarkerR;
   unsigned long iVertex, iPoint, nVertexS, nVertexR, nBufferS_Vector, nBufferR_Vector;
   double rotMatrix[3][3], *angles, theta, cosTheta, sinTheta, phi, cosPhi, sinPhi, psi, cosPsi, sinPsi,
@@ -334,6 +346,8 @@ void CTurbSolver::Set_MPI_Solution_Gradient(CGeometry *geometry, CConfig *config
 }
 
 void CTurbSolver::Set_MPI_Solution_Limiter(CGeometry *geometry, CConfig *config) {
+  CProfilerTimer Profile_Timer(PROFILE_MPI_HALO);
+  
   unsigned short iVar, iMarker, MarkerS, MarkerR;
   unsigned long iVertex, iPoint, nVertexS, nVertexR, nBufferS_Vector, nBufferR_Vector;
   double *Buffer_Receive_Limit = NULL, *Buffer_Send_Limit = NULL;
@@ -414,15 +428,36 @@ void CTurbSolver::Set_MPI_Solution_Limiter(CGeometry *geometry, CConfig *config)
 
 void CTurbSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics *numerics, CConfig *config, unsigned short iMesh) {
   
+  Upwind_Edge_Loop(geometry, solver_container, numerics, NULL, config, iMesh);
+  
+}
+
+void CTurbSolver::Upwind_Viscous_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics *conv_numerics,
+                                          CNumerics *visc_numerics, CConfig *config, unsigned short iMesh, unsigned short iRKStep) {
+  
+  Upwind_Edge_Loop(geometry, solver_container, conv_numerics, visc_numerics, config, iMesh);
+  
+}
+
+void CTurbSolver::Upwind_Edge_Loop(CGeometry *geometry, CSolver **solver_container, CNumerics *numerics,
+                                   CNumerics *visc_numerics, CConfig *config, unsigned short iMesh) {
+  
   double *Turb_i, *Turb_j, *Limiter_i = NULL, *Limiter_j = NULL, *V_i, *V_j, **Gradient_i, **Gradient_j, Project_Grad_i, Project_Grad_j;
-  unsigned long iEdge, iPoint, jPoint;
-  unsigned short iDim, iVar;
+  unsigned long iEdge, iPoint, jPoint, nEdge = geometry->GetnEdge();
+  unsigned short iDim, iVar, jVar;
   
   bool second_order  = ((config->GetSpatialOrder() == SECOND_ORDER) || (config->GetSpatialOrder() == SECOND_ORDER_LIMITER));
   bool limiter       = (config->GetSpatialOrder() == SECOND_ORDER_LIMITER);
   bool grid_movement = config->GetGrid_Movement();
+  bool viscous       = (visc_numerics != NULL);
+  bool sst           = (config->GetKind_Turb_Model() == SST);
+  bool reference     = (viscous && (config->GetKind_Edge_Loop() == FUSED_EDGE_LOOP_REFERENCE));
   
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
+  /*--- In the reference mode the viscous fluxes are stored by edge (in the arrays
+   allocated by the constructor), and added after all the convective ones (same
+   summation order as separate loops) ---*/
+  
+  for (iEdge = 0; iEdge < nEdge; iEdge++) {
     
     /*--- Points in edge and normal vectors ---*/
     
@@ -456,11 +491,11 @@ void CTurbSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_containe
       
       /*--- Mean flow primitive variables using gradient reconstruction and limiters ---*/
       
-      Gradient_i = solver_container[FLOW_SOL]->node[iPoint]->GetGradient_Primitive();
-      Gradient_j = solver_container[FLOW_SOL]->node[jPoint]->GetGradient_Primitive();
+      Gradient_i = solver_container[FLOW_SOL]->node[iPoint]->GetGradient_Primitive(Gradient_Load_i);
+      Gradient_j = solver_container[FLOW_SOL]->node[jPoint]->GetGradient_Primitive(Gradient_Load_j);
       if (limiter) {
-        Limiter_i = solver_container[FLOW_SOL]->node[iPoint]->GetLimiter_Primitive();
-        Limiter_j = solver_container[FLOW_SOL]->node[jPoint]->GetLimiter_Primitive();
+        Limiter_i = solver_container[FLOW_SOL]->node[iPoint]->GetLimiter_Primitive(Limiter_Load_i);
+        Limiter_j = solver_container[FLOW_SOL]->node[jPoint]->GetLimiter_Primitive(Limiter_Load_j);
       }
       
       for (iVar = 0; iVar < solver_container[FLOW_SOL]->GetnPrimVarGrad(); iVar++) {
@@ -524,6 +559,65 @@ void CTurbSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_containe
     Jacobian.SubtractBlock(jPoint, iPoint, Jacobian_i);
     Jacobian.SubtractBlock(jPoint, jPoint, Jacobian_j);
     
+    if (!viscous) continue;
+    
+    /*--- Viscous flux of the same edge (see CTurbSolver::Viscous_Residual) ---*/
+    
+    visc_numerics->SetCoord(geometry->node[iPoint]->GetCoord(), geometry->node[jPoint]->GetCoord());
+    visc_numerics->SetNormal(geometry->edge[iEdge]->GetNormal());
+    visc_numerics->SetPrimitive(V_i, V_j);
+    visc_numerics->SetTurbVar(Turb_i, Turb_j);
+    visc_numerics->SetTurbVarGradient(node[iPoint]->GetGradient(), node[jPoint]->GetGradient());
+    if (sst)
+      visc_numerics->SetF1blending(node[iPoint]->GetF1blending(), node[jPoint]->GetF1blending());
+    
+    visc_numerics->ComputeResidual(Residual, Jacobian_i, Jacobian_j, config);
+    
+    if (reference) {
+      for (iVar = 0; iVar < nVar; iVar++) {
+        Res_Visc_Edge[iEdge*nVar+iVar] = Residual[iVar];
+        for (jVar = 0; jVar < nVar; jVar++) {
+          Jacobian_Edge[(2*iEdge)*nVar*nVar+iVar*nVar+jVar]   = Jacobian_i[iVar][jVar];
+          Jacobian_Edge[(2*iEdge+1)*nVar*nVar+iVar*nVar+jVar] = Jacobian_j[iVar][jVar];
+        }
+      }
+      continue;
+    }
+    
+    LinSysRes.SubtractBlock(iPoint, Residual);
+    LinSysRes.AddBlock(jPoint, Residual);
+    
+    Jacobian.SubtractBlock(iPoint, iPoint, Jacobian_i);
+    Jacobian.SubtractBlock(iPoint, jPoint, Jacobian_j);
+    Jacobian.AddBlock(jPoint, iPoint, Jacobian_i);
+    Jacobian.AddBlock(jPoint, jPoint, Jacobian_j);
+    
+  }
+  
+  /*--- Reference mode, add the stored viscous fluxes in edge order ---*/
+  
+  if (reference) {
+    
+    for (iEdge = 0; iEdge < nEdge; iEdge++) {
+      
+      iPoint = geometry->edge[iEdge]->GetNode(0);
+      jPoint = geometry->edge[iEdge]->GetNode(1);
+      
+      LinSysRes.SubtractBlock(iPoint, &Res_Visc_Edge[iEdge*nVar]);
+      LinSysRes.AddBlock(jPoint, &Res_Visc_Edge[iEdge*nVar]);
+      
+      for (iVar = 0; iVar < nVar; iVar++)
+        for (jVar = 0; jVar < nVar; jVar++) {
+          Jacobian_i[iVar][jVar] = Jacobian_Edge[(2*iEdge)*nVar*nVar+iVar*nVar+jVar];
+          Jacobian_j[iVar][jVar] = Jacobian_Edge[(2*iEdge+1)*nVar*nVar+iVar*nVar+jVar];
+        }
+      Jacobian.SubtractBlock(iPoint, iPoint, Jacobian_i);
+      Jacobian.SubtractBlock(iPoint, jPoint, Jacobian_j);
+      Jacobian.AddBlock(jPoint, iPoint, Jacobian_i);
+      Jacobian.AddBlock(jPoint, jPoint, Jacobian_j);
+      
+    }
+    
   }
   
 }
@@ -1036,6 +1130,14 @@ CTurbSASolver::CTurbSASolver(CGeometry *geometry, CConfig *config, unsigned shor
       if (rank == MASTER_NODE) cout << "Compute linelet structure. " << nLineLets << " elements in each line (average)." << endl;
     }
     
+    /*--- Viscous fluxes of the edges, stored until all the convective ones are
+     added (EDGE_LOOP= FUSED_REFERENCE) ---*/
+    
+    if (config->GetKind_Edge_Loop() == FUSED_EDGE_LOOP_REFERENCE) {
+      Res_Visc_Edge = new double [geometry->GetnEdge()*nVar];
+      Jacobian_Edge = new double [2*geometry->GetnEdge()*nVar*nVar];
+    }
+    
     LinSysSol.Initialize(nPoint, nPointDomain, nVar, 0.0);
     LinSysRes.Initialize(nPoint, nPointDomain, nVar, 0.0);
     
@@ -1217,6 +1319,7 @@ CTurbSASolver::~CTurbSASolver(void) {
 }
 
 void CTurbSASolver::Preprocessing(CGeometry *geometry, CSolver **solver_container, CConfig *config, unsigned short iMesh, unsigned short iRKStep, unsigned short RunTime_EqSystem, bool Output) {
+  CProfilerTimer Profile_Timer(PROFILE_PREPROCESSING);
   
   unsigned long iPoint;
   
@@ -1298,7 +1401,7 @@ void CTurbSASolver::Source_Residual(CGeometry *geometry, CSolver **solver_contai
     
     /*--- Gradient of the primitive and conservative variables ---*/
     
-    numerics->SetPrimVarGradient(solver_container[FLOW_SOL]->node[iPoint]->GetGradient_Primitive(), NULL);
+    numerics->SetPrimVarGradient(solver_container[FLOW_SOL]->node[iPoint]->GetGradient_Primitive(Gradient_Load_i), NULL);
     
     /*--- Set intermittency ---*/
     
@@ -2347,6 +2450,14 @@ CTurbSSTSolver::CTurbSSTSolver(CGeometry *geometry, CConfig *config, unsigned sh
       if (rank == MASTER_NODE) cout << "Compute linelet structure. " << nLineLets << " elements in each line (average)." << endl;
     }
     
+    /*--- Viscous fluxes of the edges, stored until all the convective ones are
+     added (EDGE_LOOP= FUSED_REFERENCE) ---*/
+    
+    if (config->GetKind_Edge_Loop() == FUSED_EDGE_LOOP_REFERENCE) {
+      Res_Visc_Edge = new double [geometry->GetnEdge()*nVar];
+      Jacobian_Edge = new double [2*geometry->GetnEdge()*nVar*nVar];
+    }
+    
     LinSysSol.Initialize(nPoint, nPointDomain, nVar, 0.0);
     LinSysRes.Initialize(nPoint, nPointDomain, nVar, 0.0);
   }
@@ -2511,6 +2622,7 @@ CTurbSSTSolver::~CTurbSSTSolver(void) {
 }
 
 void CTurbSSTSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container, CConfig *config, unsigned short iMesh, unsigned short iRKStep, unsigned short RunTime_EqSystem, bool Output) {
+  CProfilerTimer Profile_Timer(PROFILE_PREPROCESSING);
   
   unsigned long iPoint;
   
@@ -2543,14 +2655,18 @@ void CTurbSSTSolver::Postprocessing(CGeometry *geometry, CSolver **solver_contai
   bool incompressible = (config->GetKind_Regime() == INCOMPRESSIBLE);
   bool freesurface = (config->GetKind_Regime() == FREESURFACE);
   
-  /*--- Compute mean flow and turbulence gradients ---*/
+  /*--- Compute mean flow and turbulence gradients, the mean flow gradients are only
+   computed again if the primitive variables have changed since the flow preprocessing ---*/
+  
+  bool flow_gradient = solver_container[FLOW_SOL]->GetDerived_Current(DERIVED_PRIM_GRADIENT);
+  bool flow_vorticity = solver_container[FLOW_SOL]->GetDerived_Current(DERIVED_VORTICITY);
   
   if (config->GetKind_Gradient_Method() == GREEN_GAUSS) {
-    solver_container[FLOW_SOL]->SetPrimitive_Gradient_GG(geometry, config);
+    if (!flow_gradient) solver_container[FLOW_SOL]->SetPrimitive_Gradient_GG(geometry, config);
     SetSolution_Gradient_GG(geometry, config);
   }
   if (config->GetKind_Gradient_Method() == WEIGHTED_LEAST_SQUARES) {
-    solver_container[FLOW_SOL]->SetPrimitive_Gradient_LS(geometry, config);
+    if (!flow_gradient) solver_container[FLOW_SOL]->SetPrimitive_Gradient_LS(geometry, config);
     SetSolution_Gradient_LS(geometry, config);
   }
   
@@ -2558,12 +2674,14 @@ void CTurbSSTSolver::Postprocessing(CGeometry *geometry, CSolver **solver_contai
     
     /*--- Compute vorticity and rate of strain magnitude ---*/
     
-    solver_container[FLOW_SOL]->node[iPoint]->SetVorticity();
+    if (!flow_vorticity) {
+      solver_container[FLOW_SOL]->node[iPoint]->SetVorticity();
+      solver_container[FLOW_SOL]->node[iPoint]->SetStrainMag();
+    }
     vorticity[0] = solver_container[FLOW_SOL]->node[iPoint]->GetVorticity(0);
     vorticity[1] = solver_container[FLOW_SOL]->node[iPoint]->GetVorticity(1);
     vorticity[2] = solver_container[FLOW_SOL]->node[iPoint]->GetVorticity(2);
     vortMag = sqrt(vorticity[0]*vorticity[0] + vorticity[1]*vorticity[1] + vorticity[2]*vorticity[2]);
-    solver_container[FLOW_SOL]->node[iPoint]->SetStrainMag();
     strMag = solver_container[FLOW_SOL]->node[iPoint]->GetStrainMag();
     
     /*--- Compute blending functions and cross diffusion ---*/
@@ -2592,6 +2710,8 @@ void CTurbSSTSolver::Postprocessing(CGeometry *geometry, CSolver **solver_contai
     
   }
   
+  if (!flow_vorticity) solver_container[FLOW_SOL]->SetDerived_Computed(DERIVED_VORTICITY);
+  
 }
 
 void CTurbSSTSolver::Source_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics *numerics, CNumerics *second_numerics, CConfig *config, unsigned short iMesh) {
@@ -2606,7 +2726,7 @@ void CTurbSSTSolver::Source_Residual(CGeometry *geometry, CSolver **solver_conta
     
     /*--- Gradient of the primitive and conservative variables ---*/
     
-    numerics->SetPrimVarGradient(solver_container[FLOW_SOL]->node[iPoint]->GetGradient_Primitive(), NULL);
+    numerics->SetPrimVarGradient(solver_container[FLOW_SOL]->node[iPoint]->GetGradient_Primitive(Gradient_Load_i), NULL);
     
     /*--- Turbulent variables w/o reconstruction, and its gradient ---*/
     
@@ -3014,7 +3134,12 @@ double* CTurbSSTSolver::GetConstants() {
   return constants;
 }
 
-CTurbMLSolver::CTurbMLSolver(void) : CTurbSolver() { }
+CTurbMLSolver::CTurbMLSolver(void) : CTurbSolver() {
+  
+  NetInput = NULL;
+  NetOutput = NULL;
+  
+}
 
 CTurbMLSolver::CTurbMLSolver(CGeometry *geometry, CConfig *config, unsigned short iMesh) : CTurbSolver() {
   unsigned short iVar, iDim, nLineLets;
@@ -3091,6 +3216,14 @@ CTurbMLSolver::CTurbMLSolver(CGeometry *geometry, CConfig *config, unsigned shor
       if (rank == MASTER_NODE) cout << "Compute linelet structure. " << nLineLets << " elements in each line (average)." << endl;
     }
     
+    /*--- Viscous fluxes of the edges, stored until all the convective ones are
+     added (EDGE_LOOP= FUSED_REFERENCE) ---*/
+    
+    if (config->GetKind_Edge_Loop() == FUSED_EDGE_LOOP_REFERENCE) {
+      Res_Visc_Edge = new double [geometry->GetnEdge()*nVar];
+      Jacobian_Edge = new double [2*geometry->GetnEdge()*nVar*nVar];
+    }
+    
     LinSysSol.Initialize(nPoint, nPointDomain, nVar, 0.0);
     LinSysRes.Initialize(nPoint, nPointDomain, nVar, 0.0);
     
@@ -3269,6 +3402,9 @@ CTurbMLSolver::CTurbMLSolver(CGeometry *geometry, CConfig *config, unsigned shor
 
 CTurbMLSolver::~CTurbMLSolver(void) {
   
+  if (NetInput != NULL) delete [] NetInput;
+  if (NetOutput != NULL) delete [] NetOutput;
+  
 }
 
 void CTurbMLSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container, CConfig *config, unsigned short iMesh, unsigned short iRKStep, unsigned short RunTime_EqSystem, bool Output) {
@@ -3340,40 +3476,48 @@ void CTurbMLSolver::Source_Residual(CGeometry *geometry, CSolver **solver_contai
   
   bool freesurface = (config->GetKind_Regime() == FREESURFACE);
   bool time_spectral = (config->GetUnsteady_Simulation() == TIME_SPECTRAL);
-  bool transition = (config->GetKind_Trans_Model() == LM);
   double epsilon          = config->GetFreeSurface_Thickness();
   
+  CSourcePieceWise_TurbML *mynum = (CSourcePieceWise_TurbML*)numerics;
+  bool batch = mynum->UsesMLModel();
+  unsigned long iBlock = 0, nBlock, jPoint;
+  int iInput, nNetInput = 0, nNetOutput = 0;
+  
+  if (batch) {
+    nNetOutput = mynum->GetMLModel()->Pred->OutputDim();
+    if (NetInput == NULL) NetInput = new double [ML_BATCH_SIZE*MAX_ML_INPUTS];
+    if (NetOutput == NULL) NetOutput = new double [ML_BATCH_SIZE*nNetOutput];
+  }
+  
   for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
     
-    /*--- Conservative variables w/o reconstruction ---*/
-    numerics->SetPrimitive(solver_container[FLOW_SOL]->node[iPoint]->GetPrimitive(), NULL);
-    
-    /*--- Gradient of the primitive and conservative variables ---*/
-    numerics->SetPrimVarGradient(solver_container[FLOW_SOL]->node[iPoint]->GetGradient_Primitive(), NULL);
-    
-    /*--- Set intermittency ---*/
-    if (transition) {
-      numerics->SetIntermittency(solver_container[TRANS_SOL]->node[iPoint]->GetIntermittency() );
+    /*--- At the first point of each block the network is evaluated for the
+     whole block at once. The Spalart-Allmaras terms computed with the inputs
+     are kept by the numerics and reused by ComputeResidual ---*/
+    if (batch && (iPoint % ML_BATCH_SIZE == 0)) {
+      
+      iBlock = iPoint;
+      nBlock = min((unsigned long)ML_BATCH_SIZE, nPointDomain-iBlock);
+      
+      for (jPoint = 0; jPoint < nBlock; jPoint++) {
+        SetSource_Numerics(geometry, solver_container, numerics, config, iBlock+jPoint);
+        nNetInput = mynum->SetNetInput(&NetInput[jPoint*MAX_ML_INPUTS], jPoint);
+      }
+      
+      /*--- Compact the inputs, their number is fixed by the feature set ---*/
+      for (jPoint = 1; jPoint < nBlock; jPoint++)
+        for (iInput = 0; iInput < nNetInput; iInput++)
+          NetInput[jPoint*nNetInput+iInput] = NetInput[jPoint*MAX_ML_INPUTS+iInput];
+      
+      mynum->GetMLModel()->PredictBatch(nBlock, NetInput, NetOutput);
     }
     
-    /*--- Turbulent variables w/o reconstruction, and its gradient ---*/
-    numerics->SetTurbVar(node[iPoint]->GetSolution(), NULL);
-    numerics->SetTurbVarGradient(node[iPoint]->GetGradient(), NULL);
-    
-    /*--- Set volume ---*/
-    numerics->SetVolume(geometry->node[iPoint]->GetVolume());
-    
-    /*--- Set distance to the surface ---*/
-    numerics->SetDistance(geometry->node[iPoint]->GetWall_Distance(), 0.0);
-    
-    /*--- Set coordinates ---*/
-    numerics->SetCoord(geometry->node[iPoint]->GetCoord(),geometry->node[iPoint]->GetCoord());
+    SetSource_Numerics(geometry, solver_container, numerics, config, iPoint);
     
     /*--- Compute the source term ---*/
+    if (batch) mynum->SetNetOutput(&NetOutput[(iPoint-iBlock)*nNetOutput], iPoint-iBlock);
     numerics->ComputeResidual(Residual, Jacobian_i, NULL, config);
     
-    CSourcePieceWise_TurbML *mynum = (CSourcePieceWise_TurbML*)numerics;
-    
     unsigned long idx = 0;
     if (config->GetExtraOutput()) {
       
@@ -3492,6 +3636,8 @@ void CTurbMLSolver::Source_Residual(CGeometry *geometry, CSolver **solver_contai
     
   }
   
+  mynum->SetNetOutput(NULL, -1);
+  
   if (time_spectral) {
     
     double Volume, Source;
@@ -3518,6 +3664,37 @@ void CTurbMLSolver::Source_Residual(CGeometry *geometry, CSolver **solver_contai
 }
 
 
+void CTurbMLSolver::SetSource_Numerics(CGeometry *geometry, CSolver **solver_container, CNumerics *numerics,
+                                       CConfig *config, unsigned long iPoint) {
+  
+  bool transition = (config->GetKind_Trans_Model() == LM);
+  
+  /*--- Conservative variables w/o reconstruction ---*/
+  numerics->SetPrimitive(solver_container[FLOW_SOL]->node[iPoint]->GetPrimitive(), NULL);
+  
+  /*--- Gradient of the primitive and conservative variables ---*/
+  numerics->SetPrimVarGradient(solver_container[FLOW_SOL]->node[iPoint]->GetGradient_Primitive(Gradient_Load_i), NULL);
+  
+  /*--- Set intermittency ---*/
+  if (transition) {
+    numerics->SetIntermittency(solver_container[TRANS_SOL]->node[iPoint]->GetIntermittency() );
+  }
+  
+  /*--- Turbulent variables w/o reconstruction, and its gradient ---*/
+  numerics->SetTurbVar(node[iPoint]->GetSolution(), NULL);
+  numerics->SetTurbVarGradient(node[iPoint]->GetGradient(), NULL);
+  
+  /*--- Set volume ---*/
+  numerics->SetVolume(geometry->node[iPoint]->GetVolume());
+  
+  /*--- Set distance to the surface ---*/
+  numerics->SetDistance(geometry->node[iPoint]->GetWall_Distance(), 0.0);
+  
+  /*--- Set coordinates ---*/
+  numerics->SetCoord(geometry->node[iPoint]->GetCoord(),geometry->node[iPoint]->GetCoord());
+  
+}
+
 void CTurbMLSolver::Source_Template(CGeometry *geometry, CSolver **solver_container, CNumerics *numerics,
                                     CConfig *config, unsigned short iMesh) {
   
@@ -148,15 +148,32 @@ CWaveSolver::CWaveSolver(CGeometry *geometry,
 		    cout << "There is no wave restart file!!" << endl;
 			exit(EXIT_FAILURE);
 		}
-		unsigned long index;
+		unsigned long index, iPoint;
 		string text_line;
     
-		for(unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
-			getline(restart_file,text_line);
+		/*--- The restart file is in global order, map each line to its local point ---*/
+		long *Global2Local = new long[geometry->GetGlobal_nPointDomain()];
+		long iPoint_Local; unsigned long iPoint_Global = 0;
+		for (iPoint = 0; iPoint < geometry->GetGlobal_nPointDomain(); iPoint++)
+			Global2Local[iPoint] = -1;
+		for (iPoint = 0; iPoint < geometry->GetnPointDomain(); iPoint++)
+			Global2Local[geometry->node[iPoint]->GetGlobalIndex()] = iPoint;
+    
+		while (getline(restart_file,text_line)) {
 			istringstream point_line(text_line);
-			point_line >> index >> Solution[0] >> Solution[1];
-			node[iPoint] = new CWaveVariable(Solution, nDim, nVar, config);
+			iPoint_Local = Global2Local[iPoint_Global];
+			if (iPoint_Local >= 0) {
+				point_line >> index >> Solution[0] >> Solution[1];
+				node[iPoint_Local] = new CWaveVariable(Solution, nDim, nVar, config);
+			}
+			iPoint_Global++;
 		}
+    
+		/*--- Halo points, set by the first send/receive ---*/
+		for (iPoint = geometry->GetnPointDomain(); iPoint < nPoint; iPoint++)
+			node[iPoint] = new CWaveVariable(Solution, nDim, nVar, config);
+    
+		delete [] Global2Local;
 		restart_file.close();
 	}
   
@@ -782,14 +799,27 @@ void CWaveSolver::LoadRestart(CGeometry **geometry, CSolver ***solver, CConfig *
     exit(EXIT_FAILURE);
   }
   
+  /*--- The restart file is in global order, map each line to its local point ---*/
+  long *Global2Local = new long[geometry[MESH_0]->GetGlobal_nPointDomain()];
+  long iPoint_Local; unsigned long iPoint_Global = 0;
+  for (iPoint = 0; iPoint < geometry[MESH_0]->GetGlobal_nPointDomain(); iPoint++)
+    Global2Local[iPoint] = -1;
+  for (iPoint = 0; iPoint < geometry[MESH_0]->GetnPointDomain(); iPoint++)
+    Global2Local[geometry[MESH_0]->node[iPoint]->GetGlobalIndex()] = iPoint;
+  
   /*--- Read the restart file ---*/
-  for(iPoint = 0; iPoint < geometry[MESH_0]->GetnPoint(); iPoint++) {
-    getline(restart_file,text_line);
+  while (getline(restart_file,text_line)) {
     istringstream point_line(text_line);
-    point_line >> index >> Solution[0] >> Solution[1];
-    node[iPoint]->SetSolution_Direct(Solution);
+    iPoint_Local = Global2Local[iPoint_Global];
+    if (iPoint_Local >= 0) {
+      point_line >> index >> Solution[0] >> Solution[1];
+      node[iPoint_Local]->SetSolution_Direct(Solution);
+    }
+    iPoint_Global++;
   }
   
+  delete [] Global2Local;
+  
   /*--- Close the restart file ---*/
   restart_file.close();
   
@@ -57,12 +57,59 @@ CSolver::CSolver(void) {
   node = NULL;
   nOutputVariables = 0;
   
+  /*--- No derived field has been computed yet ---*/
+  
+  Derived_Counter = 0;
+  for (unsigned short iField = 0; iField < MAX_DERIVED_FIELDS; iField++) {
+    Derived_Version[iField] = 0; Derived_Source[iField] = 0;
+  }
+  
+  /*--- The coupling interface map is built on demand ---*/
+  
+  Interface_Map = false;
+  nInterface_Target = 0; nInterface_Send = 0; nInterface_Receive = 0;
+  Interface_Target_Marker = NULL;
+  Interface_Target_Vertex = NULL;
+  Interface_Donor_Slot = NULL;
+  Interface_Donor_Weight = NULL;
+  Interface_Send_Point = NULL;
+  Interface_nSend = NULL;
+  Interface_nReceive = NULL;
+  
+  /*--- Buffers to load the gradients and limiters stored in single precision ---*/
+  
+  Gradient_Load_i = new double* [MAX_PRIMVAR_GRAD];
+  Gradient_Load_j = new double* [MAX_PRIMVAR_GRAD];
+  for (unsigned short iVar = 0; iVar < MAX_PRIMVAR_GRAD; iVar++) {
+    Gradient_Load_i[iVar] = new double [3];
+    Gradient_Load_j[iVar] = new double [3];
+  }
+  Limiter_Load_i = new double [MAX_PRIMVAR_GRAD];
+  Limiter_Load_j = new double [MAX_PRIMVAR_GRAD];
+  
 }
 
 CSolver::~CSolver(void) {
   if( OutputHeadingNames != NULL){
     delete []OutputHeadingNames;
   }
+  
+  if (Interface_Target_Marker != NULL) delete [] Interface_Target_Marker;
+  if (Interface_Target_Vertex != NULL) delete [] Interface_Target_Vertex;
+  if (Interface_Donor_Slot != NULL) delete [] Interface_Donor_Slot;
+  if (Interface_Donor_Weight != NULL) delete [] Interface_Donor_Weight;
+  if (Interface_Send_Point != NULL) delete [] Interface_Send_Point;
+  if (Interface_nSend != NULL) delete [] Interface_nSend;
+  if (Interface_nReceive != NULL) delete [] Interface_nReceive;
+  
+  for (unsigned short iVar = 0; iVar < MAX_PRIMVAR_GRAD; iVar++) {
+    delete [] Gradient_Load_i[iVar];
+    delete [] Gradient_Load_j[iVar];
+  }
+  delete [] Gradient_Load_i;
+  delete [] Gradient_Load_j;
+  delete [] Limiter_Load_i;
+  delete [] Limiter_Load_j;
   //  delete [] OutputHeadingNames;
   /*  unsigned short iVar, iDim;
    unsigned long iPoint;
@@ -162,6 +209,8 @@ CSolver::~CSolver(void) {
 }
 
 void CSolver::SetResidual_RMS(CGeometry *geometry, CConfig *config) {
+  CProfilerTimer Profile_Timer(PROFILE_MPI_REDUCE);
+  
   unsigned short iVar;
   
 #ifndef HAVE_MPI
@@ -327,6 +376,7 @@ void CSolver::SetGrid_Movement_Residual (CGeometry *geometry, CConfig *config) {
 }
 
 void CSolver::SetAuxVar_Gradient_GG(CGeometry *geometry) {
+  CProfilerTimer Profile_Timer(PROFILE_GRADIENT);
   
   //	Internal variables
   unsigned long Point = 0, iPoint = 0, jPoint = 0, iEdge, iVertex;
@@ -377,6 +427,7 @@ void CSolver::SetAuxVar_Gradient_GG(CGeometry *geometry) {
 }
 
 void CSolver::SetAuxVar_Gradient_LS(CGeometry *geometry, CConfig *config) {
+  CProfilerTimer Profile_Timer(PROFILE_GRADIENT);
   
   unsigned short iDim, jDim, iNeigh;
   unsigned short nDim = geometry->GetnDim();
@@ -497,6 +548,8 @@ void CSolver::SetAuxVar_Gradient_LS(CGeometry *geometry, CConfig *config) {
 }
 
 void CSolver::SetSolution_Gradient_GG(CGeometry *geometry, CConfig *config) {
+  CProfilerTimer Profile_Timer(PROFILE_GRADIENT);
+  
   unsigned long Point = 0, iPoint = 0, jPoint = 0, iEdge, iVertex;
   unsigned short iVar, iDim, iMarker;
   double *Solution_Vertex, *Solution_i, *Solution_j, Solution_Average, **Gradient, DualArea,
@@ -557,6 +610,7 @@ void CSolver::SetSolution_Gradient_GG(CGeometry *geometry, CConfig *config) {
 }
 
 void CSolver::SetSolution_Gradient_LS(CGeometry *geometry, CConfig *config) {
+  CProfilerTimer Profile_Timer(PROFILE_GRADIENT);
   
   unsigned short iDim, jDim, iVar, iNeigh;
   unsigned long iPoint, jPoint;
@@ -930,6 +984,7 @@ void CSolver::SetAuxVar_Surface_Gradient(CGeometry *geometry, CConfig *config) {
 }
 
 void CSolver::SetSolution_Limiter(CGeometry *geometry, CConfig *config) {
+  CProfilerTimer Profile_Timer(PROFILE_GRADIENT);
   
   unsigned long iEdge, iPoint, jPoint;
   unsigned short iVar, iDim;
@@ -1516,6 +1571,523 @@ void CSolver::SolveTypicalSectionWingModel(CGeometry *geometry, double Cl, doubl
   
 }
 
+void CSolver::SetInterface_Map(CGeometry *target_geometry, bool *target_marker, CGeometry *donor_geometry, bool *donor_marker) {
+  
+  unsigned short iMarker, iDim, iDonor, nActive;
+  unsigned long iVertex, iPoint, iTarget, iLocal, nLocalDonor = 0, nGlobalDonor, nCandidate, iCandidate, iBin, nBin_Total,
+  iSend;
+  long nBin[3], iCell[3], jCell[3], kCell[3], iRing, nRing, Candidate_Donor[INTERFACE_NDONOR];
+  double *Coord_i, Dist, Dist_Donor[INTERFACE_NDONOR], Weight_Sum, Dist_Far, Dist_Near, Radius, Bin_Min[3], Bin_Cell[3],
+  Extent[3], Extent_Max, Bin_Size, Bin_Cell_Min;
+  int iProcessor, rank = MASTER_NODE, size = SINGLE_NODE;
+  
+#ifdef HAVE_MPI
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+#endif
+  
+  /*--- Interface points of the donor zone that belong to this rank (a point
+   shared by several interface markers is only stored once) ---*/
+  
+  bool *Donor_Flag = new bool [donor_geometry->GetnPoint()];
+  for (iPoint = 0; iPoint < donor_geometry->GetnPoint(); iPoint++) Donor_Flag[iPoint] = false;
+  
+  for (iMarker = 0; iMarker < donor_geometry->GetnMarker(); iMarker++)
+    if (donor_marker[iMarker])
+      for (iVertex = 0; iVertex < donor_geometry->GetnVertex(iMarker); iVertex++) {
+        iPoint = donor_geometry->vertex[iMarker][iVertex]->GetNode();
+        if (donor_geometry->node[iPoint]->GetDomain() && !Donor_Flag[iPoint]) {
+          Donor_Flag[iPoint] = true; nLocalDonor++;
+        }
+      }
+  
+  unsigned long *Donor_Point = new unsigned long [nLocalDonor];
+  double *Donor_Coord = new double [nLocalDonor*nDim];
+  
+  /*--- Bounding box of the donor points of this rank (minimum, then maximum) ---*/
+  
+  double *Donor_Box = new double [2*nDim];
+  for (iDim = 0; iDim < nDim; iDim++) {
+    Donor_Box[iDim] = 1E30; Donor_Box[nDim+iDim] = -1E30;
+  }
+  
+  nLocalDonor = 0;
+  for (iPoint = 0; iPoint < donor_geometry->GetnPoint(); iPoint++)
+    if (Donor_Flag[iPoint]) {
+      Donor_Point[nLocalDonor] = iPoint;
+      for (iDim = 0; iDim < nDim; iDim++) {
+        Donor_Coord[nLocalDonor*nDim+iDim] = donor_geometry->node[iPoint]->GetCoord(iDim);
+        Donor_Box[iDim] = min(Donor_Box[iDim], Donor_Coord[nLocalDonor*nDim+iDim]);
+        Donor_Box[nDim+iDim] = max(Donor_Box[nDim+iDim], Donor_Coord[nLocalDonor*nDim+iDim]);
+      }
+      nLocalDonor++;
+    }
+  
+  delete [] Donor_Flag;
+  
+  /*--- Number of donor points and bounding box of every rank ---*/
+  
+  int *nDonor_Rank = new int [size];
+  double *Donor_Box_Rank = new double [size*2*nDim];
+  
+#ifdef HAVE_MPI
+  int nLocalDonor_Int = int(nLocalDonor);
+  MPI_Allgather(&nLocalDonor_Int, 1, MPI_INT, nDonor_Rank, 1, MPI_INT, MPI_COMM_WORLD);
+  MPI_Allgather(Donor_Box, 2*nDim, MPI_DOUBLE, Donor_Box_Rank, 2*nDim, MPI_DOUBLE, MPI_COMM_WORLD);
+#else
+  nDonor_Rank[MASTER_NODE] = int(nLocalDonor);
+  for (iDim = 0; iDim < 2*nDim; iDim++) Donor_Box_Rank[iDim] = Donor_Box[iDim];
+#endif
+  
+  delete [] Donor_Box;
+  
+  nGlobalDonor = 0;
+  for (iProcessor = 0; iProcessor < size; iProcessor++)
+    nGlobalDonor += nDonor_Rank[iProcessor];
+  
+  if (nGlobalDonor == 0) {
+    if (rank == MASTER_NODE)
+      cout << "There are no donor points on the coupling interface!!" << endl;
+    exit(EXIT_FAILURE);
+  }
+  
+  /*--- Target vertices of this rank, the halo vertices are included so that
+   the boundary values are also consistent across the partitions ---*/
+  
+  nInterface_Target = 0;
+  for (iMarker = 0; iMarker < target_geometry->GetnMarker(); iMarker++)
+    if (target_marker[iMarker]) nInterface_Target += target_geometry->GetnVertex(iMarker);
+  
+  Interface_Target_Marker = new unsigned short [nInterface_Target];
+  Interface_Target_Vertex = new unsigned long [nInterface_Target];
+  Interface_Donor_Slot = new unsigned long [nInterface_Target*INTERFACE_NDONOR];
+  Interface_Donor_Weight = new double [nInterface_Target*INTERFACE_NDONOR];
+  long *Target_Donor = new long [nInterface_Target*INTERFACE_NDONOR];
+  
+  iTarget = 0;
+  for (iMarker = 0; iMarker < target_geometry->GetnMarker(); iMarker++)
+    if (target_marker[iMarker])
+      for (iVertex = 0; iVertex < target_geometry->GetnVertex(iMarker); iVertex++) {
+        Interface_Target_Marker[iTarget] = iMarker;
+        Interface_Target_Vertex[iTarget] = iVertex;
+        iTarget++;
+      }
+  
+  /*--- Bounding box of the target vertices, and search radius of this rank: all the
+   points of a donor box lie within its farthest corner, so a box with INTERFACE_NDONOR
+   points bounds the distance to the nearest donors of each target vertex (-1 if the
+   rank has no target vertex, and all the donors if no rank has enough of them) ---*/
+  
+  double *Target_Box = new double [2*nDim+1];
+  for (iDim = 0; iDim < nDim; iDim++) {
+    Target_Box[iDim] = 1E30; Target_Box[nDim+iDim] = -1E30;
+  }
+  Target_Box[2*nDim] = (nInterface_Target == 0) ? -1.0 : 0.0;
+  
+  for (iTarget = 0; iTarget < nInterface_Target; iTarget++) {
+    iPoint = target_geometry->vertex[Interface_Target_Marker[iTarget]][Interface_Target_Vertex[iTarget]]->GetNode();
+    Coord_i = target_geometry->node[iPoint]->GetCoord();
+    
+    Radius = 1E30;
+    for (iProcessor = 0; iProcessor < size; iProcessor++) {
+      if (nDonor_Rank[iProcessor] < int(INTERFACE_NDONOR)) continue;
+      Dist_Far = 0.0;
+      for (iDim = 0; iDim < nDim; iDim++) {
+        Dist = max(fabs(Coord_i[iDim]-Donor_Box_Rank[iProcessor*2*nDim+iDim]),
+                   fabs(Coord_i[iDim]-Donor_Box_Rank[iProcessor*2*nDim+nDim+iDim]));
+        Dist_Far += Dist*Dist;
+      }
+      Radius = min(Radius, sqrt(Dist_Far));
+    }
+    
+    for (iDim = 0; iDim < nDim; iDim++) {
+      Target_Box[iDim] = min(Target_Box[iDim], Coord_i[iDim]);
+      Target_Box[nDim+iDim] = max(Target_Box[nDim+iDim], Coord_i[iDim]);
+    }
+    Target_Box[2*nDim] = max(Target_Box[2*nDim], Radius);
+  }
+  
+  double *Target_Box_Rank = new double [size*(2*nDim+1)];
+  
+#ifdef HAVE_MPI
+  MPI_Allgather(Target_Box, 2*nDim+1, MPI_DOUBLE, Target_Box_Rank, 2*nDim+1, MPI_DOUBLE, MPI_COMM_WORLD);
+#else
+  for (iDim = 0; iDim < 2*nDim+1; iDim++) Target_Box_Rank[iDim] = Target_Box[iDim];
+#endif
+  
+  delete [] Target_Box;
+  
+  /*--- Each rank only sends the donor points that are within the search radius of
+   the target box of the other rank, ordered by destination rank ---*/
+  
+  int *nCandidate_Send = new int [size];
+  int *nCandidate_Receive = new int [size];
+  bool *Candidate_Flag = new bool [size*nLocalDonor];
+  unsigned long nCandidate_Send_Total = 0;
+  
+  for (iProcessor = 0; iProcessor < size; iProcessor++) {
+    nCandidate_Send[iProcessor] = 0;
+    Radius = Target_Box_Rank[iProcessor*(2*nDim+1)+2*nDim];
+    for (iLocal = 0; iLocal < nLocalDonor; iLocal++) {
+      Dist_Near = 0.0;
+      for (iDim = 0; iDim < nDim; iDim++) {
+        Dist = max(0.0, max(Target_Box_Rank[iProcessor*(2*nDim+1)+iDim]-Donor_Coord[iLocal*nDim+iDim],
+                            Donor_Coord[iLocal*nDim+iDim]-Target_Box_Rank[iProcessor*(2*nDim+1)+nDim+iDim]));
+        Dist_Near += Dist*Dist;
+      }
+      Candidate_Flag[iProcessor*nLocalDonor+iLocal] = ((Radius >= 0.0) && (Dist_Near <= Radius*Radius*(1.0+1E-10)));
+      if (Candidate_Flag[iProcessor*nLocalDonor+iLocal]) nCandidate_Send[iProcessor]++;
+    }
+    nCandidate_Send_Total += nCandidate_Send[iProcessor];
+  }
+  
+  double *Buffer_Send_Coord = new double [nCandidate_Send_Total*nDim];
+  unsigned long *Buffer_Send_Index = new unsigned long [nCandidate_Send_Total];
+  
+  iSend = 0;
+  for (iProcessor = 0; iProcessor < size; iProcessor++)
+    for (iLocal = 0; iLocal < nLocalDonor; iLocal++)
+      if (Candidate_Flag[iProcessor*nLocalDonor+iLocal]) {
+        for (iDim = 0; iDim < nDim; iDim++)
+          Buffer_Send_Coord[iSend*nDim+iDim] = Donor_Coord[iLocal*nDim+iDim];
+        Buffer_Send_Index[iSend] = iLocal;
+        iSend++;
+      }
+  
+  delete [] Candidate_Flag;
+  delete [] Donor_Coord;
+  delete [] Donor_Box_Rank;
+  delete [] Target_Box_Rank;
+  
+#ifdef HAVE_MPI
+  MPI_Alltoall(nCandidate_Send, 1, MPI_INT, nCandidate_Receive, 1, MPI_INT, MPI_COMM_WORLD);
+#else
+  nCandidate_Receive[MASTER_NODE] = nCandidate_Send[MASTER_NODE];
+#endif
+  
+  nCandidate = 0;
+  for (iProcessor = 0; iProcessor < size; iProcessor++)
+    nCandidate += nCandidate_Receive[iProcessor];
+  
+  /*--- The candidates keep the order of the owner ranks and of their donor points
+   (the order of a global numbering of the donors) ---*/
+  
+  double *Candidate_Coord = new double [nCandidate*nDim];
+  unsigned long *Candidate_Index = new unsigned long [nCandidate];
+  
+#ifdef HAVE_MPI
+  int *Candidate_Send_Offset = new int [size];
+  int *Candidate_Receive_Offset = new int [size];
+  int *nCoord_Send = new int [size];
+  int *nCoord_Receive = new int [size];
+  int *Coord_Send_Offset = new int [size];
+  int *Coord_Receive_Offset = new int [size];
+  Candidate_Send_Offset[0] = 0; Candidate_Receive_Offset[0] = 0;
+  for (iProcessor = 1; iProcessor < size; iProcessor++) {
+    Candidate_Send_Offset[iProcessor] = Candidate_Send_Offset[iProcessor-1] + nCandidate_Send[iProcessor-1];
+    Candidate_Receive_Offset[iProcessor] = Candidate_Receive_Offset[iProcessor-1] + nCandidate_Receive[iProcessor-1];
+  }
+  for (iProcessor = 0; iProcessor < size; iProcessor++) {
+    nCoord_Send[iProcessor] = nCandidate_Send[iProcessor]*nDim;
+    nCoord_Receive[iProcessor] = nCandidate_Receive[iProcessor]*nDim;
+    Coord_Send_Offset[iProcessor] = Candidate_Send_Offset[iProcessor]*nDim;
+    Coord_Receive_Offset[iProcessor] = Candidate_Receive_Offset[iProcessor]*nDim;
+  }
+  MPI_Alltoallv(Buffer_Send_Coord, nCoord_Send, Coord_Send_Offset, MPI_DOUBLE,
+                Candidate_Coord, nCoord_Receive, Coord_Receive_Offset, MPI_DOUBLE, MPI_COMM_WORLD);
+  MPI_Alltoallv(Buffer_Send_Index, nCandidate_Send, Candidate_Send_Offset, MPI_UNSIGNED_LONG,
+                Candidate_Index, nCandidate_Receive, Candidate_Receive_Offset, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+  delete [] Candidate_Send_Offset;
+  delete [] Candidate_Receive_Offset;
+  delete [] nCoord_Send;
+  delete [] nCoord_Receive;
+  delete [] Coord_Send_Offset;
+  delete [] Coord_Receive_Offset;
+#else
+  for (iCandidate = 0; iCandidate < nCandidate; iCandidate++) {
+    for (iDim = 0; iDim < nDim; iDim++)
+      Candidate_Coord[iCandidate*nDim+iDim] = Buffer_Send_Coord[iCandidate*nDim+iDim];
+    Candidate_Index[iCandidate] = Buffer_Send_Index[iCandidate];
+  }
+#endif
+  
+  delete [] Buffer_Send_Coord;
+  delete [] Buffer_Send_Index;
+  delete [] nCandidate_Send;
+  
+  /*--- Uniform bins over the bounding box of the candidates, with about one candidate
+   per bin. The directions that are much shorter than the bins (flat interfaces) get a
+   single bin ---*/
+  
+  Extent_Max = 0.0;
+  for (iDim = 0; iDim < 3; iDim++) {
+    Bin_Min[iDim] = 0.0; Extent[iDim] = 0.0; nBin[iDim] = 1; Bin_Cell[iDim] = 0.0;
+  }
+  if (nCandidate > 0) {
+    for (iDim = 0; iDim < nDim; iDim++) {
+      Bin_Min[iDim] = 1E30; Dist = -1E30;
+      for (iCandidate = 0; iCandidate < nCandidate; iCandidate++) {
+        Bin_Min[iDim] = min(Bin_Min[iDim], Candidate_Coord[iCandidate*nDim+iDim]);
+        Dist = max(Dist, Candidate_Coord[iCandidate*nDim+iDim]);
+      }
+      Extent[iDim] = Dist-Bin_Min[iDim];
+      Extent_Max = max(Extent_Max, Extent[iDim]);
+    }
+  }
+  
+  Bin_Size = Extent_Max;
+  for (iRing = 0; iRing < nDim; iRing++) {
+    Dist = 1.0; nActive = 0;
+    for (iDim = 0; iDim < nDim; iDim++)
+      if ((Extent[iDim] > 1E-10*Extent_Max) && (Extent[iDim] >= Bin_Size)) {
+        Dist *= Extent[iDim]; nActive++;
+      }
+    if (nActive == 0) break;
+    Bin_Size = pow(Dist/double(nCandidate), 1.0/double(nActive));
+  }
+  
+  nBin_Total = 1; Bin_Cell_Min = 1E30;
+  for (iDim = 0; iDim < nDim; iDim++) {
+    if ((Extent[iDim] > 1E-10*Extent_Max) && (Bin_Size > 0.0))
+      nBin[iDim] = max(1L, min(long(nCandidate), long(Extent[iDim]/Bin_Size)));
+    if (nBin[iDim] > 1) {
+      Bin_Cell[iDim] = Extent[iDim]/double(nBin[iDim]);
+      Bin_Cell_Min = min(Bin_Cell_Min, Bin_Cell[iDim]);
+    }
+    nBin_Total *= nBin[iDim];
+  }
+  
+  /*--- Candidates of each bin, in increasing order ---*/
+  
+  unsigned long *Bin_Start = new unsigned long [nBin_Total+1];
+  unsigned long *Bin_Candidate = new unsigned long [nCandidate];
+  unsigned long *Candidate_Bin = new unsigned long [nCandidate];
+  
+  for (iBin = 0; iBin <= nBin_Total; iBin++) Bin_Start[iBin] = 0;
+  for (iCandidate = 0; iCandidate < nCandidate; iCandidate++) {
+    for (iDim = 0; iDim < 3; iDim++) {
+      iCell[iDim] = 0;
+      if (nBin[iDim] > 1)
+        iCell[iDim] = max(0L, min(nBin[iDim]-1, long((Candidate_Coord[iCandidate*nDim+iDim]-Bin_Min[iDim])/Bin_Cell[iDim])));
+    }
+    Candidate_Bin[iCandidate] = (iCell[2]*nBin[1]+iCell[1])*nBin[0]+iCell[0];
+    Bin_Start[Candidate_Bin[iCandidate]+1]++;
+  }
+  for (iBin = 0; iBin < nBin_Total; iBin++) Bin_Start[iBin+1] += Bin_Start[iBin];
+  for (iCandidate = 0; iCandidate < nCandidate; iCandidate++) {
+    Bin_Candidate[Bin_Start[Candidate_Bin[iCandidate]]] = iCandidate;
+    Bin_Start[Candidate_Bin[iCandidate]]++;
+  }
+  for (iBin = nBin_Total; iBin > 0; iBin--) Bin_Start[iBin] = Bin_Start[iBin-1];
+  Bin_Start[0] = 0;
+  
+  delete [] Candidate_Bin;
+  
+  /*--- Nearest donors of each target vertex, and inverse distance weights (a
+   coincident donor takes all the weight). The bins are visited by rings around the
+   bin of the vertex, until the points out of the rings cannot be closer. Equal
+   distances are ordered by candidate, as in a search over all the donors ---*/
+  
+  for (iTarget = 0; iTarget < nInterface_Target; iTarget++) {
+    iPoint = target_geometry->vertex[Interface_Target_Marker[iTarget]][Interface_Target_Vertex[iTarget]]->GetNode();
+    Coord_i = target_geometry->node[iPoint]->GetCoord();
+    
+    for (iDonor = 0; iDonor < INTERFACE_NDONOR; iDonor++) {
+      Dist_Donor[iDonor] = 1E30; Candidate_Donor[iDonor] = -1;
+    }
+    
+    nRing = 0;
+    for (iDim = 0; iDim < 3; iDim++) {
+      iCell[iDim] = 0;
+      if (nBin[iDim] > 1)
+        iCell[iDim] = max(0L, min(nBin[iDim]-1, long((Coord_i[iDim]-Bin_Min[iDim])/Bin_Cell[iDim])));
+      nRing = max(nRing, max(iCell[iDim], nBin[iDim]-1-iCell[iDim]));
+    }
+    
+    for (iRing = 0; iRing <= nRing; iRing++) {
+      
+      for (jCell[2] = max(0L, iCell[2]-iRing); jCell[2] <= min(nBin[2]-1, iCell[2]+iRing); jCell[2]++)
+        for (jCell[1] = max(0L, iCell[1]-iRing); jCell[1] <= min(nBin[1]-1, iCell[1]+iRing); jCell[1]++)
+          for (jCell[0] = max(0L, iCell[0]-iRing); jCell[0] <= min(nBin[0]-1, iCell[0]+iRing); jCell[0]++) {
+            
+            for (iDim = 0; iDim < 3; iDim++) kCell[iDim] = labs(jCell[iDim]-iCell[iDim]);
+            if (max(kCell[0], max(kCell[1], kCell[2])) != iRing) continue;
+            
+            iBin = (jCell[2]*nBin[1]+jCell[1])*nBin[0]+jCell[0];
+            for (iLocal = Bin_Start[iBin]; iLocal < Bin_Start[iBin+1]; iLocal++) {
+              iCandidate = Bin_Candidate[iLocal];
+              Dist = 0.0;
+              for (iDim = 0; iDim < nDim; iDim++)
+                Dist += (Candidate_Coord[iCandidate*nDim+iDim]-Coord_i[iDim])*(Candidate_Coord[iCandidate*nDim+iDim]-Coord_i[iDim]);
+              
+              /*--- Insert the point in the ordered list of the nearest donors ---*/
+              
+              if ((Dist < Dist_Donor[INTERFACE_NDONOR-1]) ||
+                  ((Dist == Dist_Donor[INTERFACE_NDONOR-1]) && (long(iCandidate) < Candidate_Donor[INTERFACE_NDONOR-1]))) {
+                iDonor = INTERFACE_NDONOR-1;
+                while ((iDonor > 0) && ((Dist < Dist_Donor[iDonor-1]) ||
+                                        ((Dist == Dist_Donor[iDonor-1]) && (long(iCandidate) < Candidate_Donor[iDonor-1])))) {
+                  Dist_Donor[iDonor] = Dist_Donor[iDonor-1]; Candidate_Donor[iDonor] = Candidate_Donor[iDonor-1];
+                  iDonor--;
+                }
+                Dist_Donor[iDonor] = Dist; Candidate_Donor[iDonor] = iCandidate;
+              }
+            }
+            
+          }
+      
+      /*--- The bins out of the rings are at least iRing cells away ---*/
+      
+      if ((Candidate_Donor[INTERFACE_NDONOR-1] != -1) &&
+          (Dist_Donor[INTERFACE_NDONOR-1] < (double(iRing)*Bin_Cell_Min)*(double(iRing)*Bin_Cell_Min))) break;
+      
+    }
+    
+    Weight_Sum = 0.0;
+    for (iDonor = 0; iDonor < INTERFACE_NDONOR; iDonor++) {
+      Interface_Donor_Weight[iTarget*INTERFACE_NDONOR+iDonor] = 0.0;
+      if (Candidate_Donor[iDonor] == -1) Candidate_Donor[iDonor] = Candidate_Donor[0];
+      else if (sqrt(Dist_Donor[0]) < 1E-10) { if (iDonor == 0) Interface_Donor_Weight[iTarget*INTERFACE_NDONOR] = 1.0; }
+      else Interface_Donor_Weight[iTarget*INTERFACE_NDONOR+iDonor] = 1.0/sqrt(Dist_Donor[iDonor]);
+      Weight_Sum += Interface_Donor_Weight[iTarget*INTERFACE_NDONOR+iDonor];
+      Target_Donor[iTarget*INTERFACE_NDONOR+iDonor] = Candidate_Donor[iDonor];
+    }
+    for (iDonor = 0; iDonor < INTERFACE_NDONOR; iDonor++)
+      Interface_Donor_Weight[iTarget*INTERFACE_NDONOR+iDonor] /= Weight_Sum;
+    
+  }
+  
+  delete [] Candidate_Coord;
+  delete [] Bin_Start;
+  delete [] Bin_Candidate;
+  
+  /*--- Number the donors needed by this rank (each one once); as the candidates
+   follow the ranks, the slots are grouped by the owner rank ---*/
+  
+  long *Candidate_Slot = new long [nCandidate];
+  for (iCandidate = 0; iCandidate < nCandidate; iCandidate++) Candidate_Slot[iCandidate] = -1;
+  for (iTarget = 0; iTarget < nInterface_Target*INTERFACE_NDONOR; iTarget++)
+    Candidate_Slot[Target_Donor[iTarget]] = 0;
+  
+  Interface_nReceive = new int [size];
+  nInterface_Receive = 0;
+  iCandidate = 0;
+  for (iProcessor = 0; iProcessor < size; iProcessor++) {
+    Interface_nReceive[iProcessor] = 0;
+    for (iLocal = 0; iLocal < (unsigned long)nCandidate_Receive[iProcessor]; iLocal++) {
+      if (Candidate_Slot[iCandidate] != -1) {
+        Candidate_Slot[iCandidate] = nInterface_Receive; nInterface_Receive++;
+        Interface_nReceive[iProcessor]++;
+      }
+      iCandidate++;
+    }
+  }
+  
+  for (iTarget = 0; iTarget < nInterface_Target*INTERFACE_NDONOR; iTarget++)
+    Interface_Donor_Slot[iTarget] = Candidate_Slot[Target_Donor[iTarget]];
+  
+  /*--- Position of each requested donor in the list of interface points of its owner ---*/
+  
+  unsigned long *Buffer_Send_Request = new unsigned long [nInterface_Receive];
+  for (iCandidate = 0; iCandidate < nCandidate; iCandidate++)
+    if (Candidate_Slot[iCandidate] != -1) Buffer_Send_Request[Candidate_Slot[iCandidate]] = Candidate_Index[iCandidate];
+  
+  delete [] Target_Donor;
+  delete [] Candidate_Slot;
+  delete [] Candidate_Index;
+  delete [] nCandidate_Receive;
+  
+  /*--- Tell each rank which of its points are requested, the exchanges of the
+   coupling iterations only move those values ---*/
+  
+  Interface_nSend = new int [size];
+  
+#ifdef HAVE_MPI
+  MPI_Alltoall(Interface_nReceive, 1, MPI_INT, Interface_nSend, 1, MPI_INT, MPI_COMM_WORLD);
+#else
+  Interface_nSend[MASTER_NODE] = Interface_nReceive[MASTER_NODE];
+#endif
+  
+  nInterface_Send = 0;
+  for (iProcessor = 0; iProcessor < size; iProcessor++)
+    nInterface_Send += Interface_nSend[iProcessor];
+  
+  unsigned long *Buffer_Receive_Request = new unsigned long [nInterface_Send];
+  
+#ifdef HAVE_MPI
+  int *Send_Offset = new int [size];
+  int *Receive_Offset = new int [size];
+  Send_Offset[0] = 0; Receive_Offset[0] = 0;
+  for (iProcessor = 1; iProcessor < size; iProcessor++) {
+    Send_Offset[iProcessor] = Send_Offset[iProcessor-1] + Interface_nSend[iProcessor-1];
+    Receive_Offset[iProcessor] = Receive_Offset[iProcessor-1] + Interface_nReceive[iProcessor-1];
+  }
+  MPI_Alltoallv(Buffer_Send_Request, Interface_nReceive, Receive_Offset, MPI_UNSIGNED_LONG,
+                Buffer_Receive_Request, Interface_nSend, Send_Offset, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+  delete [] Send_Offset;
+  delete [] Receive_Offset;
+#else
+  for (iSend = 0; iSend < nInterface_Send; iSend++)
+    Buffer_Receive_Request[iSend] = Buffer_Send_Request[iSend];
+#endif
+  
+  Interface_Send_Point = new unsigned long [nInterface_Send];
+  for (iSend = 0; iSend < nInterface_Send; iSend++)
+    Interface_Send_Point[iSend] = Donor_Point[Buffer_Receive_Request[iSend]];
+  
+  delete [] Buffer_Send_Request;
+  delete [] Buffer_Receive_Request;
+  delete [] Donor_Point;
+  delete [] nDonor_Rank;
+  
+  Interface_Map = true;
+  
+}
+
+void CSolver::SetInterface_Exchange(double *Buffer_Send, double *Buffer_Receive, unsigned short val_nVal) {
+  
+#ifndef HAVE_MPI
+  
+  for (unsigned long iVal = 0; iVal < nInterface_Send*val_nVal; iVal++)
+    Buffer_Receive[iVal] = Buffer_Send[iVal];
+  
+#else
+  
+  int iProcessor, size, nRequest = 0;
+  unsigned long Send_Offset = 0, Receive_Offset = 0;
+  
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+  MPI_Request *request = new MPI_Request [2*size];
+  
+  /*--- Only the ranks that share part of the interface are contacted, and
+   all the values for one rank travel in a single message ---*/
+  
+  for (iProcessor = 0; iProcessor < size; iProcessor++) {
+    if (Interface_nReceive[iProcessor] > 0) {
+      MPI_Irecv(&Buffer_Receive[Receive_Offset*val_nVal], Interface_nReceive[iProcessor]*val_nVal, MPI_DOUBLE,
+                iProcessor, 0, MPI_COMM_WORLD, &request[nRequest]);
+      nRequest++;
+    }
+    Receive_Offset += Interface_nReceive[iProcessor];
+  }
+  
+  for (iProcessor = 0; iProcessor < size; iProcessor++) {
+    if (Interface_nSend[iProcessor] > 0) {
+      MPI_Isend(&Buffer_Send[Send_Offset*val_nVal], Interface_nSend[iProcessor]*val_nVal, MPI_DOUBLE,
+                iProcessor, 0, MPI_COMM_WORLD, &request[nRequest]);
+      nRequest++;
+    }
+    Send_Offset += Interface_nSend[iProcessor];
+  }
+  
+  MPI_Waitall(nRequest, request, MPI_STATUSES_IGNORE);
+  
+  delete [] request;
+  
+#endif
+  
+}
+
 CBaselineSolver::CBaselineSolver(void) : CSolver() { }
 
 CBaselineSolver::CBaselineSolver(CGeometry *geometry, CConfig *config, unsigned short iMesh) : CSolver() {
@@ -30,6 +30,8 @@ CEulerVariable::CEulerVariable(void) : CVariable() {
 	Gradient_Primitive = NULL;
 	Reconst_Gradient_Primitive = NULL;
 	Limiter_Primitive = NULL;
+  Gradient_Primitive_Single = NULL;
+  Limiter_Primitive_Single = NULL;
   WindGust = NULL;
   WindGustDer = NULL;
   
@@ -47,6 +49,7 @@ CEulerVariable::CEulerVariable(double val_density, double *val_velocity, double
                     (config->GetUnsteady_Simulation() == DT_STEPPING_2ND));
   bool viscous = config->GetViscous();
   bool windgust = config->GetWind_Gust();
+  bool single_precision = config->GetSingle_Precision_Gradient();
   
   /*--- Array initialization ---*/
 	TS_Source = NULL;
@@ -54,6 +57,8 @@ CEulerVariable::CEulerVariable(double val_density, double *val_velocity, double
 	Gradient_Primitive = NULL;
 	Reconst_Gradient_Primitive = NULL;
 	Limiter_Primitive = NULL;
+  Gradient_Primitive_Single = NULL;
+  Limiter_Primitive_Single = NULL;
   WindGust = NULL;
   WindGustDer = NULL;
 
@@ -88,9 +93,16 @@ CEulerVariable::CEulerVariable(double val_density, double *val_velocity, double
   
   /*--- Always allocate the slope limiter,
    and the auxiliar variables (check the logic - JST with 2nd order Turb model - ) ---*/
-  Limiter_Primitive = new double [nPrimVarGrad];
-  for (iVar = 0; iVar < nPrimVarGrad; iVar++)
-    Limiter_Primitive[iVar] = 0.0;
+  if (single_precision) {
+    Limiter_Primitive_Single = new float [nPrimVarGrad];
+    for (iVar = 0; iVar < nPrimVarGrad; iVar++)
+      Limiter_Primitive_Single[iVar] = 0.0;
+  }
+  else {
+    Limiter_Primitive = new double [nPrimVarGrad];
+    for (iVar = 0; iVar < nPrimVarGrad; iVar++)
+      Limiter_Primitive[iVar] = 0.0;
+  }
   
   Limiter_Secondary = new double [nSecondaryVarGrad];
   for (iVar = 0; iVar < nSecondaryVarGrad; iVar++)
@@ -176,12 +188,20 @@ CEulerVariable::CEulerVariable(double val_density, double *val_velocity, double
   /*--- Incompressible flow, gradients primitive variables nDim+2, (P,vx,vy,vz,rho),
         FreeSurface Incompressible flow, primitive variables nDim+3, (P,vx,vy,vz,rho,beta,dist),
         Compressible flow, gradients primitive variables nDim+4, (T,vx,vy,vz,P,rho,h)
-        We need P, and rho for running the adjoint problem ---*/
-  Gradient_Primitive = new double* [nPrimVarGrad];
-  for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
-    Gradient_Primitive[iVar] = new double [nDim];
-    for (iDim = 0; iDim < nDim; iDim++)
-      Gradient_Primitive[iVar][iDim] = 0.0;
+        We need P, and rho for running the adjoint problem.
+        In single precision the gradient is stored contiguously (nPrimVarGrad x nDim) ---*/
+  if (single_precision) {
+    Gradient_Primitive_Single = new float [nPrimVarGrad*nDim];
+    for (iVar = 0; iVar < nPrimVarGrad*nDim; iVar++)
+      Gradient_Primitive_Single[iVar] = 0.0;
+  }
+  else {
+    Gradient_Primitive = new double* [nPrimVarGrad];
+    for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
+      Gradient_Primitive[iVar] = new double [nDim];
+      for (iDim = 0; iDim < nDim; iDim++)
+        Gradient_Primitive[iVar][iDim] = 0.0;
+    }
   }
   
   Reconst_Gradient_Primitive = new double* [nPrimVarGrad];
@@ -211,6 +231,7 @@ CEulerVariable::CEulerVariable(double *val_solution, unsigned short val_nDim, un
                     (config->GetUnsteady_Simulation() == DT_STEPPING_2ND));
   bool viscous = config->GetViscous();
   bool windgust = config->GetWind_Gust();
+  bool single_precision = config->GetSingle_Precision_Gradient();
   
   /*--- Array initialization ---*/
 	TS_Source = NULL;
@@ -218,6 +239,8 @@ CEulerVariable::CEulerVariable(double *val_solution, unsigned short val_nDim, un
 	Gradient_Primitive = NULL;
 	Reconst_Gradient_Primitive = NULL;
   Limiter_Primitive = NULL;
+  Gradient_Primitive_Single = NULL;
+  Limiter_Primitive_Single = NULL;
   WindGust = NULL;
   WindGustDer = NULL;
   
@@ -251,9 +274,16 @@ CEulerVariable::CEulerVariable(double *val_solution, unsigned short val_nDim, un
   
   /*--- Always allocate the slope limiter,
    and the auxiliar variables (check the logic - JST with 2nd order Turb model - ) ---*/
-  Limiter_Primitive = new double [nPrimVarGrad];
-  for (iVar = 0; iVar < nPrimVarGrad; iVar++)
-    Limiter_Primitive[iVar] = 0.0;
+  if (single_precision) {
+    Limiter_Primitive_Single = new float [nPrimVarGrad];
+    for (iVar = 0; iVar < nPrimVarGrad; iVar++)
+      Limiter_Primitive_Single[iVar] = 0.0;
+  }
+  else {
+    Limiter_Primitive = new double [nPrimVarGrad];
+    for (iVar = 0; iVar < nPrimVarGrad; iVar++)
+      Limiter_Primitive[iVar] = 0.0;
+  }
   
   Limiter_Secondary = new double [nSecondaryVarGrad];
   for (iVar = 0; iVar < nSecondaryVarGrad; iVar++)
@@ -314,12 +344,20 @@ CEulerVariable::CEulerVariable(double *val_solution, unsigned short val_nDim, un
   /*--- Incompressible flow, gradients primitive variables nDim+2, (P,vx,vy,vz,rho),
         FreeSurface Incompressible flow, primitive variables nDim+4, (P,vx,vy,vz,rho,beta,dist),
         Compressible flow, gradients primitive variables nDim+4, (T,vx,vy,vz,P,rho,h)
-        We need P, and rho for running the adjoint problem ---*/
-  Gradient_Primitive = new double* [nPrimVarGrad];
-  for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
-    Gradient_Primitive[iVar] = new double [nDim];
-    for (iDim = 0; iDim < nDim; iDim++)
-      Gradient_Primitive[iVar][iDim] = 0.0;
+        We need P, and rho for running the adjoint problem.
+        In single precision the gradient is stored contiguously (nPrimVarGrad x nDim) ---*/
+  if (single_precision) {
+    Gradient_Primitive_Single = new float [nPrimVarGrad*nDim];
+    for (iVar = 0; iVar < nPrimVarGrad*nDim; iVar++)
+      Gradient_Primitive_Single[iVar] = 0.0;
+  }
+  else {
+    Gradient_Primitive = new double* [nPrimVarGrad];
+    for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
+      Gradient_Primitive[iVar] = new double [nDim];
+      for (iDim = 0; iDim < nDim; iDim++)
+        Gradient_Primitive[iVar][iDim] = 0.0;
+    }
   }
   
     Reconst_Gradient_Primitive = new double* [nPrimVarGrad];
@@ -344,6 +382,8 @@ CEulerVariable::~CEulerVariable(void) {
 	if (TS_Source         != NULL) delete [] TS_Source;
   if (Primitive         != NULL) delete [] Primitive;
   if (Limiter_Primitive != NULL) delete [] Limiter_Primitive;
+  if (Limiter_Primitive_Single != NULL) delete [] Limiter_Primitive_Single;
+  if (Gradient_Primitive_Single != NULL) delete [] Gradient_Primitive_Single;
   if (WindGust          != NULL) delete [] WindGust;
   if (WindGustDer       != NULL) delete [] WindGustDer;
 
@@ -364,6 +404,12 @@ CEulerVariable::~CEulerVariable(void) {
 void CEulerVariable::SetGradient_PrimitiveZero(unsigned short val_primvar) {
 	unsigned short iVar, iDim;
   
+	if (Gradient_Primitive_Single != NULL) {
+		for (iVar = 0; iVar < val_primvar*nDim; iVar++)
+			Gradient_Primitive_Single[iVar] = 0.0;
+		return;
+	}
+  
 	for (iVar = 0; iVar < val_primvar; iVar++)
 		for (iDim = 0; iDim < nDim; iDim++)
 			Gradient_Primitive[iVar][iDim] = 0.0;
@@ -545,18 +591,18 @@ CNSVariable::~CNSVariable(void) { }
 
 void CNSVariable::SetVorticity(void) {
   
-	double u_y = Gradient_Primitive[1][1];
-	double v_x = Gradient_Primitive[2][0];
+	double u_y = GetGradient_Primitive(1, 1);
+	double v_x = GetGradient_Primitive(2, 0);
 	double u_z = 0.0;
 	double v_z = 0.0;
 	double w_x = 0.0;
 	double w_y = 0.0;
   
 	if (nDim == 3) {
-		u_z = Gradient_Primitive[1][2];
-		v_z = Gradient_Primitive[2][2];
-		w_x = Gradient_Primitive[3][0];
-		w_y = Gradient_Primitive[3][1];
+		u_z = GetGradient_Primitive(1, 2);
+		v_z = GetGradient_Primitive(2, 2);
+		w_x = GetGradient_Primitive(3, 0);
+		w_y = GetGradient_Primitive(3, 1);
 	}
   
 	Vorticity[0] = w_y-v_z;
@@ -570,32 +616,32 @@ void CNSVariable::SetStrainMag(void) {
   double div;
   
   if (nDim == 2) {
-    div = Gradient_Primitive[1][0] + Gradient_Primitive[2][1];
+    div = GetGradient_Primitive(1, 0) + GetGradient_Primitive(2, 1);
     StrainMag = 0.0;
     
     // add diagonals
-    StrainMag += pow(Gradient_Primitive[1][0] - 1.0/3.0*div, 2.0);
-    StrainMag += pow(Gradient_Primitive[2][1] - 1.0/3.0*div, 2.0);
+    StrainMag += pow(GetGradient_Primitive(1, 0) - 1.0/3.0*div, 2.0);
+    StrainMag += pow(GetGradient_Primitive(2, 1) - 1.0/3.0*div, 2.0);
     
     // add off diagonals
-    StrainMag += 2.0*pow(0.5*(Gradient_Primitive[1][1] + Gradient_Primitive[2][0]), 2.0);
+    StrainMag += 2.0*pow(0.5*(GetGradient_Primitive(1, 1) + GetGradient_Primitive(2, 0)), 2.0);
     
     StrainMag = sqrt(2.0*StrainMag);
     
   }
   else {
-    div = Gradient_Primitive[1][0] + Gradient_Primitive[2][1] + Gradient_Primitive[3][2];
+    div = GetGradient_Primitive(1, 0) + GetGradient_Primitive(2, 1) + GetGradient_Primitive(3, 2);
     StrainMag = 0.0;
     
     // add diagonals
-    StrainMag += pow(Gradient_Primitive[1][0] - 1.0/3.0*div,2.0);
-    StrainMag += pow(Gradient_Primitive[2][1] - 1.0/3.0*div,2.0);
-    StrainMag += pow(Gradient_Primitive[3][2] - 1.0/3.0*div,2.0);
+    StrainMag += pow(GetGradient_Primitive(1, 0) - 1.0/3.0*div,2.0);
+    StrainMag += pow(GetGradient_Primitive(2, 1) - 1.0/3.0*div,2.0);
+    StrainMag += pow(GetGradient_Primitive(3, 2) - 1.0/3.0*div,2.0);
     
     // add off diagonals
-    StrainMag += 2.0*pow(0.5*(Gradient_Primitive[1][1] + Gradient_Primitive[2][0]), 2.0);
-    StrainMag += 2.0*pow(0.5*(Gradient_Primitive[1][2] + Gradient_Primitive[3][0]), 2.0);
-    StrainMag += 2.0*pow(0.5*(Gradient_Primitive[2][2] + Gradient_Primitive[3][1]), 2.0);
+    StrainMag += 2.0*pow(0.5*(GetGradient_Primitive(1, 1) + GetGradient_Primitive(2, 0)), 2.0);
+    StrainMag += 2.0*pow(0.5*(GetGradient_Primitive(1, 2) + GetGradient_Primitive(3, 0)), 2.0);
+    StrainMag += 2.0*pow(0.5*(GetGradient_Primitive(2, 2) + GetGradient_Primitive(3, 1)), 2.0);
     
     StrainMag = sqrt(2.0*StrainMag);
   }
@@ -1002,6 +1002,78 @@ double CTNE2EulerVariable::CalcCvve(double val_Tve, CConfig *config, unsigned sh
 
 
 
+void CTNE2EulerVariable::CalcRhoEveCvve(double *U, double val_Tve, CConfig *config,
+                                        double &val_rhoEve, double &val_rhoCvve) {
+  
+  unsigned short iEl, iSpecies, nHeavy, *nElStates;
+  double *Ms, *thetav, **thetae, **g, *hf, *Tref, Ru, RuoMs;
+  double Tve, thoTve, exptv, Ev, Eel, Cvvs, Cves;
+  double num, num2, num3, denom;
+  
+  /*--- Read the species data from config once for the whole mixture ---*/
+  Ms        = config->GetMolar_Mass();
+  thetav    = config->GetCharVibTemp();
+  thetae    = config->GetCharElTemp();
+  g         = config->GetElDegeneracy();
+  nElStates = config->GetnElStates();
+  
+  /*--- Rename for convenience ---*/
+  Ru  = UNIVERSAL_GAS_CONSTANT;
+  Tve = val_Tve;
+  
+  if (ionization) nHeavy = nSpecies-1;
+  else            nHeavy = nSpecies;
+  
+  val_rhoEve  = 0.0;
+  val_rhoCvve = 0.0;
+  
+  /*--- Heavy particles, sharing the exponentials between Eve and Cvve ---*/
+  for (iSpecies = 0; iSpecies < nHeavy; iSpecies++) {
+    RuoMs = Ru/Ms[iSpecies];
+    Ev = 0.0; Eel = 0.0; Cvvs = 0.0; Cves = 0.0;
+    
+    /*--- Vibrational energy (harmonic-oscillator model) ---*/
+    if (thetav[iSpecies] != 0.0) {
+      thoTve = thetav[iSpecies]/Tve;
+      exptv  = exp(thoTve);
+      Ev     = RuoMs * thetav[iSpecies] / (exptv-1.0);
+      Cvvs   = RuoMs * thoTve*thoTve * exptv / ((exptv-1.0)*(exptv-1.0));
+    }
+    
+    /*--- Electronic energy ---*/
+    if (nElStates[iSpecies] != 0) {
+      num = 0.0; num2 = 0.0;
+      denom = g[iSpecies][0] * exp(thetae[iSpecies][0]/Tve);
+      num3  = g[iSpecies][0] * (thetae[iSpecies][0]/(Tve*Tve))*exp(-thetae[iSpecies][0]/Tve);
+      for (iEl = 1; iEl < nElStates[iSpecies]; iEl++) {
+        thoTve = thetae[iSpecies][iEl]/Tve;
+        exptv  = exp(-thoTve);
+        num   += g[iSpecies][iEl] * thetae[iSpecies][iEl] * exptv;
+        denom += g[iSpecies][iEl] * exptv;
+        num2  += g[iSpecies][iEl] * (thoTve*thoTve) * exptv;
+        num3  += g[iSpecies][iEl] * thoTve/Tve * exptv;
+      }
+      Eel  = RuoMs * (num/denom);
+      Cves = RuoMs * (num2/denom - num*num3/(denom*denom));
+    }
+    
+    val_rhoEve  += U[iSpecies] * (Ev + Eel);
+    val_rhoCvve += U[iSpecies] * (Cvvs + Cves);
+  }
+  
+  /*--- Electron t-r mode contributes to mixture vib-el energy ---*/
+  if (ionization) {
+    Tref  = config->GetRefTemperature();
+    hf    = config->GetEnthalpy_Formation();
+    RuoMs = Ru/Ms[nSpecies-1];
+    Eel   = 3.0/2.0 * RuoMs * (Tve - Tref[nSpecies-1])
+          + hf[nSpecies-1] - RuoMs * Tref[nSpecies-1];
+    val_rhoEve  += U[nSpecies-1] * Eel;
+    val_rhoCvve += U[nSpecies-1] * 3.0/2.0 * RuoMs;
+  }
+  
+}
+
 void CTNE2EulerVariable::CalcdTdU(double *V, CConfig *config,
                                   double *val_dTdU) {
   
@@ -1148,12 +1220,12 @@ bool CTNE2EulerVariable::Cons2PrimVar(CConfig *config, double *U, double *V,
                                       double *val_dPdU, double *val_dTdU,
                                       double *val_dTvedU) {
   
-  bool ionization, nonphys, nrconvg, converr;
-	unsigned short iDim, iEl, iSpecies, nHeavy, nEl, iIter, maxBIter, maxNIter;
+  bool ionization, nonphys, nrconvg, converr, warmstart;
+	unsigned short iDim, iEl, iSpecies, nHeavy, nEl, iIter, maxBIter, maxNIter, nClamp;
   double rho, rhoE, rhoEve, rhoE_f, rhoE_ref, rhoEve_t;
   double Ru, sqvel, rhoCvtr, rhoCvve;
-  double Tve, Tve2, Tve_o;
-  double f, df, tol;
+  double Tve, Tve2, Tve_o, Tve_prev;
+  double f, df, tol, relax, maxDTve;
   double Tmin, Tmax, Tvemin, Tvemax;
   double radical2;
   double *xi, *Ms, *hf, *Tref;
@@ -1164,6 +1236,12 @@ bool CTNE2EulerVariable::Cons2PrimVar(CConfig *config, double *U, double *V,
   
   converr = false;
   
+  /*--- Store the last converged V-E temperature of this point before V is
+   overwritten (V may be the Primitive vector itself), so that it can be
+   used as the initial guess of the Newton-Raphson iterations ---*/
+  Tve_prev = 0.0;
+  if (Primitive != NULL) Tve_prev = Primitive[TVE_INDEX];
+  
   /*--- Read from config ---*/
   xi         = config->GetRotationModes();      // Rotational modes of energy storage
   Ms         = config->GetMolar_Mass();         // Species molar mass
@@ -1251,9 +1329,7 @@ bool CTNE2EulerVariable::Cons2PrimVar(CConfig *config, double *U, double *V,
   // Check for non-physical solutions
   nonphys = false;
   V[TVE_INDEX] = Tvemin;
-  rhoEve_t = 0.0;
-  for (iSpecies = 0; iSpecies < nSpecies; iSpecies++)
-    rhoEve_t += U[iSpecies]*CalcEve(V, config, iSpecies);
+  CalcRhoEveCvve(U, Tvemin, config, rhoEve_t, rhoCvve);
   if (rhoEve < rhoEve_t) {
     nonphys = true;
     converr = true;
@@ -1262,9 +1338,7 @@ bool CTNE2EulerVariable::Cons2PrimVar(CConfig *config, double *U, double *V,
   }
   
   V[TVE_INDEX] = Tvemax;
-  rhoEve_t = 0.0;
-  for (iSpecies = 0; iSpecies < nSpecies; iSpecies++)
-    rhoEve_t += U[iSpecies]*CalcEve(V, config, iSpecies);
+  CalcRhoEveCvve(U, Tvemax, config, rhoEve_t, rhoCvve);
   if (rhoEve > rhoEve_t) {
     nonphys = true;
     converr = true;
@@ -1272,32 +1346,40 @@ bool CTNE2EulerVariable::Cons2PrimVar(CConfig *config, double *U, double *V,
 //    cout << "Tve > Tve max" << endl;
   }
   
-  // Initialize trial values of Tve for Newton-Raphson method
-//  Tve   = Primitive[TVE_INDEX];
-//  Tve_o = Primitive[TVE_INDEX];
-  Tve   = V[T_INDEX];
-  Tve_o = V[T_INDEX];
+  // Initialize trial values of Tve for Newton-Raphson method. The value from
+  // the previous iteration is usually within the tolerance of the new root,
+  // in which case the undamped Newton step converges in one or two iterations.
+  // A poor guess (e.g. after a large solution update) could make the undamped
+  // step overshoot, so the first updates of the warm start are clamped.
+  warmstart = ((Tve_prev > Tvemin) && (Tve_prev < Tvemax));
+  if (warmstart) { Tve = Tve_prev;   relax = 1.0; }
+  else           { Tve = V[T_INDEX]; relax = 0.5; }
+  Tve_o = Tve;
+  nClamp   = 3;
+  maxDTve  = 0.2;
 
   // Newton-Raphson
   if (!nonphys) {
     nrconvg = false;
     for (iIter = 0; iIter < maxNIter; iIter++) {
-      rhoEve_t     = 0.0;
-      rhoCvve      = 0.0;
       V[TVE_INDEX] = Tve;
-      for (iSpecies = 0; iSpecies < nSpecies; iSpecies++) {
-        rhoEve_t += U[iSpecies] * CalcEve(V, config, iSpecies);
-        rhoCvve  += U[iSpecies] * CalcCvve(Tve, config, iSpecies);
-      }
+      CalcRhoEveCvve(U, Tve, config, rhoEve_t, rhoCvve);
       
       // Find the root
       f  = rhoEve - rhoEve_t;
       df = -rhoCvve;
-      Tve2 = Tve - (f/df)*0.5;
+      Tve2 = Tve - (f/df)*relax;
       
-      // Check for non-physical conditions
+      // Limit the first warm-started updates to a fraction of Tve
+      if (warmstart && (iIter < nClamp)) {
+        if (Tve2 > Tve*(1.0+maxDTve)) Tve2 = Tve*(1.0+maxDTve);
+        if (Tve2 < Tve*(1.0-maxDTve)) Tve2 = Tve*(1.0-maxDTve);
+      }
+      
+      // Check for non-physical conditions (a diverged warm start falls back
+      // on the bisection below)
       if ((Tve2 != Tve2) || (Tve2 < 0)) {
-        nonphys = true;
+        if (!warmstart) nonphys = true;
         break;
       }
       // Check for convergence
@@ -1322,9 +1404,7 @@ bool CTNE2EulerVariable::Cons2PrimVar(CConfig *config, double *U, double *V,
       for (iIter = 0; iIter < maxBIter; iIter++) {
         Tve = (Tve_o+Tve2)/2.0;
         V[TVE_INDEX] = Tve;
-        rhoEve_t = 0.0;
-        for (iSpecies = 0; iSpecies < nSpecies; iSpecies++)
-          rhoEve_t += U[iSpecies] * CalcEve(V, config, iSpecies);
+        CalcRhoEveCvve(U, Tve, config, rhoEve_t, rhoCvve);
         
         if (fabs(rhoEve_t - rhoEve) < tol) {
           V[TVE_INDEX] = Tve;
@@ -1337,9 +1417,8 @@ bool CTNE2EulerVariable::Cons2PrimVar(CConfig *config, double *U, double *V,
     }
   }
 
-  V[RHOCVVE_INDEX] = 0.0;
-  for (iSpecies = 0; iSpecies < nSpecies; iSpecies++)
-    V[RHOCVVE_INDEX] += U[iSpecies]*CalcCvve(V[TVE_INDEX], config, iSpecies);
+  CalcRhoEveCvve(U, V[TVE_INDEX], config, rhoEve_t, rhoCvve);
+  V[RHOCVVE_INDEX] = rhoCvve;
   
   /*--- Pressure ---*/
   V[P_INDEX] = 0.0;
@@ -59,6 +59,12 @@ int main(int argc, char *argv[]) {
     config[ZONE_0] = new CConfig(mesh_file, SU2_DEF, ZONE_0, nZone, 0, VERB_HIGH);
   }
   
+  /*--- Start the wall-clock profiler (if requested), the setup includes the
+   reading and preprocessing of the grid ---*/
+  
+  CProfiler::SetActive(config[ZONE_0]->GetProfiling());
+  CProfiler::Start(PROFILE_SETUP);
+  
 #ifdef HAVE_MPI
   
   /*--- Change the name of the input-output files for the parallel computation ---*/
@@ -75,10 +81,8 @@ int main(int argc, char *argv[]) {
   
 #ifdef HAVE_MPI
   MPI_Barrier(MPI_COMM_WORLD);
-  StartTime = MPI_Wtime();
-#else
-  StartTime = double(clock())/double(CLOCKS_PER_SEC);
 #endif
+  StartTime = CProfiler::GetTime();
   
   /*--- Computational grid preprocesing ---*/
   
@@ -127,6 +131,8 @@ int main(int argc, char *argv[]) {
     
   }
   
+  CProfiler::Stop(PROFILE_SETUP);
+  
   /*--- Surface grid deformation using design variables ---*/
   
   if (rank == MASTER_NODE) cout << endl << "------------------------- Surface grid deformation ----------------------" << endl;
@@ -166,6 +172,8 @@ int main(int argc, char *argv[]) {
   
   if (rank == MASTER_NODE) cout << endl << "----------------------- Write deformed grid files -----------------------" << endl;
   
+  CProfiler::Start(PROFILE_OUTPUT);
+  
   /*--- Output deformed grid for visualization, if requested (surface and volumetric) ---*/
   
   if (config[ZONE_0]->GetVisualize_Deformation()) {
@@ -204,15 +212,15 @@ int main(int argc, char *argv[]) {
 
   surface_movement->WriteFFDInfo(geometry[ZONE_0], config[ZONE_0], out_file);
   
+  CProfiler::Stop(PROFILE_OUTPUT);
+  
   /*--- Synchronization point after a single solver iteration. Compute the
    wall clock time required. ---*/
   
 #ifdef HAVE_MPI
   MPI_Barrier(MPI_COMM_WORLD);
-  StopTime = MPI_Wtime();
-#else
-  StopTime = double(clock())/double(CLOCKS_PER_SEC);
 #endif
+  StopTime = CProfiler::GetTime();
   
   /*--- Compute/print the total time for performance benchmarking. ---*/
   
@@ -222,6 +230,10 @@ int main(int argc, char *argv[]) {
     if (size == 1) cout << " core." << endl; else cout << " cores." << endl;
   }
   
+  /*--- Min/max/mean time of the phases over all the ranks ---*/
+  
+  CProfiler::WriteReport(config[ZONE_0]->GetProfiling_FileName());
+  
   /*--- Exit the solver cleanly ---*/
   
   if (rank == MASTER_NODE)
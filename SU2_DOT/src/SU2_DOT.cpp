@@ -25,13 +25,17 @@ using namespace std;
 
 int main(int argc, char *argv[]) {	
   
-	unsigned short iMarker, iDim, iDV, iFFDBox, nZone = 1;
-	unsigned long iVertex, iPoint;
-	double delta_eps, my_Gradient, Gradient, *Normal, dS, *VarCoord, Sensitivity,
-  dalpha[3], deps[3], dalpha_deps;
-	char *cstr;
+	unsigned short iMarker, iDim, iDV, iFFDBox, nZone = 1, nDV, nAnalytic_DV = 0, Jacobian_Format;
+	unsigned long iVertex, iPoint, iSurfacePoints, iJac, nJac, *Jacobian_Index;
+	double delta_eps, *my_Gradient, *Gradient, *Normal, *Coord, dS, *VarCoord,
+  dalpha[3], deps[3], dalpha_deps, *Sensitivity_Point, *Jacobian_Row, AoA;
+	char *cstr, buffer[50];
 	ofstream Gradient_file, Jacobian_file;
-	bool *UpdatePoint, Comma;
+	bool *UpdatePoint, *Analytic_DV, Comma, FFD_Design = false, HicksHenne_Design = false;
+  unsigned short *Sensitivity_Marker;
+  long *Sensitivity_Vertex;
+  vector<unsigned long> *Jacobian_Point;
+  vector<double> *Jacobian_Value;
 	int rank = MASTER_NODE;
 	int size = SINGLE_NODE;
   
@@ -100,9 +104,201 @@ int main(int argc, char *argv[]) {
 	unsigned short nFFDBox = MAX_NUMBER_FFD;
 	FFDBox = new CFreeFormDefBox*[nFFDBox];
 	
+  /*--- Sparse geometric Jacobian, one row (DV) with the derivative of the normal
+   displacement of each owned surface point, and the gradient of each DV ---*/
+  
+  nDV = config->GetnDV();
+  Jacobian_Point = new vector<unsigned long> [nDV];
+  Jacobian_Value = new vector<double> [nDV];
+  my_Gradient = new double [nDV];
+  Gradient = new double [nDV];
+  Analytic_DV = new bool [nDV];
+  Jacobian_Format = config->GetGeoJacobian_FileFormat();
+  
+  /*--- Control point DVs are linear in the control point movement, and their
+   Jacobian can be built from the Bernstein basis of the surface points. Hicks-Henne
+   DVs are linear in the amplitude of the bump. The other DVs use the perturbation ---*/
+  
+  for (iDV = 0; iDV < nDV; iDV++) {
+    switch (config->GetDesign_Variable(iDV)) {
+      case FFD_CONTROL_POINT_2D : case FFD_CAMBER_2D : case FFD_THICKNESS_2D :
+      case FFD_CONTROL_POINT : case FFD_DIHEDRAL_ANGLE : case FFD_TWIST_ANGLE :
+      case FFD_ROTATION : case FFD_CAMBER : case FFD_THICKNESS :
+        FFD_Design = true; break;
+    }
+    Analytic_DV[iDV] = (config->GetGeoJacobian_Analytic() &&
+                        ((config->GetDesign_Variable(iDV) == FFD_CONTROL_POINT_2D) ||
+                         (config->GetDesign_Variable(iDV) == FFD_CONTROL_POINT) ||
+                         (config->GetDesign_Variable(iDV) == HICKS_HENNE)));
+    if (Analytic_DV[iDV] && (config->GetDesign_Variable(iDV) == HICKS_HENNE))
+      HicksHenne_Design = true;
+  }
+  
+  /*--- Surface sensitivity of each point (first vertex of the point, as the
+   geometric Jacobian), and the vertex that gives the normal of the point ---*/
+  
+  Sensitivity_Point = new double [boundary->GetnPoint()];
+  Sensitivity_Marker = new unsigned short [boundary->GetnPoint()];
+  Sensitivity_Vertex = new long [boundary->GetnPoint()];
+  for (iPoint = 0; iPoint < boundary->GetnPoint(); iPoint++) {
+    Sensitivity_Point[iPoint] = 0.0;
+    Sensitivity_Marker[iPoint] = 0;
+    Sensitivity_Vertex[iPoint] = -1;
+    UpdatePoint[iPoint] = true;
+  }
+  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++)
+    if (config->GetMarker_All_DV(iMarker) == YES)
+      for (iVertex = 0; iVertex < boundary->nVertex[iMarker]; iVertex++) {
+        iPoint = boundary->vertex[iMarker][iVertex]->GetNode();
+        if (UpdatePoint[iPoint]) {
+          Sensitivity_Point[iPoint] = boundary->vertex[iMarker][iVertex]->GetAuxVar();
+          Sensitivity_Marker[iPoint] = iMarker;
+          Sensitivity_Vertex[iPoint] = iVertex;
+          UpdatePoint[iPoint] = false;
+        }
+      }
+  
+  /*--- Read the FFD information from the grid file ---*/
+  
+  if (FFD_Design) {
+    
+    if (rank == MASTER_NODE)
+      cout << "Read the FFD information from mesh file." << endl;
+    
+    surface_mov->ReadFFDInfo(boundary, config, FFDBox, config->GetMesh_FileName(), true);
+    
+    /*--- If the FFDBox was not defined in the input file ---*/
+    if (!surface_mov->GetFFDBoxDefinition() && (rank == MASTER_NODE)) {
+      cout << "The input grid doesn't have the entire FFD information!" << endl;
+      cout << "Press any key to exit..." << endl;
+      cin.get();
+    }
+    
+    /*--- The control points of a child box move with its parent boxes, which is
+     not in the derivative of a single box: the DVs of nested boxes use the perturbation ---*/
+    
+    for (iDV = 0; iDV < nDV; iDV++) {
+      if (!Analytic_DV[iDV] || (config->GetDesign_Variable(iDV) == HICKS_HENNE)) continue;
+      for (iFFDBox = 0; iFFDBox < surface_mov->GetnFFDBox(); iFFDBox++)
+        if ((config->GetFFDTag(iDV).compare(FFDBox[iFFDBox]->GetTag()) == 0) &&
+            ((FFDBox[iFFDBox]->GetnParentFFDBox() != 0) || (FFDBox[iFFDBox]->GetnChildFFDBox() != 0)))
+          Analytic_DV[iDV] = false;
+    }
+    
+    if (rank == MASTER_NODE)
+      cout <<"-------------------------------------------------------------------------" << endl;
+    
+  }
+  
+  /*--- Design variables without an analytic Jacobian ---*/
+  
+  for (iDV = 0; iDV < nDV; iDV++) {
+    if (Analytic_DV[iDV]) nAnalytic_DV++;
+    else if (config->GetGeoJacobian_Analytic() && (rank == MASTER_NODE))
+      cout << "Design variable number " << iDV << " has no analytic Jacobian, the surface is perturbed." << endl;
+  }
+  
 	if (rank == MASTER_NODE) 
 		cout << endl <<"---------- Start gradient evaluation using surface sensitivity ----------" << endl;
 	
+  /*--- Analytic Jacobian of all the control point DVs in a single pass over the
+   surface points of each box (no deformation of the surface is required) ---*/
+  
+  if ((nAnalytic_DV > 0) && FFD_Design) {
+    
+    if (rank == MASTER_NODE)
+      cout << "Compute the analytic surface Jacobian of the FFD control point design variables." << endl;
+    
+    for (iFFDBox = 0; iFFDBox < surface_mov->GetnFFDBox(); iFFDBox++) {
+      
+      for (iPoint = 0; iPoint < boundary->GetnPoint(); iPoint++)
+        UpdatePoint[iPoint] = true;
+      
+      for (iSurfacePoints = 0; iSurfacePoints < FFDBox[iFFDBox]->GetnSurfacePoint(); iSurfacePoints++) {
+        
+        iPoint = FFDBox[iFFDBox]->Get_PointIndex(iSurfacePoints);
+        
+        if ((Sensitivity_Vertex[iPoint] != -1) &&
+            (iPoint < boundary->GetnPointDomain()) && UpdatePoint[iPoint]) {
+          
+          /*--- Normal of the vertex of the surface sensitivity (and of the
+           perturbation path), the box may list another vertex of the point ---*/
+          
+          Normal = boundary->vertex[Sensitivity_Marker[iPoint]][Sensitivity_Vertex[iPoint]]->GetNormal();
+          
+          dS = 0.0;
+          for (iDim = 0; iDim < boundary->GetnDim(); iDim++)
+            dS += Normal[iDim]*Normal[iDim];
+          dS = sqrt(dS);
+          
+          for (iDim = 0; iDim < boundary->GetnDim(); iDim++)
+            dalpha[iDim] = Normal[iDim] / dS;
+          
+          for (iDV = 0; iDV < nDV; iDV++) {
+            if (!Analytic_DV[iDV] || (config->GetDesign_Variable(iDV) == HICKS_HENNE)) continue;
+            if (!surface_mov->GetFFDCPDerivative(config, FFDBox[iFFDBox], iDV, iSurfacePoints, deps)) continue;
+            
+            dalpha_deps = 0.0;
+            for (iDim = 0; iDim < boundary->GetnDim(); iDim++)
+              dalpha_deps -= dalpha[iDim]*deps[iDim];
+            
+            if (dalpha_deps != 0.0) {
+              Jacobian_Point[iDV].push_back(iPoint);
+              Jacobian_Value[iDV].push_back(dalpha_deps);
+            }
+          }
+          
+          UpdatePoint[iPoint] = false;
+        }
+        
+      }
+    }
+    
+  }
+  
+  /*--- Analytic Jacobian of all the Hicks-Henne DVs in a single pass over the
+   surface points, with the same vertex (coordinates and normal) as the perturbation ---*/
+  
+  if (HicksHenne_Design) {
+    
+    if (rank == MASTER_NODE)
+      cout << "Compute the analytic surface Jacobian of the Hicks-Henne design variables." << endl;
+    
+    AoA = surface_mov->GetAirfoil_AoA(boundary, config);
+    
+    for (iPoint = 0; iPoint < boundary->GetnPointDomain(); iPoint++) {
+      
+      if (Sensitivity_Vertex[iPoint] == -1) continue;
+      
+      Coord = boundary->vertex[Sensitivity_Marker[iPoint]][Sensitivity_Vertex[iPoint]]->GetCoord();
+      Normal = boundary->vertex[Sensitivity_Marker[iPoint]][Sensitivity_Vertex[iPoint]]->GetNormal();
+      
+      dS = 0.0;
+      for (iDim = 0; iDim < boundary->GetnDim(); iDim++)
+        dS += Normal[iDim]*Normal[iDim];
+      dS = sqrt(dS);
+      
+      for (iDim = 0; iDim < boundary->GetnDim(); iDim++)
+        dalpha[iDim] = Normal[iDim] / dS;
+      
+      for (iDV = 0; iDV < nDV; iDV++) {
+        if (!Analytic_DV[iDV] || (config->GetDesign_Variable(iDV) != HICKS_HENNE)) continue;
+        if (!surface_mov->GetHicksHenneDerivative(config, iDV, AoA, Coord, Normal, deps)) continue;
+        
+        dalpha_deps = 0.0;
+        for (iDim = 0; iDim < boundary->GetnDim(); iDim++)
+          dalpha_deps -= dalpha[iDim]*deps[iDim];
+        
+        if (dalpha_deps != 0.0) {
+          Jacobian_Point[iDV].push_back(iPoint);
+          Jacobian_Value[iDV].push_back(dalpha_deps);
+        }
+      }
+      
+    }
+    
+  }
+  
 	/*--- Write the gradient in a external file ---*/
 	if (rank == MASTER_NODE) {
 		cstr = new char [config->GetObjFunc_Grad_FileName().size()+1];
@@ -110,8 +306,8 @@ int main(int argc, char *argv[]) {
 		Gradient_file.open(cstr, ios::out);
     
     /*--- Write an additional file with the geometric Jacobian ---*/
-    /*--- WARNING: This is only for serial calculations!!! ---*/
-    if (size == SINGLE_NODE) {
+    /*--- WARNING: The CSV file is only for serial calculations!!! ---*/
+    if ((size == SINGLE_NODE) && (Jacobian_Format == GEO_JACOBIAN_CSV)) {
       Jacobian_file.open("geo_jacobian.csv", ios::out);
       Jacobian_file.precision(15);
       
@@ -130,9 +326,11 @@ int main(int argc, char *argv[]) {
     }
 	}
   
-	for (iDV = 0; iDV < config->GetnDV(); iDV++) {
+	for (iDV = 0; iDV < nDV; iDV++) {
 				
-    if (size == SINGLE_NODE) { Jacobian_file << iDV; }
+    /*--- The analytic DVs are already in the geometric Jacobian ---*/
+    
+    if (Analytic_DV[iDV]) continue;
     
     /*--- Free Form deformation based ---*/
     
@@ -146,29 +344,6 @@ int main(int argc, char *argv[]) {
         (config->GetDesign_Variable(iDV) == FFD_CAMBER) ||
         (config->GetDesign_Variable(iDV) == FFD_THICKNESS) ) {
       
-      /*--- Read the FFD information in the first iteration ---*/
-      
-      if (iDV == 0) {
-        
-        if (rank == MASTER_NODE)
-          cout << "Read the FFD information from mesh file." << endl;
-        
-        /*--- Read the FFD information from the grid file ---*/
-        
-        surface_mov->ReadFFDInfo(boundary, config, FFDBox, config->GetMesh_FileName(), true);
-        
-        /*--- If the FFDBox was not defined in the input file ---*/
-        if (!surface_mov->GetFFDBoxDefinition() && (rank == MASTER_NODE)) {
-          cout << "The input grid doesn't have the entire FFD information!" << endl;
-          cout << "Press any key to exit..." << endl;
-          cin.get();
-        }
-        
-        if (rank == MASTER_NODE)
-          cout <<"-------------------------------------------------------------------------" << endl;
-        
-      }
-      
       if (rank == MASTER_NODE) {
         cout << endl << "Design variable number "<< iDV <<"." << endl;
         cout << "Perform 3D deformation of the surface." << endl;
@@ -284,14 +459,9 @@ int main(int argc, char *argv[]) {
     else { cout << "Design Variable not implement yet" << endl; }
 
 
-		/*--- Continuous adjoint gradient computation ---*/
-		if (rank == MASTER_NODE)
-			cout << "Evaluate functional gradient using the continuous adjoint strategy." << endl;
-		
     /*--- Load the delta change in the design variable (finite difference step). ---*/
     
 		delta_eps = config->GetDV_Value(iDV);
-    my_Gradient = 0.0; Gradient = 0.0;
       
       /*--- Reset update points ---*/
     
@@ -307,7 +477,6 @@ int main(int argc, char *argv[]) {
 							
 							Normal = boundary->vertex[iMarker][iVertex]->GetNormal();
 							VarCoord = boundary->vertex[iMarker][iVertex]->GetVarCoord();
-							Sensitivity = boundary->vertex[iMarker][iVertex]->GetAuxVar();
               
 							dS = 0.0; 
 							for (iDim = 0; iDim < boundary->GetnDim(); iDim++) {
@@ -324,105 +493,192 @@ int main(int argc, char *argv[]) {
 							
               /*--- Store the geometric sensitivity for this DV (rows) & this node (column) ---*/
               
-              if (size == SINGLE_NODE) {
-                Jacobian_file  << ", " << dalpha_deps;
+              if (dalpha_deps != 0.0) {
+                Jacobian_Point[iDV].push_back(iPoint);
+                Jacobian_Value[iDV].push_back(dalpha_deps);
               }
               
-							my_Gradient += Sensitivity*dalpha_deps;
 							UpdatePoint[iPoint] = false;
 						}
 					}
 				}				
     }
     
+	}
+	
+  /*--- Continuous adjoint gradient computation, a single sparse product of the
+   geometric Jacobian with the surface sensitivity (owned points only) ---*/
+  
+	if (rank == MASTER_NODE)
+		cout << endl << "Evaluate functional gradient using the continuous adjoint strategy." << endl;
+  
+  for (iDV = 0; iDV < nDV; iDV++) {
+    my_Gradient[iDV] = 0.0; Gradient[iDV] = 0.0;
+    nJac = Jacobian_Point[iDV].size();
+    for (iJac = 0; iJac < nJac; iJac++)
+      my_Gradient[iDV] += Sensitivity_Point[Jacobian_Point[iDV][iJac]]*Jacobian_Value[iDV][iJac];
+  }
+  
 #ifdef HAVE_MPI
-		MPI_Allreduce(&my_Gradient, &Gradient, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+	MPI_Allreduce(my_Gradient, Gradient, nDV, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
 #else
-		Gradient = my_Gradient;
+	for (iDV = 0; iDV < nDV; iDV++) Gradient[iDV] = my_Gradient[iDV];
 #endif
-		
-		if (rank == MASTER_NODE) {
+	
+	if (rank == MASTER_NODE) {
+		for (iDV = 0; iDV < nDV; iDV++) {
 			switch (config->GetKind_ObjFunc()) {
 				case LIFT_COEFFICIENT : 
 					if (iDV == 0) Gradient_file << "Lift coeff. grad. using cont. adj." << endl;
-					cout << "Lift coefficient gradient: "<< Gradient << "." << endl; break;
+					cout << "Lift coefficient gradient: "<< Gradient[iDV] << "." << endl; break;
 				case DRAG_COEFFICIENT : 
 					if (iDV == 0) Gradient_file << "Drag coeff. grad. using cont. adj." << endl;
-					cout << "Drag coefficient gradient: "<< Gradient << "." << endl; break;
+					cout << "Drag coefficient gradient: "<< Gradient[iDV] << "." << endl; break;
 				case SIDEFORCE_COEFFICIENT :
 					if (iDV == 0) Gradient_file << "Sideforce coeff. grad. using cont. adj." << endl;
-					cout << "Sideforce coefficient gradient: "<< Gradient << "." << endl; break;
+					cout << "Sideforce coefficient gradient: "<< Gradient[iDV] << "." << endl; break;
         case INVERSE_DESIGN_PRESSURE :
 					if (iDV == 0) Gradient_file << "Pressure inverse design using cont. adj."<< endl;
-					cout << "Pressure inverse design gradient: "<< Gradient << "." << endl; break;
+					cout << "Pressure inverse design gradient: "<< Gradient[iDV] << "." << endl; break;
         case INVERSE_DESIGN_HEATFLUX :
 					if (iDV == 0) Gradient_file << "Heat inverse design using cont. adj."<< endl;
-					cout << "Heat flux inverse design gradient: "<< Gradient << "." << endl; break;
+					cout << "Heat flux inverse design gradient: "<< Gradient[iDV] << "." << endl; break;
         case TOTAL_HEATFLUX :
 					if (iDV == 0) Gradient_file << "Integrated surface heat flux. using cont. adj."<< endl;
-					cout << "Total heat flux gradient: "<< Gradient << "." << endl; break;
+					cout << "Total heat flux gradient: "<< Gradient[iDV] << "." << endl; break;
         case MAXIMUM_HEATFLUX :
 					if (iDV == 0) Gradient_file << "Integrated surface heat flux. using cont. adj."<< endl;
-					cout << "Maximum heat flux gradient: "<< Gradient << "." << endl; break;
+					cout << "Maximum heat flux gradient: "<< Gradient[iDV] << "." << endl; break;
 				case MOMENT_X_COEFFICIENT :
 					if (iDV == 0) Gradient_file << "Moment x coeff. grad. using cont. adj." << endl;
-					cout << "Moment x coefficient gradient: "<< Gradient << "." << endl; break;
+					cout << "Moment x coefficient gradient: "<< Gradient[iDV] << "." << endl; break;
 				case MOMENT_Y_COEFFICIENT :
 					if (iDV == 0) Gradient_file << "Moment y coeff. grad. using cont. adj." << endl;
-					cout << "Moment y coefficient gradient: "<< Gradient << "." << endl; break;
+					cout << "Moment y coefficient gradient: "<< Gradient[iDV] << "." << endl; break;
 				case MOMENT_Z_COEFFICIENT :
 					if (iDV == 0) Gradient_file << "Moment z coeff. grad. using cont. adj." << endl;
-					cout << "Moment z coefficient gradient: "<< Gradient << "." << endl; break;
+					cout << "Moment z coefficient gradient: "<< Gradient[iDV] << "." << endl; break;
 				case EFFICIENCY :
 					if (iDV == 0) Gradient_file << "Efficiency coeff. grad. using cont. adj." << endl;
-					cout << "Efficiency coefficient gradient: "<< Gradient << "." << endl; break;
+					cout << "Efficiency coefficient gradient: "<< Gradient[iDV] << "." << endl; break;
 				case EQUIVALENT_AREA :
 					if (iDV == 0) Gradient_file << "Equivalent area coeff. grad. using cont. adj." << endl;
-					cout << "Equivalent Area coefficient gradient: "<< Gradient << "." << endl; break;
+					cout << "Equivalent Area coefficient gradient: "<< Gradient[iDV] << "." << endl; break;
 				case NEARFIELD_PRESSURE :
 					if (iDV == 0) Gradient_file << "Near-field pressure coeff. grad. using cont. adj." << endl;
-					cout << "Near-field pressure coefficient gradient: "<< Gradient << "." << endl; break;
+					cout << "Near-field pressure coefficient gradient: "<< Gradient[iDV] << "." << endl; break;
 				case FORCE_X_COEFFICIENT :
 					if (iDV == 0) Gradient_file << "Force x coeff. grad. using cont. adj." << endl;
-					cout << "Force x coefficient gradient: "<< Gradient << "." << endl; break;
+					cout << "Force x coefficient gradient: "<< Gradient[iDV] << "." << endl; break;
 				case FORCE_Y_COEFFICIENT :
 					if (iDV == 0) Gradient_file << "Force y coeff. grad. using cont. adj." << endl;
-					cout << "Force y coefficient gradient: "<< Gradient << "." << endl; break;
+					cout << "Force y coefficient gradient: "<< Gradient[iDV] << "." << endl; break;
 				case FORCE_Z_COEFFICIENT :
 					if (iDV == 0) Gradient_file << "Force z coeff. grad. using cont. adj." << endl;
-					cout << "Force z coefficient gradient: "<< Gradient << "." << endl; break;
+					cout << "Force z coefficient gradient: "<< Gradient[iDV] << "." << endl; break;
 				case THRUST_COEFFICIENT :
 					if (iDV == 0) Gradient_file << "Thrust coeff. grad. using cont. adj."<< endl;
-					cout << "Thrust coefficient gradient: "<< Gradient << "." << endl; break;
+					cout << "Thrust coefficient gradient: "<< Gradient[iDV] << "." << endl; break;
 				case TORQUE_COEFFICIENT :
 					if (iDV == 0) Gradient_file << "Torque coeff. grad. using cont. adj."<< endl;
-					cout << "Torque coefficient gradient: "<< Gradient << "." << endl; break;
+					cout << "Torque coefficient gradient: "<< Gradient[iDV] << "." << endl; break;
 				case FIGURE_OF_MERIT :
 					if (iDV == 0) Gradient_file << "Rotor Figure of Merit grad. using cont. adj."<< endl;
-					cout << "Rotor Figure of Merit gradient: "<< Gradient << "." << endl; break;
+					cout << "Rotor Figure of Merit gradient: "<< Gradient[iDV] << "." << endl; break;
 				case FREE_SURFACE :
 					if (iDV == 0) Gradient_file << "Free-Surface grad. using cont. adj."<< endl;
-					cout << "Free-surface gradient: "<< Gradient << "." << endl; break;
+					cout << "Free-surface gradient: "<< Gradient[iDV] << "." << endl; break;
 			}
-			
-			Gradient_file << Gradient << endl;
+		
+			Gradient_file << Gradient[iDV] << endl;
 			
 			cout <<"-------------------------------------------------------------------------" << endl;
-			      
+			
+		}
+		Gradient_file.close();
+	}
+  
+  /*--- Dense CSV file with the geometric Jacobian, DV (rows) & node (column) ---*/
+  
+  if ((size == SINGLE_NODE) && (Jacobian_Format == GEO_JACOBIAN_CSV)) {
+    
+    Jacobian_Row = new double [boundary->GetnPoint()];
+    
+    for (iDV = 0; iDV < nDV; iDV++) {
+      
+      Jacobian_file << iDV;
+      
+      for (iPoint = 0; iPoint < boundary->GetnPoint(); iPoint++) {
+        Jacobian_Row[iPoint] = 0.0;
+        UpdatePoint[iPoint] = true;
+      }
+      for (iJac = 0; iJac < Jacobian_Point[iDV].size(); iJac++)
+        Jacobian_Row[Jacobian_Point[iDV][iJac]] = Jacobian_Value[iDV][iJac];
+      
+      for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++)
+        if (config->GetMarker_All_DV(iMarker) == YES)
+          for (iVertex = 0; iVertex < boundary->nVertex[iMarker]; iVertex++) {
+            iPoint = boundary->vertex[iMarker][iVertex]->GetNode();
+            if ((iPoint < boundary->GetnPointDomain()) && UpdatePoint[iPoint]) {
+              Jacobian_file  << ", " << Jacobian_Row[iPoint];
+              UpdatePoint[iPoint] = false;
+            }
+          }
+      
+      /*--- End the line for the current DV in the geometric Jacobian file ---*/
+      
+      Jacobian_file << endl;
+      
     }
-		
-    /*--- End the line for the current DV in the geometric Jacobian file ---*/
     
-    if (size == SINGLE_NODE) Jacobian_file << endl;
-	}
-	
-	if (rank == MASTER_NODE)
-		Gradient_file.close();
+    Jacobian_file.close();
+    delete [] Jacobian_Row;
+    
+  }
+  
+  /*--- Sparse binary file with the geometric Jacobian, one file per domain: the number
+   of DVs, then for each DV the number of nonzeros, the global index of the points,
+   and the values ---*/
   
-  if (size == SINGLE_NODE)
+  if (Jacobian_Format == GEO_JACOBIAN_BINARY) {
+    
+    if (size > 1) sprintf (buffer, "geo_jacobian_%d.dat", int(rank+1));
+    else strcpy (buffer, "geo_jacobian.dat");
+    Jacobian_file.open(buffer, ios::out | ios::binary);
+    
+    Jacobian_Index = new unsigned long [boundary->GetnPoint()];
+    
+    Jacobian_file.write((char *)&nDV, sizeof(unsigned short));
+    for (iDV = 0; iDV < nDV; iDV++) {
+      nJac = Jacobian_Point[iDV].size();
+      for (iJac = 0; iJac < nJac; iJac++) {
+#ifndef HAVE_MPI
+        Jacobian_Index[iJac] = Jacobian_Point[iDV][iJac];
+#else
+        Jacobian_Index[iJac] = boundary->node[Jacobian_Point[iDV][iJac]]->GetGlobalIndex();
+#endif
+      }
+      Jacobian_file.write((char *)&nJac, sizeof(unsigned long));
+      if (nJac > 0) {
+        Jacobian_file.write((char *)Jacobian_Index, nJac*sizeof(unsigned long));
+        Jacobian_file.write((char *)&Jacobian_Value[iDV][0], nJac*sizeof(double));
+      }
+    }
+    
     Jacobian_file.close();
+    delete [] Jacobian_Index;
+    
+  }
 	
 	delete [] UpdatePoint;
+  delete [] Sensitivity_Point;
+  delete [] Sensitivity_Marker;
+  delete [] Sensitivity_Vertex;
+  delete [] Analytic_DV;
+  delete [] my_Gradient;
+  delete [] Gradient;
+  delete [] Jacobian_Point;
+  delete [] Jacobian_Value;
 	
 #ifdef HAVE_MPI
 	/*--- Finalize MPI parallelization ---*/
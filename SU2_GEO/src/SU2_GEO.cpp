@@ -153,10 +153,8 @@ int main(int argc, char *argv[]) {
   /*--- Create airfoil section structure ---*/
   
   if (rank == MASTER_NODE) cout << "Set airfoil section structure." << endl;
-  for (iPlane = 0; iPlane < nPlane; iPlane++) {
-    boundary->ComputeAirfoil_Section(Plane_P0[iPlane], Plane_Normal[iPlane], iPlane, MinXCoord, MaxXCoord, NULL,
-                                     Xcoord_Airfoil[iPlane], Ycoord_Airfoil[iPlane], Zcoord_Airfoil[iPlane], Variable_Airfoil[iPlane], true, config);
-  }
+  boundary->ComputeAirfoil_Sections(nPlane, Plane_P0, Plane_Normal, MinXCoord, MaxXCoord, NULL,
+                                    Xcoord_Airfoil, Ycoord_Airfoil, Zcoord_Airfoil, Variable_Airfoil, true, config);
   
   /*--- Compute the internal volume of a 3D body. ---*/
   
@@ -408,10 +406,8 @@ int main(int argc, char *argv[]) {
       else { cout << "Design Variable not implement yet" << endl; }
       
       /*--- Create airfoil structure ---*/
-      for (iPlane = 0; iPlane < nPlane; iPlane++) {
-        boundary->ComputeAirfoil_Section(Plane_P0[iPlane], Plane_Normal[iPlane], iPlane, MinXCoord, MaxXCoord, NULL,
-                                         Xcoord_Airfoil[iPlane], Ycoord_Airfoil[iPlane], Zcoord_Airfoil[iPlane], Variable_Airfoil[iPlane], false, config);
-      }
+      boundary->ComputeAirfoil_Sections(nPlane, Plane_P0, Plane_Normal, MinXCoord, MaxXCoord, NULL,
+                                        Xcoord_Airfoil, Ycoord_Airfoil, Zcoord_Airfoil, Variable_Airfoil, false, config);
       
       /*--- Compute the gradient for the volume. In 2D this is just
        the gradient of the area. ---*/
@@ -50,6 +50,12 @@ int main(int argc, char *argv[]) {
 	if (argc == 2) { config = new CConfig(argv[1], SU2_PRT, ZONE_0, nZone, 0, VERB_HIGH); }
 	else { strcpy (file_name, "default.cfg"); config = new CConfig(file_name, SU2_PRT, ZONE_0, nZone, 0, VERB_HIGH); }
   
+  /*--- Start the wall-clock profiler (if requested), the setup includes the
+   reading and the partitioning of the grid ---*/
+  
+  CProfiler::SetActive(config->GetProfiling());
+  CProfiler::Start(PROFILE_SETUP);
+  
   if (rank == MASTER_NODE) {
     
     /*--- Definition of the Class for the geometry ---*/
@@ -57,12 +63,10 @@ int main(int argc, char *argv[]) {
     
   }
   
-#ifndef HAVE_MPI
-  StartTime = double(clock())/double(CLOCKS_PER_SEC);
-#else
+#ifdef HAVE_MPI
   MPI_Barrier(MPI_COMM_WORLD);
-  StartTime = MPI_Wtime();
 #endif
+  StartTime = CProfiler::GetTime();
   
 	/*--- Set domains for parallel computation (if any) ---*/
 	if (size > 1) {
@@ -95,6 +99,9 @@ int main(int argc, char *argv[]) {
     /*--- Setting the right order for the MPI boundaries ---*/
     domain->SetBoundaries(config);
 
+    CProfiler::Stop(PROFILE_SETUP);
+    CProfiler::Start(PROFILE_OUTPUT);
+    
 #ifdef HAVE_MPI
   MPI_Barrier(MPI_COMM_WORLD);
 #endif
@@ -145,17 +152,19 @@ int main(int argc, char *argv[]) {
     surface_mov->ReadFFDInfo(domain, config, FFDBox, config->GetMesh_FileName(), false);
     surface_mov->WriteFFDInfo(domain, config, FFDBox, cstr_su2);
     
+    CProfiler::Stop(PROFILE_OUTPUT);
+    
   }
   
+  CProfiler::Stop(PROFILE_SETUP);
+  
   /*--- Synchronization point after a single solver iteration. Compute the
    wall clock time required. ---*/
   
-#ifndef HAVE_MPI
-  StopTime = double(clock())/double(CLOCKS_PER_SEC);
-#else
+#ifdef HAVE_MPI
   MPI_Barrier(MPI_COMM_WORLD);
-  StopTime = MPI_Wtime();
 #endif
+  StopTime = CProfiler::GetTime();
   
   /*--- Compute/print the total time for performance benchmarking. ---*/
   
@@ -165,6 +174,10 @@ int main(int argc, char *argv[]) {
     if (size == 1) cout << " core." << endl; else cout << " cores." << endl;
   }
   
+  /*--- Min/max/mean time of the phases over all the ranks ---*/
+  
+  CProfiler::WriteReport(config->GetProfiling_FileName());
+  
   
 	/*--- End solver ---*/
   
@@ -388,9 +388,12 @@ def findiff( config, state=None, step=1e-4 ):
             Updates config and state by reference.
             Gradient Redundancy if state.GRADIENTS has the key func_name.
             Direct Redundancy if state.FUNCTIONS has key func_name.
+            The steps run concurrently in config.FINDIFF_GROUPS groups,
+            which split config.NUMBER_PART. A decomposed mesh runs
+            the steps sequentially.
     
         Executes in:
-            ./FINDIFF
+            ./FINDIFF, or ./FINDIFF/STEP_* for concurrent groups
             
         Inputs:
             config - an SU2 config
@@ -499,49 +502,97 @@ def findiff( config, state=None, step=1e-4 ):
     if 'INV_DESIGN_HEATFLUX' in special_cases and 'TARGET_HEATFLUX' in files:
       pull.append(files['TARGET_HEATFLUX'])
 
+    # concurrent groups, the ranks are split among them
+    n_groups = min( konfig.get('FINDIFF_GROUPS',1) , n_dv )
+    if konfig.get('LIBRARY','NO') == 'YES':
+        n_groups = 1 # resident drivers are not shared among processes
+    if konfig.get('DECOMPOSED',False):
+        n_groups = 1 # the partitions fix the rank count of every step
+    if n_groups > 1:
+        n_part = konfig['NUMBER_PART']
+        if n_part > 1:
+            n_groups = min( n_groups , n_part ) # at least one rank per group
+            konfig['NUMBER_PART'] = n_part / n_groups
+    
     # output redirection
     with redirect_folder('FINDIFF',pull,link) as push:
         with redirect_output(log_findiff):
             
-            # iterate each dv    
-            for i_dv in range(n_dv):
+            # concurrent steps, each one in its own folder
+            if n_groups > 1:
                 
-                this_step = step[i_dv]
-                temp_config_name = 'config_FINDIFF_%i.cfg' % i_dv 
+                steps = []
+                for i_dv in range(n_dv):
+                    this_dvs = copy.deepcopy(dvs_base)
+                    this_dvs[i_dv] = this_dvs[i_dv] + step[i_dv]
+                    steps.append([ i_dv, this_dvs, dvs_base, konfig, state.FILES, pull+link ])
                 
-                this_dvs    = copy.deepcopy(dvs_base)
-                this_konfig = copy.deepcopy(konfig)
-                this_dvs[i_dv] = this_dvs[i_dv] + this_step
+                evaluate   = su2util.mp_eval(findiff_step,n_groups)
+                func_steps = evaluate(steps)
+                del evaluate
                 
-                this_state = su2io.State()
-                this_state.FILES = copy.deepcopy( state.FILES )
-                this_konfig.unpack_dvs(this_dvs,dvs_base)
+                for i_dv in range(n_dv):
+                    if isinstance(func_steps[i_dv],Exception):
+                        raise func_steps[i_dv]
+                    
+                    # calc finite difference and store
+                    this_step = step[i_dv]
+                    func_step = func_steps[i_dv]
+                    for key in grads.keys():
+                        if key == 'VARIABLE': 
+                            grads[key].append(i_dv)
+                        elif key == 'FINDIFF_STEP': 
+                            grads[key].append(this_step)
+                        else:
+                            this_grad = ( func_step[key] - func_base[key] ) / this_step
+                            grads[key].append(this_grad)
+                    #: for each grad name
+                
+                su2util.write_plot(grad_filename,output_format,grads)
                 
-                this_konfig.dump(temp_config_name)
+            # sequential steps
+            else:
                 
-                # Direct Solution, findiff step
-                func_step = function( 'ALL', this_konfig, this_state )
+                # iterate each dv    
+                for i_dv in range(n_dv):
                 
-                # remove deform step files
-                meshfiles = this_state.FILES.MESH
-                meshfiles = su2io.expand_part(meshfiles,this_konfig)
-                for name in meshfiles: os.remove(name)
+                    this_step = step[i_dv]
+                    temp_config_name = 'config_FINDIFF_%i.cfg' % i_dv 
                 
-                # calc finite difference and store
-                for key in grads.keys():
-                    if key == 'VARIABLE': 
-                        grads[key].append(i_dv)
-                    elif key == 'FINDIFF_STEP': 
-                        grads[key].append(this_step)
-                    else:
-                        this_grad = ( func_step[key] - func_base[key] ) / this_step
-                        grads[key].append(this_grad)
-                #: for each grad name
+                    this_dvs    = copy.deepcopy(dvs_base)
+                    this_konfig = copy.deepcopy(konfig)
+                    this_dvs[i_dv] = this_dvs[i_dv] + this_step
                 
-                su2util.write_plot(grad_filename,output_format,grads)
-                os.remove(temp_config_name)
+                    this_state = su2io.State()
+                    this_state.FILES = copy.deepcopy( state.FILES )
+                    this_konfig.unpack_dvs(this_dvs,dvs_base)
+                
+                    this_konfig.dump(temp_config_name)
+                
+                    # Direct Solution, findiff step
+                    func_step = function( 'ALL', this_konfig, this_state )
+                
+                    # remove deform step files
+                    meshfiles = this_state.FILES.MESH
+                    meshfiles = su2io.expand_part(meshfiles,this_konfig)
+                    for name in meshfiles: os.remove(name)
+                
+                    # calc finite difference and store
+                    for key in grads.keys():
+                        if key == 'VARIABLE': 
+                            grads[key].append(i_dv)
+                        elif key == 'FINDIFF_STEP': 
+                            grads[key].append(this_step)
+                        else:
+                            this_grad = ( func_step[key] - func_base[key] ) / this_step
+                            grads[key].append(this_grad)
+                    #: for each grad name
+                
+                    su2util.write_plot(grad_filename,output_format,grads)
+                    os.remove(temp_config_name)
             
-            #: for each dv
+                #: for each dv
+            #: if concurrent
             
     #: with output redirection
     
@@ -556,6 +607,56 @@ def findiff( config, state=None, step=1e-4 ):
 
 #: def findiff()
 
+def findiff_step( i_dv, this_dvs, dvs_base, konfig, files, link ):
+    """ func_step = SU2.eval.gradients.findiff_step(i_dv,this_dvs,dvs_base,konfig,files,link)
+    
+        Evaluates the functions of one finite difference step
+        for the concurrent groups of findiff()
+        
+        Assumptions:
+            Files (mesh, direct solution, targets) are in ./
+            Restarts from the baseline direct solution if there is one
+            The folder is removed after a successful step.
+            
+        Executes in:
+            ./STEP_<i_dv>, with i_dv zero-padded to three digits (STEP_007)
+            
+        Outputs:
+            Bunch() of functions, or the exception of a failed step
+    """
+    
+    folder = 'STEP_%03i' % i_dv
+    link   = [ os.path.split(name)[-1] for name in link ]
+    
+    try:
+        with redirect_folder(folder,[],link,force=True):
+            with redirect_output('log_FinDiff.out'):
+                
+                this_konfig = copy.deepcopy(konfig)
+                this_konfig.unpack_dvs(this_dvs,dvs_base)
+                
+                # warm start from the baseline solution
+                if files.has_key('DIRECT'):
+                    this_konfig['RESTART_SOL'] = 'YES'
+                
+                this_konfig.dump('config_FINDIFF_%i.cfg' % i_dv)
+                
+                this_state = su2io.State()
+                this_state.FILES = copy.deepcopy(files)
+                
+                # Direct Solution, findiff step
+                func_step = function( 'ALL', this_konfig, this_state )
+                
+    # the folder of a failed step is kept with its log
+    except (Exception,SystemExit), err:
+        return Exception( 'finite difference step %i failed in %s: %s' % (i_dv,folder,err) )
+    
+    shutil.rmtree(folder)
+    
+    return func_step
+
+#: def findiff_step()
+
 
 # ----------------------------------------------------------------------
 #  Geometric Gradients
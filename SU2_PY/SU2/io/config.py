@@ -363,6 +363,7 @@ def read_config(filename):
             if case("TIME_INSTANCES")         : pass
             if case("UNST_ADJOINT_ITER")      : pass
             if case("ITER_AVERAGE_OBJ")       : pass
+            if case("FINDIFF_GROUPS")         : pass
             if case("ADAPT_CYCLES")           :
                 data_dict[this_param] = int(this_value)
                 break                
@@ -638,6 +639,7 @@ def write_config(filename,param_dict):
             if case("TIME_INSTANCES")         : pass
             if case("AVAILABLE_PROC")         : pass
             if case("UNST_ADJOINT_ITER")      : pass
+            if case("FINDIFF_GROUPS")         : pass
             if case("EXT_ITER")               :
                 output_file.write("%i" % new_value)
                 break
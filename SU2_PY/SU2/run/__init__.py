@@ -10,6 +10,10 @@ from interface import  \
     DOT               ,\
     SOL               ;
 
+from library import  \
+    Driver            ,\
+    get_driver        ;
+
 from decompose  import decompose
 from direct     import direct
 from adjoint    import adjoint
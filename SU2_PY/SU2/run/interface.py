@@ -27,6 +27,7 @@ import os, sys, shutil, copy
 import subprocess
 from ..io import Config
 from ..util import which
+import library
 
 # ------------------------------------------------------------
 #  Setup
@@ -79,10 +80,15 @@ def PRT(config):
 def CFD(config):
     """ run SU2_CFD
         partitions set by config.NUMBER_PART
+        in the resident driver of libSU2_CFD.so if config.LIBRARY
     """
     
     konfig = copy.deepcopy(config)
     
+    if konfig.get('LIBRARY','NO') == 'YES':
+        library.CFD(konfig)
+        return
+    
     tempname = 'config_CFD.cfg'
     konfig.dump(tempname)
     
@@ -122,9 +128,14 @@ def DEF(config):
     """ run SU2_DEF
         partitions set by config.NUMBER_PART
         forced to run in serial, expects merged mesh input
+        in the resident drivers of libSU2_CFD.so if config.LIBRARY
     """
     konfig = copy.deepcopy(config)
     
+    if konfig.get('LIBRARY','NO') == 'YES':
+        library.DEF(konfig)
+        return
+    
     tempname = 'config_DEF.cfg'
     konfig.dump(tempname) 
     
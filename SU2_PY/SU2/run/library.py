@@ -0,0 +1,201 @@
+## \file library.py
+#  \brief python binding of the SU2_CFD driver library (libSU2_CFD.so)
+#  \author Aerospace Design Laboratory (Stanford University) <http://su2.stanford.edu>.
+#  \version 3.2.3 "eagle"
+#
+# Stanford University Unstructured (SU2) Code
+# Copyright (C) 2012 Aerospace Design Laboratory
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+# ----------------------------------------------------------------------
+#  Imports
+# ----------------------------------------------------------------------
+
+import os, copy, ctypes, atexit
+
+# ------------------------------------------------------------
+#  Setup
+# ------------------------------------------------------------
+
+# the library is built with "make libSU2_CFD.so" in SU2_CFD/obj (configure
+# with CFLAGS and CXXFLAGS="-O2 -fPIC" for the static tecio and metis),
+# on several ranks python itself is started with mpirun -n NUMBER_PART
+# and the grid is decomposed first (DECOMPOSED= TRUE), each rank keeps
+# its partition and writes its part of the deformed mesh, as SU2_DEF
+_library = None
+
+def load_library():
+    """ lib = load_library()
+        loads libSU2_CFD.so (SU2_LIB, or SU2_RUN/libSU2_CFD.so)
+        and initializes MPI, only once, MPI is finalized at exit
+    """
+    global _library
+    if _library is None:
+        if os.environ.has_key('SU2_LIB'):
+            lib_name = os.environ['SU2_LIB']
+        else:
+            lib_name = os.path.join(os.environ['SU2_RUN'],'libSU2_CFD.so')
+        lib = ctypes.CDLL(lib_name,mode=ctypes.RTLD_GLOBAL)
+
+        lib.SU2_Initialize.argtypes            = []
+        lib.SU2_Finalize.argtypes              = []
+        lib.SU2_Driver_New.restype             = ctypes.c_void_p
+        lib.SU2_Driver_New.argtypes            = [ctypes.c_char_p]
+        lib.SU2_Driver_Delete.argtypes         = [ctypes.c_void_p]
+        lib.SU2_Driver_Run.argtypes            = [ctypes.c_void_p]
+        lib.SU2_Driver_SetDV_Value.argtypes    = [ctypes.c_void_p,ctypes.c_ushort,ctypes.c_double]
+        lib.SU2_Driver_Deform.argtypes         = [ctypes.c_void_p]
+        lib.SU2_Driver_WriteMesh.argtypes      = [ctypes.c_void_p,ctypes.c_char_p]
+        lib.SU2_Driver_SetFlow_Solution.argtypes = [ctypes.c_void_p,ctypes.c_void_p]
+        lib.SU2_Driver_GetTotal_CLift.restype  = ctypes.c_double
+        lib.SU2_Driver_GetTotal_CLift.argtypes = [ctypes.c_void_p]
+        lib.SU2_Driver_GetTotal_CDrag.restype  = ctypes.c_double
+        lib.SU2_Driver_GetTotal_CDrag.argtypes = [ctypes.c_void_p]
+
+        lib.SU2_Initialize()
+        _library = lib
+        atexit.register(_finalize)
+
+    return _library
+
+def _finalize():
+    """ deletes the resident drivers and finalizes MPI """
+    for driver in _drivers.values():
+        driver.delete()
+    _drivers.clear()
+    _library.SU2_Finalize()
+
+# ----------------------------------------------------------------------
+#  Driver Class
+# ----------------------------------------------------------------------
+
+class Driver(object):
+    """ driver = SU2.run.Driver(filename)
+
+        Resident SU2_CFD problem, the grid, its partition and the
+        solution are read and preprocessed once and kept in memory
+
+        Methods:
+            deform(dv_values) - deforms the grid as it was read
+            write_mesh(filename)
+            run()             - solves from the solution in memory
+            set_flow_solution(driver)
+            lift(), drag()
+            delete()          - releases the problem (also done by the destructor)
+    """
+
+    def __init__(self,filename):
+        self.lib    = load_library()
+        self.handle = self.lib.SU2_Driver_New(filename)
+
+    def __del__(self):
+        self.delete()
+
+    def delete(self):
+        if not self.handle is None:
+            self.lib.SU2_Driver_Delete(self.handle)
+            self.handle = None
+
+    def deform(self,dv_values):
+        for i_dv,value in enumerate(dv_values):
+            self.lib.SU2_Driver_SetDV_Value(self.handle,i_dv,value)
+        self.lib.SU2_Driver_Deform(self.handle)
+
+    def write_mesh(self,filename):
+        self.lib.SU2_Driver_WriteMesh(self.handle,filename)
+
+    def run(self):
+        self.lib.SU2_Driver_Run(self.handle)
+
+    def set_flow_solution(self,driver):
+        self.lib.SU2_Driver_SetFlow_Solution(self.handle,driver.handle)
+
+    def lift(self):
+        return self.lib.SU2_Driver_GetTotal_CLift(self.handle)
+
+    def drag(self):
+        return self.lib.SU2_Driver_GetTotal_CDrag(self.handle)
+
+#: class Driver()
+
+# ----------------------------------------------------------------------
+#  Resident Drivers
+# ----------------------------------------------------------------------
+
+# one driver per problem (direct, and adjoint of each objective), all
+# of them are built from the same (reference) mesh and follow the
+# current design variables
+_drivers   = {}
+_reference = { 'MESH_FILENAME' : None , 'DV_VALUE' : [] }
+
+def get_driver(config):
+    """ driver = get_driver(config)
+        resident driver of the problem of config, it is created
+        (and deformed to the current design) if needed
+    """
+
+    key = config['MATH_PROBLEM']
+    if key != 'DIRECT':
+        key = key + '_' + config['OBJECTIVE_FUNCTION']
+
+    if not _drivers.has_key(key):
+        konfig = copy.deepcopy(config)
+        if _reference['MESH_FILENAME'] is None:
+            _reference['MESH_FILENAME'] = konfig['MESH_FILENAME']
+        konfig['MESH_FILENAME'] = _reference['MESH_FILENAME']
+
+        tempname = 'config_LIB_%s.cfg' % key
+        konfig.dump(tempname)
+
+        driver = Driver(tempname)
+        if _reference['DV_VALUE']:
+            driver.deform(_reference['DV_VALUE'])
+        _drivers[key] = driver
+
+    return _drivers[key]
+
+def CFD(config):
+    """ run SU2_CFD in the resident driver of the problem,
+        the adjoint problems take the flow solution of the direct one
+    """
+    driver = get_driver(config)
+
+    if config['MATH_PROBLEM'] != 'DIRECT':
+        if _drivers.has_key('DIRECT'):
+            driver.set_flow_solution(_drivers['DIRECT'])
+
+    driver.run()
+
+    return
+
+def DEF(config):
+    """ run SU2_DEF in the resident drivers,
+        the design variables are applied to the reference mesh
+        and the deformed mesh is written to MESH_OUT_FILENAME
+    """
+    if not _drivers:
+        konfig = copy.deepcopy(config)
+        konfig['MATH_PROBLEM'] = 'DIRECT'
+        get_driver(konfig)
+
+    dv_values = copy.deepcopy(config['DV_VALUE_NEW'])
+    _reference['DV_VALUE'] = dv_values
+
+    for driver in _drivers.values():
+        driver.deform(dv_values)
+
+    _drivers.values()[0].write_mesh(config['MESH_OUT_FILENAME'])
+
+    return
@@ -61,6 +61,8 @@ def main():
     #level5()    # working
     
     mesh0()
+    library0()
+    batch0()
     
     print 'DONE!'
     
@@ -319,6 +321,167 @@ def mesh0():
         
         SU2.run.MSH(config)
         
+def library0():
+    folder='test_library0'; pull='inv_NACA0012.cfg'; link='mesh_NACA0012_inv.su2'
+    with SU2.io.redirect_folder(folder,pull,link):
+        
+        # Setup, a FFD box around the airfoil
+        ffd_box = [ 'FFD_NBOX= 1', 'FFD_NLEVEL= 1', 'FFD_TAG= 0', 'FFD_LEVEL= 0',
+                    'FFD_DEGREE_I= 4', 'FFD_DEGREE_J= 1', 'FFD_PARENTS= 0', 'FFD_CHILDREN= 0',
+                    'FFD_CORNER_POINTS= 4', '-0.05\t-0.08', '1.05\t-0.08', '1.05\t0.08', '-0.05\t0.08',
+                    'FFD_CONTROL_POINTS= 0', 'FFD_SURFACE_POINTS= 0' ]
+        mesh_file = open('mesh_box.su2','w')
+        mesh_file.write( open('mesh_NACA0012_inv.su2').read() + '\n'.join(ffd_box) + '\n' )
+        mesh_file.close()
+        
+        write_config( 'config_FFD.cfg', OrderedDict([ ('MESH_FILENAME'     , 'mesh_box.su2') ,
+                                                      ('MESH_OUT_FILENAME' , 'mesh_ffd.su2') ,
+                                                      ('DV_KIND'           , 'FFD_SETTING' ) ,
+                                                      ('DV_PARAM'          , '( 0 )'       ) ,
+                                                      ('DV_VALUE'          , '0.0'         ) ]) )
+        SU2.run.run_command( SU2.run.build_command('SU2_DEF config_FFD.cfg') )
+        
+        # Design variables, the control points of both rows move vertically
+        dv_kind  = []; dv_param = []; dv_value = []
+        for j_ind in range(2):
+            for i_ind in range(5):
+                dv_kind.append('FFD_CONTROL_POINT_2D')
+                dv_param.append('( 0, %i, %i, 0.0, 1.0 )' % (i_ind,j_ind))
+                dv_value.append( 0.002*(i_ind+1)*(2*j_ind-1) )
+        dv_options = OrderedDict([ ('MESH_FILENAME' , 'mesh_ffd.su2'     ) ,
+                                   ('DV_KIND'       , ', '.join(dv_kind) ) ,
+                                   ('DV_PARAM'      , '; '.join(dv_param)) ,
+                                   ('DV_VALUE'      , ', '.join([ '%s' % x for x in dv_value ])) ])
+        
+        # Reference, SU2_DEF (the points keep the numbering of the file)
+        options = OrderedDict(dv_options)
+        options['MESH_OUT_FILENAME'] = 'mesh_def.su2'
+        write_config( 'config_DEF.cfg', options )
+        SU2.run.run_command( SU2.run.build_command('SU2_DEF config_DEF.cfg') )
+        
+        # Resident driver, the points are renumbered after reading the grid
+        options = OrderedDict(dv_options)
+        options['CUTHILL_MCKEE_ORDERING'] = 'YES'
+        write_config( 'config_LIB.cfg', options )
+        driver = SU2.run.Driver('config_LIB.cfg')
+        driver.deform( [ 0.5*x for x in dv_value ] )
+        driver.deform( dv_value )
+        driver.write_mesh('mesh_lib.su2')
+        driver.delete()
+        
+        # Same elements, markers and FFD boxes, and the same coordinates
+        compare_meshes( 'mesh_def.su2', 'mesh_lib.su2', 1.e-8 )
+        
+        # Hicks-Henne bumps, the side of each point comes from the vertex normals,
+        # which a rotation of the airfoil changes near the leading edge
+        dv_kind  = [ 'ROTATION', 'HICKS_HENNE', 'HICKS_HENNE' ]
+        dv_param = [ '( 0.25, 0.0, 0.0, 0.25, 0.0, 1.0 )', '( 1, 0.05 )', '( 0, 0.05 )' ]
+        dv_value = [ 0.0, 0.002, -0.0005 ]
+        dv_options = OrderedDict([ ('MESH_FILENAME'     , 'mesh_NACA0012_inv.su2') ,
+                                   ('DV_KIND'           , ', '.join(dv_kind) ) ,
+                                   ('DV_PARAM'          , '; '.join(dv_param)) ,
+                                   ('DV_VALUE'          , ', '.join([ '%s' % x for x in dv_value ])) ,
+                                   ('DEFORM_TOL_FACTOR' , '1E-10') ])
+        
+        options = OrderedDict(dv_options)
+        options['MESH_OUT_FILENAME'] = 'mesh_def_hh.su2'
+        write_config( 'config_DEF_HH.cfg', options )
+        SU2.run.run_command( SU2.run.build_command('SU2_DEF config_DEF_HH.cfg') )
+        
+        # The bumps of the second design are applied to the grid that was read, not to the rotated one
+        options = OrderedDict(dv_options)
+        options['CUTHILL_MCKEE_ORDERING'] = 'YES'
+        write_config( 'config_LIB_HH.cfg', options )
+        driver = SU2.run.Driver('config_LIB_HH.cfg')
+        driver.deform( [ 10.0, 0.0, 0.0 ] )
+        driver.deform( dv_value )
+        driver.write_mesh('mesh_lib_hh.su2')
+        driver.delete()
+        
+        compare_meshes( 'mesh_def_hh.su2', 'mesh_lib_hh.su2', 1.e-8 )
+        
+    wait = 0
+    
+def batch0():
+    folder='test_batch0'; pull='inv_NACA0012.cfg'; link='mesh_NACA0012_inv.su2'
+    with SU2.io.redirect_folder(folder,pull,link):
+        
+        # Upwind, centered and viscous edge loops, the airfoil is a wall in the laminar case
+        cases = OrderedDict([ ('roe' , OrderedDict([ ('CONV_NUM_METHOD_FLOW' , 'ROE'              ) ])) ,
+                              ('jst' , OrderedDict([ ('CONV_NUM_METHOD_FLOW' , 'JST'              ) ])) ,
+                              ('ns'  , OrderedDict([ ('PHYSICAL_PROBLEM'     , 'NAVIER_STOKES'    ) ,
+                                                     ('MACH_NUMBER'          , '0.5'              ) ,
+                                                     ('REYNOLDS_NUMBER'      , '5000.0'           ) ,
+                                                     ('MARKER_EULER'         , '( NONE )'         ) ,
+                                                     ('MARKER_HEATFLUX'      , '( airfoil, 0.0 )' ) ,
+                                                     ('CONV_NUM_METHOD_FLOW' , 'ROE'              ) ,
+                                                     ('CFL_NUMBER'           , '2.0'              ) ,
+                                                     ('MGLEVEL'              , '0'                ) ])) ])
+        
+        # Edge by edge (reference) and batched kernels. The vector loops may round differently
+        # (fused multiply-adds), which the limiter amplifies in the residuals
+        for name,case_options in cases.items():
+            for batch in [ 'NO', 'YES' ]:
+                options = OrderedDict(case_options)
+                options['EXT_ITER']      = '100'
+                options['EDGE_BATCH']    = batch
+                options['CONV_FILENAME'] = 'history_%s_%s' % (name,batch)
+                write_config( 'config_%s_%s.cfg' % (name,batch), options )
+                SU2.run.run_command( SU2.run.build_command('SU2_CFD config_%s_%s.cfg' % (name,batch)) )
+            compare_histories( 'history_%s_NO.dat' % name, 'history_%s_YES.dat' % name, 1.e-4, 0.05 )
+        
+    wait = 0
+    
+def write_config(filename,options):
+    """ writes inv_NACA0012.cfg with the options replaced,
+        appended in the order given (DV_KIND before DV_PARAM)
+    """
+    config_file = open(filename,'w')
+    for line in open('inv_NACA0012.cfg'):
+        if options.has_key( line.split('=')[0].strip() ): continue
+        config_file.write(line)
+    for key,value in options.items():
+        config_file.write('%s= %s\n' % (key,value))
+    config_file.close()
+    
+def compare_meshes(filename_1,filename_2,tolerance):
+    """ checks that two su2 mesh files are the same line by line,
+        the numbers within tolerance
+    """
+    lines_1 = open(filename_1).readlines()
+    lines_2 = open(filename_2).readlines()
+    assert len(lines_1) == len(lines_2) , 'different number of lines'
+    for i_line in range(len(lines_1)):
+        items_1 = lines_1[i_line].split()
+        items_2 = lines_2[i_line].split()
+        assert len(items_1) == len(items_2) , 'line %i differs' % (i_line+1)
+        for item_1,item_2 in zip(items_1,items_2):
+            try:
+                same = abs( float(item_1) - float(item_2) ) <= tolerance
+            except ValueError:
+                same = item_1 == item_2
+            assert same , 'line %i differs: %s / %s' % (i_line+1,item_1,item_2)
+    
+def compare_histories(filename_1,filename_2,tolerance,res_tolerance):
+    """ checks that two convergence histories have the same iterations,
+        the coefficients within tolerance (relative above one) and the
+        residuals (log10) within res_tolerance, except the wall time
+    """
+    lines_1 = open(filename_1).readlines()
+    lines_2 = open(filename_2).readlines()
+    assert len(lines_1) == len(lines_2) , 'different number of iterations'
+    variables = [ x.strip().strip('"') for x in lines_1[1].split('=')[1].split(',') ]
+    for i_line in range(3,len(lines_1)):
+        items_1 = lines_1[i_line].split(',')
+        items_2 = lines_2[i_line].split(',')
+        for variable,item_1,item_2 in zip(variables,items_1,items_2):
+            if variable == 'Time(min)': continue
+            value_1 = float(item_1); value_2 = float(item_2)
+            if variable.startswith('Res_'):
+                same = abs( value_1 - value_2 ) <= res_tolerance
+            else:
+                same = abs( value_1 - value_2 ) <= tolerance*max( abs(value_1), 1.0 )
+            assert same , 'iteration %i, %s differs: %s / %s' % (i_line-3,variable,item_1.strip(),item_2.strip())
         
 
 if __name__ == '__main__':